@@ -0,0 +1,62 @@
+#include <memory>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "operators/get_table.hpp"
+#include "sql/sql_plan_cache.hpp"
+
+namespace opossum {
+
+namespace {
+
+constexpr auto QUERY_COUNT = 512;
+
+std::vector<std::string> cached_queries() {
+  auto queries = std::vector<std::string>{};
+  for (auto query_idx = 0; query_idx < QUERY_COUNT; ++query_idx) {
+    queries.emplace_back("SELECT * FROM table_" + std::to_string(query_idx) + ";");
+  }
+  return queries;
+}
+
+}  // namespace
+
+// Every client looks up plans that are in the cache, as done by the SQLPipeline for each statement. Run with multiple
+// threads to measure the contention on the cache.
+static void BM_SQLPhysicalPlanCacheHit(benchmark::State& state) {
+  static const auto queries = cached_queries();
+  static const auto cache = []() {
+    const auto cache = std::make_shared<SQLPhysicalPlanCache>();
+    for (const auto& query : queries) {
+      cache->set(query, std::make_shared<GetTable>(query));
+    }
+    return cache;
+  }();
+
+  // Threads start at different queries so that they do not look up the same query at the same time
+  auto query_idx = std::hash<std::thread::id>{}(std::this_thread::get_id());
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->try_get(queries[query_idx % QUERY_COUNT]));
+    ++query_idx;
+  }
+}
+BENCHMARK(BM_SQLPhysicalPlanCacheHit)->ThreadRange(1, 32)->UseRealTime();
+
+// All clients look up the same plan, e.g., the same prepared statement
+static void BM_SQLPhysicalPlanCacheHitSingleQuery(benchmark::State& state) {
+  static const auto query = std::string{"SELECT * FROM table_a;"};
+  static const auto cache = []() {
+    const auto cache = std::make_shared<SQLPhysicalPlanCache>();
+    cache->set(query, std::make_shared<GetTable>("table_a"));
+    return cache;
+  }();
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(cache->try_get(query));
+  }
+}
+BENCHMARK(BM_SQLPhysicalPlanCacheHitSingleQuery)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
@@ -0,0 +1,67 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "benchmark/benchmark.h"
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+// Creating and destroying a TransactionContext registers and deregisters its snapshot-commit-id. Run with multiple
+// threads to measure the contention on the TransactionManager's registry of active snapshots.
+static void BM_TransactionManagerNewTransactionContext(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+  for (auto _ : state) {
+    auto transaction_context = transaction_manager.new_transaction_context();
+    benchmark::DoNotOptimize(transaction_context);
+  }
+}
+BENCHMARK(BM_TransactionManagerNewTransactionContext)->ThreadRange(1, 32)->UseRealTime();
+
+// Looking up the lowest active snapshot-commit-id while other transactions are active, as done by the MvccDeletePlugin
+static void BM_TransactionManagerLowestActiveSnapshotCommitID(benchmark::State& state) {
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  auto transaction_contexts = std::vector<std::shared_ptr<TransactionContext>>{};
+  for (auto transaction_idx = int64_t{0}; transaction_idx < state.range(0); ++transaction_idx) {
+    transaction_contexts.emplace_back(transaction_manager.new_transaction_context());
+  }
+
+  for (auto _ : state) {
+    benchmark::DoNotOptimize(transaction_manager.get_lowest_active_snapshot_commit_id());
+  }
+}
+BENCHMARK(BM_TransactionManagerLowestActiveSnapshotCommitID)->Arg(10)->Arg(1'000);
+
+// Short write transactions that insert a single row. Run with multiple threads to measure how well concurrent commits
+// are grouped into commit batches.
+static void BM_TransactionManagerCommit(benchmark::State& state) {
+  static const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  static const auto table_name = []() {
+    const auto name = std::string{"commit_benchmark"};
+    Hyrise::get().storage_manager.add_table(name, std::make_shared<Table>(column_definitions, TableType::Data));
+    return name;
+  }();
+
+  auto& transaction_manager = Hyrise::get().transaction_manager;
+
+  auto values = std::make_shared<Table>(column_definitions, TableType::Data);
+  values->append({1});
+  const auto table_wrapper = std::make_shared<TableWrapper>(values);
+  table_wrapper->execute();
+
+  for (auto _ : state) {
+    auto transaction_context = transaction_manager.new_transaction_context();
+    const auto insert = std::make_shared<Insert>(table_name, table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->commit();
+  }
+}
+BENCHMARK(BM_TransactionManagerCommit)->ThreadRange(1, 32)->UseRealTime();
+
+}  // namespace opossum
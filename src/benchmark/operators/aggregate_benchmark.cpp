@@ -4,8 +4,12 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
+#include "hyrise.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "synthetic_table_generator.hpp"
 #include "types.hpp"
 
 namespace opossum {
@@ -28,4 +32,42 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Aggregate)(benchmark::State& state) {
   }
 }
 
+// Aggregates 10M rows with a single GROUP BY column. The first argument is the number of groups, the second one the
+// number of cores. With few groups, the pre-aggregation of the chunks does most of the work. With many groups, the
+// merge of the partial results dominates.
+static void BM_AggregateHash_GroupCardinality(benchmark::State& state) {
+  const auto group_count = static_cast<double>(state.range(0));
+  const auto column_specifications =
+      std::vector<ColumnSpecification>{{ColumnDataDistribution::make_uniform_config(0.0, group_count), DataType::Int},
+                                       {ColumnDataDistribution::make_uniform_config(0.0, 1'000.0), DataType::Int}};
+  const auto table = SyntheticTableGenerator::generate_table(column_specifications, 10'000'000, ChunkOffset{100'000});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::static_pointer_cast<AggregateExpression>(sum_(pqp_column_(ColumnID{1}, DataType::Int, false, "b"))),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+  const auto groupby = std::vector<ColumnID>{ColumnID{0}};
+
+  Hyrise::get().topology.use_non_numa_topology(static_cast<uint32_t>(state.range(1)));
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  for (auto _ : state) {
+    const auto aggregate = std::make_shared<AggregateHash>(table_wrapper, aggregates, groupby);
+    aggregate->execute();
+  }
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+BENCHMARK(BM_AggregateHash_GroupCardinality)
+    ->Apply([](benchmark::internal::Benchmark* benchmark) {
+      for (const auto group_count : {10, 1'000, 100'000, 1'000'000, 10'000'000}) {
+        for (const auto core_count : {1, 4, 16}) {
+          benchmark->Args({group_count, core_count});
+        }
+      }
+    })
+    ->UseRealTime();
+
 }  // namespace opossum
@@ -6,9 +6,13 @@
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "expression/expression_functional.hpp"
 #include "expression/pqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "synthetic_table_generator.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -51,4 +55,29 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Projection_ConstantTerm)(benchmark::S
   benchmark_projection_impl(state, _table_wrapper_a, {add_(a, 5)});
 }
 
+// Projects an arithmetic-heavy expression similar to the revenue expressions of TPC-H Q1 and Q9 using the number of
+// cores given as the benchmark's argument, to show how the chunk-parallel projection scales.
+static void BM_Projection_ArithmeticScaling(benchmark::State& state) {
+  const auto table = SyntheticTableGenerator{}.generate_table(4ul, 2'000'000, ChunkOffset{20'000});
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  const auto a = PQPColumnExpression::from_table(*table, "column_1");
+  const auto b = PQPColumnExpression::from_table(*table, "column_2");
+  const auto c = PQPColumnExpression::from_table(*table, "column_3");
+  const auto d = PQPColumnExpression::from_table(*table, "column_4");
+
+  // a * (100 - b) + c * (100 + d), a * (100 - b)
+  const auto expressions = std::vector<std::shared_ptr<AbstractExpression>>{
+      add_(mul_(a, sub_(100, b)), mul_(c, add_(100, d))), mul_(a, sub_(100, b))};
+
+  Hyrise::get().topology.use_non_numa_topology(static_cast<uint32_t>(state.range(0)));
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  benchmark_projection_impl(state, table_wrapper, expressions);
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+BENCHMARK(BM_Projection_ArithmeticScaling)->RangeMultiplier(2)->Range(1, 32)->UseRealTime();
+
 }  // namespace opossum
@@ -1,22 +1,68 @@
 #include <memory>
+#include <vector>
 
 #include "benchmark/benchmark.h"
 
 #include "../micro_benchmark_basic_fixture.hpp"
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 
 namespace opossum {
 
 BENCHMARK_F(MicroBenchmarkBasicFixture, BM_Sort)(benchmark::State& state) {
   _clear_cache();
 
-  auto warm_up = std::make_shared<Sort>(_table_wrapper_a, ColumnID{0} /* "a" */, OrderByMode::Ascending);
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0} /* "a" */}};
+
+  auto warm_up = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
   warm_up->execute();
   for (auto _ : state) {
-    auto sort = std::make_shared<Sort>(_table_wrapper_a, ColumnID{0} /* "a" */, OrderByMode::Ascending);
+    auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
     sort->execute();
   }
 }
 
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SortMultipleColumns)(benchmark::State& state) {
+  _clear_cache();
+
+  const auto sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0} /* "a" */, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1} /* "b" */, OrderByMode::Descending}};
+
+  auto warm_up = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+  warm_up->execute();
+  for (auto _ : state) {
+    auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+    sort->execute();
+  }
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_SortAndLimit)(benchmark::State& state) {
+  _clear_cache();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0} /* "a" */}};
+
+  for (auto _ : state) {
+    auto sort = std::make_shared<Sort>(_table_wrapper_a, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, expression_functional::value_(int64_t{100}));
+    limit->execute();
+  }
+}
+
+BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TopK)(benchmark::State& state) {
+  _clear_cache();
+
+  const auto sort_definitions = std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0} /* "a" */}};
+
+  for (auto _ : state) {
+    auto top_k =
+        std::make_shared<TopK>(_table_wrapper_a, sort_definitions, expression_functional::value_(int64_t{100}));
+    top_k->execute();
+  }
+}
+
 }  // namespace opossum
@@ -1,11 +1,18 @@
+#include <array>
+#include <functional>
 #include <memory>
+#include <random>
+#include <utility>
 
 #include "../micro_benchmark_basic_fixture.hpp"
 #include "benchmark/benchmark.h"
 #include "expression/expression_functional.hpp"
 #include "operators/table_scan.hpp"
+#include "operators/table_scan/value_id_scan_kernel.hpp"
 #include "operators/table_wrapper.hpp"
 #include "storage/table.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
 #include "utils/load_table.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
@@ -83,4 +90,70 @@ BENCHMARK_F(MicroBenchmarkBasicFixture, BM_TableScan_Like)(benchmark::State& sta
   }
 }
 
+// The following benchmarks compare the scalar scan of an attribute vector, i.e., one ValueID comparison and one
+// emplace_back per position through the compressed vector's iterators, with the ValueIDScanKernel. The first argument
+// selects the compressed vector (0: FixedSizeByteAligned<uint8_t>, 1: <uint16_t>, 2: <uint32_t>, 3: SimdBp128), the
+// second argument is the selectivity of the predicate `value_id < search_value_id` in percent.
+std::pair<std::unique_ptr<const BaseCompressedVector>, ValueID> create_attribute_vector_and_search_value_id(
+    const benchmark::State& state) {
+  constexpr auto VALUE_COUNT = size_t{65'000};
+
+  const auto vector_type = state.range(0);
+  const auto compression_type =
+      vector_type == 3 ? VectorCompressionType::SimdBp128 : VectorCompressionType::FixedSizeByteAligned;
+  const auto max_value_id = std::array<uint32_t, 4>{200, 60'000, 100'000, 100'000}[vector_type];
+
+  auto random_engine = std::mt19937{};
+  auto distribution = std::uniform_int_distribution<uint32_t>{0, max_value_id};
+  auto value_ids = pmr_vector<uint32_t>(VALUE_COUNT);
+  for (auto& value_id : value_ids) {
+    value_id = distribution(random_engine);
+  }
+
+  auto attribute_vector = compress_vector(value_ids, compression_type, {}, {max_value_id});
+  const auto search_value_id = ValueID{static_cast<ValueID::base_type>(max_value_id * state.range(1) / 100)};
+  return {std::move(attribute_vector), search_value_id};
+}
+
+void value_id_scan_arguments(benchmark::internal::Benchmark* benchmark) {
+  for (auto vector_type = 0; vector_type < 4; ++vector_type) {
+    for (const auto selectivity : {1, 10, 50, 90}) {
+      benchmark->Args({vector_type, selectivity});
+    }
+  }
+}
+
+static void BM_TableScanValueIDsScalar(benchmark::State& state) {
+  const auto attribute_vector_and_search_value_id = create_attribute_vector_and_search_value_id(state);
+  const auto& attribute_vector = attribute_vector_and_search_value_id.first;
+  const auto search_value_id = attribute_vector_and_search_value_id.second;
+
+  for (auto _ : state) {
+    auto matches = PosList{};
+    resolve_compressed_vector_type(*attribute_vector, [&](const auto& vector) {
+      auto chunk_offset = ChunkOffset{0};
+      for (auto it = vector.cbegin(); it != vector.cend(); ++it, ++chunk_offset) {
+        if (*it < search_value_id) matches.emplace_back(RowID{ChunkID{0}, chunk_offset});
+      }
+    });
+    benchmark::DoNotOptimize(matches);
+  }
+}
+BENCHMARK(BM_TableScanValueIDsScalar)->Apply(value_id_scan_arguments);
+
+static void BM_TableScanValueIDsKernel(benchmark::State& state) {
+  const auto attribute_vector_and_search_value_id = create_attribute_vector_and_search_value_id(state);
+  const auto& attribute_vector = attribute_vector_and_search_value_id.first;
+  const auto search_value_id = attribute_vector_and_search_value_id.second;
+
+  for (auto _ : state) {
+    auto matches = PosList{};
+    // The null_value_id is never less than the search_value_id, so the kernel does not need to check for NULLs
+    ValueIDScanKernel::scan<false>(*attribute_vector, std::less<void>{}, search_value_id, ValueID{0}, ChunkID{0},
+                                   matches);
+    benchmark::DoNotOptimize(matches);
+  }
+}
+BENCHMARK(BM_TableScanValueIDsKernel)->Apply(value_id_scan_arguments);
+
 }  // namespace opossum
@@ -1,9 +1,12 @@
 #include "tpcc/tpcc_table_generator.hpp"
 
 #include <algorithm>
+#include <filesystem>
 
 #include "benchmark_runner.hpp"
 #include "cli_config_parser.hpp"
+#include "hyrise.hpp"
+#include "logging/log_manager.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "tpcc/constants.hpp"
 #include "tpcc/tpcc_benchmark_item_runner.hpp"
@@ -19,7 +22,7 @@ using namespace opossum;  // NOLINT
  * Other limitations (that may be removed in the future):
  *  - No primary / foreign keys are used as they are currently unsupported
  *  - Values that are "retrieved" by the terminal are just selected, but not necessarily materialized
- *  - Data is not persisted as logging is currently unsupported; this means that the durability tests are not executed
+ *  - Data is only persisted if logging is enabled with --wal; even then, the durability tests are not executed
  *  - As decimals are not supported, we use floats instead
  *  - The delivery transaction is not executed in a "deferred" mode; as such, no delivery result file is written
  *  - We do not execute the isolation tests, as we consider our MVCC tests to be sufficient
@@ -41,7 +44,9 @@ int main(int argc, char* argv[]) {
   cli_options.add_options()
     // We use -s instead of -w for consistency with the options of our other TPC-x binaries.
     ("s,scale", "Scale factor (warehouses)", cxxopts::value<size_t>()->default_value("1")) // NOLINT
-    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")); // NOLINT
+    ("consistency_checks", "Run TPC-C consistency checks after benchmark (included with --verify)", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("wal", "Log the committed transactions to this file (which is overwritten) to measure the cost of logging", cxxopts::value<std::string>()->default_value("")) // NOLINT
+    ("wal_sync_mode", "When commits are acknowledged if --wal is used: after the log is synced (durable) or right away (throughput)", cxxopts::value<std::string>()->default_value("durable")); // NOLINT
   // clang-format on
 
   std::shared_ptr<BenchmarkConfig> config;
@@ -55,6 +60,11 @@ int main(int argc, char* argv[]) {
 
   num_warehouses = cli_parse_result["scale"].as<size_t>();
   consistency_checks = cli_parse_result["consistency_checks"].as<bool>();
+  const auto wal_path = cli_parse_result["wal"].as<std::string>();
+  const auto wal_sync_mode_string = cli_parse_result["wal_sync_mode"].as<std::string>();
+  Assert(wal_sync_mode_string == "durable" || wal_sync_mode_string == "throughput",
+         "Unknown WAL sync mode: " + wal_sync_mode_string);
+  const auto wal_sync_mode = wal_sync_mode_string == "durable" ? LogSyncMode::Durable : LogSyncMode::Throughput;
 
   config = std::make_shared<BenchmarkConfig>(CLIConfigParser::parse_cli_options(cli_parse_result));
 
@@ -68,6 +78,15 @@ int main(int argc, char* argv[]) {
 
   // Add TPC-C-specific information
   context.emplace("scale_factor", num_warehouses);
+  context.emplace("wal", !wal_path.empty());
+  if (!wal_path.empty()) {
+    std::cout << "- Logging committed transactions to " << wal_path << " (" << wal_sync_mode_string << ")" << std::endl;
+    context.emplace("wal_sync_mode", wal_sync_mode_string);
+
+    // The generated tables are not logged, only the transactions of the benchmark
+    std::filesystem::remove(wal_path);
+    Hyrise::get().log_manager.enable(wal_path, wal_sync_mode);
+  }
 
   // Run the benchmark
   auto item_runner = std::make_unique<TPCCBenchmarkItemRunner>(config, num_warehouses);
@@ -75,6 +94,12 @@ int main(int argc, char* argv[]) {
                   context)
       .run();
 
+  if (!wal_path.empty()) {
+    Hyrise::get().log_manager.disable();
+    std::cout << "- Wrote " << std::filesystem::file_size(wal_path) << " bytes to the log with "
+              << Hyrise::get().log_manager.sync_count() << " syncs" << std::endl;
+  }
+
   if (consistency_checks || config->verify) {
     std::cout << "- Running consistency checks at the end of the benchmark" << std::endl;
     check_consistency(num_warehouses);
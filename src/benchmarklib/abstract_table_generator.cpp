@@ -16,6 +16,9 @@ namespace opossum {
 
 void to_json(nlohmann::json& json, const TableGenerationMetrics& metrics) {
   json = {{"generation_duration", metrics.generation_duration.count()},
+          {"binary_loading_duration", metrics.binary_loading_duration.count()},
+          {"csv_import_duration", metrics.csv_import_duration.count()},
+          {"csv_import_bytes", metrics.csv_import_bytes},
           {"encoding_duration", metrics.encoding_duration.count()},
           {"binary_caching_duration", metrics.binary_caching_duration.count()},
           {"sort_duration", metrics.sort_duration.count()},
@@ -100,7 +103,9 @@ void AbstractTableGenerator::generate_and_store() {
 
       auto table_wrapper = std::make_shared<TableWrapper>(table);
       table_wrapper->execute();
-      auto sort = std::make_shared<Sort>(table_wrapper, sort_column_id, order_by_mode, _benchmark_config->chunk_size);
+      const auto sort_definitions =
+          std::vector<SortColumnDefinition>{SortColumnDefinition{sort_column_id, order_by_mode}};
+      auto sort = std::make_shared<Sort>(table_wrapper, sort_definitions, _benchmark_config->chunk_size);
       sort->execute();
       const auto immutable_sorted_table = sort->get_output();
 
@@ -38,6 +38,10 @@ struct BenchmarkTableInfo {
 
 struct TableGenerationMetrics {
   std::chrono::nanoseconds generation_duration{};
+  // Parts of the generation_duration that were spent loading tables from binary files and importing CSV files
+  std::chrono::nanoseconds binary_loading_duration{};
+  std::chrono::nanoseconds csv_import_duration{};
+  size_t csv_import_bytes{0};
   std::chrono::nanoseconds encoding_duration{};
   std::chrono::nanoseconds binary_caching_duration{};
   std::chrono::nanoseconds sort_duration{};
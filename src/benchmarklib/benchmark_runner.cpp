@@ -11,6 +11,8 @@
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
 #include "scheduler/job_task.hpp"
+#include "scheduler/task_queue.hpp"
+#include "scheduler/worker.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/chunk.hpp"
 #include "tpch/tpch_table_generator.hpp"
@@ -378,6 +380,19 @@ void BenchmarkRunner::_create_report(std::ostream& stream) const {
       {"table_size_in_bytes", table_size},
       {"total_duration", std::chrono::duration_cast<std::chrono::nanoseconds>(_total_run_duration).count()}};
 
+  // Report how the work was distributed across the workers, e.g., to evaluate changes to the work stealing
+  if (const auto node_queue_scheduler = std::dynamic_pointer_cast<NodeQueueScheduler>(Hyrise::get().scheduler())) {
+    auto workers_json = nlohmann::json::array();
+    for (const auto& worker : node_queue_scheduler->workers()) {
+      workers_json.push_back({{"id", static_cast<size_t>(worker->id())},
+                              {"cpu_id", static_cast<size_t>(worker->cpu_id())},
+                              {"node_id", static_cast<size_t>(worker->queue()->node_id())},
+                              {"finished_tasks", worker->num_finished_tasks()},
+                              {"stolen_tasks", worker->num_stolen_tasks()}});
+    }
+    summary["workers"] = workers_json;
+  }
+
   nlohmann::json report{{"context", _context},
                         {"benchmarks", benchmarks},
                         {"summary", summary},
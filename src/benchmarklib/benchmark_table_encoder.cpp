@@ -60,6 +60,48 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
   /**
    * 1. Build the ChunkEncodingSpec, i.e. the Encoding to be used
    */
+  const auto chunk_encoding_spec =
+      required_chunk_encoding_spec(table_name, table->column_definitions(), encoding_config);
+
+  /**
+   * 2. Actually encode chunks
+   */
+  auto encoding_performed = std::atomic<bool>{false};
+  const auto column_data_types = table->column_data_types();
+
+  // Encode chunks in parallel, using `hardware_concurrency + 1` workers
+  // Not using JobTasks here because we want parallelism even if the scheduler is disabled.
+  auto next_chunk = std::atomic_uint{0};
+  const auto thread_count = std::min(static_cast<uint>(table->chunk_count()), std::thread::hardware_concurrency() + 1);
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(thread_count);
+
+  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
+    threads.emplace_back([&] {
+      while (true) {
+        auto my_chunk = next_chunk++;
+        if (my_chunk >= table->chunk_count()) return;
+
+        const auto chunk = table->get_chunk(ChunkID{my_chunk});
+        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+        if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
+          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
+          encoding_performed = true;
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) thread.join();
+
+  generate_chunk_pruning_statistics(table);
+
+  return encoding_performed;
+}
+
+ChunkEncodingSpec BenchmarkTableEncoder::required_chunk_encoding_spec(const std::string& table_name,
+                                                                      const TableColumnDefinitions& column_definitions,
+                                                                      const EncodingConfig& encoding_config) {
   const auto& type_mapping = encoding_config.type_encoding_mapping;
   const auto& custom_mapping = encoding_config.custom_encoding_mapping;
 
@@ -68,10 +110,10 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
 
   ChunkEncodingSpec chunk_encoding_spec;
 
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
+  for (const auto& column_definition : column_definitions) {
     // Check if a column specific encoding was specified
     if (table_has_custom_encoding) {
-      const auto& column_name = table->column_name(column_id);
+      const auto& column_name = column_definition.name;
       const auto& encoding_by_column_name = column_mapping_it->second;
       const auto& segment_encoding = encoding_by_column_name.find(column_name);
       if (segment_encoding != encoding_by_column_name.end()) {
@@ -82,7 +124,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
 
     // Check if a type specific encoding was specified
-    const auto& column_data_type = table->column_data_type(column_id);
+    const auto& column_data_type = column_definition.data_type;
     const auto& encoding_by_data_type = type_mapping.find(column_data_type);
     if (encoding_by_data_type != type_mapping.end()) {
       // The column type has a specific encoding
@@ -95,7 +137,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     if (encoding_supports_data_type(encoding_config.default_encoding_spec.encoding_type, column_data_type)) {
       chunk_encoding_spec.push_back(encoding_config.default_encoding_spec);
     } else {
-      std::cout << " - Column '" << table_name << "." << table->column_name(column_id) << "' of type ";
+      std::cout << " - Column '" << table_name << "." << column_definition.name << "' of type ";
       std::cout << column_data_type << " cannot be encoded as ";
       std::cout << encoding_config.default_encoding_spec.encoding_type << " and is ";
       std::cout << "left Unencoded." << std::endl;
@@ -103,40 +145,7 @@ bool BenchmarkTableEncoder::encode(const std::string& table_name, const std::sha
     }
   }
 
-  /**
-   * 2. Actually encode chunks
-   */
-  auto encoding_performed = std::atomic<bool>{false};
-  const auto column_data_types = table->column_data_types();
-
-  // Encode chunks in parallel, using `hardware_concurrency + 1` workers
-  // Not using JobTasks here because we want parallelism even if the scheduler is disabled.
-  auto next_chunk = std::atomic_uint{0};
-  const auto thread_count = std::min(static_cast<uint>(table->chunk_count()), std::thread::hardware_concurrency() + 1);
-  auto threads = std::vector<std::thread>{};
-  threads.reserve(thread_count);
-
-  for (auto thread_id = 0u; thread_id < thread_count; ++thread_id) {
-    threads.emplace_back([&] {
-      while (true) {
-        auto my_chunk = next_chunk++;
-        if (my_chunk >= table->chunk_count()) return;
-
-        const auto chunk = table->get_chunk(ChunkID{my_chunk});
-        Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        if (!is_chunk_encoding_spec_satisfied(chunk_encoding_spec, get_chunk_encoding_spec(*chunk))) {
-          ChunkEncoder::encode_chunk(chunk, column_data_types, chunk_encoding_spec);
-          encoding_performed = true;
-        }
-      }
-    });
-  }
-
-  for (auto& thread : threads) thread.join();
-
-  generate_chunk_pruning_statistics(table);
-
-  return encoding_performed;
+  return chunk_encoding_spec;
 }
 
 }  // namespace opossum
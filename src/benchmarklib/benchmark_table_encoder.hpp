@@ -3,6 +3,9 @@
 #include <memory>
 #include <string>
 
+#include "storage/encoding_type.hpp"
+#include "storage/table_column_definition.hpp"
+
 namespace opossum {
 
 class EncodingConfig;
@@ -15,6 +18,11 @@ class BenchmarkTableEncoder {
   //              false, if the @param table was already encoded as required by @param encoding_config
   static bool encode(const std::string& table_name, const std::shared_ptr<Table>& table,
                      const EncodingConfig& encoding_config);
+
+  // @return      the encoding of the columns of a table as required by @param encoding_config
+  static ChunkEncodingSpec required_chunk_encoding_spec(const std::string& table_name,
+                                                        const TableColumnDefinitions& column_definitions,
+                                                        const EncodingConfig& encoding_config);
 };
 
 }  // namespace opossum
@@ -1,10 +1,16 @@
 #include "file_based_table_generator.hpp"
 
+#include <chrono>
+#include <iomanip>
+#include <sstream>
+#include <string>
+
 #include <boost/algorithm/string.hpp>
 
 #include "benchmark_config.hpp"
 #include "benchmark_table_encoder.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/csv/csv_meta.hpp"
 #include "import_export/csv/csv_parser.hpp"
 #include "utils/format_duration.hpp"
 #include "utils/list_directory.hpp"
@@ -13,6 +19,17 @@
 
 using namespace std::string_literals;  // NOLINT
 
+namespace {
+
+std::string format_throughput(const size_t bytes, const std::chrono::nanoseconds duration) {
+  const auto seconds = std::chrono::duration<double>{duration}.count();
+  auto stream = std::stringstream{};
+  stream << std::fixed << std::setprecision(1) << static_cast<double>(bytes) / 1'000'000 / seconds << " MB/s";
+  return stream.str();
+}
+
+}  // namespace
+
 namespace opossum {
 
 FileBasedTableGenerator::FileBasedTableGenerator(const std::shared_ptr<BenchmarkConfig>& benchmark_config,
@@ -77,6 +94,7 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
    * 3. Actually load the tables. Load from binary file if a up-to-date binary file exists for a Table.
    */
   for (auto& [table_name, table_info] : table_info_by_name) {
+    auto file_size = size_t{0};
     Timer timer;
 
     std::cout << "-  Loading table '" << table_name << "' ";
@@ -84,21 +102,49 @@ std::unordered_map<std::string, BenchmarkTableInfo> FileBasedTableGenerator::gen
     // Pick a source file to load a table from, prefer the binary version
     if (table_info.binary_file_path && !table_info.binary_file_out_of_date) {
       std::cout << "from " << *table_info.binary_file_path << std::flush;
+      file_size = std::filesystem::file_size(*table_info.binary_file_path);
       table_info.table = BinaryParser::parse(*table_info.binary_file_path);
       table_info.loaded_from_binary = true;
     } else {
       std::cout << "from " << *table_info.text_file_path << std::flush;
+      file_size = std::filesystem::file_size(*table_info.text_file_path);
       const auto extension = table_info.text_file_path->extension();
       if (extension == ".tbl") {
         table_info.table = load_table(*table_info.text_file_path, _benchmark_config->chunk_size);
       } else if (extension == ".csv") {
-        table_info.table = CsvParser::parse(*table_info.text_file_path, _benchmark_config->chunk_size);
+        // Chunks are encoded as soon as they are parsed, so that the unencoded chunks of large files do not have to be
+        // kept in memory until all of them are parsed. BenchmarkTableEncoder then finds them encoded as required.
+        const auto csv_path = table_info.text_file_path->string();
+        const auto column_definitions =
+            CsvParser::create_table_from_meta_file(csv_path + CsvMeta::META_FILE_EXTENSION)->column_definitions();
+        const auto encoding_spec = BenchmarkTableEncoder::required_chunk_encoding_spec(
+            table_name, column_definitions, _benchmark_config->encoding_config);
+        table_info.table = CsvParser::parse(csv_path, _benchmark_config->chunk_size, std::nullopt, encoding_spec);
+        metrics.csv_import_bytes += file_size;
       } else {
         Fail("Unknown textual file format. This should have been caught earlier.");
       }
     }
 
-    std::cout << " (" << table_info.table->row_count() << " rows; " << timer.lap_formatted() << ")" << std::endl;
+    const auto load_duration = timer.lap();
+    if (table_info.loaded_from_binary) {
+      metrics.binary_loading_duration += load_duration;
+    } else if (table_info.text_file_path->extension() == ".csv") {
+      metrics.csv_import_duration += load_duration;
+    }
+
+    std::cout << " (" << table_info.table->row_count() << " rows; " << format_duration(load_duration) << "; "
+              << format_throughput(file_size, load_duration) << ")" << std::endl;
+  }
+
+  if (metrics.binary_loading_duration.count() > 0) {
+    std::cout << "-  Loading tables from binary files took " << format_duration(metrics.binary_loading_duration)
+              << std::endl;
+  }
+
+  if (metrics.csv_import_duration.count() > 0) {
+    std::cout << "-  Importing CSV files took " << format_duration(metrics.csv_import_duration) << " ("
+              << format_throughput(metrics.csv_import_bytes, metrics.csv_import_duration) << ")" << std::endl;
   }
 
   return table_info_by_name;
@@ -536,6 +536,32 @@ std::unordered_map<std::string, BenchmarkTableInfo> TPCCTableGenerator::generate
                                                               {"NEW_ORDER", BenchmarkTableInfo{new_order_table}}});
 }
 
+void TPCCTableGenerator::_add_constraints(
+    std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const {
+  const auto primary_keys = std::vector<std::pair<std::string, std::vector<std::string>>>{
+      {"ITEM", {"I_ID"}},
+      {"WAREHOUSE", {"W_ID"}},
+      {"STOCK", {"S_W_ID", "S_I_ID"}},
+      {"DISTRICT", {"D_W_ID", "D_ID"}},
+      {"CUSTOMER", {"C_W_ID", "C_D_ID", "C_ID"}},
+      {"ORDER", {"O_W_ID", "O_D_ID", "O_ID"}},
+      {"ORDER_LINE", {"OL_W_ID", "OL_D_ID", "OL_O_ID", "OL_NUMBER"}},
+      {"NEW_ORDER", {"NO_W_ID", "NO_D_ID", "NO_O_ID"}}};
+
+  for (const auto& [table_name, column_names] : primary_keys) {
+    const auto& table = table_info_by_name.at(table_name).table;
+    auto column_ids = std::vector<ColumnID>{};
+    for (const auto& column_name : column_names) {
+      column_ids.emplace_back(table->column_id_by_name(column_name));
+    }
+    table->add_soft_unique_constraint(column_ids, IsPrimaryKey::Yes);
+
+    // The transactions access most rows by their primary key. The index is maintained by the Insert operator, so that
+    // it also covers the orders that are added during the benchmark.
+    table->create_primary_key_index();
+  }
+}
+
 thread_local TPCCRandomGenerator TPCCTableGenerator::_random_gen;  // NOLINT
 
 }  // namespace opossum
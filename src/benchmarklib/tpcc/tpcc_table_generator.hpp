@@ -69,6 +69,9 @@ class TPCCTableGenerator : public AbstractTableGenerator {
   // TPC-C Specification.
   static thread_local TPCCRandomGenerator _random_gen;
 
+  // Adds the primary keys defined by the TPC-C specification and creates a PrimaryKeyIndex for each of them
+  void _add_constraints(std::unordered_map<std::string, BenchmarkTableInfo>& table_info_by_name) const override;
+
   /**
    * In TPCC and TPCH table sizes are usually defined relatively to each other.
    * E.g. the specification defines that there are 10 districts for each warehouse.
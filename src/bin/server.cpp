@@ -13,6 +13,8 @@ cxxopts::Options get_server_cli_options() {
     ("address", "Specify the address to run on", cxxopts::value<std::string>()->default_value("0.0.0.0"))  // NOLINT
     ("p,port", "Specify the port number. 0 means randomly select an available one. If no port is specified, the the server will start on PostgreSQL's official port", cxxopts::value<uint16_t>()->default_value("5432"))  // NOLINT
     ("execution_info", "Send execution information after statement execution", cxxopts::value<bool>()->default_value("false")) // NOLINT
+    ("io_threads", "Number of threads that accept connections and wait for requests", cxxopts::value<uint32_t>()->default_value(std::to_string(opossum::Server::DEFAULT_IO_THREAD_COUNT))) // NOLINT
+    ("request_threads", "Number of threads that handle requests and wait for their execution", cxxopts::value<uint32_t>()->default_value(std::to_string(opossum::Server::DEFAULT_REQUEST_THREAD_COUNT))) // NOLINT
     ;  // NOLINT
   // clang-format on
 
@@ -31,6 +33,8 @@ int main(int argc, char* argv[]) {
 
   const auto execution_info = parsed_options["execution_info"].as<bool>();
   const auto port = parsed_options["port"].as<uint16_t>();
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
+  const auto request_thread_count = parsed_options["request_threads"].as<uint32_t>();
 
   boost::system::error_code error;
   const auto address = boost::asio::ip::make_address(parsed_options["address"].as<std::string>(), error);
@@ -40,7 +44,8 @@ int main(int argc, char* argv[]) {
   // Set scheduler so that the server can execute the tasks on separate threads.
   opossum::Hyrise::get().set_scheduler(std::make_shared<opossum::NodeQueueScheduler>());
 
-  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info)};
+  auto server = opossum::Server{address, port, static_cast<opossum::SendExecutionInfo>(execution_info), io_thread_count,
+                                request_thread_count};
   server.run();
 
   return 0;
@@ -0,0 +1,136 @@
+#include <pqxx/pqxx>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <iostream>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "cxxopts.hpp"
+
+#include "hyrise.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
+#include "server/server.hpp"
+#include "storage/table.hpp"
+
+// Measures how the server copes with many concurrent connections. A server is started in this process and a number
+// of client threads open the requested number of connections. Each client thread sends simple queries on its
+// connections in a round-robin fashion, so that all connections are open and in use at the same time.
+
+namespace {
+
+cxxopts::Options get_server_connection_benchmark_cli_options() {
+  cxxopts::Options cli_options("./hyriseServerConnectionBenchmark",
+                               "Measures the query latency of the server with many concurrent connections.");
+
+  // clang-format off
+  cli_options.add_options()
+    ("help", "Display this help and exit") // NOLINT
+    ("connections", "Number of connections to the server", cxxopts::value<uint32_t>()->default_value("1000")) // NOLINT
+    ("client_threads", "Number of client threads that share the connections", cxxopts::value<uint32_t>()->default_value("16")) // NOLINT
+    ("queries", "Number of queries sent per connection", cxxopts::value<uint32_t>()->default_value("10")) // NOLINT
+    ("io_threads", "Number of I/O threads of the server", cxxopts::value<uint32_t>()->default_value(std::to_string(opossum::Server::DEFAULT_IO_THREAD_COUNT))) // NOLINT
+    ;  // NOLINT
+  // clang-format on
+
+  return cli_options;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  using namespace opossum;  // NOLINT
+
+  auto cli_options = get_server_connection_benchmark_cli_options();
+  const auto parsed_options = cli_options.parse(argc, argv);
+
+  if (parsed_options.count("help")) {
+    std::cout << cli_options.help() << std::endl;
+    return 0;
+  }
+
+  const auto connection_count = parsed_options["connections"].as<uint32_t>();
+  const auto client_thread_count = std::max(uint32_t{1}, parsed_options["client_threads"].as<uint32_t>());
+  const auto query_count = parsed_options["queries"].as<uint32_t>();
+  const auto io_thread_count = parsed_options["io_threads"].as<uint32_t>();
+
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data);
+  for (auto value = 0; value < 100; ++value) {
+    table->append({value});
+  }
+  Hyrise::get().storage_manager.add_table("connection_benchmark", table);
+
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Port 0 to select a random open port
+  auto server = Server{boost::asio::ip::address(), 0, SendExecutionInfo::No, io_thread_count};
+  auto server_thread = std::thread{[&server]() { server.run(); }};
+  const auto connection_string = "hostaddr=127.0.0.1 port=" + std::to_string(server.server_port());
+
+  std::cout << "- Opening " << connection_count << " connections from " << client_thread_count << " client threads"
+            << std::endl;
+
+  auto latencies_per_thread = std::vector<std::vector<std::chrono::nanoseconds>>(client_thread_count);
+  auto connected_thread_count = std::atomic_uint32_t{0};
+  auto benchmark_start = std::chrono::steady_clock::time_point{};
+  auto start_flag = std::atomic_bool{false};
+
+  auto client_threads = std::vector<std::thread>{};
+  for (auto thread_id = uint32_t{0}; thread_id < client_thread_count; ++thread_id) {
+    client_threads.emplace_back([&, thread_id]() {
+      auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+      for (auto connection_id = thread_id; connection_id < connection_count; connection_id += client_thread_count) {
+        connections.emplace_back(std::make_unique<pqxx::connection>(connection_string));
+      }
+
+      ++connected_thread_count;
+      while (!start_flag) std::this_thread::yield();
+
+      auto& latencies = latencies_per_thread[thread_id];
+      latencies.reserve(connections.size() * query_count);
+      for (auto query_id = uint32_t{0}; query_id < query_count; ++query_id) {
+        for (auto& connection : connections) {
+          const auto query_start = std::chrono::steady_clock::now();
+          auto transaction = pqxx::nontransaction{*connection};
+          transaction.exec("SELECT a FROM connection_benchmark WHERE a < 10;");
+          latencies.emplace_back(std::chrono::steady_clock::now() - query_start);
+        }
+      }
+    });
+  }
+
+  while (connected_thread_count < client_thread_count) std::this_thread::sleep_for(std::chrono::milliseconds(10));
+  std::cout << "- All connections established, sending " << query_count << " queries per connection" << std::endl;
+
+  benchmark_start = std::chrono::steady_clock::now();
+  start_flag = true;
+  for (auto& client_thread : client_threads) {
+    client_thread.join();
+  }
+  const auto duration = std::chrono::steady_clock::now() - benchmark_start;
+
+  auto latencies = std::vector<std::chrono::nanoseconds>{};
+  for (const auto& thread_latencies : latencies_per_thread) {
+    latencies.insert(latencies.end(), thread_latencies.begin(), thread_latencies.end());
+  }
+  std::sort(latencies.begin(), latencies.end());
+
+  const auto percentile = [&](const double fraction) {
+    if (latencies.empty()) return 0.0;
+    const auto index = std::min(latencies.size() - 1, static_cast<size_t>(fraction * latencies.size()));
+    return static_cast<double>(latencies[index].count()) / 1'000.0;
+  };
+
+  const auto duration_seconds = std::chrono::duration<double>(duration).count();
+  std::cout << "- Executed " << latencies.size() << " queries in " << duration_seconds << " s ("
+            << static_cast<double>(latencies.size()) / duration_seconds << " queries/s)" << std::endl;
+  std::cout << "  -> Latency p50: " << percentile(0.5) << " µs, p99: " << percentile(0.99) << " µs" << std::endl;
+
+  server.shutdown();
+  server_thread.join();
+  Hyrise::get().scheduler()->finish();
+
+  return 0;
+}
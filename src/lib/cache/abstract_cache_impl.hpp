@@ -49,6 +49,10 @@ class AbstractCacheImpl {
   // Causes undefined behavior if the item is not in the cache.
   virtual Value& get(const Key& key) = 0;
 
+  // Get the cached value at the given key without counting this as an access, or nullptr if the item is not in the
+  // cache. Unlike get(), this does not modify the cache and can be called concurrently.
+  virtual const Value* peek(const Key& key) const = 0;
+
   // Returns true if the cache holds an item at the given key.
   virtual bool has(const Key& key) const = 0;
 
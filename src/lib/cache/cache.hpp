@@ -1,14 +1,20 @@
 #pragma once
 
+#include <algorithm>
+#include <atomic>
+#include <functional>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
 #include <utility>
 #include <vector>
 
+#include "frequency_sketch.hpp"
 #include "gdfs_cache.hpp"
 
+#include "utils/assert.hpp"
 #include "utils/singleton.hpp"
 
 namespace opossum {
@@ -16,89 +22,278 @@ namespace opossum {
 inline constexpr size_t DefaultCacheCapacity = 1024;
 
 // Per-default, uses the GDFS cache as underlying storage.
+//
+// To let many clients look up their queries concurrently, the entries are distributed over shards by the hash of their
+// key. Each shard has its own lock and its own underlying cache of an equal share of the capacity, so that the
+// eviction strategy is applied per shard. The number of shards follows from the capacity and is recomputed when the
+// capacity changes. Small caches consist of a single shard and behave like the underlying cache.
+//
+// A cache hit only takes a shared lock on its shard. The access is counted in the FrequencySketch of the shard, and the
+// accessed key is recorded until it has been accessed MAX_PENDING_ACCESSES_PER_ENTRY times. The recorded accesses are
+// passed on to the underlying cache (e.g., to update the access frequency of GDFS) in the order in which they happened
+// before the next entry is added to the shard or entries are evicted, i.e., when the eviction strategy needs them.
+// Thus, hits never wait for an exclusive lock, and frequently accessed keys only increment the counters of the sketch.
+// Until then, the underlying cache (see unsafe_cache()) does not reflect the hits.
 template <typename Value, typename Key = std::string>
 class Cache {
  public:
   using Iterator = typename AbstractCacheImpl<Key, Value>::ErasedIterator;
 
+  // Caches are split into at most MAX_SHARD_COUNT shards with a capacity of at least MIN_SHARD_CAPACITY each
+  static constexpr auto MIN_SHARD_CAPACITY = size_t{64};
+  static constexpr auto MAX_SHARD_COUNT = size_t{16};
+
   explicit Cache(size_t capacity = DefaultCacheCapacity)
-      : _impl(std::move(std::make_unique<GDFSCache<Key, Value>>(capacity))) {}
+      : _shards(MAX_SHARD_COUNT), _shard_count(_shard_count_for(capacity)) {
+    for (auto shard_idx = size_t{0}; shard_idx < MAX_SHARD_COUNT; ++shard_idx) {
+      _shards[shard_idx].impl = std::make_unique<GDFSCache<Key, Value>>(_shard_capacity(capacity, shard_idx));
+    }
+  }
 
   // Adds or refreshes the cache entry [query, value].
   void set(const Key& query, const Value& value) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
+    auto lock = std::unique_lock<std::shared_mutex>{};
+    auto& shard = _lock_shard(query, lock);
 
-    if (_impl->capacity() == 0) return;
+    if (shard.impl->capacity() == 0) return;
 
-    _impl->set(query, value);
+    _pass_on_pending_accesses(shard);
+    shard.impl->set(query, value);
   }
 
   // Tries to fetch the cache entry for the query into the result object. Returns true if the entry was found, false
-  // otherwise. This needs a write lock to be acquired as most implementation update some type of access count when
-  // retrieving an entry.
+  // otherwise. This only needs a shared lock, the access is passed on to the underlying cache as described above.
   std::optional<Value> try_get(const Key& query) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
+    auto lock = std::shared_lock<std::shared_mutex>{};
+    auto& shard = _lock_shard(query, lock);
 
-    if (_impl->capacity() == 0) return {};
+    const auto* const cached_value = shard.impl->peek(query);
+    if (!cached_value) return {};
 
-    if (!_impl->has(query)) {
-      return {};
+    // Hash collisions can only cause overestimates, so that accesses might get lost but the recorded keys are bounded
+    if (shard.pending_accesses.increment(std::hash<Key>{}(query)) <= MAX_PENDING_ACCESSES_PER_ENTRY) {
+      std::lock_guard<std::mutex> accessed_keys_lock(shard.accessed_keys_mutex);
+      shard.accessed_keys.emplace_back(query);
     }
-    return _impl->get(query);
+
+    return *cached_value;
   }
 
   // Checks whether an entry for the query exists.
   bool has(const Key& query) const {
-    std::shared_lock<std::shared_mutex> lock(_mutex);
-    return _impl->has(query);
+    auto lock = std::shared_lock<std::shared_mutex>{};
+    const auto& shard = _lock_shard(query, lock);
+    return shard.impl->has(query);
   }
 
-  // Returns and refreshes the cache entry for the given query. Causes undefined behavior if the query is not in the
-  // cache. This needs a write lock to be acquired as most implementation update some type of access count when
-  // retrieving an entry.
+  // Returns and refreshes the cache entry for the given query. The query has to be in the cache.
   Value get_entry(const Key& query) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-    return _impl->get(query);
+    auto value = try_get(query);
+    DebugAssert(value, "Query is not cached");
+    return std::move(*value);
   }
 
   // Purges all entries from the cache.
   void clear() {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-    _impl->clear();
+    for (auto& shard : _shards) {
+      std::unique_lock<std::shared_mutex> lock(shard.mutex);
+      shard.impl->clear();
+      _discard_pending_accesses(shard);
+    }
   }
 
+  // If the number of shards changes, the entries are redistributed over the new shards. They are added again in an
+  // arbitrary order, so that the underlying caches lose the information gathered about them (e.g., the frequencies).
   void resize(size_t capacity) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-    _impl->resize(capacity);
+    const auto locks = _lock_all_shards();
+    const auto shard_count = _shard_count_for(capacity);
+
+    if (shard_count == _shard_count) {
+      for (auto shard_idx = size_t{0}; shard_idx < MAX_SHARD_COUNT; ++shard_idx) {
+        auto& shard = _shards[shard_idx];
+        _pass_on_pending_accesses(shard);
+        shard.impl->resize(_shard_capacity(capacity, shard_idx));
+      }
+      return;
+    }
+
+    auto entries = std::vector<std::pair<Key, Value>>{};
+    for (auto& shard : _shards) {
+      _discard_pending_accesses(shard);
+      for (auto it = shard.impl->begin(); it != shard.impl->end(); ++it) {
+        entries.emplace_back(*it);
+      }
+      shard.impl->clear();
+    }
+
+    _shard_count = shard_count;
+    for (auto shard_idx = size_t{0}; shard_idx < MAX_SHARD_COUNT; ++shard_idx) {
+      _shards[shard_idx].impl->resize(_shard_capacity(capacity, shard_idx));
+    }
+
+    for (const auto& [key, value] : entries) {
+      auto& shard = _shards[_shard_idx(key)];
+      if (shard.impl->capacity() > 0) shard.impl->set(key, value);
+    }
   }
 
   size_t size() const {
-    std::shared_lock<std::shared_mutex> lock(_mutex);
-    return _impl->size();
+    auto size = size_t{0};
+    for (const auto& shard : _shards) {
+      std::shared_lock<std::shared_mutex> lock(shard.mutex);
+      size += shard.impl->size();
+    }
+    return size;
   }
 
-  // Replaces the underlying cache by creating a new object of the given cache type.
+  // Replaces the underlying caches of all shards by creating new objects of the given cache type.
   template <class cache_t>
   void replace_cache_impl(size_t capacity) {
-    std::unique_lock<std::shared_mutex> lock(_mutex);
-    _impl = std::make_unique<cache_t>(capacity);
+    const auto locks = _lock_all_shards();
+    _shard_count = _shard_count_for(capacity);
+
+    for (auto shard_idx = size_t{0}; shard_idx < MAX_SHARD_COUNT; ++shard_idx) {
+      auto& shard = _shards[shard_idx];
+      shard.impl = std::make_unique<cache_t>(_shard_capacity(capacity, shard_idx));
+      _discard_pending_accesses(shard);
+    }
   }
 
   // These methods are named "unsafe_" (similar to tbb's naming) because iterator does not hold a mutex. As such,
   // modifications to the cache invalidate the iterators. While this is also true for begin()/end() in other data
   // structures, the Cache class usually deals with concurrency.
-  Iterator unsafe_begin() { return _impl->begin(); }
-  Iterator unsafe_end() { return _impl->end(); }
+  Iterator unsafe_begin() { return Iterator{std::make_unique<ShardIterator>(_shards, 0)}; }
+  Iterator unsafe_end() { return Iterator{std::make_unique<ShardIterator>(_shards, _shards.size())}; }
 
-  // Returns a reference to the underlying cache.
-  AbstractCacheImpl<Key, Value>& unsafe_cache() { return *_impl; }
-  const AbstractCacheImpl<Key, Value>& unsafe_cache() const { return *_impl; }
+  // Returns a reference to the underlying cache of the shard that the query belongs to.
+  AbstractCacheImpl<Key, Value>& unsafe_cache(const Key& query) { return *_shards[_shard_idx(query)].impl; }
+  const AbstractCacheImpl<Key, Value>& unsafe_cache(const Key& query) const {
+    return *_shards[_shard_idx(query)].impl;
+  }
 
  protected:
-  // Underlying cache eviction strategy.
-  std::unique_ptr<AbstractCacheImpl<Key, Value>> _impl;
+  struct Shard {
+    // Underlying cache eviction strategy.
+    std::unique_ptr<AbstractCacheImpl<Key, Value>> impl;
+
+    // Hits that have not been passed on to impl yet. accessed_keys holds them in the order in which they happened.
+    FrequencySketch pending_accesses;
+    std::mutex accessed_keys_mutex;
+    std::vector<Key> accessed_keys;
+
+    mutable std::shared_mutex mutex;
+  };
+
+  // Iterates over the entries of all shards, one shard after another
+  class ShardIterator : public AbstractCacheImpl<Key, Value>::AbstractIterator {
+   public:
+    using KeyValuePair = typename AbstractCacheImpl<Key, Value>::KeyValuePair;
+    using AbstractIterator = typename AbstractCacheImpl<Key, Value>::AbstractIterator;
+
+    ShardIterator(std::vector<Shard>& shards, const size_t shard_idx) : _shards(shards), _shard_idx(shard_idx) {
+      _skip_exhausted_shards();
+    }
+
+    void increment() override {
+      ++*_iterator;
+      _skip_exhausted_shards();
+    }
+
+    bool equal(const AbstractIterator& other) const override {
+      const auto& other_iterator = static_cast<const ShardIterator&>(other);
+      if (_shard_idx != other_iterator._shard_idx) return false;
+      return _shard_idx == _shards.size() || *_iterator == *other_iterator._iterator;
+    }
+
+    const KeyValuePair& dereference() const override { return **_iterator; }
+
+   private:
+    void _skip_exhausted_shards() {
+      while (_shard_idx < _shards.size()) {
+        if (!_iterator) {
+          _iterator.emplace(_shards[_shard_idx].impl->begin());
+          _end.emplace(_shards[_shard_idx].impl->end());
+        }
+        if (*_iterator != *_end) return;
+
+        ++_shard_idx;
+        _iterator.reset();
+        _end.reset();
+      }
+    }
+
+    std::vector<Shard>& _shards;
+    size_t _shard_idx;
+    std::optional<Iterator> _iterator;
+    std::optional<Iterator> _end;
+  };
+
+  // The number of accesses to a single entry that is passed on at once is limited, so that the eviction strategy can
+  // still react to changes of the workload. This also bounds the number of recorded keys.
+  static constexpr auto MAX_PENDING_ACCESSES_PER_ENTRY = uint32_t{8};
+
+  static size_t _shard_count_for(const size_t capacity) {
+    return std::clamp(capacity / MIN_SHARD_CAPACITY, size_t{1}, MAX_SHARD_COUNT);
+  }
+
+  // The capacity is split exactly over the used shards, the unused shards get no capacity at all
+  size_t _shard_capacity(const size_t capacity, const size_t shard_idx) const {
+    if (shard_idx >= _shard_count) return 0;
+    return capacity / _shard_count + (shard_idx < capacity % _shard_count ? 1 : 0);
+  }
+
+  size_t _shard_idx(const Key& query) const { return std::hash<Key>{}(query) % _shard_count; }
+
+  // Locks the shard that the query belongs to. The number of shards only changes while all shards are locked. If it
+  // changed before the lock was acquired, the shard that the query now belongs to is locked instead.
+  template <typename Lock>
+  Shard& _lock_shard(const Key& query, Lock& lock) const {
+    while (true) {
+      const auto shard_idx = _shard_idx(query);
+      lock = Lock{_shards[shard_idx].mutex};
+      if (shard_idx == _shard_idx(query)) return _shards[shard_idx];
+
+      // Release the lock before locking another shard, as _lock_all_shards() locks them in a fixed order
+      lock.unlock();
+    }
+  }
+
+  // Locks the shards in a fixed order, so that concurrent calls cannot deadlock
+  std::vector<std::unique_lock<std::shared_mutex>> _lock_all_shards() {
+    auto locks = std::vector<std::unique_lock<std::shared_mutex>>{};
+    locks.reserve(MAX_SHARD_COUNT);
+    for (auto& shard : _shards) {
+      locks.emplace_back(shard.mutex);
+    }
+    return locks;
+  }
+
+  // Requires the exclusive lock of the shard. Only touches the keys that have been accessed.
+  static void _pass_on_pending_accesses(Shard& shard) {
+    auto accessed_keys = std::vector<Key>{};
+    {
+      std::lock_guard<std::mutex> accessed_keys_lock(shard.accessed_keys_mutex);
+      if (shard.accessed_keys.empty()) return;
+      std::swap(accessed_keys, shard.accessed_keys);
+      shard.pending_accesses.clear();
+    }
+
+    for (const auto& key : accessed_keys) {
+      if (shard.impl->has(key)) shard.impl->get(key);
+    }
+  }
+
+  // Requires the exclusive lock of the shard
+  static void _discard_pending_accesses(Shard& shard) {
+    std::lock_guard<std::mutex> accessed_keys_lock(shard.accessed_keys_mutex);
+    shard.accessed_keys.clear();
+    shard.pending_accesses.clear();
+  }
 
-  mutable std::shared_mutex _mutex;
+  // All MAX_SHARD_COUNT shards exist at all times, so that their locks stay valid while the number of used shards
+  // changes. Unused shards have no capacity and are empty.
+  mutable std::vector<Shard> _shards;
+  std::atomic<size_t> _shard_count;
 };
 
 }  // namespace opossum
@@ -0,0 +1,66 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstdint>
+#include <functional>
+#include <thread>
+
+namespace opossum {
+
+// Approximately counts accesses per key hash without taking a lock, similar to the sketch of TinyLFU (Einziger et al.,
+// "TinyLFU: A Highly Efficient Cache Admission Policy", ACM TOS 2017). Each key hash is counted in one counter of each
+// of two rows, and its estimate is the smaller of the two counts. Hash collisions can only cause overestimates. To keep
+// threads that access the same hot key from contending for the same cache line, each thread increments the counters
+// of one of several stripes, and the estimate sums up all stripes.
+class FrequencySketch {
+ public:
+  // Returns the estimate including this increment
+  uint32_t increment(const size_t hash) {
+    static thread_local const auto stripe_index =
+        std::hash<std::thread::id>{}(std::this_thread::get_id()) % STRIPE_COUNT;
+
+    auto& counters = _stripes[stripe_index].counters;
+    counters[_index(hash, 0)].fetch_add(1, std::memory_order_relaxed);
+    counters[_index(hash, 1)].fetch_add(1, std::memory_order_relaxed);
+    return estimate(hash);
+  }
+
+  uint32_t estimate(const size_t hash) const {
+    auto counts = std::array<uint32_t, 2>{};
+    for (const auto& stripe : _stripes) {
+      counts[0] += stripe.counters[_index(hash, 0)].load(std::memory_order_relaxed);
+      counts[1] += stripe.counters[_index(hash, 1)].load(std::memory_order_relaxed);
+    }
+    return std::min(counts[0], counts[1]);
+  }
+
+  // Concurrent increments might get lost, which is acceptable for an approximate count
+  void clear() {
+    for (auto& stripe : _stripes) {
+      for (auto& counter : stripe.counters) {
+        counter.store(0, std::memory_order_relaxed);
+      }
+    }
+  }
+
+ private:
+  static constexpr auto STRIPE_COUNT = size_t{4};
+  static constexpr auto ROW_WIDTH = size_t{64};
+
+  // The hashes might have been used to pick the sketch (e.g., the shard of a Cache), so that their lower bits are
+  // correlated. Thus, the upper bits of the hash multiplied with one odd constant per row select the counter.
+  static size_t _index(const size_t hash, const size_t row) {
+    constexpr auto MULTIPLIERS = std::array<uint64_t, 2>{0x9E3779B97F4A7C15ULL, 0xC2B2AE3D27D4EB4FULL};
+    return row * ROW_WIDTH + ((uint64_t{hash} * MULTIPLIERS[row]) >> 58);
+  }
+
+  struct alignas(64) Stripe {
+    std::array<std::atomic<uint32_t>, 2 * ROW_WIDTH> counters{};
+  };
+
+  std::array<Stripe, STRIPE_COUNT> _stripes{};
+};
+
+}  // namespace opossum
@@ -99,6 +99,12 @@ class GDSCache : public AbstractCacheImpl<Key, Value> {
     return entry.value;
   }
 
+  const Value* peek(const Key& key) const {
+    const auto it = _map.find(key);
+    if (it == _map.end()) return nullptr;
+    return &(*it->second).value;
+  }
+
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
   size_t size() const { return _map.size(); }
@@ -66,6 +66,12 @@ class LRUCache : public AbstractCacheImpl<Key, Value> {
     return it->second->second;
   }
 
+  const Value* peek(const Key& key) const {
+    const auto it = _map.find(key);
+    if (it == _map.end()) return nullptr;
+    return &it->second->second;
+  }
+
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
   // Returns the underlying list of all elements in the cache.
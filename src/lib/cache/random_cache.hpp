@@ -76,6 +76,12 @@ class RandomCache : public AbstractCacheImpl<Key, Value> {
     return _list[it->second].second;
   }
 
+  const Value* peek(const Key& key) const {
+    const auto it = _map.find(key);
+    if (it == _map.end()) return nullptr;
+    return &_list[it->second].second;
+  }
+
   bool has(const Key& key) const { return _map.find(key) != _map.end(); }
 
   size_t size() const { return _map.size(); }
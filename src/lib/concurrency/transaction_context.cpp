@@ -2,9 +2,10 @@
 
 #include <future>
 #include <memory>
+#include <vector>
 
-#include "commit_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_entry_writer.hpp"
 #include "operators/abstract_read_write_operator.hpp"
 #include "utils/assert.hpp"
 
@@ -58,9 +59,9 @@ CommitID TransactionContext::snapshot_commit_id() const { return _snapshot_commi
 AutoCommit TransactionContext::is_auto_commit() const { return _is_auto_commit; }
 
 CommitID TransactionContext::commit_id() const {
-  Assert(_commit_context, "TransactionContext cid only available after commit context has been created.");
+  Assert(_commit_id, "TransactionContext cid only available after the commit id has been assigned.");
 
-  return _commit_context->commit_id();
+  return *_commit_id;
 }
 
 TransactionPhase TransactionContext::phase() const { return _phase; }
@@ -83,11 +84,9 @@ void TransactionContext::rollback() {
 void TransactionContext::commit_async(const std::function<void(TransactionID)>& callback) {
   _prepare_commit();
 
-  for (const auto& op : _read_write_operators) {
-    op->commit_records(commit_id());
-  }
-
-  _mark_as_pending_and_try_commit(callback);
+  // The commit id is assigned, the records are committed, and the callback is called when the TransactionManager
+  // processes the commit batch this transaction joins. This might happen in another thread.
+  Hyrise::get().transaction_manager._commit(shared_from_this(), callback);
 }
 
 void TransactionContext::commit() {
@@ -139,10 +138,31 @@ void TransactionContext::_prepare_commit() {
 
   _wait_for_active_operators_to_finish();
 
-  _commit_context = Hyrise::get().transaction_manager._new_commit_context();
+  // Announce the commit, so that a concurrently processed commit batch can wait for this transaction to join it. This
+  // happens right before the transaction is handed to the TransactionManager, so that the leader does not wait for
+  // transactions whose operators are still running.
+  ++Hyrise::get().transaction_manager._num_preparing_commits;
+}
+
+void TransactionContext::_commit_records(const CommitID commit_id) {
+  _commit_id = commit_id;
+
+  for (const auto& op : _read_write_operators) {
+    op->commit_records(commit_id);
+  }
+}
+
+void TransactionContext::_write_log_entry(std::vector<char>& log_entries) const {
+  auto log_entry_writer = LogEntryWriter{log_entries, commit_id()};
+
+  for (const auto& op : _read_write_operators) {
+    op->write_log_records(log_entry_writer);
+  }
+
+  log_entry_writer.finish();
 }
 
-void TransactionContext::_mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback) {
+void TransactionContext::_mark_as_committed() {
   DebugAssert(([this]() {
                 for (const auto& op : _read_write_operators) {
                   if (op->state() != ReadWriteOperatorState::Committed) return false;
@@ -151,17 +171,7 @@ void TransactionContext::_mark_as_pending_and_try_commit(const std::function<voi
               }()),
               "All read/write operators need to have been committed.");
 
-  auto context_weak_ptr = std::weak_ptr<TransactionContext>{this->shared_from_this()};
-  _commit_context->make_pending(_transaction_id, [context_weak_ptr, callback](auto transaction_id) {
-    // If the transaction context still exists, set its phase to Committed.
-    if (auto context_ptr = context_weak_ptr.lock()) {
-      context_ptr->_transition(TransactionPhase::Committing, TransactionPhase::Committed);
-    }
-
-    if (callback) callback(transaction_id);
-  });
-
-  Hyrise::get().transaction_manager._try_increment_last_commit_id(_commit_context);
+  _transition(TransactionPhase::Committing, TransactionPhase::Committed);
 }
 
 void TransactionContext::on_operator_started() { ++_num_active_operators; }
@@ -171,14 +181,16 @@ void TransactionContext::on_operator_finished() {
   const auto num_before = _num_active_operators--;
 
   if (num_before == 1) {
+    // Acquire the mutex before notifying, so that the notification cannot get lost between a waiting thread checking
+    // the counter and going to sleep
+    { const auto lock = std::lock_guard<std::mutex>{_active_operators_mutex}; }
     _active_operators_cv.notify_all();
   }
 }
 
 void TransactionContext::_wait_for_active_operators_to_finish() const {
   std::unique_lock<std::mutex> lock(_active_operators_mutex);
-  if (_num_active_operators == 0) return;
-  _active_operators_cv.wait(lock, [&] { return _num_active_operators != 0; });
+  _active_operators_cv.wait(lock, [&] { return _num_active_operators == 0; });
 }
 
 void TransactionContext::_transition(TransactionPhase from_phase, TransactionPhase to_phase) {
@@ -2,7 +2,9 @@
 
 #include <atomic>
 #include <condition_variable>
+#include <functional>
 #include <memory>
+#include <optional>
 #include <vector>
 
 #include "types.hpp"
@@ -10,7 +12,6 @@
 namespace opossum {
 
 class AbstractReadWriteOperator;
-class CommitContext;
 
 /**
  * @brief Overview of the different transaction phases
@@ -27,10 +28,10 @@ class CommitContext;
  *  | Aborted |                    | Committing |
  *  +---------+                    +------------+
  *      |                             |
- *   Rollback operators             Commit operators
+ *   Rollback operators             Join the next commit batch
  *      |                             |
- *  +------------+                  Wait for all previous
- *  | RolledBack |                  transaction to be committed
+ *  +------------+                  Get commit ID and commit
+ *  | RolledBack |                  operators with the batch
  *  +------------+                    |
  *                                 +-----------+
  *                                 | Committed |
@@ -40,7 +41,7 @@ enum class TransactionPhase {
   Active,      // Transaction has just been created. Operators may be executed.
   Aborted,     // One of the operators failed. Transaction needs to be rolled back.
   RolledBack,  // Transaction has been rolled back.
-  Committing,  // Commit ID has been assigned. Operators may commit records.
+  Committing,  // Transaction waits for its commit batch. Operators commit records once the commit ID is assigned.
   Committed    // Transaction has been committed.
 };
 
@@ -71,7 +72,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * The commit id that this transaction has once it is committed. This is the one that is written to the
    * begin/end commit ids of rows modified by this transaction.
-   * Only available after TransactionManager::prepare_commit has been called
+   * Only available after the TransactionManager has assigned the commit id to the transaction's commit batch.
    */
   CommitID commit_id() const;
 
@@ -98,7 +99,8 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   /**
    * Commits the transaction.
    *
-   * @param callback called when transaction is actually committed
+   * @param callback called when transaction is actually committed. If logging is enabled in LogSyncMode::Durable, it
+   *                 is called by the logger thread and must not wait for other transactions to commit.
    */
   void commit_async(const std::function<void(TransactionID)>& callback);
 
@@ -150,7 +152,6 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
 
   /**
    * Sets transaction phase to Committing.
-   * Creates a new commit context and assigns a new commit id.
    * All operators within this context must be finished and
    * none of the registered operators should have failed when
    * calling this function.
@@ -158,18 +159,30 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   void _prepare_commit();
 
   /**
-   * Sets transaction phase to Pending.
-   * Tries to commit transaction and all following
-   * transactions also marked as “pending”. If there are
-   * uncommitted transaction with a smaller commit id, it
-   * will be committed after those.
-   *
-   * @param callback called when transaction is committed
+   * Called by the TransactionManager when the commit batch of this transaction is processed.
+   * Stores the commit id and lets the operators write it to the MVCC data of their records.
    */
-  void _mark_as_pending_and_try_commit(const std::function<void(TransactionID)>& callback);
+  void _commit_records(CommitID commit_id);
+
+  /**
+   * Called by the TransactionManager after _commit_records if logging is enabled. Appends the log entry with the
+   * records of all operators to `log_entries`.
+   */
+  void _write_log_entry(std::vector<char>& log_entries) const;
+
+  /**
+   * Sets transaction phase to Committed.
+   * Called by the TransactionManager once the last commit id has been advanced past this transaction.
+   */
+  void _mark_as_committed();
 
   /**@}*/
 
+  /**
+   * Blocks until no operator of this transaction is executing anymore (see on_operator_started/finished()), so that
+   * no operator modifies records while they are committed or rolled back. Thus, a transaction must not be committed
+   * or rolled back from within the execution of one of its own operators.
+   */
   void _wait_for_active_operators_to_finish() const;
 
   /**
@@ -185,7 +198,7 @@ class TransactionContext : public std::enable_shared_from_this<TransactionContex
   std::vector<std::shared_ptr<AbstractReadWriteOperator>> _read_write_operators;
 
   std::atomic<TransactionPhase> _phase;
-  std::shared_ptr<CommitContext> _commit_context;
+  std::optional<CommitID> _commit_id;
 
   std::atomic_size_t _num_active_operators;
 
@@ -1,27 +1,57 @@
 #include "transaction_manager.hpp"
 
-#include "commit_context.hpp"
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include "hyrise.hpp"
 #include "storage/mvcc_data.hpp"
 #include "transaction_context.hpp"
 #include "utils/assert.hpp"
 
+namespace {
+
+// Set while the thread processes commit batches
+thread_local auto is_commit_leader_thread = false;
+
+// Callbacks of the batches published by the commit leader. They are called once the thread is no longer the leader.
+thread_local auto deferred_commit_callbacks = std::vector<std::function<void()>>{};
+
+}  // namespace
+
 namespace opossum {
 
 TransactionManager::TransactionManager()
     : _next_transaction_id{INITIAL_TRANSACTION_ID},
       _last_commit_id{INITIAL_COMMIT_ID},
-      _last_commit_context{std::make_shared<CommitContext>(INITIAL_COMMIT_ID)} {}
+      _last_assigned_commit_id{INITIAL_COMMIT_ID},
+      _snapshot_commit_id_slots(SNAPSHOT_SLOT_COUNT) {
+  for (auto& slot : _snapshot_commit_id_slots) {
+    slot.store(UNUSED_SNAPSHOT_SLOT, std::memory_order_relaxed);
+  }
+}
 
 TransactionManager::~TransactionManager() {
-  Assert(_active_snapshot_commit_ids.empty(),
+  Assert(_active_snapshot_commit_ids().empty(),
          "Some transactions do not seem to have finished yet as they are still registered as active.");
 }
 
 TransactionManager& TransactionManager::operator=(TransactionManager&& transaction_manager) noexcept {
   _next_transaction_id = transaction_manager._next_transaction_id.load();
   _last_commit_id = transaction_manager._last_commit_id.load();
-  _last_commit_context = transaction_manager._last_commit_context;
-  _active_snapshot_commit_ids = transaction_manager._active_snapshot_commit_ids;
+  _last_assigned_commit_id = transaction_manager._last_assigned_commit_id;
+  _pending_commits = transaction_manager._pending_commits;
+  _commit_leader_active = transaction_manager._commit_leader_active;
+  _next_batch_id = transaction_manager._next_batch_id;
+  _last_processed_batch_id = transaction_manager._last_processed_batch_id;
+  _num_waiting_pending_commits = transaction_manager._num_waiting_pending_commits;
+  _handover_pending = transaction_manager._handover_pending;
+  _num_preparing_commits = transaction_manager._num_preparing_commits.load();
+  for (auto slot_idx = size_t{0}; slot_idx < SNAPSHOT_SLOT_COUNT; ++slot_idx) {
+    _snapshot_commit_id_slots[slot_idx] = transaction_manager._snapshot_commit_id_slots[slot_idx].load();
+  }
+  _overflow_snapshot_commit_ids = transaction_manager._overflow_snapshot_commit_ids;
+  _overflow_snapshot_commit_id_count = transaction_manager._overflow_snapshot_commit_id_count.load();
   return *this;
 }
 
@@ -32,92 +62,220 @@ std::shared_ptr<TransactionContext> TransactionManager::new_transaction_context(
   return std::make_shared<TransactionContext>(_next_transaction_id++, snapshot_commit_id, auto_commit);
 }
 
+size_t TransactionManager::_first_slot_of_this_thread() {
+  static auto next_thread_idx = std::atomic<size_t>{0};
+  thread_local const auto first_slot = (next_thread_idx++ * SNAPSHOT_SLOTS_PER_CACHE_LINE) % SNAPSHOT_SLOT_COUNT;
+  return first_slot;
+}
+
 void TransactionManager::_register_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-  _active_snapshot_commit_ids.insert(snapshot_commit_id);
+  DebugAssert(snapshot_commit_id != UNUSED_SNAPSHOT_SLOT, "Invalid snapshot_commit_id");
+
+  const auto first_slot = _first_slot_of_this_thread();
+  for (auto slot_offset = size_t{0}; slot_offset < SNAPSHOT_SLOT_COUNT; ++slot_offset) {
+    auto& slot = _snapshot_commit_id_slots[(first_slot + slot_offset) % SNAPSHOT_SLOT_COUNT];
+    if (slot.load(std::memory_order_relaxed) != UNUSED_SNAPSHOT_SLOT) continue;
+
+    auto expected = UNUSED_SNAPSHOT_SLOT;
+    if (slot.compare_exchange_strong(expected, snapshot_commit_id)) return;
+  }
+
+  // All slots are in use
+  std::lock_guard<std::mutex> lock(_mutex_overflow_snapshot_commit_ids);
+  _overflow_snapshot_commit_ids.insert(snapshot_commit_id);
+  ++_overflow_snapshot_commit_id_count;
 }
 
 void TransactionManager::_deregister_transaction(const CommitID snapshot_commit_id) {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
-
-  auto it = std::find(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end(), snapshot_commit_id);
+  // Any slot holding the snapshot_commit_id can be released. If another thread releases the slot that was claimed by
+  // this transaction, it leaves its own slot, which holds the same snapshot_commit_id, to us.
+  const auto first_slot = _first_slot_of_this_thread();
+  for (auto slot_offset = size_t{0}; slot_offset < SNAPSHOT_SLOT_COUNT; ++slot_offset) {
+    auto& slot = _snapshot_commit_id_slots[(first_slot + slot_offset) % SNAPSHOT_SLOT_COUNT];
+    if (slot.load(std::memory_order_relaxed) != snapshot_commit_id) continue;
 
-  if (it != _active_snapshot_commit_ids.end()) {
-    _active_snapshot_commit_ids.erase(it);
-    return;
+    auto expected = snapshot_commit_id;
+    if (slot.compare_exchange_strong(expected, UNUSED_SNAPSHOT_SLOT)) return;
   }
 
+  std::lock_guard<std::mutex> lock(_mutex_overflow_snapshot_commit_ids);
+  const auto it = _overflow_snapshot_commit_ids.find(snapshot_commit_id);
+
   Assert(
-      it == _active_snapshot_commit_ids.end(),
-      "Could not find snapshot_commit_id in TransactionManager's _active_snapshot_commit_ids. Therefore, the removal "
+      it != _overflow_snapshot_commit_ids.end(),
+      "Could not find snapshot_commit_id in TransactionManager's active snapshot-commit-ids. Therefore, the removal "
       "failed and the function should not have been called.");
+
+  _overflow_snapshot_commit_ids.erase(it);
+  --_overflow_snapshot_commit_id_count;
 }
 
 std::optional<CommitID> TransactionManager::get_lowest_active_snapshot_commit_id() const {
-  std::unique_lock<std::mutex> lock(_mutex_active_snapshot_commit_ids);
+  auto lowest_snapshot_commit_id = std::optional<CommitID>{};
+
+  const auto update_lowest = [&](const CommitID snapshot_commit_id) {
+    if (!lowest_snapshot_commit_id || snapshot_commit_id < *lowest_snapshot_commit_id) {
+      lowest_snapshot_commit_id = snapshot_commit_id;
+    }
+  };
+
+  for (const auto& slot : _snapshot_commit_id_slots) {
+    const auto snapshot_commit_id = slot.load(std::memory_order_acquire);
+    if (snapshot_commit_id != UNUSED_SNAPSHOT_SLOT) update_lowest(snapshot_commit_id);
+  }
+
+  if (_overflow_snapshot_commit_id_count > 0) {
+    std::lock_guard<std::mutex> lock(_mutex_overflow_snapshot_commit_ids);
+    for (const auto snapshot_commit_id : _overflow_snapshot_commit_ids) {
+      update_lowest(snapshot_commit_id);
+    }
+  }
 
-  if (_active_snapshot_commit_ids.empty()) {
-    return std::nullopt;
+  return lowest_snapshot_commit_id;
+}
+
+std::vector<CommitID> TransactionManager::_active_snapshot_commit_ids() const {
+  auto snapshot_commit_ids = std::vector<CommitID>{};
+
+  for (const auto& slot : _snapshot_commit_id_slots) {
+    const auto snapshot_commit_id = slot.load();
+    if (snapshot_commit_id != UNUSED_SNAPSHOT_SLOT) snapshot_commit_ids.emplace_back(snapshot_commit_id);
   }
 
-  auto it = std::min_element(_active_snapshot_commit_ids.begin(), _active_snapshot_commit_ids.end());
-  return *it;
+  std::lock_guard<std::mutex> lock(_mutex_overflow_snapshot_commit_ids);
+  snapshot_commit_ids.insert(snapshot_commit_ids.end(), _overflow_snapshot_commit_ids.begin(),
+                             _overflow_snapshot_commit_ids.end());
+
+  return snapshot_commit_ids;
 }
 
-/**
- * Logic of the lock-free algorithm
- *
- * Let’s say n threads call this method simultaneously. They all enter the main while-loop.
- * Eventually they reach the point where they try to set the successor of _last_commit_context
- * (pointed to by current_context). Only one of them will succeed and will be able to pass the
- * following if statement. The rest continues with the loop and will now try to get the latest
- * context, which does not have a successor. As long as the thread that succeeded setting
- * the next commit context has not finished updating _last_commit_context, they are stuck in
- * the small while-loop. As soon as it is done, _last_commit_context will point to a commit
- * context with no successor and they will be able to leave this loop.
- */
-std::shared_ptr<CommitContext> TransactionManager::_new_commit_context() {
-  auto current_context = std::atomic_load(&_last_commit_context);
-  auto next_context = std::shared_ptr<CommitContext>();
-
-  auto success = false;
-  while (!success) {
-    while (current_context->has_next()) {
-      current_context = std::atomic_load(&_last_commit_context);
+void TransactionManager::_commit(const std::shared_ptr<TransactionContext>& transaction_context,
+                                 const std::function<void(TransactionID)>& callback) {
+  auto lock = std::unique_lock<std::mutex>{_pending_commits_mutex};
+  _pending_commits.push_back({transaction_context, callback});
+  --_num_preparing_commits;
+
+  // A commit issued by the leader itself, e.g., from within an operator's commit_records(), joins the next batch. The
+  // leader processes that batch before it returns.
+  if (is_commit_leader_thread) return;
+
+  if (_commit_leader_active) {
+    // Wait until the batch of this transaction has been processed or until the leader hands over to this thread
+    const auto batch_id = _next_batch_id;
+    ++_num_waiting_pending_commits;
+    _commit_leader_handover.wait(lock, [&]() { return _last_processed_batch_id >= batch_id || _handover_pending; });
+    if (_last_processed_batch_id >= batch_id) return;
+    _handover_pending = false;
+  } else {
+    _commit_leader_active = true;
+  }
+
+  is_commit_leader_thread = true;
+  while (true) {
+    // Give transactions that are about to commit the chance to join the batch. Transactions that commit alone do not
+    // have to wait.
+    lock.unlock();
+    const auto window_end = std::chrono::steady_clock::now() + GROUP_COMMIT_WINDOW;
+    while (_num_preparing_commits > 0 && std::chrono::steady_clock::now() < window_end) {
+      std::this_thread::yield();
     }
+    lock.lock();
 
-    next_context = std::make_shared<CommitContext>(current_context->commit_id() + 1u);
+    auto batch = std::vector<PendingCommit>{};
+    batch.swap(_pending_commits);
+    const auto batch_id = _next_batch_id++;
+    _num_waiting_pending_commits = 0;
+    lock.unlock();
 
-    success = current_context->try_set_next(next_context);
+    _commit_batch(std::move(batch));
 
-    if (!success) continue;
+    lock.lock();
+    _last_processed_batch_id = batch_id;
+    if (_pending_commits.empty()) {
+      _commit_leader_active = false;
+      break;
+    }
 
-    /**
-     * Only one thread at a time can ever reach this code since only one thread
-     * succeeds to set _last_commit_context’s successor.
-     */
-    success = std::atomic_compare_exchange_strong(&_last_commit_context, &current_context, next_context);
+    // The leader processes only its own batch, so that its latency is bounded even if other transactions keep
+    // committing. One of the transactions waiting for the next batch takes over.
+    if (_num_waiting_pending_commits > 0) {
+      _handover_pending = true;
+      break;
+    }
 
-    Assert(success, "Invariant violated.");
+    // Only commits that were issued by the leader itself are pending and nobody else waits for them
   }
+  is_commit_leader_thread = false;
 
-  return next_context;
+  lock.unlock();
+  _commit_leader_handover.notify_all();
+
+  // The callbacks are called only after the batch lock has been released and the leadership has been given up, so
+  // that they can commit further transactions, e.g., by calling TransactionContext::commit(). Such a commit is
+  // processed like the commit of any other thread instead of waiting for this thread to process it.
+  auto callbacks = std::vector<std::function<void()>>{};
+  callbacks.swap(deferred_commit_callbacks);
+  for (const auto& callback : callbacks) {
+    callback();
+  }
 }
 
-void TransactionManager::_try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context) {
-  auto current_context = context;
+void TransactionManager::_commit_batch(std::vector<PendingCommit>&& batch) {
+  // Only the commit leader assigns commit ids, so there are no concurrent modifications
+  auto commit_id = _last_assigned_commit_id;
 
-  while (current_context->is_pending()) {
-    auto expected_last_commit_id = current_context->commit_id() - 1;
+  for (const auto& pending_commit : batch) {
+    pending_commit.transaction_context->_commit_records(++commit_id);
+  }
 
-    if (!_last_commit_id.compare_exchange_strong(expected_last_commit_id, current_context->commit_id())) return;
+  _last_assigned_commit_id = commit_id;
 
-    current_context->fire_callback();
+  auto& log_manager = Hyrise::get().log_manager;
+  if (!log_manager.is_enabled()) {
+    _publish_batch(batch, commit_id);
+    return;
+  }
+
+  auto log_entries = std::vector<char>{};
+  for (const auto& pending_commit : batch) {
+    pending_commit.transaction_context->_write_log_entry(log_entries);
+  }
+
+  // Depending on the LogSyncMode, the LogManager publishes the batch after syncing the log or right away. Batches are
+  // published in the order in which they are handed to the LogManager.
+  log_manager._append(std::move(log_entries),
+                      [this, batch = std::move(batch), commit_id]() { _publish_batch(batch, commit_id); });
+}
 
-    if (!current_context->has_next()) return;
+void TransactionManager::_publish_batch(const std::vector<PendingCommit>& batch, const CommitID last_commit_id) {
+  // The records of all transactions in the batch become visible at once
+  _last_commit_id = last_commit_id;
 
-    current_context = current_context->next();
+  for (const auto& pending_commit : batch) {
+    const auto& transaction_context = pending_commit.transaction_context;
+    transaction_context->_mark_as_committed();
+    if (!pending_commit.callback) continue;
+
+    if (is_commit_leader_thread) {
+      deferred_commit_callbacks.emplace_back(
+          [callback = pending_commit.callback, transaction_id = transaction_context->transaction_id()]() {
+            callback(transaction_id);
+          });
+    } else {
+      pending_commit.callback(transaction_context->transaction_id());
+    }
   }
 }
 
+void TransactionManager::_advance_last_commit_id(const CommitID commit_id) {
+  Assert(_active_snapshot_commit_ids().empty(), "Commit IDs cannot be advanced while transactions are active");
+
+  std::lock_guard<std::mutex> lock(_pending_commits_mutex);
+  Assert(!_commit_leader_active, "Commit IDs cannot be advanced while transactions are committed");
+  if (commit_id <= _last_assigned_commit_id) return;
+
+  _last_assigned_commit_id = commit_id;
+  _last_commit_id = commit_id;
+}
+
 }  // namespace opossum
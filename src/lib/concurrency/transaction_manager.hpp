@@ -1,10 +1,13 @@
 #pragma once
 
 #include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <functional>
 #include <memory>
 #include <mutex>
 #include <unordered_set>
+#include <vector>
 
 #include "types.hpp"
 
@@ -32,13 +35,23 @@
  * transaction context.
  *
  * TransactionContext contains data used by a transaction, mainly its ID, the snapshot commit ID explained above, and,
- * when it enters the commit phase, the TransactionManager gives it a CommitContext, which contains
- * a new commit ID that is used to make its changes visible to others.
+ * when it is committed, a new commit ID that is used to make its changes visible to others.
+ *
+ * Commits are processed in batches (group commit): Transactions that commit at about the same time are collected in
+ * a batch, get consecutive commit IDs, and write them to their MVCC data. Afterwards, the last commit ID is advanced
+ * once for the entire batch, which makes all of its changes visible at the same time. The first transaction that
+ * finds no batch being processed becomes the commit leader and processes the batch it is part of. All other
+ * transactions add themselves to the next batch and wait. Once the leader is done, it hands over to one of the
+ * transactions waiting for the next batch, which becomes the new leader. Thus, a leader processes only one batch, no
+ * matter how many transactions keep committing.
+ *
+ * If logging is enabled (see LogManager), the log entries of a batch are handed to the LogManager after its records
+ * have been committed. Depending on the LogSyncMode, the batch is published (i.e., the last commit ID is advanced and
+ * the transactions are marked as committed) once its log entries have been synced or right away.
  */
 
 namespace opossum {
 
-class CommitContext;
 class TransactionContext;
 
 /**
@@ -59,7 +72,8 @@ class TransactionManager : public Noncopyable {
   std::shared_ptr<TransactionContext> new_transaction_context(const AutoCommit auto_commit = AutoCommit::No);
 
   /**
-   * Returns the lowest snapshot-commit-id currently used by a transaction.
+   * Returns the lowest snapshot-commit-id currently used by a transaction. Does not acquire any lock unless more than
+   * SNAPSHOT_SLOT_COUNT transactions are active, so it can be called frequently.
    */
   std::optional<CommitID> get_lowest_active_snapshot_commit_id() const;
 
@@ -67,33 +81,101 @@ class TransactionManager : public Noncopyable {
   TransactionManager();
   ~TransactionManager();
 
+  friend class Checkpoint;
   friend class Hyrise;
+  friend class LogManager;
   friend class TransactionContext;
 
   TransactionManager& operator=(TransactionManager&& transaction_manager) noexcept;
 
-  std::shared_ptr<CommitContext> _new_commit_context();
-  void _try_increment_last_commit_id(const std::shared_ptr<CommitContext>& context);
+  struct PendingCommit {
+    std::shared_ptr<TransactionContext> transaction_context;
+    std::function<void(TransactionID)> callback;
+  };
+
+  /**
+   * Adds the transaction to the next commit batch. If no other thread is currently processing a commit batch, the
+   * calling thread becomes the commit leader and processes the batch. Otherwise, it waits until its batch has been
+   * processed or until the current leader hands over to it. Thus, the callback is either called before this function
+   * returns or from the thread of another committing transaction (or by the LogManager, see LogSyncMode). A leader
+   * calls the callbacks only after it has released the batch lock and handed over the leadership, so callbacks may
+   * commit other transactions. Callbacks called by the LogManager must not wait for other commits, as the LogManager
+   * does not sync further batches before they return.
+   */
+  void _commit(const std::shared_ptr<TransactionContext>& transaction_context,
+               const std::function<void(TransactionID)>& callback);
+
+  // Assigns consecutive commit IDs to the batch, commits the records, and (possibly after logging them) publishes
+  // the batch
+  void _commit_batch(std::vector<PendingCommit>&& batch);
+
+  // Makes the records of the batch visible by advancing _last_commit_id once, marks the transactions as committed,
+  // and calls their callbacks (or, if called by the commit leader, defers them until it is no longer the leader)
+  void _publish_batch(const std::vector<PendingCommit>& batch, const CommitID last_commit_id);
+
+  // Called after tables have been restored from a checkpoint or log (see Checkpoint and LogManager::recover), so that
+  // the commit IDs of new transactions follow the restored ones. Must not be called while transactions are active.
+  void _advance_last_commit_id(const CommitID commit_id);
 
   /**
    * The TransactionManager keeps track of issued snapshot-commit-ids,
    * which are in use by unfinished transactions.
    * The following two functions are used to keep the multiset of active
    * snapshot-commit-ids up to date.
+   *
+   * The multiset is stored in a fixed number of slots that are claimed and released with atomic operations. Each
+   * thread starts looking for a slot at a different cache line, so that concurrent transactions usually do not touch
+   * the same cache lines. Slots holding the same snapshot-commit-id are interchangeable, so a transaction does not
+   * need to remember which slot it claimed. Only if all slots are in use, the snapshot-commit-id is stored in
+   * _overflow_snapshot_commit_ids, which is protected by a mutex.
    */
   void _register_transaction(CommitID snapshot_commit_id);
   void _deregister_transaction(CommitID snapshot_commit_id);
 
+  // Returns the snapshot-commit-ids of all active transactions (used for testing)
+  std::vector<CommitID> _active_snapshot_commit_ids() const;
+
+  // Index of the slot where the calling thread starts looking for a free or matching slot
+  static size_t _first_slot_of_this_thread();
+
   std::atomic<TransactionID> _next_transaction_id;
 
   std::atomic<CommitID> _last_commit_id;
+  // Commit ID of the last transaction that was assigned a commit ID. Ahead of _last_commit_id while the log entries
+  // of a batch are synced. Only accessed by the commit leader.
+  CommitID _last_assigned_commit_id;
   // We use commit_id=0 for rows that were inserted and then rolled back. Also, this can be used for rows that have
   // been there "from the beginning of time".
   static constexpr auto INITIAL_COMMIT_ID = CommitID{1};
 
-  std::shared_ptr<CommitContext> _last_commit_context;
-
-  mutable std::mutex _mutex_active_snapshot_commit_ids;
-  std::unordered_multiset<CommitID> _active_snapshot_commit_ids;
+  // Time for which the commit leader waits for transactions that are about to commit, so that they join its batch.
+  // The leader does not wait if no other transaction is preparing its commit.
+  static constexpr auto GROUP_COMMIT_WINDOW = std::chrono::microseconds{50};
+
+  std::mutex _pending_commits_mutex;
+  std::vector<PendingCommit> _pending_commits;
+  bool _commit_leader_active{false};
+  // Batches are numbered in the order in which they are processed. The transactions in _pending_commits form the batch
+  // _next_batch_id. _num_waiting_pending_commits of them have a thread waiting in _commit().
+  uint64_t _next_batch_id{1};
+  uint64_t _last_processed_batch_id{0};
+  size_t _num_waiting_pending_commits{0};
+  // Set by a leader that finished its batch to hand over to one of the waiting transactions
+  bool _handover_pending{false};
+  std::condition_variable _commit_leader_handover;
+  // Number of transactions that have entered the commit phase but have not yet been added to _pending_commits
+  std::atomic<size_t> _num_preparing_commits{0};
+
+  static constexpr auto SNAPSHOT_SLOT_COUNT = size_t{4096};
+  static constexpr auto SNAPSHOT_SLOTS_PER_CACHE_LINE = size_t{64} / sizeof(CommitID);
+  // Snapshot-commit-ids start at INITIAL_COMMIT_ID, so 0 can be used to mark a slot as unused
+  static constexpr auto UNUSED_SNAPSHOT_SLOT = CommitID{0};
+
+  std::vector<std::atomic<CommitID>> _snapshot_commit_id_slots;
+
+  mutable std::mutex _mutex_overflow_snapshot_commit_ids;
+  std::unordered_multiset<CommitID> _overflow_snapshot_commit_ids;
+  // Allows readers to skip the mutex if there are no overflowing snapshot-commit-ids
+  std::atomic<size_t> _overflow_snapshot_commit_id_count{0};
 };
 }  // namespace opossum
@@ -322,14 +322,14 @@ ExpressionEvaluator::_evaluate_like_expression<ExpressionEvaluator::Bool>(const
       });
     }
   } else if (!left_results->is_literal() && right_results->is_literal()) {
-    // E.g., `a LIKE '%hello%'` -- A single matcher for all rows
+    // E.g., `a LIKE '%hello%'` -- A single matcher for all rows, resolved only once
     LikeMatcher like_matcher{right_results->values.front()};
 
-    for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
-      like_matcher.resolve(invert_results, [&](const auto& matcher) {
+    like_matcher.resolve(invert_results, [&](const auto& matcher) {
+      for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
         result_values[row_idx] = matcher(left_results->values[row_idx]);
-      });
-    }
+      }
+    });
   } else {
     // E.g., `'hello' LIKE b` -- A new matcher for each row but the value to check is constant
     for (auto row_idx = ChunkOffset{0}; row_idx < result_size; ++row_idx) {
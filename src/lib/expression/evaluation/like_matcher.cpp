@@ -1,12 +1,12 @@
 #include "like_matcher.hpp"
 
-#include "boost/algorithm/string/replace.hpp"
+#include <algorithm>
 
 #include "utils/assert.hpp"
 
 namespace opossum {
 
-LikeMatcher::LikeMatcher(const pmr_string& pattern) { _pattern_variant = pattern_string_to_pattern_variant(pattern); }
+LikeMatcher::LikeMatcher(const pmr_string& pattern) : _pattern_variant(pattern_string_to_pattern_variant(pattern)) {}
 
 size_t LikeMatcher::get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset) {
   return pattern.find_first_of("_%", offset);
@@ -59,13 +59,13 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
 
   } else {
     /**
-     * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or, if it isn't we fall back to
-     * using a regex matcher.
+     * Pattern is either MultipleContainsPattern, e.g., '%hello%world%how%are%you%' or, if it isn't, a
+     * GeneralPattern.
      *
      * A MultipleContainsPattern begins and ends with '%' and  contains only strings and '%'.
      */
 
-    // Pick ContainsMultiple or Regex
+    // Pick ContainsMultiple or GeneralPattern
     auto pattern_is_contains_multiple = true;  // Set to false if tokens don't match %(, string, %)* pattern
     auto strings = std::vector<pmr_string>{};  // arguments used for ContainsMultiple, if it gets used
     auto expect_any_chars = true;              // If true, expect '%', if false, expect a string
@@ -88,37 +88,95 @@ LikeMatcher::AllPatternVariant LikeMatcher::pattern_string_to_pattern_variant(co
       expect_any_chars = !expect_any_chars;
     }
 
-    if (pattern_is_contains_multiple) {
+    // The pattern has to end with '%' as well (e.g., '%hello%world' or '' are no MultipleContainsPatterns)
+    if (pattern_is_contains_multiple && !expect_any_chars) {
       return MultipleContainsPattern{strings};
     } else {
-      return std::regex(sql_like_to_regex(pattern));
+      return GeneralPattern{pattern};
     }
   }
 }
 
-std::string LikeMatcher::sql_like_to_regex(pmr_string sql_like) {
-  // Do substitution of <backslash> with <backslash><backslash> FIRST, because otherwise it will also replace
-  // backslashes introduced by the other substitutions
-  constexpr auto REPLACE_BY = std::array<std::pair<const char*, const char*>, 14u>{{{"\\", "\\\\"},
-                                                                                    {".", "\\."},
-                                                                                    {"^", "\\^"},
-                                                                                    {"$", "\\$"},
-                                                                                    {"+", "\\+"},
-                                                                                    {"?", "\\?"},
-                                                                                    {"(", "\\("},
-                                                                                    {")", "\\)"},
-                                                                                    {"{", "\\{"},
-                                                                                    {"}", "\\}"},
-                                                                                    {"|", "\\|"},
-                                                                                    {"*", "\\*"},
-                                                                                    {"%", ".*"},
-                                                                                    {"_", "."}}};
-
-  for (const auto& pair : REPLACE_BY) {
-    boost::replace_all(sql_like, pair.first, pair.second);
+LikeMatcher::GeneralPattern::GeneralPattern(const pmr_string& pattern) {
+  auto segment_begin = size_t{0};
+  while (true) {
+    const auto segment_end = std::min(pattern.find('%', segment_begin), pattern.size());
+    const auto is_last_segment = segment_end == pattern.size();
+
+    if (segment_end > segment_begin || segments.empty() || is_last_segment) {
+      auto& segment = segments.emplace_back();
+      segment.string = pattern.substr(segment_begin, segment_end - segment_begin);
+      segment.has_single_char_wildcards = segment.string.find('_') != pmr_string::npos;
+
+      auto substring_begin = size_t{0};
+      while (substring_begin < segment.string.size()) {
+        const auto substring_end = std::min(segment.string.find('_', substring_begin), segment.string.size());
+        if (substring_end - substring_begin > segment.search_string.size()) {
+          segment.search_string_offset = substring_begin;
+          segment.search_string = segment.string.substr(substring_begin, substring_end - substring_begin);
+        }
+        substring_begin = substring_end + 1;
+      }
+    }
+
+    if (is_last_segment) break;
+    segment_begin = segment_end + 1;
+  }
+}
+
+bool LikeMatcher::GeneralPattern::matches(const std::string_view& string) const {
+  const auto matches_at = [&](const Segment& segment, const size_t position) {
+    if (!segment.has_single_char_wildcards) {
+      return string.compare(position, segment.string.size(), segment.string) == 0;
+    }
+    for (auto char_idx = size_t{0}; char_idx < segment.string.size(); ++char_idx) {
+      if (segment.string[char_idx] != '_' && segment.string[char_idx] != string[position + char_idx]) return false;
+    }
+    return true;
+  };
+
+  const auto& first_segment = segments.front();
+  if (string.size() < first_segment.string.size() || !matches_at(first_segment, 0)) return false;
+  if (segments.size() == 1) return string.size() == first_segment.string.size();
+
+  // The part of the string that is left for the segments between the first and the last one
+  auto begin = first_segment.string.size();
+  auto end = string.size();
+
+  const auto& last_segment = segments.back();
+  if (end - begin < last_segment.string.size()) return false;
+  end -= last_segment.string.size();
+  if (!matches_at(last_segment, end)) return false;
+
+  for (auto segment_idx = size_t{1}; segment_idx + 1 < segments.size(); ++segment_idx) {
+    const auto& segment = segments[segment_idx];
+    const auto segment_size = segment.string.size();
+    if (end - begin < segment_size) return false;
+
+    if (segment.search_string.empty()) {
+      // The segment only consists of '_', i.e., it matches any characters
+      begin += segment_size;
+      continue;
+    }
+
+    // Find the leftmost occurrence of the segment's search string (std::string_view::find looks for its first
+    // character with memchr) and check whether the rest of the segment matches around it.
+    auto search_position = begin + segment.search_string_offset;
+    while (true) {
+      search_position = string.find(segment.search_string, search_position);
+      if (search_position == std::string_view::npos) return false;
+
+      const auto segment_position = search_position - segment.search_string_offset;
+      if (segment_position + segment_size > end) return false;
+      if (matches_at(segment, segment_position)) {
+        begin = segment_position + segment_size;
+        break;
+      }
+      ++search_position;
+    }
   }
 
-  return std::string{"^" + sql_like + "$"};
+  return true;
 }
 
 std::ostream& operator<<(std::ostream& stream, const LikeMatcher::Wildcard& wildcard) {
@@ -1,8 +1,8 @@
 #pragma once
 
 #include <experimental/functional>
-#include <regex>
 #include <string>
+#include <string_view>
 #include <variant>
 #include <vector>
 
@@ -15,7 +15,7 @@ namespace opossum {
  * Wraps an SQL LIKE pattern (e.g. "Hello%Wo_ld") which strings can be tested against.
  *
  * Performance optimizations exist for several simple patterns, such as "Hello%" - which is really just a starts_with()
- * check.
+ * check. All other patterns are compiled into a GeneralPattern once, which is matched without backtracking.
  */
 class LikeMatcher {
   // A faster search algorithm than the typical byte-wise search if we can reuse the searcher
@@ -26,11 +26,6 @@ class LikeMatcher {
 #endif
 
  public:
-  /**
-   * Turn SQL LIKE-pattern into a C++ regex.
-   */
-  static std::string sql_like_to_regex(pmr_string sql_like);
-
   static size_t get_index_of_next_wildcard(const pmr_string& pattern, const size_t offset = 0);
   static bool contains_wildcard(const pmr_string& pattern);
 
@@ -48,7 +43,7 @@ class LikeMatcher {
 
   /**
    * To speed up LIKE there are special implementations available for simple, common patterns.
-   * Any other pattern will fall back to regex.
+   * Any other pattern is matched as a GeneralPattern.
    */
   // 'hello%'
   struct StartsWithPattern final {
@@ -66,13 +61,39 @@ class LikeMatcher {
   struct MultipleContainsPattern final {
     std::vector<pmr_string> strings;
   };
+  // 'H_llo%W%ld', or any other pattern
+  struct GeneralPattern final {
+    /**
+     * The pattern is split at its '%' wildcards into segments of a fixed length, which may contain '_' wildcards. The
+     * first and the last segment are anchored to the beginning and the end of the string (as in 'H_llo%' or '%W_ld'),
+     * the segments in between are matched at their leftmost occurrence after the previous segment. As all segments
+     * have a fixed length, the leftmost occurrence never prevents a match of the following segments, so that no
+     * backtracking is needed.
+     */
+    struct Segment {
+      // '_' is kept in place as the wildcard for a single character
+      pmr_string string;
+      bool has_single_char_wildcards{false};
+
+      // The longest substring without '_', which is searched for to find candidate occurrences of the segment
+      size_t search_string_offset{0};
+      pmr_string search_string;
+    };
+
+    explicit GeneralPattern(const pmr_string& pattern);
+
+    bool matches(const std::string_view& string) const;
+
+    // Empty segments between consecutive '%' are dropped, apart from the first and the last one. Patterns without '%'
+    // consist of a single segment that has to match the whole string.
+    std::vector<Segment> segments;
+  };
 
   /**
-   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or falls back to std::regex for a
-   * general pattern.
+   * Contains one of the specialised patterns from above (StartsWithPattern, ...) or a GeneralPattern.
    */
-  using AllPatternVariant =
-      std::variant<std::regex, StartsWithPattern, EndsWithPattern, ContainsPattern, MultipleContainsPattern>;
+  using AllPatternVariant = std::variant<GeneralPattern, StartsWithPattern, EndsWithPattern, ContainsPattern,
+                                         MultipleContainsPattern>;
 
   static AllPatternVariant pattern_string_to_pattern_variant(const pmr_string& pattern);
 
@@ -126,11 +147,10 @@ class LikeMatcher {
         return !invert_results;
       });
 
-    } else if (std::holds_alternative<std::regex>(_pattern_variant)) {
-      const auto& regex = std::get<std::regex>(_pattern_variant);
-
+    } else if (std::holds_alternative<GeneralPattern>(_pattern_variant)) {
+      const auto& general_pattern = std::get<GeneralPattern>(_pattern_variant);
       functor([&](const auto& string) -> bool {
-        return std::regex_match(string.cbegin(), string.cend(), regex) ^ invert_results;
+        return general_pattern.matches(std::string_view{string.data(), string.size()}) ^ invert_results;
       });
 
     } else {
@@ -16,6 +16,7 @@ Hyrise::Hyrise() {
   plugin_manager = PluginManager{};
   storage_manager = StorageManager{};
   transaction_manager = TransactionManager{};
+  log_manager = LogManager{};
   meta_table_manager = MetaTableManager{};
   settings_manager = SettingsManager{};
   topology = Topology{};
@@ -24,6 +25,7 @@ Hyrise::Hyrise() {
 
 void Hyrise::reset() {
   Hyrise::get().scheduler()->finish();
+  Hyrise::get().log_manager.disable();
   get() = Hyrise{};
 }
 
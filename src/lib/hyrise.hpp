@@ -2,6 +2,7 @@
 
 #include "boost/container/pmr/memory_resource.hpp"
 #include "concurrency/transaction_manager.hpp"
+#include "logging/log_manager.hpp"
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/topology.hpp"
 #include "sql/sql_plan_cache.hpp"
@@ -34,6 +35,7 @@ class Hyrise : public Singleton<Hyrise> {
   PluginManager plugin_manager;
   StorageManager storage_manager;
   TransactionManager transaction_manager;
+  LogManager log_manager;
   MetaTableManager meta_table_manager;
   SettingsManager settings_manager;
   Topology topology;
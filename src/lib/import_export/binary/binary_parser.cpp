@@ -1,15 +1,16 @@
 #include "binary_parser.hpp"
 
 #include <cstdint>
-#include <fstream>
+#include <istream>
 #include <memory>
-#include <numeric>
 #include <optional>
 #include <string>
 #include <utility>
 
+#include "binary_writer.hpp"
 #include "constant_mappings.hpp"
 #include "hyrise.hpp"
+#include "import_export/memory_mapped_file.hpp"
 #include "resolve_type.hpp"
 #include "storage/chunk.hpp"
 #include "storage/encoding_type.hpp"
@@ -22,9 +23,11 @@
 namespace opossum {
 
 std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
-  std::ifstream file;
-  file.open(filename, std::ios::binary);
-  file.exceptions(std::ifstream::failbit | std::ifstream::badbit);
+  // The compressed vectors of the table view the mapping, so it lives as long as they do
+  const auto mapped_file = std::make_shared<const MemoryMappedFile>(filename);
+  auto buffer = MemoryStreamBuffer{mapped_file->data(), mapped_file->data() + mapped_file->size(), mapped_file};
+  auto file = std::istream{&buffer};
+  file.exceptions(std::istream::failbit | std::istream::badbit);
 
   auto [table, chunk_count] = _read_header(file);
   for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
@@ -35,7 +38,7 @@ std::shared_ptr<Table> BinaryParser::parse(const std::string& filename) {
 }
 
 template <typename T>
-pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<T> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<T> values(count);
   file.read(reinterpret_cast<char*>(values.data()), values.size() * sizeof(T));
   return values;
@@ -43,42 +46,70 @@ pmr_vector<T> BinaryParser::_read_values(std::ifstream& file, const size_t count
 
 // specialized implementation for string values
 template <>
-pmr_vector<pmr_string> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_values(std::istream& file, const size_t count) {
   return _read_string_values(file, count);
 }
 
 // specialized implementation for bool values
 template <>
-pmr_vector<bool> BinaryParser::_read_values(std::ifstream& file, const size_t count) {
+pmr_vector<bool> BinaryParser::_read_values(std::istream& file, const size_t count) {
   pmr_vector<BoolAsByteType> readable_bools(count);
   file.read(reinterpret_cast<char*>(readable_bools.data()), readable_bools.size() * sizeof(BoolAsByteType));
   return pmr_vector<bool>(readable_bools.begin(), readable_bools.end());
 }
 
-pmr_vector<pmr_string> BinaryParser::_read_string_values(std::ifstream& file, const size_t count) {
+pmr_vector<pmr_string> BinaryParser::_read_string_values(std::istream& file, const size_t count) {
   const auto string_lengths = _read_values<size_t>(file, count);
-  const auto total_length = std::accumulate(string_lengths.cbegin(), string_lengths.cend(), static_cast<size_t>(0));
-  const auto buffer = _read_values<char>(file, total_length);
 
+  // The characters are read into the strings directly instead of through an intermediate buffer for all of them
   pmr_vector<pmr_string> values(count);
-  size_t start = 0;
-
   for (size_t i = 0; i < count; ++i) {
-    values[i] = pmr_string(buffer.data() + start, buffer.data() + start + string_lengths[i]);
-    start += string_lengths[i];
+    values[i].resize(string_lengths[i]);
+    file.read(values[i].data(), static_cast<std::streamsize>(string_lengths[i]));
   }
 
   return values;
 }
 
 template <typename T>
-T BinaryParser::_read_value(std::ifstream& file) {
+T BinaryParser::_read_value(std::istream& file) {
   T result;
   file.read(reinterpret_cast<char*>(&result), sizeof(T));
   return result;
 }
 
-std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstream& file) {
+template <typename T>
+const T* BinaryParser::_view_values(std::istream& file, const size_t count) {
+  auto* const buffer = dynamic_cast<MemoryStreamBuffer*>(file.rdbuf());
+  if (!buffer || !buffer->memory_owner()) return nullptr;
+
+  // The writer aligns the values relative to the beginning of the file (or chunk, for checkpoints). If the buffer does
+  // not start at an aligned address, the values have to be copied.
+  const auto* const position = buffer->view(0);
+  if (reinterpret_cast<uintptr_t>(position) % alignof(T) != 0) return nullptr;
+
+  const auto* const values = buffer->view(count * sizeof(T));
+  Assert(values, "Unexpected end of binary file");
+  return reinterpret_cast<const T*>(values);
+}
+
+void BinaryParser::_skip_padding(std::istream& file) {
+  const auto position = static_cast<size_t>(file.tellg());
+  const auto padding = (BinaryWriter::ALIGNMENT - position % BinaryWriter::ALIGNMENT) % BinaryWriter::ALIGNMENT;
+  file.ignore(static_cast<std::streamsize>(padding));
+  Assert(static_cast<size_t>(file.gcount()) == padding, "Unexpected end of binary file");
+}
+
+std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::istream& file) {
+  const auto format_magic = _read_value<uint32_t>(file);
+  Assert(format_magic == BinaryWriter::FORMAT_MAGIC,
+         "Not a binary table file, or written before the format was versioned. Please re-export the table.");
+  const auto format_version = _read_value<uint32_t>(file);
+  Assert(format_version == BinaryWriter::FORMAT_VERSION,
+         "Unsupported binary format version " + std::to_string(format_version) + ". Please re-export the table.");
+  const auto alignment = _read_value<uint32_t>(file);
+  Assert(alignment == BinaryWriter::ALIGNMENT, "Unsupported alignment of binary file: " + std::to_string(alignment));
+
   const auto chunk_size = _read_value<ChunkOffset>(file);
   const auto chunk_count = _read_value<ChunkID>(file);
   const auto column_count = _read_value<ColumnID>(file);
@@ -92,27 +123,34 @@ std::pair<std::shared_ptr<Table>, ChunkID> BinaryParser::_read_header(std::ifstr
     output_column_definitions.emplace_back(std::string{column_names[column_id]}, data_type,
                                            column_nullables[column_id]);
   }
+  _skip_padding(file);
 
   auto table = std::make_shared<Table>(output_column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 
   return std::make_pair(table, chunk_count);
 }
 
-void BinaryParser::_import_chunk(std::ifstream& file, std::shared_ptr<Table>& table) {
+void BinaryParser::_import_chunk(std::istream& file, std::shared_ptr<Table>& table) {
   const auto row_count = _read_value<ChunkOffset>(file);
-
-  Segments output_segments;
-  for (ColumnID column_id{0}; column_id < table->column_count(); ++column_id) {
-    output_segments.push_back(
-        _import_segment(file, row_count, table->column_data_type(column_id), table->column_is_nullable(column_id)));
-  }
+  const auto output_segments = _import_segments(file, row_count, *table);
+  _skip_padding(file);
 
   const auto mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
   table->append_chunk(output_segments, mvcc_data);
   table->last_chunk()->finalize();
 }
 
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+Segments BinaryParser::_import_segments(std::istream& file, ChunkOffset row_count, const Table& table) {
+  Segments segments;
+  for (ColumnID column_id{0}; column_id < table.column_count(); ++column_id) {
+    segments.push_back(
+        _import_segment(file, row_count, table.column_data_type(column_id), table.column_is_nullable(column_id)));
+  }
+
+  return segments;
+}
+
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
                                                            DataType data_type, bool is_nullable) {
   std::shared_ptr<BaseSegment> result;
   resolve_data_type(data_type, [&](auto type) {
@@ -124,7 +162,7 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
 }
 
 template <typename ColumnDataType>
-std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::istream& file, ChunkOffset row_count,
                                                            bool is_nullable) {
   const auto column_type = _read_value<EncodingType>(file);
 
@@ -151,7 +189,7 @@ std::shared_ptr<BaseSegment> BinaryParser::_import_segment(std::ifstream& file,
 }
 
 template <typename T>
-std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstream& file, ChunkOffset row_count,
+std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                      bool is_nullable) {
   if (is_nullable) {
     auto nullables = _read_values<bool>(file, row_count);
@@ -164,7 +202,7 @@ std::shared_ptr<ValueSegment<T>> BinaryParser::_import_value_segment(std::ifstre
 }
 
 template <typename T>
-std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::ifstream& file,
+std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(std::istream& file,
                                                                                ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto dictionary_size = _read_value<ValueID>(file);
@@ -176,7 +214,7 @@ std::shared_ptr<DictionarySegment<T>> BinaryParser::_import_dictionary_segment(s
 }
 
 template <typename T>
-std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::ifstream& file,
+std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(std::istream& file,
                                                                               ChunkOffset row_count) {
   const auto size = _read_value<uint32_t>(file);
   const auto values = std::make_shared<pmr_vector<T>>(_read_values<T>(file, size));
@@ -187,7 +225,7 @@ std::shared_ptr<RunLengthSegment<T>> BinaryParser::_import_run_length_segment(st
 }
 
 template <typename T>
-std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::ifstream& file,
+std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_reference_segment(std::istream& file,
                                                                                              ChunkOffset row_count) {
   const auto attribute_vector_width = _read_value<AttributeVectorWidth>(file);
   const auto block_count = _read_value<uint32_t>(file);
@@ -200,7 +238,7 @@ std::shared_ptr<FrameOfReferenceSegment<T>> BinaryParser::_import_frame_of_refer
 }
 
 template <typename T>
-std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream& file, ChunkOffset row_count) {
+std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::istream& file, ChunkOffset row_count) {
   const auto num_elements = _read_value<uint32_t>(file);
   const auto block_count = _read_value<uint32_t>(file);
 
@@ -240,8 +278,16 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
     const auto string_offsets_data_size = _read_value<uint32_t>(file);
 
     // so far, only SimdBp128 compression is supported
-    auto string_offsets =
-        std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, string_offsets_data_size), string_offsets_size);
+    _skip_padding(file);
+    auto string_offsets = std::unique_ptr<SimdBp128Vector>{};
+    if (const auto* const data = _view_values<uint128_t>(file, string_offsets_data_size)) {
+      const auto& memory_owner = static_cast<MemoryStreamBuffer*>(file.rdbuf())->memory_owner();
+      string_offsets =
+          std::make_unique<SimdBp128Vector>(data, string_offsets_data_size, string_offsets_size, memory_owner);
+    } else {
+      string_offsets = std::make_unique<SimdBp128Vector>(_read_values<uint128_t>(file, string_offsets_data_size),
+                                                         string_offsets_size);
+    }
 
     return std::make_shared<LZ4Segment<T>>(std::move(lz4_blocks), std::move(null_values), std::move(dictionary),
                                            std::move(string_offsets), block_size, last_block_size, compressed_size,
@@ -258,31 +304,44 @@ std::shared_ptr<LZ4Segment<T>> BinaryParser::_import_lz4_segment(std::ifstream&
 }
 
 std::shared_ptr<BaseCompressedVector> BinaryParser::_import_attribute_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+  _skip_padding(file);
   switch (attribute_vector_width) {
     case 1:
-      return std::make_shared<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint8_t>(file, row_count);
     case 2:
-      return std::make_shared<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint16_t>(file, row_count);
     case 4:
-      return std::make_shared<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
 std::unique_ptr<const BaseCompressedVector> BinaryParser::_import_offset_value_vector(
-    std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+    std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width) {
+  _skip_padding(file);
   switch (attribute_vector_width) {
     case 1:
-      return std::make_unique<FixedSizeByteAlignedVector<uint8_t>>(_read_values<uint8_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint8_t>(file, row_count);
     case 2:
-      return std::make_unique<FixedSizeByteAlignedVector<uint16_t>>(_read_values<uint16_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint16_t>(file, row_count);
     case 4:
-      return std::make_unique<FixedSizeByteAlignedVector<uint32_t>>(_read_values<uint32_t>(file, row_count));
+      return _import_fixed_size_byte_aligned_vector<uint32_t>(file, row_count);
     default:
       Fail("Cannot import attribute vector with width: " + std::to_string(attribute_vector_width));
   }
 }
 
+template <typename UnsignedIntType>
+std::unique_ptr<FixedSizeByteAlignedVector<UnsignedIntType>> BinaryParser::_import_fixed_size_byte_aligned_vector(
+    std::istream& file, const size_t size) {
+  if (const auto* const data = _view_values<UnsignedIntType>(file, size)) {
+    const auto& memory_owner = static_cast<MemoryStreamBuffer*>(file.rdbuf())->memory_owner();
+    return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(data, size, memory_owner);
+  }
+
+  return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(_read_values<UnsignedIntType>(file, size));
+}
+
 }  // namespace opossum
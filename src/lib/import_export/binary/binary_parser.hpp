@@ -1,6 +1,6 @@
 #pragma once
 
-#include <fstream>
+#include <istream>
 #include <memory>
 #include <optional>
 #include <string>
@@ -15,12 +15,18 @@
 #include "storage/run_length_segment.hpp"
 #include "storage/table.hpp"
 #include "storage/value_segment.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 namespace opossum {
 
 /*
  * This parser reads an Opossum binary file and creates a table from that input.
  * Documentation of the file formats can be found in BinaryWriter header file.
+ *
+ * The file is memory-mapped and parsed from the mapping (see MemoryMappedFile). The compressed vectors (attribute
+ * vectors, offset values, and LZ4 string offsets) are not copied but view the mapping, which they keep alive. This is
+ * possible because the writer aligns them to BinaryWriter::ALIGNMENT bytes. All other values (e.g., dictionaries) are
+ * copied once, from the mapping into the segment, as the segments own them in pmr_vectors.
  */
 class BinaryParser {
  public:
@@ -38,12 +44,15 @@ class BinaryParser {
   static std::shared_ptr<Table> parse(const std::string& filename);
 
  private:
+  // Loads the chunks of checkpoints in parallel
+  friend class Checkpoint;
+
   /*
-   * Reads the header from the given file.
+   * Reads the header from the given file and checks that its format version is supported.
    * Creates an empty table from the extracted information and
    * returns that table and the number of chunks.
    */
-  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::ifstream& file);
+  static std::pair<std::shared_ptr<Table>, ChunkID> _read_header(std::istream& file);
 
   /*
    * Creates a chunk from chunk information from the given file and adds it to the given table.
@@ -57,48 +66,64 @@ class BinaryParser {
    *
    * ¹Number of columns is provided in the binary header
    */
-  static void _import_chunk(std::ifstream& file, std::shared_ptr<Table>& table);
+  static void _import_chunk(std::istream& file, std::shared_ptr<Table>& table);
+
+  // Reads the segments of a chunk (i.e., the part after the row count) for all columns of the given table
+  static Segments _import_segments(std::istream& file, ChunkOffset row_count, const Table& table);
 
   // Calls the right _import_column<ColumnDataType> depending on the given data_type.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, DataType data_type,
+  static std::shared_ptr<BaseSegment> _import_segment(std::istream& file, ChunkOffset row_count, DataType data_type,
                                                       bool is_nullable);
 
   template <typename ColumnDataType>
   // Reads the column type from the given file and chooses a segment import function from it.
-  static std::shared_ptr<BaseSegment> _import_segment(std::ifstream& file, ChunkOffset row_count, bool is_nullable);
+  static std::shared_ptr<BaseSegment> _import_segment(std::istream& file, ChunkOffset row_count, bool is_nullable);
 
   template <typename T>
-  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<ValueSegment<T>> _import_value_segment(std::istream& file, ChunkOffset row_count,
                                                                 bool is_nullable);
   template <typename T>
-  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<DictionarySegment<T>> _import_dictionary_segment(std::istream& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<RunLengthSegment<T>> _import_run_length_segment(std::istream& file, ChunkOffset row_count);
 
   template <typename T>
-  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::ifstream& file,
+  static std::shared_ptr<FrameOfReferenceSegment<T>> _import_frame_of_reference_segment(std::istream& file,
                                                                                         ChunkOffset row_count);
   template <typename T>
-  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::ifstream& file, ChunkOffset row_count);
+  static std::shared_ptr<LZ4Segment<T>> _import_lz4_segment(std::istream& file, ChunkOffset row_count);
 
   // Calls the _import_attribute_vector<uintX_t> function that corresponds to the given attribute_vector_width.
-  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::ifstream& file, ChunkOffset row_count,
+  static std::shared_ptr<BaseCompressedVector> _import_attribute_vector(std::istream& file, ChunkOffset row_count,
                                                                         AttributeVectorWidth attribute_vector_width);
 
   static std::unique_ptr<const BaseCompressedVector> _import_offset_value_vector(
-      std::ifstream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+      std::istream& file, ChunkOffset row_count, AttributeVectorWidth attribute_vector_width);
+
+  // Views `size` values in the mapped file if possible and reads them otherwise.
+  template <typename UnsignedIntType>
+  static std::unique_ptr<FixedSizeByteAlignedVector<UnsignedIntType>> _import_fixed_size_byte_aligned_vector(
+      std::istream& file, const size_t size);
+
+  // Returns a pointer to the next count values in the file and skips them if the file is backed by memory that can be
+  // viewed (see MemoryStreamBuffer::memory_owner) and the values are aligned. Otherwise, returns nullptr.
+  template <typename T>
+  static const T* _view_values(std::istream& file, const size_t count);
+
+  // Skips the padding that the writer inserted to align the next value to BinaryWriter::ALIGNMENT bytes
+  static void _skip_padding(std::istream& file);
 
   // Reads row_count many values from type T and returns them in a vector
   template <typename T>
-  static pmr_vector<T> _read_values(std::ifstream& file, const size_t count);
+  static pmr_vector<T> _read_values(std::istream& file, const size_t count);
 
   // Reads row_count many strings from input file. String lengths are encoded in type T.
-  static pmr_vector<pmr_string> _read_string_values(std::ifstream& file, const size_t count);
+  static pmr_vector<pmr_string> _read_string_values(std::istream& file, const size_t count);
 
   // Reads a single value of type T from the input file.
   template <typename T>
-  static T _read_value(std::ifstream& file);
+  static T _read_value(std::istream& file);
 };
 
 }  // namespace opossum
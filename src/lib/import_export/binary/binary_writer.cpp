@@ -1,6 +1,8 @@
 #include "binary_writer.hpp"
 
+#include <array>
 #include <cstring>
+#include <filesystem>
 #include <fstream>
 #include <memory>
 #include <string>
@@ -20,18 +22,18 @@ namespace {
 
 using namespace opossum;  // NOLINT
 
-// Writes the content of the vector to the ofstream
+// Writes the content of the vector to the stream
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values);
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values);
 
-/* Writes the given strings to the ofstream. First an array of string lengths is written. After that the strings are
+/* Writes the given strings to the stream. First an array of string lengths is written. After that the strings are
  * written without any gaps between them.
  * In order to reduce the number of memory allocations we iterate twice over the string vector.
  * After the first iteration we know the number of byte that must be written to the file and can construct a buffer of
  * this size.
  * This approach is indeed faster than a dynamic approach with a stringstream.
  */
-void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
+void export_string_values(std::ostream& stream, const pmr_vector<pmr_string>& values) {
   pmr_vector<size_t> string_lengths(values.size());
   size_t total_length = 0;
 
@@ -41,7 +43,7 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     total_length += values[i].size();
   }
 
-  export_values(ofstream, string_lengths);
+  export_values(stream, string_lengths);
 
   // We do not have to iterate over values if all strings are empty.
   if (total_length == 0) return;
@@ -54,32 +56,38 @@ void export_string_values(std::ofstream& ofstream, const pmr_vector<pmr_string>&
     start += str.size();
   }
 
-  export_values(ofstream, buffer);
+  export_values(stream, buffer);
 }
 
 template <typename T, typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<T, Alloc>& values) {
-  ofstream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+void export_values(std::ostream& stream, const std::vector<T, Alloc>& values) {
+  stream.write(reinterpret_cast<const char*>(values.data()), values.size() * sizeof(T));
+}
+
+// Writes `count` values, e.g., of a compressed vector
+template <typename T>
+void export_values(std::ostream& stream, const T* values, const size_t count) {
+  stream.write(reinterpret_cast<const char*>(values), count * sizeof(T));
 }
 
 // specialized implementation for string values
 template <>
-void export_values(std::ofstream& ofstream, const pmr_vector<pmr_string>& values) {
-  export_string_values(ofstream, values);
+void export_values(std::ostream& stream, const pmr_vector<pmr_string>& values) {
+  export_string_values(stream, values);
 }
 
 // specialized implementation for bool values
 template <typename Alloc>
-void export_values(std::ofstream& ofstream, const std::vector<bool, Alloc>& values) {
+void export_values(std::ostream& stream, const std::vector<bool, Alloc>& values) {
   // Cast to fixed-size format used in binary file
   const auto writable_bools = pmr_vector<BoolAsByteType>(values.begin(), values.end());
-  export_values(ofstream, writable_bools);
+  export_values(stream, writable_bools);
 }
 
-// Writes a shallow copy of the given value to the ofstream
+// Writes a shallow copy of the given value to the stream
 template <typename T>
-void export_value(std::ofstream& ofstream, const T& value) {
-  ofstream.write(reinterpret_cast<const char*>(&value), sizeof(T));
+void export_value(std::ostream& stream, const T& value) {
+  stream.write(reinterpret_cast<const char*>(&value), sizeof(T));
 }
 
 }  // namespace
@@ -87,22 +95,34 @@ void export_value(std::ofstream& ofstream, const T& value) {
 namespace opossum {
 
 void BinaryWriter::write(const Table& table, const std::string& filename) {
-  std::ofstream ofstream;
-  ofstream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
-  ofstream.open(filename, std::ios::binary);
-
-  _write_header(table, ofstream);
-
-  for (ChunkID chunk_id{0}; chunk_id < table.chunk_count(); chunk_id++) {
-    _write_chunk(table, ofstream, chunk_id);
+  const auto temporary_filename = filename + ".tmp";
+  {
+    std::ofstream stream;
+    stream.exceptions(std::ofstream::failbit | std::ofstream::badbit);
+    stream.open(temporary_filename, std::ios::binary);
+
+    const auto chunk_count = table.chunk_count();
+    _write_header(table, chunk_count, stream);
+
+    for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
+      const auto chunk = table.get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      _write_chunk(*chunk, stream);
+    }
   }
+
+  std::filesystem::rename(temporary_filename, filename);
 }
 
-void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
+void BinaryWriter::_write_header(const Table& table, const ChunkID chunk_count, std::ostream& stream) {
+  export_value(stream, FORMAT_MAGIC);
+  export_value(stream, FORMAT_VERSION);
+  export_value(stream, ALIGNMENT);
+
   const auto target_chunk_size = table.type() == TableType::Data ? table.target_chunk_size() : Chunk::DEFAULT_SIZE;
-  export_value(ofstream, static_cast<ChunkOffset>(target_chunk_size));
-  export_value(ofstream, static_cast<ChunkID::base_type>(table.chunk_count()));
-  export_value(ofstream, static_cast<ColumnID::base_type>(table.column_count()));
+  export_value(stream, static_cast<ChunkOffset>(target_chunk_size));
+  export_value(stream, static_cast<ChunkID::base_type>(chunk_count));
+  export_value(stream, static_cast<ColumnID::base_type>(table.column_count()));
 
   pmr_vector<pmr_string> column_types(table.column_count());
   pmr_vector<pmr_string> column_names(table.column_count());
@@ -114,42 +134,44 @@ void BinaryWriter::_write_header(const Table& table, std::ofstream& ofstream) {
     column_names[column_id] = table.column_name(column_id);
     columns_are_nullable[column_id] = table.column_is_nullable(column_id);
   }
-  export_values(ofstream, column_types);
-  export_values(ofstream, columns_are_nullable);
-  export_string_values(ofstream, column_names);
+  export_values(stream, column_types);
+  export_values(stream, columns_are_nullable);
+  export_string_values(stream, column_names);
+
+  _write_padding(stream);
 }
 
-void BinaryWriter::_write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id) {
-  const auto chunk = table.get_chunk(chunk_id);
-  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-  export_value(ofstream, static_cast<ChunkOffset>(chunk->size()));
+void BinaryWriter::_write_chunk(const Chunk& chunk, std::ostream& stream) {
+  export_value(stream, static_cast<ChunkOffset>(chunk.size()));
 
   // Iterating over all segments of this chunk and exporting them
-  for (ColumnID column_id{0}; column_id < chunk->column_count(); column_id++) {
+  for (ColumnID column_id{0}; column_id < chunk.column_count(); column_id++) {
     resolve_data_and_segment_type(
-        *chunk->get_segment(column_id),
-        [&](const auto data_type_t, const auto& resolved_segment) { _write_segment(resolved_segment, ofstream); });
+        *chunk.get_segment(column_id),
+        [&](const auto data_type_t, const auto& resolved_segment) { _write_segment(resolved_segment, stream); });
   }
+
+  _write_padding(stream);
 }
 
-void BinaryWriter::_write_segment(const BaseSegment& base_segment, std::ofstream& ofstream) {
+void BinaryWriter::_write_segment(const BaseSegment& base_segment, std::ostream& stream) {
   Fail("Binary export for segment type is not supported yet.");
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::Unencoded);
+void BinaryWriter::_write_segment(const ValueSegment<T>& value_segment, std::ostream& stream) {
+  export_value(stream, EncodingType::Unencoded);
 
   if (value_segment.is_nullable()) {
-    export_values(ofstream, value_segment.null_values());
+    export_values(stream, value_segment.null_values());
   }
 
-  export_values(ofstream, value_segment.values());
+  export_values(stream, value_segment.values());
 }
 
-void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream) {
+void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std::ostream& stream) {
   // We materialize reference segments and save them as value segments
-  export_value(ofstream, EncodingType::Unencoded);
+  export_value(stream, EncodingType::Unencoded);
 
   if (reference_segment.size() == 0) return;
   resolve_data_type(reference_segment.data_type(), [&](auto type) {
@@ -166,141 +188,139 @@ void BinaryWriter::_write_segment(const ReferenceSegment& reference_segment, std
         values << value.value();
       });
 
-      export_values(ofstream, string_lengths);
-      ofstream << values.rdbuf();
+      export_values(stream, string_lengths);
+      stream << values.rdbuf();
 
     } else {
       // Unfortunately, we have to iterate over all values of the reference segment
       // to materialize its contents. Then we can write them to the file
-      iterable.for_each([&](const auto& value) { export_value(ofstream, value.value()); });
+      iterable.for_each([&](const auto& value) { export_value(stream, value.value()); });
     }
   });
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream) {
+void BinaryWriter::_write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& stream) {
   Assert(dictionary_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
   Assert(is_fixed_size_byte_aligned(*dictionary_segment.compressed_vector_type()),
          "Does only support fixed-size byte-aligned compressed attribute vectors.");
-  export_value(ofstream, EncodingType::Dictionary);
+  export_value(stream, EncodingType::Dictionary);
 
   // Write attribute vector width
   const auto attribute_vector_width = _compressed_vector_width<T>(dictionary_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(attribute_vector_width));
+  export_value(stream, static_cast<AttributeVectorWidth>(attribute_vector_width));
 
   // Write the dictionary size and dictionary
-  export_value(ofstream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
-  export_values(ofstream, *dictionary_segment.dictionary());
+  export_value(stream, static_cast<ValueID::base_type>(dictionary_segment.dictionary()->size()));
+  export_values(stream, *dictionary_segment.dictionary());
 
   // Write attribute vector
   Assert(dictionary_segment.compressed_vector_type(),
          "Expected DictionarySegment to use vector compression for attribute vector");
-  _export_compressed_vector(ofstream, *dictionary_segment.compressed_vector_type(),
+  _export_compressed_vector(stream, *dictionary_segment.compressed_vector_type(),
                             *dictionary_segment.attribute_vector());
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::RunLength);
+void BinaryWriter::_write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& stream) {
+  export_value(stream, EncodingType::RunLength);
 
   // Write size and values
-  export_value(ofstream, static_cast<uint32_t>(run_length_segment.values()->size()));
-  export_values(ofstream, *run_length_segment.values());
+  export_value(stream, static_cast<uint32_t>(run_length_segment.values()->size()));
+  export_values(stream, *run_length_segment.values());
 
   // Write NULL values
-  export_values(ofstream, *run_length_segment.null_values());
+  export_values(stream, *run_length_segment.null_values());
 
   // Write end positions
-  export_values(ofstream, *run_length_segment.end_positions());
+  export_values(stream, *run_length_segment.end_positions());
 }
 
 template <>
 void BinaryWriter::_write_segment(const FrameOfReferenceSegment<int32_t>& frame_of_reference_segment,
-                                  std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::FrameOfReference);
+                                  std::ostream& stream) {
+  export_value(stream, EncodingType::FrameOfReference);
 
   // Write attribute vector width
   const auto offset_value_vector_width = _compressed_vector_width<int32_t>(frame_of_reference_segment);
-  export_value(ofstream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
+  export_value(stream, static_cast<AttributeVectorWidth>(offset_value_vector_width));
 
   // Write number of blocks and block minima
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
-  export_values(ofstream, frame_of_reference_segment.block_minima());
+  export_value(stream, static_cast<uint32_t>(frame_of_reference_segment.block_minima().size()));
+  export_values(stream, frame_of_reference_segment.block_minima());
 
   // Write length of the NULL and offset value vectors (i.e., size of segment)
-  export_value(ofstream, static_cast<uint32_t>(frame_of_reference_segment.null_values().size()));
+  export_value(stream, static_cast<uint32_t>(frame_of_reference_segment.null_values().size()));
 
   // Write NULL values
-  export_values(ofstream, frame_of_reference_segment.null_values());
+  export_values(stream, frame_of_reference_segment.null_values());
 
   // Write offset values
   Assert(frame_of_reference_segment.compressed_vector_type(),
          "Expected FrameOfReference to use vector compression for offset values");
-  _export_compressed_vector(ofstream, *frame_of_reference_segment.compressed_vector_type(),
+  _export_compressed_vector(stream, *frame_of_reference_segment.compressed_vector_type(),
                             frame_of_reference_segment.offset_values());
 }
 
 template <typename T>
-void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream) {
-  export_value(ofstream, EncodingType::LZ4);
+void BinaryWriter::_write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& stream) {
+  export_value(stream, EncodingType::LZ4);
 
   // Write num elements (rows in segment)
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.size()));
+  export_value(stream, static_cast<uint32_t>(lz4_segment.size()));
 
   // Write number of blocks
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
+  export_value(stream, static_cast<uint32_t>(lz4_segment.lz4_blocks().size()));
 
   if (lz4_segment.lz4_blocks().empty()) {
     // No blocks at all: write just last block size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(stream, uint32_t{0});
   } else {
     // if more than one block, write decompressed block size
     if (lz4_segment.lz4_blocks().size() > 1) {
-      export_value(ofstream, static_cast<uint32_t>(lz4_segment.block_size()));
+      export_value(stream, static_cast<uint32_t>(lz4_segment.block_size()));
     }
     // Write last decompressed block size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.last_block_size()));
+    export_value(stream, static_cast<uint32_t>(lz4_segment.last_block_size()));
   }
 
   // Write compressed size for each LZ4 Block
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_value(ofstream, static_cast<uint32_t>(lz4_block.size()));
+    export_value(stream, static_cast<uint32_t>(lz4_block.size()));
   }
 
   // Write LZ4 Blocks
   for (const auto& lz4_block : lz4_segment.lz4_blocks()) {
-    export_values(ofstream, lz4_block);
+    export_values(stream, lz4_block);
   }
 
   if (lz4_segment.null_values()) {
     // Write NULL value size
-    export_value(ofstream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
+    export_value(stream, static_cast<uint32_t>(lz4_segment.null_values()->size()));
     // Write NULL values
-    export_values(ofstream, *lz4_segment.null_values());
+    export_values(stream, *lz4_segment.null_values());
   } else {
     // No NULL values
-    export_value(ofstream, uint32_t{0});
+    export_value(stream, uint32_t{0});
   }
 
   // Write dictionary size
-  export_value(ofstream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
+  export_value(stream, static_cast<uint32_t>(lz4_segment.dictionary().size()));
 
   // Write dictionary
-  export_values(ofstream, lz4_segment.dictionary());
+  export_values(stream, lz4_segment.dictionary());
 
   if (lz4_segment.string_offsets() && *lz4_segment.string_offsets()) {
     // Write string_offset size
-    export_value(ofstream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
+    export_value(stream, static_cast<uint32_t>((*lz4_segment.string_offsets())->size()));
     // Write string_offset data_size
-    export_value(ofstream,
-                 static_cast<uint32_t>(
-                     dynamic_cast<const SimdBp128Vector&>(*lz4_segment.string_offsets().value()).data().size()));
+    export_value(stream, static_cast<uint32_t>((*lz4_segment.string_offsets())->data_size() / sizeof(uint128_t)));
     // Write string offsets
-    _export_compressed_vector(ofstream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
+    _export_compressed_vector(stream, *lz4_segment.compressed_vector_type(), *lz4_segment.string_offsets().value());
   } else {
     // Write string_offset size = 0
-    export_value(ofstream, uint32_t{0});
+    export_value(stream, uint32_t{0});
   }
 }
 
@@ -326,26 +346,39 @@ uint32_t BinaryWriter::_compressed_vector_width(const BaseEncodedSegment& base_e
   return vector_width;
 }
 
-void BinaryWriter::_export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+void BinaryWriter::_export_compressed_vector(std::ostream& stream, const CompressedVectorType type,
                                              const BaseCompressedVector& compressed_vector) {
+  _write_padding(stream);
+
   switch (type) {
     case CompressedVectorType::FixedSize4ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint32_t>&>(compressed_vector).data(),
+                    compressed_vector.size());
       return;
     case CompressedVectorType::FixedSize2ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint16_t>&>(compressed_vector).data(),
+                    compressed_vector.size());
       return;
     case CompressedVectorType::FixedSize1ByteAligned:
-      export_values(ofstream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data());
+      export_values(stream, dynamic_cast<const FixedSizeByteAlignedVector<uint8_t>&>(compressed_vector).data(),
+                    compressed_vector.size());
       return;
     case CompressedVectorType::SimdBp128:
-      export_values(ofstream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data());
+      export_values(stream, dynamic_cast<const SimdBp128Vector&>(compressed_vector).data(),
+                    compressed_vector.data_size() / sizeof(uint128_t));
       return;
     default:
       Fail("Any other type should have been caught before.");
   }
 }
 
+void BinaryWriter::_write_padding(std::ostream& stream) {
+  const auto position = static_cast<size_t>(stream.tellp());
+  const auto padding = (ALIGNMENT - position % ALIGNMENT) % ALIGNMENT;
+  const auto zeros = std::array<char, ALIGNMENT>{};
+  stream.write(zeros.data(), static_cast<std::streamsize>(padding));
+}
+
 template <typename T>
 size_t BinaryWriter::_size(const T& object) {
   return sizeof(object);
@@ -19,14 +19,36 @@ enum class CompressedVectorType : uint8_t;
 
 class BinaryWriter {
  public:
+  /**
+   * Writes the table to the given file. The file is written to a temporary file first and then renamed, so that tables
+   * that were loaded from a previous version of the file and still view its mapping (see BinaryParser) are not
+   * affected.
+   */
   static void write(const Table& table, const std::string& filename);
 
+  // Identifies binary table files. Files written before the format was versioned do not start with it.
+  static constexpr auto FORMAT_MAGIC = uint32_t{0x42525948};  // "HYRB"
+
+  // Incremented whenever the layout changes. Files of other versions are rejected by the BinaryParser.
+  static constexpr auto FORMAT_VERSION = uint32_t{2};
+
+  // The header, every chunk, and the payload of every compressed vector (i.e., attribute vectors, offset values, and
+  // string offsets) are padded with zeros so that they start at a multiple of ALIGNMENT bytes from the beginning of
+  // the file. Thus, the compressed vectors can be used in place when the file is memory-mapped.
+  static constexpr auto ALIGNMENT = uint32_t{64};
+
  private:
+  // Writes the chunks of checkpoints in parallel
+  friend class Checkpoint;
+
   /**
-   * This methods writes the header of this table into the given ofstream.
+   * This methods writes the header of this table into the given stream.
    *
    * Description           | Type                                  | Size in bytes
    * -----------------------------------------------------------------------------------------
+   * Format magic          | uint32_t (FORMAT_MAGIC)               |   4
+   * Format version        | uint32_t (FORMAT_VERSION)             |   4
+   * Alignment             | uint32_t (ALIGNMENT)                  |   4
    * Chunk size            | ChunkOffset                           |   4
    * Chunk count           | ChunkID                               |   4
    * Column count          | ColumnID                              |   2
@@ -34,14 +56,16 @@ class BinaryWriter {
    * Column nullable       | bool (stored as BoolAsByteType)       |   Column Count * 1
    * Column name lengths   | size_t array                          |   Column Count * 1
    * Column names          | std::string array                     |   Sum of lengths of all names
+   * Padding               | char                                  |   Up to ALIGNMENT - 1
    *
    * @param table The table that is to be exported
-   * @param ofstream The output stream for exporting
+   * @param chunk_count The number of chunks that are written after the header
+   * @param stream The output stream for exporting
    */
-  static void _write_header(const Table& table, std::ofstream& ofstream);
+  static void _write_header(const Table& table, const ChunkID chunk_count, std::ostream& stream);
 
   /**
-   * Writes the contents of the chunk into the given ofstream.
+   * Writes the contents of the chunk into the given stream.
    * First, it creates a chunk header with the following contents:
    *
    * Description           | Type                                  | Size in bytes
@@ -50,15 +74,15 @@ class BinaryWriter {
    *
    * Next, it dumps the contents of the segments in the respective format (depending on the type
    * of the segment, such as ValueSegment, ReferenceSegment, DictionarySegment, RunLengthSegment).
+   * Finally, the chunk is padded to a multiple of ALIGNMENT bytes.
    *
-   * @param table The table we are currently exporting
-   * @param ofstream The output stream to write to
-   * @param chunkId The id of the chunk that is to be worked on now
+   * @param chunk The chunk that is to be worked on now
+   * @param stream The output stream to write to
    *
    */
-  static void _write_chunk(const Table& table, std::ofstream& ofstream, const ChunkID& chunk_id);
+  static void _write_chunk(const Chunk& chunk, std::ostream& stream);
 
-  [[noreturn]] static void _write_segment(const BaseSegment& base_segment, std::ofstream& ofstream);
+  [[noreturn]] static void _write_segment(const BaseSegment& base_segment, std::ostream& stream);
 
   /**
    * Value Segments are dumped with the following layout:
@@ -79,11 +103,11 @@ class BinaryWriter {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param value_segment The segment to export
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    *
    */
   template <typename T>
-  static void _write_segment(const ValueSegment<T>& value_segment, std::ofstream& ofstream);
+  static void _write_segment(const ValueSegment<T>& value_segment, std::ostream& stream);
 
   /**
    * Reference Segments are dumped with the following layout, which is similar to value segments:
@@ -102,9 +126,9 @@ class BinaryWriter {
    * °: This field is writen if the type of the column is NOT a string
    *
    * @param reference_segment The segment to export
-   * @param base_context A context in the form of an ExportContext. Contains a reference to the ofstream.
+   * @param base_context A context in the form of an ExportContext. Contains a reference to the stream.
    */
-  static void _write_segment(const ReferenceSegment& reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const ReferenceSegment& reference_segment, std::ostream& stream);
 
   /**
    * Dictionary Segments are dumped with the following layout:
@@ -117,6 +141,7 @@ class BinaryWriter {
    * Dictionary Values°    | T (int, float, double, long)          |   dict. size * sizeof(T)
    * Dict. String Length^  | size_t                                |   dict. size * 2
    * Dictionary Values^    | std::string                           |   Sum of all string lengths
+   * Padding               | char                                  |   Up to ALIGNMENT - 1
    * Attribute v. values   | uintX                                 |   rows * width of attribute v.
    *
    * Please note that the number of rows are written in the header of the chunk.
@@ -126,10 +151,10 @@ class BinaryWriter {
    * °: This field is written if the type of the column is NOT a string
    *
    * @param base_dictionary_segment The segment to export
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
   template <typename T>
-  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ofstream& ofstream);
+  static void _write_segment(const DictionarySegment<T>& dictionary_segment, std::ostream& stream);
 
   /**
    * RunLength Segments are dumped with the following layout:
@@ -147,10 +172,10 @@ class BinaryWriter {
    *
    *
    * @param run_length_segment The segment to export
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
   template <typename T>
-  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ofstream& ofstream);
+  static void _write_segment(const RunLengthSegment<T>& run_length_segment, std::ostream& stream);
 
   /**
    * FrameOfReference Segments are dumped with the following layout:
@@ -163,17 +188,18 @@ class BinaryWriter {
    * Block minima           | T                                     |   Number of Blocks * sizeof(T)
    * Size                   | uint32_t                              |   4
    * NULL values            | vector<bool> (BoolAsByteType)         |   size * 1
-   * Offset values          | uint32_t                              |   size * 4
+   * Padding                | char                                  |   Up to ALIGNMENT - 1
+   * Offset values          | uintX                                 |   size * width of offset v.
    *
    * Please note that the number of rows are written in the header of the chunk.
    * The type of the column can be found in the global header of the file.
    *
    *
    * @param frame_of_reference_segment The segment to export
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
   template <typename T>
-  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ofstream& ofstream);
+  static void _write_segment(const FrameOfReferenceSegment<T>& frame_of_reference_segment, std::ostream& stream);
 
   /**
    * LZ4 Segments are dumped with the following layout:
@@ -193,7 +219,8 @@ class BinaryWriter {
    * Dictionary              | vector<char>                          |   dictionary size * 1
    * string offset size      | uint32_t                              |   4
    * string offset data size³| uint32_t                              |   4
-   * string offset³          | uint32_t                              |   size * 4
+   * Padding³                | char                                  |   Up to ALIGNMENT - 1
+   * string offset³          | uint128_t (SimdBp128Vector)           |   string offset data size * 16
 
    *
    * Please note that the number of rows are written in the header of the chunk.
@@ -205,18 +232,21 @@ class BinaryWriter {
    * ³: These fields are only written if string offset size is not 0
    *
    * @param lz4_segment The segment to export
-   * @param ofstream The output stream for exporting
+   * @param stream The output stream for exporting
    */
   template <typename T>
-  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ofstream& ofstream);
+  static void _write_segment(const LZ4Segment<T>& lz4_segment, std::ostream& stream);
 
   template <typename T>
   static uint32_t _compressed_vector_width(const BaseEncodedSegment& base_encoded_segment);
 
-  // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it.
-  static void _export_compressed_vector(std::ofstream& ofstream, const CompressedVectorType type,
+  // Chooses the right Compressed Vector depending on the CompressedVectorType and exports it, preceded by padding.
+  static void _export_compressed_vector(std::ostream& stream, const CompressedVectorType type,
                                         const BaseCompressedVector& compressed_vector);
 
+  // Pads the stream with zeros to the next multiple of ALIGNMENT. The stream has to start at such a multiple, too.
+  static void _write_padding(std::ostream& stream);
+
   template <typename T>
   static size_t _size(const T& object);
 };
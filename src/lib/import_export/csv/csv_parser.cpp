@@ -1,8 +1,12 @@
 #include "csv_parser.hpp"
 
-#include <fstream>
-#include <list>
+#include <algorithm>
+#include <array>
+#include <cstdint>
+#include <filesystem>
+#include <iterator>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
@@ -13,16 +17,88 @@
 #include "hyrise.hpp"
 #include "import_export/csv/csv_converter.hpp"
 #include "import_export/csv/csv_meta.hpp"
+#include "import_export/memory_mapped_file.hpp"
 #include "resolve_type.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "utils/assert.hpp"
 #include "utils/load_table.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The csv content is scanned in words of 64 characters. For each word, the positions of the characters that separate
+// rows and fields are stored as bitmasks, in which bit i refers to the i-th character of the word.
+constexpr auto WORD_SIZE = size_t{64};
+
+struct WordMasks {
+  uint64_t delimiters{0};
+  uint64_t separators{0};
+  // Quotes that toggle the quote state, i.e., quotes that are not escaped
+  uint64_t quotes{0};
+};
+
+WordMasks find_characters(const std::string_view csv_content, const size_t word_begin, const ParseConfig& config) {
+  const auto* word = csv_content.data() + word_begin;
+
+  // The last word is padded with null characters, so that all words are scanned by the same vectorized loop
+  auto padded_word = std::array<char, WORD_SIZE>{};
+  if (word_begin + WORD_SIZE > csv_content.size()) {
+    std::copy(word, csv_content.data() + csv_content.size(), padded_word.begin());
+    word = padded_word.data();
+  }
+
+  auto delimiters = uint64_t{0};
+  auto separators = uint64_t{0};
+  auto quotes = uint64_t{0};
+  auto escapes = uint64_t{0};
+
+  // We only use the compiler pragmas of OpenMP (-fopenmp-simd), not its runtime.
+  // NOLINTNEXTLINE
+  {}  // clang-format off
+  #pragma omp simd reduction(|:delimiters, separators, quotes, escapes) safelen(WORD_SIZE)
+  // clang-format on
+  for (auto index = size_t{0}; index < WORD_SIZE; ++index) {
+    const auto character = word[index];
+    delimiters |= static_cast<uint64_t>(character == config.delimiter) << index;
+    separators |= static_cast<uint64_t>(character == config.separator) << index;
+    quotes |= static_cast<uint64_t>(character == config.quote) << index;
+    escapes |= static_cast<uint64_t>(character == config.escape) << index;
+  }
+
+  // A quote is escaped if it is preceded by the escape character, unless both are the same character (as in RFC 4180,
+  // where an escaped quote toggles the quote state twice)
+  if (config.quote != config.escape) {
+    const auto preceded_by_escape = word_begin > 0 && csv_content[word_begin - 1] == config.escape;
+    quotes &= ~((escapes << 1) | static_cast<uint64_t>(preceded_by_escape));
+  }
+
+  return WordMasks{delimiters, separators, quotes};
+}
+
+// Returns a mask of the characters of a word that are in quotes, given the quotes of the word and whether the word
+// begins in quotes. Each bit is the parity of the quotes up to and including its character (i.e., a prefix XOR).
+uint64_t quoted_characters(uint64_t quotes, const bool begins_in_quotes) {
+  quotes ^= quotes << 1;
+  quotes ^= quotes << 2;
+  quotes ^= quotes << 4;
+  quotes ^= quotes << 8;
+  quotes ^= quotes << 16;
+  quotes ^= quotes << 32;
+  return begins_in_quotes ? ~quotes : quotes;
+}
+
+bool ends_in_quotes(const uint64_t quoted) { return (quoted >> (WORD_SIZE - 1)) != 0; }
+
+}  // namespace
+
 namespace opossum {
 
 std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const ChunkOffset chunk_size,
-                                        const std::optional<CsvMeta>& csv_meta) {
+                                        const std::optional<CsvMeta>& csv_meta,
+                                        const std::optional<ChunkEncodingSpec>& encoding_spec) {
   // If no meta info is given as a parameter, look for a json file
   CsvMeta meta;
   if (csv_meta == std::nullopt) {
@@ -34,54 +110,55 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
   auto escaped_linebreak = std::string(1, meta.config.delimiter_escape) + std::string(1, meta.config.delimiter);
 
   auto table = _create_table_from_meta(chunk_size, meta);
+  Assert(!encoding_spec || encoding_spec->size() == static_cast<size_t>(table->column_count()),
+         "Number of column encoding specs must match the table's column count.");
+
+  if (!std::filesystem::exists(filename)) return table;
 
-  std::ifstream csvfile{filename};
+  const auto csv_file = MemoryMappedFile{filename};
+  const auto content = std::string_view{csv_file.data(), csv_file.size()};
 
   // return empty table if input file is empty
-  if (!csvfile || csvfile.peek() == EOF || csvfile.peek() == '\r' || csvfile.peek() == '\n') return table;
+  if (content.empty() || content.front() == '\r' || content.front() == '\n') return table;
 
-  {
-    std::string line;
-    std::getline(csvfile, line);
-    Assert(line.find('\r') == std::string::npos, "Windows encoding is not supported, use dos2unix");
-  }
-
-  /**
-   * Load the whole file(!) into a std::string using the, hopefully, fastest method to do so.
-   * TODO(anybody) Maybe use mmap() in the future. The current approach needs to have the entire file in RAM, mmap might
-   *               be cleverer, dunno.
-   */
-  csvfile.seekg(0, std::ios::end);
-  const auto csvfile_size = csvfile.tellg();
-  std::string content(csvfile_size, ' ');
-  csvfile.seekg(0);
-  csvfile.read(content.data(), csvfile_size);
-
-  // make sure content ends with a delimiter for better row processing later
-  if (content.back() != meta.config.delimiter) content.push_back(meta.config.delimiter);
-
-  std::string_view content_view{content.c_str(), content.size()};
-
-  // Save chunks in list to avoid memory relocation
-  std::list<Segments> segments_by_chunks;
-  std::vector<std::shared_ptr<AbstractTask>> tasks;
-  std::vector<size_t> field_ends;
-  std::mutex append_chunk_mutex;
-  while (_find_fields_in_chunk(content_view, *table, field_ends, meta)) {
-    // create empty chunk
-    segments_by_chunks.emplace_back();
-    auto& segments = segments_by_chunks.back();
+  Assert(content.substr(0, content.find('\n')).find('\r') == std::string_view::npos,
+         "Windows encoding is not supported, use dos2unix");
+
+  const auto blocks = _scan_blocks(content, meta);
 
-    // Only pass the part of the string that is actually needed to the parsing task
-    std::string_view relevant_content = content_view.substr(0, field_ends.back());
+  // The last row does not need to be terminated by a delimiter
+  auto row_count = blocks.back().first_row_end +
+                   blocks.back().row_end_count_by_begins_in_quotes[blocks.back().begins_in_quotes];
+  if (content.back() != meta.config.delimiter) ++row_count;
 
-    // Remove processed part of the csv content
-    content_view = content_view.substr(field_ends.back() + 1);
+  const auto target_chunk_size = table->target_chunk_size();
+  const auto chunk_count = (row_count + target_chunk_size - 1) / target_chunk_size;
 
+  auto segments_by_chunks = std::vector<Segments>(chunk_count);
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(chunk_count);
+  std::mutex append_chunk_mutex;
+  for (auto chunk_index = size_t{0}; chunk_index < chunk_count; ++chunk_index) {
     // create and start parsing task to fill chunk
-    tasks.emplace_back(std::make_shared<JobTask>([relevant_content, field_ends, &table, &segments, &meta,
-                                                  &escaped_linebreak, &append_chunk_mutex]() {
+    tasks.emplace_back(std::make_shared<JobTask>([&, chunk_index]() {
+      const auto chunk_begin = _find_row_begin(content, blocks, chunk_index * target_chunk_size, meta);
+      const auto remaining_content = content.substr(chunk_begin);
+
+      auto field_ends = std::vector<size_t>{};
+      _find_fields_in_chunk(remaining_content, *table, field_ends, meta);
+
+      // Only pass the part of the string that is actually needed to the parsing task
+      const auto relevant_content = remaining_content.substr(0, field_ends.back());
+
+      auto& segments = segments_by_chunks[chunk_index];
       _parse_into_chunk(relevant_content, field_ends, *table, segments, meta, escaped_linebreak, append_chunk_mutex);
+
+      if (encoding_spec) {
+        for (auto column_id = ColumnID{0}; column_id < table->column_count(); ++column_id) {
+          segments[column_id] = ChunkEncoder::encode_segment(segments[column_id], table->column_data_type(column_id),
+                                                             (*encoding_spec)[column_id]);
+        }
+      }
     }));
     tasks.back()->schedule();
   }
@@ -92,10 +169,9 @@ std::shared_ptr<Table> CsvParser::parse(const std::string& filename, const Chunk
     DebugAssert(!segments.empty(), "Empty chunks shouldn't occur when importing CSV");
     const auto mvcc_data = std::make_shared<MvccData>(segments.front()->size(), CommitID{0});
     table->append_chunk(segments, mvcc_data);
+    table->last_chunk()->finalize();
   }
 
-  table->last_chunk()->finalize();
-
   return table;
 }
 
@@ -122,6 +198,85 @@ std::shared_ptr<Table> CsvParser::_create_table_from_meta(const ChunkOffset chun
   return std::make_shared<Table>(column_definitions, TableType::Data, chunk_size, UseMvcc::Yes);
 }
 
+std::vector<CsvParser::Block> CsvParser::_scan_blocks(std::string_view csv_content, const CsvMeta& meta) {
+  const auto block_count = (csv_content.size() + BLOCK_SIZE - 1) / BLOCK_SIZE;
+  auto blocks = std::vector<Block>(block_count);
+
+  auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+  tasks.reserve(block_count);
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    tasks.emplace_back(std::make_shared<JobTask>([&, block_index]() {
+      auto& block = blocks[block_index];
+      block.begin = block_index * BLOCK_SIZE;
+      block.end = std::min(block.begin + BLOCK_SIZE, csv_content.size());
+
+      // Delimiters that are not quoted if the block begins outside of quotes are quoted if it begins in quotes, and
+      // vice versa
+      auto in_quotes = false;
+      for (auto word_begin = block.begin; word_begin < block.end; word_begin += WORD_SIZE) {
+        const auto masks = find_characters(csv_content, word_begin, meta.config);
+        const auto quoted = quoted_characters(masks.quotes, in_quotes);
+        in_quotes = ends_in_quotes(quoted);
+
+        block.quote_count += __builtin_popcountll(masks.quotes);
+        block.row_end_count_by_begins_in_quotes[false] += __builtin_popcountll(masks.delimiters & ~quoted);
+        block.row_end_count_by_begins_in_quotes[true] += __builtin_popcountll(masks.delimiters & quoted);
+      }
+    }));
+    tasks.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(tasks);
+
+  auto begins_in_quotes = false;
+  auto first_row_end = size_t{0};
+  for (auto& block : blocks) {
+    block.begins_in_quotes = begins_in_quotes;
+    block.first_row_end = first_row_end;
+    begins_in_quotes ^= block.quote_count % 2 == 1;
+    first_row_end += block.row_end_count_by_begins_in_quotes[block.begins_in_quotes];
+  }
+
+  return blocks;
+}
+
+size_t CsvParser::_find_row_begin(std::string_view csv_content, const std::vector<Block>& blocks, const size_t row,
+                                  const CsvMeta& meta) {
+  if (row == 0) return 0;
+
+  // The row begins after the end of the previous row. Find the block that contains this row end.
+  const auto row_end = row - 1;
+  const auto block_iter = std::upper_bound(blocks.cbegin(), blocks.cend(), row_end,
+                                           [](const auto searched_row_end, const auto& block) {
+                                             return searched_row_end < block.first_row_end;
+                                           });
+  DebugAssert(block_iter != blocks.cbegin(), "The first block begins with the first row");
+  const auto& block = *std::prev(block_iter);
+
+  auto remaining_row_ends = row_end - block.first_row_end;
+  auto in_quotes = block.begins_in_quotes;
+  for (auto word_begin = block.begin; word_begin < block.end; word_begin += WORD_SIZE) {
+    const auto masks = find_characters(csv_content, word_begin, meta.config);
+    const auto quoted = quoted_characters(masks.quotes, in_quotes);
+    in_quotes = ends_in_quotes(quoted);
+
+    auto row_ends = masks.delimiters & ~quoted;
+    const auto row_end_count = static_cast<size_t>(__builtin_popcountll(row_ends));
+    if (remaining_row_ends >= row_end_count) {
+      remaining_row_ends -= row_end_count;
+      continue;
+    }
+
+    // Clear the lowest set bits, so that the lowest remaining one is the searched row end
+    for (; remaining_row_ends > 0; --remaining_row_ends) {
+      row_ends &= row_ends - 1;
+    }
+    return word_begin + __builtin_ctzll(row_ends) + 1;
+  }
+
+  Fail("Row end not found in the block that was expected to contain it");
+}
+
 bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table& table, std::vector<size_t>& field_ends,
                                       const CsvMeta& meta) {
   field_ends.clear();
@@ -129,47 +284,38 @@ bool CsvParser::_find_fields_in_chunk(std::string_view csv_content, const Table&
     return false;
   }
 
-  std::string search_for{meta.config.separator, meta.config.delimiter, meta.config.quote};
+  const auto column_count = static_cast<size_t>(table.column_count());
+  const auto target_chunk_size = table.target_chunk_size();
 
-  size_t from = 0;
-  unsigned int rows = 0;
-  unsigned int field_count = 1;
+  size_t rows = 0;
+  size_t last_row_begin = 0;
   bool in_quotes = false;
-  while (rows < table.target_chunk_size()) {
-    // Find either of row separator, column delimiter, quote identifier
-    auto pos = csv_content.find_first_of(search_for, from);
-    if (std::string::npos == pos) {
-      break;
-    }
-    from = pos + 1;
-    const char elem = csv_content[pos];
-
-    // Make sure to "toggle" in_quotes ONLY if the quotes are not part of the string (i.e. escaped)
-    if (elem == meta.config.quote) {
-      bool quote_is_escaped = false;
-      if (meta.config.quote != meta.config.escape) {
-        quote_is_escaped = pos != 0 && csv_content[pos - 1] == meta.config.escape;
+  for (auto word_begin = size_t{0}; word_begin < csv_content.size(); word_begin += WORD_SIZE) {
+    const auto masks = find_characters(csv_content, word_begin, meta.config);
+    const auto quoted = quoted_characters(masks.quotes, in_quotes);
+    in_quotes = ends_in_quotes(quoted);
+
+    // Visit the unquoted separators and delimiters one by one, clearing the lowest set bit in each iteration
+    auto field_ends_mask = (masks.separators | masks.delimiters) & ~quoted;
+    while (field_ends_mask) {
+      const auto index = __builtin_ctzll(field_ends_mask);
+      field_ends.push_back(word_begin + index);
+
+      // Determine if the field end is also the end of the row
+      if ((masks.delimiters >> index) & 1) {
+        ++rows;
+        last_row_begin = word_begin + index + 1;
+        DebugAssert(field_ends.size() == rows * column_count, "Number of CSV fields does not match number of columns.");
+        if (rows == target_chunk_size) return true;
       }
-      if (!quote_is_escaped) {
-        in_quotes = !in_quotes;
-      }
-    }
-
-    // Determine if delimiter marks end of row or is part of the (string) value
-    if (elem == meta.config.delimiter && !in_quotes) {
-      DebugAssert(field_count == static_cast<size_t>(table.column_count()),
-                  "Number of CSV fields does not match number of columns.");
-      ++rows;
-      field_count = 0;
-    }
 
-    // Determine if separator marks end of field or is part of the (string) value
-    if (in_quotes || elem == meta.config.quote) {
-      continue;
+      field_ends_mask &= field_ends_mask - 1;
     }
+  }
 
-    ++field_count;
-    field_ends.push_back(pos);
+  // The last row of the file is not terminated by a delimiter, so it ends with the file
+  if (last_row_begin < csv_content.size()) {
+    field_ends.push_back(csv_content.size());
   }
 
   return true;
@@ -1,12 +1,15 @@
 #pragma once
 
+#include <array>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <string>
 #include <string_view>
 #include <vector>
 
 #include "import_export/csv/csv_meta.hpp"
+#include "storage/encoding_type.hpp"
 
 namespace opossum {
 
@@ -21,28 +24,69 @@ class Chunk;
  * For non-RFC 4180, all linebreaks within quoted strings are further escaped with an escape character.
  * For the structure of the meta csv file see export_csv.hpp
  *
- * This parser reads the whole csv file and iterates over it to separate the data into chunks that are aligned with the
- * csv rows.
- * Each data chunk is parsed and converted into a opossum chunk. In the end all chunks are combined to the final table.
+ * This parser memory-maps the csv file and separates it into chunks that are aligned with the csv rows. The file is
+ * not copied into memory as a whole, and the separation does not scan it on a single thread: The file is split into
+ * blocks, which are scanned in parallel for unquoted row delimiters (see _scan_blocks). The quote state at the
+ * beginning of a block is not known during that scan, so the delimiters are counted for both possible states. A prefix
+ * sum over the blocks then determines the state and the number of the first row of each block. With this, each chunk
+ * finds the beginning of its first row on its own (see _find_row_begin).
+ * Each data chunk is parsed and converted into a opossum chunk in parallel. In the end all chunks are combined to the
+ * final table.
+ *
+ * Delimiters, separators and quotes are found using bitmasks over words of 64 characters, which the compiler
+ * vectorizes.
  */
 class CsvParser {
  public:
   /*
    * @param filename      Path to the input file.
    * @param csv_meta      Custom csv meta information which will be used instead of the default "filename" + ".json" meta.
+   * @param encoding_spec If given, each chunk is encoded right after it was parsed, so that the unencoded segments of
+   *                      all chunks do not have to be kept in memory at the same time.
    * @returns             The table that was created from the csv file.
    */
   static std::shared_ptr<Table> parse(const std::string& filename, const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE,
-                                      const std::optional<CsvMeta>& csv_meta = std::nullopt);
+                                      const std::optional<CsvMeta>& csv_meta = std::nullopt,
+                                      const std::optional<ChunkEncodingSpec>& encoding_spec = std::nullopt);
   static std::shared_ptr<Table> create_table_from_meta_file(const std::string& filename,
                                                             const ChunkOffset chunk_size = Chunk::DEFAULT_SIZE);
 
+  // Size of the blocks in which the file is scanned for rows in parallel
+  static constexpr auto BLOCK_SIZE = size_t{1} << 20;
+
  protected:
   /*
    * Use the meta information stored in _meta to create a new table with according column description.
    */
   static std::shared_ptr<Table> _create_table_from_meta(const ChunkOffset chunk_size, const CsvMeta& meta);
 
+  // Summary of one block of the csv content. The row delimiters are counted for both possible quote states at the
+  // beginning of the block. The remaining members are set from the preceding blocks once all of them were scanned.
+  struct Block {
+    size_t begin{0};
+    size_t end{0};
+    size_t quote_count{0};
+    std::array<size_t, 2> row_end_count_by_begins_in_quotes{};
+
+    bool begins_in_quotes{false};
+    size_t first_row_end{0};
+  };
+
+  /*
+   * @param csv_content The complete content of the CSV.
+   * @returns           The blocks of \p csv_content, scanned in parallel, with their quote states and first row ends.
+   */
+  static std::vector<Block> _scan_blocks(std::string_view csv_content, const CsvMeta& meta);
+
+  /*
+   * @param csv_content The complete content of the CSV.
+   * @param blocks      The blocks returned by _scan_blocks.
+   * @param row         Number of the row, starting at zero.
+   * @returns           The position of the first character of the \p row-th row in \p csv_content.
+   */
+  static size_t _find_row_begin(std::string_view csv_content, const std::vector<Block>& blocks, const size_t row,
+                                const CsvMeta& meta);
+
   /*
    * @param      csv_content String_view on the remaining content of the CSV.
    * @param      table       Empty table created by _process_meta_file.
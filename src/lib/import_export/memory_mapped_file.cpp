@@ -0,0 +1,89 @@
+#include "memory_mapped_file.hpp"
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+MemoryMappedFile::MemoryMappedFile(const std::filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_RDONLY);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string() + ": " + std::string{std::strerror(errno)});
+
+  struct stat file_status {};
+  if (::fstat(file_descriptor, &file_status) != 0) {
+    const auto fstat_errno = errno;
+    ::close(file_descriptor);
+    Fail("Cannot stat " + path.string() + ": " + std::string{std::strerror(fstat_errno)});
+  }
+  _size = static_cast<size_t>(file_status.st_size);
+
+  // mmap does not accept empty mappings. Empty files are represented by an empty range instead.
+  if (_size > 0) {
+    auto* const mapping = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, file_descriptor, 0);
+    const auto mmap_errno = errno;
+    ::close(file_descriptor);
+    Assert(mapping != MAP_FAILED, "Cannot map " + path.string() + ": " + std::string{std::strerror(mmap_errno)});
+
+    // The whole file is going to be read, so the kernel may read ahead all of it
+    ::madvise(mapping, _size, MADV_WILLNEED);
+    _data = static_cast<const char*>(mapping);
+  } else {
+    ::close(file_descriptor);
+  }
+}
+
+MemoryMappedFile::~MemoryMappedFile() {
+  if (_data) ::munmap(const_cast<char*>(_data), _size);
+}
+
+const char* MemoryMappedFile::data() const { return _data; }
+
+size_t MemoryMappedFile::size() const { return _size; }
+
+MemoryStreamBuffer::MemoryStreamBuffer(const char* begin, const char* end, std::shared_ptr<const void> memory_owner)
+    : _memory_owner(std::move(memory_owner)) {
+  // The get area is never written to. std::streambuf only takes non-const pointers.
+  setg(const_cast<char*>(begin), const_cast<char*>(begin), const_cast<char*>(end));
+}
+
+const char* MemoryStreamBuffer::view(const size_t size) {
+  if (static_cast<size_t>(egptr() - gptr()) < size) return nullptr;
+
+  const auto* const data = gptr();
+  setg(eback(), gptr() + size, egptr());
+  return data;
+}
+
+const std::shared_ptr<const void>& MemoryStreamBuffer::memory_owner() const { return _memory_owner; }
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekoff(off_type offset, std::ios_base::seekdir direction,
+                                                         std::ios_base::openmode mode) {
+  if (!(mode & std::ios_base::in)) return pos_type(off_type(-1));
+
+  auto* base = eback();
+  if (direction == std::ios_base::cur) {
+    base = gptr();
+  } else if (direction == std::ios_base::end) {
+    base = egptr();
+  }
+
+  if (offset < eback() - base || offset > egptr() - base) return pos_type(off_type(-1));
+
+  setg(eback(), base + offset, egptr());
+  return pos_type(gptr() - eback());
+}
+
+MemoryStreamBuffer::pos_type MemoryStreamBuffer::seekpos(pos_type position, std::ios_base::openmode mode) {
+  return seekoff(off_type(position), std::ios_base::beg, mode);
+}
+
+}  // namespace opossum
@@ -0,0 +1,58 @@
+#pragma once
+
+#include <cstddef>
+#include <filesystem>
+#include <memory>
+#include <streambuf>
+
+namespace opossum {
+
+/**
+ * Read-only memory mapping of a file that is imported. The parsers read from the mapping instead of an std::ifstream,
+ * which saves the read system calls and the copy of every page into the buffer of the stream or into a string. The
+ * mapped pages are shared with all processes that load the same file, and the mapping can be read concurrently, e.g.,
+ * by the jobs that load the chunks of a checkpoint or parse the chunks of a CSV file.
+ */
+class MemoryMappedFile {
+ public:
+  explicit MemoryMappedFile(const std::filesystem::path& path);
+  ~MemoryMappedFile();
+
+  MemoryMappedFile(const MemoryMappedFile&) = delete;
+  MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+  const char* data() const;
+  size_t size() const;
+
+ private:
+  const char* _data{nullptr};
+  size_t _size{0};
+};
+
+/**
+ * Read-only stream buffer over a range of memory, e.g., of a MemoryMappedFile. The range is used as the get area
+ * directly, so that std::istream::read copies straight out of it. Reading past its end fails like reading past the end
+ * of a file. Positions (e.g., of std::istream::tellg) are relative to `begin`.
+ *
+ * If `memory_owner` is set, it keeps the range alive, and readers may keep pointers into the range instead of copying
+ * the data (see view()).
+ */
+class MemoryStreamBuffer : public std::streambuf {
+ public:
+  MemoryStreamBuffer(const char* begin, const char* end, std::shared_ptr<const void> memory_owner = nullptr);
+
+  // Returns the current position and skips `size` bytes, so that the caller can use them in place. Returns nullptr
+  // (and does not skip anything) if fewer bytes are left.
+  const char* view(const size_t size);
+
+  const std::shared_ptr<const void>& memory_owner() const;
+
+ protected:
+  pos_type seekoff(off_type offset, std::ios_base::seekdir direction, std::ios_base::openmode mode) override;
+  pos_type seekpos(pos_type position, std::ios_base::openmode mode) override;
+
+ private:
+  const std::shared_ptr<const void> _memory_owner;
+};
+
+}  // namespace opossum
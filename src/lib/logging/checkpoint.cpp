@@ -0,0 +1,430 @@
+#include "checkpoint.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <atomic>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <istream>
+#include <memory>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nlohmann/json.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
+#include "import_export/memory_mapped_file.hpp"
+#include "operators/validate.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The file of a table that is written and the manifest entries of its chunks
+struct TableFile {
+  struct ChunkEntry {
+    bool removed{false};
+    size_t offset{0};
+    bool is_mutable{false};
+    std::vector<ChunkOffset> invisible_rows;
+  };
+
+  std::string file_name;
+  int file_descriptor{-1};
+  std::atomic<size_t> next_offset{0};
+  std::vector<ChunkEntry> chunk_entries;
+};
+
+// A chunk that has been read from a checkpoint by one of the loading jobs
+struct LoadedChunk {
+  Segments segments;
+  std::shared_ptr<MvccData> mvcc_data;
+  ChunkOffset invisible_row_count{0};
+};
+
+int open_file(const std::filesystem::path& path) {
+  const auto file_descriptor = ::open(path.c_str(), O_WRONLY | O_CREAT | O_TRUNC, 0644);
+  Assert(file_descriptor >= 0, "Cannot open " + path.string() + ": " + std::string{std::strerror(errno)});
+  return file_descriptor;
+}
+
+// Writes the entire data at `offset`. Writes at different offsets of the same file can happen in parallel.
+void write_at(const int file_descriptor, const std::string& data, const size_t offset) {
+  auto written_byte_count = size_t{0};
+  while (written_byte_count < data.size()) {
+    const auto result = ::pwrite(file_descriptor, data.data() + written_byte_count, data.size() - written_byte_count,
+                                 static_cast<off_t>(offset + written_byte_count));
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, "Cannot write checkpoint: " + std::string{std::strerror(errno)});
+
+    written_byte_count += static_cast<size_t>(result);
+  }
+}
+
+void sync_and_close(const int file_descriptor) {
+#ifdef __APPLE__
+  const auto sync_result = ::fsync(file_descriptor);
+#else
+  const auto sync_result = ::fdatasync(file_descriptor);
+#endif
+  Assert(sync_result == 0, "Cannot sync checkpoint: " + std::string{std::strerror(errno)});
+  ::close(file_descriptor);
+}
+
+/**
+ * Returns the offsets of the first `row_count` rows of the chunk that are not visible at the snapshot.
+ * `has_pending_rows` is set if some of them were neither committed nor rolled back at the snapshot. These might be
+ * committed later, in which case LogManager::recover restores them.
+ */
+std::vector<ChunkOffset> get_invisible_rows(const Chunk& chunk, const ChunkOffset row_count,
+                                            const TransactionID transaction_id, const CommitID snapshot_commit_id,
+                                            bool& has_pending_rows) {
+  auto invisible_rows = std::vector<ChunkOffset>{};
+  const auto& mvcc_data = chunk.mvcc_data();
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    // Rolled back rows get an end_cid of 0 before their begin_cid is reset, so they are not considered pending
+    const auto begin_cid = mvcc_data->get_begin_cid(chunk_offset);
+    const auto end_cid = mvcc_data->get_end_cid(chunk_offset);
+    if (Validate::is_row_visible(transaction_id, snapshot_commit_id, mvcc_data->get_tid(chunk_offset), begin_cid,
+                                 end_cid)) {
+      continue;
+    }
+
+    invisible_rows.emplace_back(chunk_offset);
+    if (begin_cid > snapshot_commit_id && end_cid != CommitID{0}) has_pending_rows = true;
+  }
+
+  return invisible_rows;
+}
+
+/**
+ * Copies the first `row_count` rows of the chunk into ValueSegments. This is used for mutable chunks, whose size
+ * changes concurrently, and for chunks with pending rows. The values of invisible rows are not read, as concurrent
+ * inserts might still be writing them. They are replaced by placeholders.
+ */
+std::shared_ptr<Chunk> copy_visible_rows(const Table& table, const Chunk& chunk, const ChunkOffset row_count,
+                                         const std::vector<ChunkOffset>& invisible_rows) {
+  auto segments = Segments{};
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    const auto is_nullable = table.column_is_nullable(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      auto values = pmr_vector<ColumnDataType>(row_count);
+      auto null_values = pmr_vector<bool>(is_nullable ? row_count : 0);
+
+      segment_with_iterators<ColumnDataType>(
+          *chunk.get_segment(column_id), [&](const auto begin, [[maybe_unused]] const auto end) {
+            auto iter = begin;
+            auto invisible_row_iter = invisible_rows.cbegin();
+            for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset, ++iter) {
+              if (invisible_row_iter != invisible_rows.cend() && *invisible_row_iter == chunk_offset) {
+                if (is_nullable) null_values[chunk_offset] = true;
+                ++invisible_row_iter;
+                continue;
+              }
+
+              if (is_nullable && iter->is_null()) {
+                null_values[chunk_offset] = true;
+              } else {
+                values[chunk_offset] = iter->value();
+              }
+            }
+          });
+
+      if (is_nullable) {
+        segments.emplace_back(
+            std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+      } else {
+        segments.emplace_back(std::make_shared<ValueSegment<ColumnDataType>>(std::move(values)));
+      }
+    });
+  }
+
+  return std::make_shared<Chunk>(segments);
+}
+
+// The Insert operator expects the ValueSegments of mutable chunks to have the capacity for a full chunk
+void reserve_chunk_capacity(const Segments& segments, const ChunkOffset target_chunk_size) {
+  for (const auto& segment : segments) {
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+      Assert(value_segment, "Mutable chunks are expected to be stored in ValueSegments");
+      value_segment->values().reserve(target_chunk_size);
+      if (value_segment->is_nullable()) {
+        value_segment->null_values().reserve(target_chunk_size);
+      }
+    });
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+CommitID Checkpoint::write(const std::filesystem::path& directory) {
+  const auto manifest_path = directory / MANIFEST_FILE_NAME;
+  Assert(!std::filesystem::exists(manifest_path), "Directory already contains a checkpoint: " + directory.string());
+  std::filesystem::create_directories(directory);
+
+  // The transaction context registers the snapshot, so that the chunks that are part of it are not physically deleted
+  // while the checkpoint is written (see MvccDeletePlugin)
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  const auto transaction_id = transaction_context->transaction_id();
+  const auto snapshot_commit_id = transaction_context->snapshot_commit_id();
+
+  const auto tables = Hyrise::get().storage_manager.tables();
+  auto table_files = std::vector<TableFile>(tables.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  auto table_index = size_t{0};
+  for (const auto& name_and_table : tables) {
+    const auto& table = name_and_table.second;
+    Assert(table->uses_mvcc() == UseMvcc::Yes, "Checkpoints can only be written for tables that use MVCC");
+
+    auto& table_file = table_files[table_index];
+    table_file.file_name = "table_" + std::to_string(table_index) + ".bin";
+    table_file.file_descriptor = open_file(directory / table_file.file_name);
+    ++table_index;
+
+    // Chunks that are appended later do not contain rows that are visible at the snapshot
+    const auto chunk_count = table->chunk_count();
+    table_file.chunk_entries.resize(chunk_count);
+
+    auto header = std::ostringstream{};
+    BinaryWriter::_write_header(*table, chunk_count, header);
+    write_at(table_file.file_descriptor, header.str(), 0);
+    table_file.next_offset = header.str().size();
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, table, chunk_id]() {
+        auto& chunk_entry = table_file.chunk_entries[chunk_id];
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk) {
+          // Physically deleted chunks do not contain visible rows
+          chunk_entry.removed = true;
+          return;
+        }
+
+        // Rows that are appended after the size was read are not visible at the snapshot
+        chunk_entry.is_mutable = chunk->is_mutable();
+        const auto row_count = chunk->size();
+
+        auto has_pending_rows = false;
+        chunk_entry.invisible_rows =
+            get_invisible_rows(*chunk, row_count, transaction_id, snapshot_commit_id, has_pending_rows);
+
+        auto stream = std::ostringstream{};
+        if (chunk_entry.is_mutable || has_pending_rows) {
+          BinaryWriter::_write_chunk(*copy_visible_rows(*table, *chunk, row_count, chunk_entry.invisible_rows), stream);
+        } else {
+          BinaryWriter::_write_chunk(*chunk, stream);
+        }
+
+        // Both the header and the chunks are padded to BinaryWriter::ALIGNMENT bytes, so that every chunk starts at an
+        // aligned offset and its compressed vectors can be viewed in the mapped file (see BinaryParser)
+        const auto data = stream.str();
+        chunk_entry.offset = table_file.next_offset.fetch_add(data.size());
+        write_at(table_file.file_descriptor, data, chunk_entry.offset);
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  auto manifest = nlohmann::json{};
+  manifest["commit_id"] = snapshot_commit_id;
+  manifest["tables"] = nlohmann::json::array();
+
+  table_index = 0;
+  for (const auto& name_and_table : tables) {
+    auto& table_file = table_files[table_index];
+    sync_and_close(table_file.file_descriptor);
+    ++table_index;
+
+    auto chunk_manifests = nlohmann::json::array();
+    for (const auto& chunk_entry : table_file.chunk_entries) {
+      if (chunk_entry.removed) {
+        chunk_manifests.push_back({{"removed", true}});
+      } else {
+        chunk_manifests.push_back({{"removed", false},
+                                   {"offset", chunk_entry.offset},
+                                   {"mutable", chunk_entry.is_mutable},
+                                   {"invisible_rows", chunk_entry.invisible_rows}});
+      }
+    }
+
+    const auto& table = name_and_table.second;
+    auto constraint_manifests = nlohmann::json::array();
+    for (const auto& constraint : table->get_soft_unique_constraints()) {
+      auto column_ids = std::vector<ColumnID::base_type>{};
+      for (const auto column_id : constraint.columns) {
+        column_ids.emplace_back(column_id);
+      }
+      constraint_manifests.push_back(
+          {{"columns", column_ids}, {"primary_key", constraint.is_primary_key == IsPrimaryKey::Yes}});
+    }
+
+    manifest["tables"].push_back({{"name", name_and_table.first},
+                                  {"file", table_file.file_name},
+                                  {"chunks", std::move(chunk_manifests)},
+                                  {"constraints", std::move(constraint_manifests)},
+                                  {"primary_key_index", table->primary_key_index() != nullptr}});
+  }
+
+  // The checkpoint only becomes valid once the complete manifest has been renamed to its final name
+  const auto temporary_manifest_path = directory / (std::string{MANIFEST_FILE_NAME} + ".tmp");
+  const auto manifest_file_descriptor = open_file(temporary_manifest_path);
+  write_at(manifest_file_descriptor, manifest.dump(), 0);
+  sync_and_close(manifest_file_descriptor);
+  std::filesystem::rename(temporary_manifest_path, manifest_path);
+
+  transaction_context->commit();
+
+  return snapshot_commit_id;
+}
+
+CommitID Checkpoint::load(const std::filesystem::path& directory) {
+  const auto manifest_path = directory / MANIFEST_FILE_NAME;
+  Assert(std::filesystem::exists(manifest_path),
+         "Directory does not contain a complete checkpoint: " + directory.string());
+
+  auto manifest = nlohmann::json{};
+  {
+    auto manifest_file = std::ifstream{manifest_path};
+    manifest_file >> manifest;
+  }
+
+  const auto& table_manifests = manifest["tables"];
+  auto tables = std::vector<std::shared_ptr<Table>>(table_manifests.size());
+  auto loaded_chunks = std::vector<std::vector<LoadedChunk>>(table_manifests.size());
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+
+  // The chunks of all tables are loaded in parallel
+  for (auto table_index = size_t{0}; table_index < table_manifests.size(); ++table_index) {
+    const auto& chunk_manifests = table_manifests[table_index]["chunks"];
+    const auto table_path = directory / table_manifests[table_index]["file"].get<std::string>();
+
+    // The file is mapped once and read by all jobs of the table
+    const auto mapped_file = std::make_shared<const MemoryMappedFile>(table_path);
+    auto header_buffer = MemoryStreamBuffer{mapped_file->data(), mapped_file->data() + mapped_file->size()};
+    auto header_stream = std::istream{&header_buffer};
+    header_stream.exceptions(std::istream::failbit | std::istream::badbit);
+    const auto table = BinaryParser::_read_header(header_stream).first;
+    tables[table_index] = table;
+    loaded_chunks[table_index].resize(chunk_manifests.size());
+
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_manifests.size(); ++chunk_index) {
+      const auto& chunk_manifest = chunk_manifests[chunk_index];
+      if (chunk_manifest["removed"].get<bool>()) continue;
+
+      auto& loaded_chunk = loaded_chunks[table_index][chunk_index];
+      jobs.emplace_back(std::make_shared<JobTask>([&, table, mapped_file]() {
+        const auto offset = chunk_manifest["offset"].get<size_t>();
+        Assert(offset <= mapped_file->size(), "Chunk offset exceeds the size of the checkpoint file");
+        auto chunk_buffer =
+            MemoryStreamBuffer{mapped_file->data() + offset, mapped_file->data() + mapped_file->size(), mapped_file};
+        auto chunk_file = std::istream{&chunk_buffer};
+        chunk_file.exceptions(std::istream::failbit | std::istream::badbit);
+
+        auto row_count = ChunkOffset{0};
+        chunk_file.read(reinterpret_cast<char*>(&row_count), sizeof(row_count));
+        loaded_chunk.segments = BinaryParser::_import_segments(chunk_file, row_count, *table);
+
+        if (chunk_manifest["mutable"].get<bool>()) {
+          // Like chunks that are created by Table::append_mutable_chunk, mutable chunks provide space for a full chunk
+          const auto target_chunk_size = table->target_chunk_size();
+          reserve_chunk_capacity(loaded_chunk.segments, target_chunk_size);
+          loaded_chunk.mvcc_data = std::make_shared<MvccData>(target_chunk_size, MvccData::MAX_COMMIT_ID);
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+            loaded_chunk.mvcc_data->set_begin_cid(chunk_offset, CommitID{0});
+          }
+        } else {
+          loaded_chunk.mvcc_data = std::make_shared<MvccData>(row_count, CommitID{0});
+        }
+
+        // Rows that are not visible at the snapshot are invisible for all transactions, like rolled back rows
+        const auto invisible_rows = chunk_manifest["invisible_rows"].get<std::vector<ChunkOffset>>();
+        for (const auto chunk_offset : invisible_rows) {
+          loaded_chunk.mvcc_data->set_end_cid(chunk_offset, CommitID{0});
+        }
+        loaded_chunk.invisible_row_count = static_cast<ChunkOffset>(invisible_rows.size());
+      }));
+      jobs.back()->schedule();
+    }
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // Chunks are appended in order, so that they keep their ChunkIDs
+  for (auto table_index = size_t{0}; table_index < table_manifests.size(); ++table_index) {
+    const auto& table = tables[table_index];
+    const auto& chunk_manifests = table_manifests[table_index]["chunks"];
+
+    // Physically deleted chunks are represented by empty chunks, which are removed once the table has been added
+    auto removed_chunk_ids = std::vector<ChunkID>{};
+    for (auto chunk_index = size_t{0}; chunk_index < chunk_manifests.size(); ++chunk_index) {
+      const auto& chunk_manifest = chunk_manifests[chunk_index];
+      if (chunk_manifest["removed"].get<bool>()) {
+        removed_chunk_ids.emplace_back(table->chunk_count());
+        table->append_mutable_chunk();
+        continue;
+      }
+
+      auto& loaded_chunk = loaded_chunks[table_index][chunk_index];
+      table->append_chunk(loaded_chunk.segments, loaded_chunk.mvcc_data);
+
+      const auto chunk = table->last_chunk();
+      chunk->increase_invalid_row_count(loaded_chunk.invisible_row_count);
+      if (!chunk_manifest["mutable"].get<bool>()) {
+        chunk->finalize();
+      }
+    }
+
+    Hyrise::get().storage_manager.add_table(table_manifests[table_index]["name"].get<std::string>(), table);
+    for (const auto chunk_id : removed_chunk_ids) {
+      table->remove_chunk(chunk_id);
+    }
+
+    for (const auto& constraint_manifest : table_manifests[table_index]["constraints"]) {
+      auto column_ids = std::vector<ColumnID>{};
+      for (const auto column_id : constraint_manifest["columns"].get<std::vector<ColumnID::base_type>>()) {
+        column_ids.emplace_back(column_id);
+      }
+      const auto is_primary_key = constraint_manifest["primary_key"].get<bool>() ? IsPrimaryKey::Yes : IsPrimaryKey::No;
+      table->add_soft_unique_constraint(column_ids, is_primary_key);
+    }
+
+    // The index is created once the rows are in place. It is rebuilt if LogManager::recover restores rows.
+    if (table_manifests[table_index]["primary_key_index"].get<bool>()) {
+      table->create_primary_key_index();
+    }
+  }
+
+  const auto commit_id = manifest["commit_id"].get<CommitID>();
+  Hyrise::get().transaction_manager._advance_last_commit_id(commit_id);
+
+  return commit_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <filesystem>
+
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * A checkpoint is a transaction-consistent copy of all tables in the StorageManager. After a restart, the tables are
+ * loaded from the last checkpoint and the log is replayed on top of them (see LogManager::recover), which only has to
+ * replay the transactions that committed after the checkpoint was written.
+ *
+ * write() takes a snapshot of the database like a transaction does, i.e., it contains exactly the rows that are
+ * visible at the snapshot commit ID. Concurrent transactions are neither blocked nor waited for. The chunks of all
+ * tables are serialized in parallel by the scheduler, using the binary format (see BinaryWriter). Each table is
+ * written to one file. The chunk writers reserve their position in the file with an atomic counter, so the chunks are
+ * not stored in order. The manifest lists the tables, their files, the offsets of their chunks, the rows that are not
+ * visible at the snapshot, the constraints of the tables, and whether they have a PrimaryKeyIndex. It is written last, so that a checkpoint without a manifest is incomplete. Thus, each
+ * checkpoint has to be written to a new directory, and the previous one may only be removed once the manifest of the
+ * new one exists.
+ *
+ * load() reads the chunks in parallel and adds the tables to the StorageManager. All rows keep their positions, so
+ * that the RowIDs in the log remain valid: Rows that are not visible at the snapshot are restored as rows that are
+ * invisible for all transactions. Some of them might belong to transactions that were committed after the snapshot.
+ * Chunks that contain such rows are stored in ValueSegments, so that LogManager::recover can fill in their values.
+ * Primary key indexes are recreated once all chunks have been loaded (and rebuilt by LogManager::recover).
+ */
+class Checkpoint {
+ public:
+  // Writes a checkpoint of all tables to `directory`, which must not contain a checkpoint yet. Returns the snapshot
+  // commit ID, which has to be passed to LogManager::recover after the checkpoint was loaded.
+  static CommitID write(const std::filesystem::path& directory);
+
+  // Loads the tables of the checkpoint in `directory` into the StorageManager and returns its snapshot commit ID. New
+  // transactions get commit IDs after it.
+  static CommitID load(const std::filesystem::path& directory);
+
+  static constexpr auto MANIFEST_FILE_NAME = "manifest.json";
+};
+
+}  // namespace opossum
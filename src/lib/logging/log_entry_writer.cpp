@@ -0,0 +1,99 @@
+#include "log_entry_writer.hpp"
+
+#include <array>
+#include <limits>
+#include <string>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "resolve_type.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+LogEntryWriter::LogEntryWriter(std::vector<char>& buffer, const CommitID commit_id)
+    : _buffer{buffer}, _entry_begin{buffer.size()} {
+  // Placeholder for the payload size and the checksum, which are only known once all records have been written
+  _buffer.resize(_entry_begin + HEADER_SIZE);
+  _write(commit_id);
+}
+
+void LogEntryWriter::write_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                                  const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  DebugAssert(!_finished, "Cannot write to a finished log entry");
+  if (begin_chunk_offset == end_chunk_offset) return;
+
+  _write(LogRecordType::Insert);
+  _write_string(table_name);
+  _write(chunk_id);
+  _write(begin_chunk_offset);
+  _write(end_chunk_offset);
+
+  const auto chunk = table.get_chunk(chunk_id);
+  const auto column_count = table.column_count();
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto is_nullable = table.column_is_nullable(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto& segment = *chunk->get_segment(column_id);
+      segment_with_iterators<ColumnDataType>(segment, [&](const auto begin, [[maybe_unused]] const auto end) {
+        auto iter = begin + begin_chunk_offset;
+        for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset, ++iter) {
+          if (is_nullable) {
+            _write(static_cast<BoolAsByteType>(iter->is_null()));
+            if (iter->is_null()) continue;
+          }
+
+          if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+            _write_string(iter->value());
+          } else {
+            _write(iter->value());
+          }
+        }
+      });
+    });
+  }
+}
+
+void LogEntryWriter::write_delete(const std::string& table_name, const PosList& pos_list) {
+  DebugAssert(!_finished, "Cannot write to a finished log entry");
+  if (pos_list.empty()) return;
+
+  _write(LogRecordType::Delete);
+  _write_string(table_name);
+  _write(static_cast<uint32_t>(pos_list.size()));
+  for (const auto& row_id : pos_list) {
+    _write(row_id);
+  }
+}
+
+void LogEntryWriter::finish() {
+  DebugAssert(!_finished, "Log entry has already been finished");
+  _finished = true;
+
+  const auto payload_begin = _entry_begin + HEADER_SIZE;
+  const auto payload_size = _buffer.size() - payload_begin;
+  Assert(payload_size <= std::numeric_limits<uint32_t>::max(), "Log entry is too large");
+
+  auto checksum = boost::crc_32_type{};
+  checksum.process_bytes(_buffer.data() + payload_begin, payload_size);
+
+  const auto header = std::array<uint32_t, 2>{static_cast<uint32_t>(payload_size), checksum.checksum()};
+  std::memcpy(_buffer.data() + _entry_begin, header.data(), HEADER_SIZE);
+}
+
+void LogEntryWriter::_write_string(const std::string_view string) {
+  Assert(string.size() <= std::numeric_limits<uint32_t>::max(), "String is too long to be logged");
+  _write(static_cast<uint32_t>(string.size()));
+
+  const auto offset = _buffer.size();
+  _buffer.resize(offset + string.size());
+  std::memcpy(_buffer.data() + offset, string.data(), string.size());
+}
+
+}  // namespace opossum
@@ -0,0 +1,70 @@
+#pragma once
+
+#include <cstring>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+enum class LogRecordType : uint8_t { Insert, Delete };
+
+/**
+ * Serializes the log records of a committed transaction into one log entry, which is appended to a buffer. An entry
+ * has the following format (see LogManager for how entries are written and replayed):
+ *
+ * Description           | Type                                  | Size in bytes
+ * -----------------------------------------------------------------------------------------
+ * Payload size          | uint32_t                              |   4
+ * Checksum              | uint32_t (CRC-32 of the payload)      |   4
+ * Commit ID             | CommitID                              |   4
+ * Records               | see below                             |   Payload size - 4
+ *
+ * Each record starts with its LogRecordType and the name of the modified table (uint32_t length, followed by the
+ * characters). Insert records contain the ChunkID and the first and last (exclusive) ChunkOffset of the inserted rows,
+ * followed by the values of one column after another. For nullable columns, each value is preceded by a
+ * BoolAsByteType that is 1 for NULLs, in which case the value itself is omitted. Strings are stored as their length
+ * (uint32_t) and their characters, all other types as raw bytes. Delete records contain the number of deleted rows
+ * (uint32_t) and their RowIDs.
+ *
+ * The RowIDs in the records are the positions of the rows in the logged run. Recovery restores the inserted rows at
+ * the same positions, so that deletes can refer to rows inserted by other entries.
+ */
+class LogEntryWriter : private Noncopyable {
+ public:
+  // Appends the header of the entry to `buffer`
+  LogEntryWriter(std::vector<char>& buffer, const CommitID commit_id);
+
+  void write_insert(const std::string& table_name, const Table& table, const ChunkID chunk_id,
+                    const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  void write_delete(const std::string& table_name, const PosList& pos_list);
+
+  // Writes the payload size and checksum to the header. No further records may be written afterwards.
+  void finish();
+
+  static constexpr auto HEADER_SIZE = sizeof(uint32_t) * 2;
+
+ private:
+  template <typename T>
+  void _write(const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "Only trivially copyable values can be written as raw bytes");
+    const auto offset = _buffer.size();
+    _buffer.resize(offset + sizeof(T));
+    std::memcpy(_buffer.data() + offset, &value, sizeof(T));
+  }
+
+  void _write_string(const std::string_view string);
+
+  std::vector<char>& _buffer;
+  const size_t _entry_begin;
+  bool _finished{false};
+};
+
+}  // namespace opossum
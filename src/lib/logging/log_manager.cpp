@@ -0,0 +1,475 @@
+#include "log_manager.hpp"
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#include <algorithm>
+#include <array>
+#include <cerrno>
+#include <cstring>
+#include <fstream>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <boost/crc.hpp>
+
+#include "hyrise.hpp"
+#include "log_entry_writer.hpp"
+#include "resolve_type.hpp"
+#include "statistics/generate_pruning_statistics.hpp"
+#include "storage/chunk.hpp"
+#include "storage/mvcc_data.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Reads the records of a log entry that has already been checked against its checksum
+class LogEntryReader {
+ public:
+  LogEntryReader(const char* data, const size_t size) : _data{data}, _size{size} {}
+
+  template <typename T>
+  T read() {
+    Assert(_offset + sizeof(T) <= _size, "Log entry ended unexpectedly");
+    auto value = T{};
+    std::memcpy(&value, _data + _offset, sizeof(T));
+    _offset += sizeof(T);
+    return value;
+  }
+
+  std::string_view read_string() {
+    const auto size = read<uint32_t>();
+    Assert(_offset + size <= _size, "Log entry ended unexpectedly");
+    const auto string = std::string_view{_data + _offset, size};
+    _offset += size;
+    return string;
+  }
+
+  bool at_end() const { return _offset == _size; }
+
+ private:
+  const char* const _data;
+  const size_t _size;
+  size_t _offset{0};
+};
+
+// The changes of all replayed entries to one table
+struct LoggedChanges {
+  struct Insert {
+    RowID first_row_id;
+    std::vector<std::vector<AllTypeVariant>> rows;
+  };
+
+  std::vector<Insert> inserts;
+  std::vector<RowID> deletes;
+};
+
+void read_insert(LogEntryReader& reader, const Table& table, LoggedChanges& changes) {
+  const auto chunk_id = reader.read<ChunkID>();
+  const auto begin_chunk_offset = reader.read<ChunkOffset>();
+  const auto end_chunk_offset = reader.read<ChunkOffset>();
+  const auto row_count = end_chunk_offset - begin_chunk_offset;
+
+  const auto column_count = table.column_count();
+  auto rows = std::vector<std::vector<AllTypeVariant>>(row_count, std::vector<AllTypeVariant>(column_count));
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto is_nullable = table.column_is_nullable(column_id);
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      for (auto& row : rows) {
+        if (is_nullable && reader.read<BoolAsByteType>()) continue;  // The row's values are initialized as NULL
+
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          row[column_id] = pmr_string{reader.read_string()};
+        } else {
+          row[column_id] = reader.read<ColumnDataType>();
+        }
+      }
+    });
+  }
+
+  changes.inserts.push_back({RowID{chunk_id, begin_chunk_offset}, std::move(rows)});
+}
+
+void read_delete(LogEntryReader& reader, LoggedChanges& changes) {
+  const auto row_count = reader.read<uint32_t>();
+  for (auto row_index = uint32_t{0}; row_index < row_count; ++row_index) {
+    changes.deletes.emplace_back(reader.read<RowID>());
+  }
+}
+
+// Reads the records of an entry unless its transaction is contained in the checkpoint. Returns the commit ID.
+CommitID read_entry(LogEntryReader& reader, const CommitID checkpoint_commit_id,
+                    std::unordered_map<std::string, LoggedChanges>& changes_per_table) {
+  // The replayed rows are visible from the beginning of time, so the commit ID is only used to skip transactions
+  const auto commit_id = reader.read<CommitID>();
+  if (commit_id <= checkpoint_commit_id) return commit_id;
+
+  while (!reader.at_end()) {
+    const auto record_type = reader.read<LogRecordType>();
+    const auto table_name = std::string{reader.read_string()};
+    auto& changes = changes_per_table[table_name];
+
+    switch (record_type) {
+      case LogRecordType::Insert:
+        read_insert(reader, *Hyrise::get().storage_manager.get_table(table_name), changes);
+        break;
+      case LogRecordType::Delete:
+        read_delete(reader, changes);
+        break;
+    }
+  }
+
+  return commit_id;
+}
+
+// Appends a row that is invisible for all transactions. Like a rolled back insert, it has an end_cid of 0.
+void append_placeholder_row(Chunk& chunk, const std::vector<AllTypeVariant>& placeholder_values) {
+  const auto chunk_offset = chunk.size();
+  chunk.append(placeholder_values);
+  chunk.mvcc_data()->set_end_cid(chunk_offset, CommitID{0});
+  chunk.increase_invalid_row_count(1);
+}
+
+/**
+ * Overwrites the placeholder that a checkpoint holds for a row that was allocated, but not yet committed, when the
+ * checkpoint was written. Checkpoints store chunks with such rows in ValueSegments. The invalid row count of the chunk
+ * is not decreased, which only prevents Validate from skipping the chunk.
+ */
+void restore_placeholder_row(Chunk& chunk, const ChunkOffset chunk_offset, const std::vector<AllTypeVariant>& row) {
+  const auto& mvcc_data = chunk.mvcc_data();
+  Assert(mvcc_data->get_end_cid(chunk_offset) == CommitID{0},
+         "Logged row overwrites a visible row. Were the tables loaded from the checkpoint with the given commit ID?");
+
+  for (auto column_id = ColumnID{0}; column_id < chunk.column_count(); ++column_id) {
+    const auto segment = chunk.get_segment(column_id);
+    resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      const auto value_segment = std::dynamic_pointer_cast<ValueSegment<ColumnDataType>>(segment);
+      Assert(value_segment, "Placeholder rows of checkpoints are expected in ValueSegments");
+
+      const auto is_null = variant_is_null(row[column_id]);
+      if (value_segment->is_nullable()) {
+        value_segment->null_values()[chunk_offset] = is_null;
+      }
+      if (!is_null) {
+        value_segment->values()[chunk_offset] = boost::get<ColumnDataType>(row[column_id]);
+      }
+    });
+  }
+
+  mvcc_data->set_end_cid(chunk_offset, MvccData::MAX_COMMIT_ID);
+}
+
+/**
+ * Returns the chunk in which the row at `row_id` has to be restored. In the logged run, the positions between the
+ * rows of the replayed inserts were taken by rows of transactions that were rolled back or did not commit. These are
+ * filled with placeholder rows. Like the Insert operator, we expect that a new chunk was only appended when the last
+ * chunk was full or immutable. If the position already exists, it holds a placeholder from a checkpoint.
+ */
+std::shared_ptr<Chunk> get_chunk_to_restore_row(Table& table, const RowID& row_id,
+                                                const std::vector<AllTypeVariant>& placeholder_values) {
+  while (table.chunk_count() <= row_id.chunk_id) {
+    if (table.chunk_count() > 0) {
+      const auto last_chunk = table.get_chunk(ChunkID{table.chunk_count() - 1});
+      if (last_chunk && last_chunk->is_mutable()) {
+        while (last_chunk->size() < table.target_chunk_size()) {
+          append_placeholder_row(*last_chunk, placeholder_values);
+        }
+        last_chunk->finalize();
+      }
+    }
+    table.append_mutable_chunk();
+  }
+
+  const auto chunk = table.get_chunk(row_id.chunk_id);
+  if (row_id.chunk_offset < chunk->size()) return chunk;
+
+  Assert(chunk->is_mutable(),
+         "Logged rows do not match the table. Was the table loaded in the state in which logging was enabled?");
+  while (chunk->size() < row_id.chunk_offset) {
+    append_placeholder_row(*chunk, placeholder_values);
+  }
+
+  return chunk;
+}
+
+/**
+ * Applies the changes of all replayed entries to the table. The order in which transactions were committed does not
+ * matter for the state after the recovery: All logged inserts are applied (in the order of their positions), then all
+ * logged deletes. As the inserted rows are restored at their logged positions, the RowIDs in the deletes, in entries
+ * that are logged after the recovery, and in checkpoints remain valid.
+ */
+void apply_changes(Table& table, LoggedChanges& changes) {
+  Assert(table.uses_mvcc() == UseMvcc::Yes, "Logged tables have to use MVCC");
+
+  auto placeholder_values = std::vector<AllTypeVariant>(table.column_count());
+  for (auto column_id = ColumnID{0}; column_id < table.column_count(); ++column_id) {
+    if (table.column_is_nullable(column_id)) continue;
+
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      placeholder_values[column_id] = ColumnDataType{};
+    });
+  }
+
+  std::sort(changes.inserts.begin(), changes.inserts.end(),
+            [](const auto& lhs, const auto& rhs) { return lhs.first_row_id < rhs.first_row_id; });
+
+  for (const auto& insert : changes.inserts) {
+    const auto chunk = get_chunk_to_restore_row(table, insert.first_row_id, placeholder_values);
+    auto chunk_offset = insert.first_row_id.chunk_offset;
+    auto restored_placeholder_rows = false;
+    for (const auto& row : insert.rows) {
+      // The rows of one insert record are located in the same chunk
+      if (chunk_offset < chunk->size()) {
+        restore_placeholder_row(*chunk, chunk_offset, row);
+        restored_placeholder_rows = true;
+      } else {
+        chunk->append(row);
+      }
+      ++chunk_offset;
+    }
+
+    // The pruning statistics of immutable chunks were generated when the checkpoint was loaded
+    if (restored_placeholder_rows && !chunk->is_mutable()) {
+      generate_chunk_pruning_statistics(chunk);
+    }
+  }
+
+  for (const auto& row_id : changes.deletes) {
+    Assert(row_id.chunk_id < table.chunk_count(), "Logged row does not exist. Were the tables loaded correctly?");
+    const auto chunk = table.get_chunk(row_id.chunk_id);
+    Assert(row_id.chunk_offset < chunk->size(), "Logged row does not exist. Were the tables loaded correctly?");
+
+    chunk->mvcc_data()->set_end_cid(row_id.chunk_offset, CommitID{0});
+    chunk->increase_invalid_row_count(1);
+  }
+}
+
+}  // namespace
+
+namespace opossum {
+
+LogManager::~LogManager() { disable(); }
+
+LogManager& LogManager::operator=(LogManager&& log_manager) noexcept {
+  disable();
+  return *this;
+}
+
+void LogManager::enable(const std::filesystem::path& log_file_path, const LogSyncMode sync_mode) {
+  Assert(!_enabled, "Logging is already enabled");
+
+  _file_descriptor = ::open(log_file_path.c_str(), O_WRONLY | O_CREAT | O_APPEND, 0644);
+  Assert(_file_descriptor >= 0,
+         "Cannot open log file " + log_file_path.string() + ": " + std::string{std::strerror(errno)});
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    _sync_mode = sync_mode;
+    _stop_requested = false;
+    _appended_byte_count = 0;
+    _synced_byte_count = 0;
+    _requested_byte_count = 0;
+    _sync_count = 0;
+  }
+
+  _logger_thread = std::thread{&LogManager::_run_logger, this};
+  _enabled = true;
+}
+
+void LogManager::disable() {
+  if (!_enabled) return;
+
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    // Batches that are committed from now on are acknowledged without being logged
+    _enabled = false;
+    _stop_requested = true;
+  }
+  _logger_condition.notify_one();
+
+  // The logger thread writes the pending entries before it stops
+  _logger_thread.join();
+
+  ::close(_file_descriptor);
+  _file_descriptor = -1;
+}
+
+bool LogManager::is_enabled() const { return _enabled; }
+
+LogSyncMode LogManager::sync_mode() const { return _sync_mode; }
+
+void LogManager::flush() {
+  auto lock = std::unique_lock<std::mutex>{_mutex};
+  if (!_enabled) return;
+
+  const auto byte_count = _appended_byte_count;
+  _requested_byte_count = std::max(_requested_byte_count, byte_count);
+  _logger_condition.notify_one();
+
+  _synced_condition.wait(lock, [&] { return _synced_byte_count >= byte_count; });
+}
+
+size_t LogManager::sync_count() const {
+  std::lock_guard<std::mutex> lock(_mutex);
+  return _sync_count;
+}
+
+size_t LogManager::recover(const std::filesystem::path& log_file_path, const CommitID checkpoint_commit_id) {
+  Assert(!_enabled, "Recovery has to happen before logging is enabled");
+
+  if (!std::filesystem::exists(log_file_path)) return 0;
+
+  const auto file_size = std::filesystem::file_size(log_file_path);
+  auto buffer = std::vector<char>(file_size);
+  {
+    auto log_file = std::ifstream{log_file_path, std::ios::binary};
+    log_file.read(buffer.data(), static_cast<std::streamsize>(file_size));
+    Assert(log_file, "Cannot read log file " + log_file_path.string());
+  }
+
+  auto changes_per_table = std::unordered_map<std::string, LoggedChanges>{};
+  auto transaction_count = size_t{0};
+  auto last_commit_id = checkpoint_commit_id;
+
+  auto entry_begin = size_t{0};
+  while (entry_begin + LogEntryWriter::HEADER_SIZE <= file_size) {
+    auto header = std::array<uint32_t, 2>{};
+    std::memcpy(header.data(), buffer.data() + entry_begin, LogEntryWriter::HEADER_SIZE);
+    const auto [payload_size, expected_checksum] = header;
+
+    // Stop at an entry that was not written completely or whose content does not match its checksum
+    const auto payload_begin = entry_begin + LogEntryWriter::HEADER_SIZE;
+    if (payload_begin + payload_size > file_size) break;
+
+    auto checksum = boost::crc_32_type{};
+    checksum.process_bytes(buffer.data() + payload_begin, payload_size);
+    if (checksum.checksum() != expected_checksum) break;
+
+    auto reader = LogEntryReader{buffer.data() + payload_begin, payload_size};
+    const auto commit_id = read_entry(reader, checkpoint_commit_id, changes_per_table);
+    if (commit_id > checkpoint_commit_id) {
+      ++transaction_count;
+      last_commit_id = std::max(last_commit_id, commit_id);
+    }
+
+    entry_begin = payload_begin + payload_size;
+  }
+
+  for (auto& [table_name, changes] : changes_per_table) {
+    const auto table = Hyrise::get().storage_manager.get_table(table_name);
+    apply_changes(*table, changes);
+
+    // The rows are restored without the Insert operator, which maintains the primary key index. Furthermore, the index
+    // of a table loaded from a checkpoint contains the placeholders of rows that are restored now.
+    if (table->primary_key_index()) table->rebuild_primary_key_index();
+  }
+
+  if (entry_begin < file_size) {
+    std::filesystem::resize_file(log_file_path, entry_begin);
+  }
+
+  Hyrise::get().transaction_manager._advance_last_commit_id(last_commit_id);
+
+  return transaction_count;
+}
+
+void LogManager::_append(std::vector<char>&& log_entries, const std::function<void()>& on_durable) {
+  auto defer_callback = false;
+  {
+    std::lock_guard<std::mutex> lock(_mutex);
+    if (_enabled) {
+      _appended_byte_count += log_entries.size();
+      if (_pending_entries.empty()) {
+        _pending_entries = std::move(log_entries);
+      } else {
+        _pending_entries.insert(_pending_entries.end(), log_entries.begin(), log_entries.end());
+      }
+
+      if (_sync_mode == LogSyncMode::Durable) {
+        _pending_callbacks.emplace_back(on_durable);
+        defer_callback = true;
+      }
+    }
+  }
+
+  if (defer_callback) {
+    _logger_condition.notify_one();
+  } else {
+    on_durable();
+  }
+}
+
+void LogManager::_run_logger() {
+  auto entries = std::vector<char>{};
+  auto callbacks = std::vector<std::function<void()>>{};
+
+  while (true) {
+    {
+      auto lock = std::unique_lock<std::mutex>{_mutex};
+      if (_sync_mode == LogSyncMode::Throughput) {
+        // Combine the entries of THROUGHPUT_SYNC_INTERVAL in one sync, unless a flush is requested earlier
+        _logger_condition.wait_for(lock, THROUGHPUT_SYNC_INTERVAL, [&] {
+          return _stop_requested || _requested_byte_count > _synced_byte_count;
+        });
+      }
+
+      // Everything that has been handed over while the previous group was synced forms the next group
+      _logger_condition.wait(lock, [&] { return _stop_requested || !_pending_entries.empty(); });
+      if (_pending_entries.empty()) return;
+
+      entries.swap(_pending_entries);
+      callbacks.swap(_pending_callbacks);
+    }
+
+    _write_and_sync(entries);
+
+    {
+      std::lock_guard<std::mutex> lock(_mutex);
+      _synced_byte_count += entries.size();
+      ++_sync_count;
+    }
+    _synced_condition.notify_all();
+
+    // Publishes the commit batches in the order in which they were handed over
+    for (const auto& callback : callbacks) {
+      callback();
+    }
+
+    entries.clear();
+    callbacks.clear();
+  }
+}
+
+void LogManager::_write_and_sync(const std::vector<char>& buffer) const {
+  auto written_byte_count = size_t{0};
+  while (written_byte_count < buffer.size()) {
+    const auto result =
+        ::write(_file_descriptor, buffer.data() + written_byte_count, buffer.size() - written_byte_count);
+    if (result < 0 && errno == EINTR) continue;
+    Assert(result >= 0, "Cannot write to log file: " + std::string{std::strerror(errno)});
+
+    written_byte_count += static_cast<size_t>(result);
+  }
+
+#ifdef __APPLE__
+  const auto sync_result = ::fsync(_file_descriptor);
+#else
+  const auto sync_result = ::fdatasync(_file_descriptor);
+#endif
+  Assert(sync_result == 0, "Cannot sync log file: " + std::string{std::strerror(errno)});
+}
+
+}  // namespace opossum
@@ -0,0 +1,120 @@
+#pragma once
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <filesystem>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+enum class LogSyncMode {
+  Durable,    // Commits are acknowledged once their log entries have been written and synced to the log file
+  Throughput  // Commits are acknowledged immediately, the log is synced periodically. The most recent commits may be
+              // lost in a crash, but the database is always recovered to a consistent state.
+};
+
+/**
+ * The LogManager implements a redo log (write-ahead log). When a batch of transactions is committed (see
+ * TransactionManager), the Insert and Delete operators of each transaction serialize their modifications into one log
+ * entry per transaction (see LogEntryWriter). The entries of a batch are handed to the LogManager, whose logger thread
+ * writes everything that has been handed to it since its last write and syncs the log file once for all of these
+ * entries (group commit). Commit batches that are handed over while the logger thread is syncing are combined into
+ * the next group.
+ *
+ * In LogSyncMode::Durable, a commit batch only becomes visible to other transactions and its transactions are only
+ * reported as committed once the log file has been synced. This happens in the order in which the batches were handed
+ * over. In LogSyncMode::Throughput, the batch becomes visible right away and the logger thread syncs the log every
+ * THROUGHPUT_SYNC_INTERVAL.
+ *
+ * Logging is disabled by default. Only data modifications are logged, but not the creation or removal of tables.
+ * Thus, recover() must be called after the tables that the logged transactions modified have been loaded in the same
+ * state as when logging was enabled (e.g., from the last checkpoint).
+ */
+class LogManager : public Noncopyable {
+ public:
+  ~LogManager();
+
+  // Opens (or creates) the log file, to which new entries are appended, and starts the logger thread
+  void enable(const std::filesystem::path& log_file_path, const LogSyncMode sync_mode = LogSyncMode::Durable);
+
+  // Waits until all log entries are synced and stops the logger thread
+  void disable();
+
+  bool is_enabled() const;
+  LogSyncMode sync_mode() const;
+
+  // Blocks until all log entries that have been handed to the LogManager before this call are synced
+  void flush();
+
+  // Number of syncs of the log file since logging was enabled. Each sync may cover the entries of multiple commits.
+  size_t sync_count() const;
+
+  /**
+   * Replays the committed transactions from the log file on top of the tables in the StorageManager. Must be called
+   * before logging is enabled. Inserted rows are restored at the positions they had in the logged run and become
+   * visible from the beginning of time (like rows appended by Table::append). Positions of rows that were rolled back
+   * are filled with invisible rows. Deleted rows become invisible for all transactions. Replaying stops at the first
+   * incomplete or corrupted entry (e.g., one that was written partially before a crash). The file is truncated to the
+   * replayed entries, so that new entries are not appended after the corrupted one.
+   *
+   * If the tables were loaded from a checkpoint (see Checkpoint), its commit ID has to be passed. Transactions that
+   * are contained in the checkpoint are skipped. Rows of transactions that committed after the checkpoint's snapshot
+   * may have been allocated before it, in which case the checkpoint holds invisible placeholders at their positions,
+   * which are overwritten. Afterwards, the commit IDs of new transactions continue after the replayed ones.
+   *
+   * @returns the number of replayed transactions
+   */
+  size_t recover(const std::filesystem::path& log_file_path, const CommitID checkpoint_commit_id = CommitID{0});
+
+ private:
+  LogManager() = default;
+
+  friend class Hyrise;
+  friend class TransactionManager;
+
+  // Only disabled LogManagers are assigned, i.e., in Hyrise::reset(). Disables this LogManager before.
+  LogManager& operator=(LogManager&& log_manager) noexcept;
+
+  /**
+   * Hands the serialized log entries of a commit batch to the logger thread. `on_durable` is called once the entries
+   * have been synced (LogSyncMode::Durable) or right away (LogSyncMode::Throughput and if logging is disabled).
+   */
+  void _append(std::vector<char>&& log_entries, const std::function<void()>& on_durable);
+
+  void _run_logger();
+
+  // Writes the entire buffer to the log file and syncs it
+  void _write_and_sync(const std::vector<char>& buffer) const;
+
+  static constexpr auto THROUGHPUT_SYNC_INTERVAL = std::chrono::milliseconds{10};
+
+  std::atomic_bool _enabled{false};
+  LogSyncMode _sync_mode{LogSyncMode::Durable};
+  int _file_descriptor{-1};
+  std::thread _logger_thread;
+
+  // Protects the following members
+  mutable std::mutex _mutex;
+  // Signals the logger thread that entries are pending, a flush was requested, or it should stop
+  std::condition_variable _logger_condition;
+  // Signals waiting flush() calls that entries have been synced
+  std::condition_variable _synced_condition;
+
+  std::vector<char> _pending_entries;
+  std::vector<std::function<void()>> _pending_callbacks;
+  bool _stop_requested{false};
+  // Byte counts of all entries handed to the LogManager, of all entries that have been synced, and the highest count
+  // that a flush() call waits for
+  size_t _appended_byte_count{0};
+  size_t _synced_byte_count{0};
+  size_t _requested_byte_count{0};
+  size_t _sync_count{0};
+};
+
+}  // namespace opossum
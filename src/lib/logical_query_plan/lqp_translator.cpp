@@ -20,7 +20,9 @@
 #include "export_node.hpp"
 #include "expression/abstract_expression.hpp"
 #include "expression/abstract_predicate_expression.hpp"
+#include "expression/binary_predicate_expression.hpp"
 #include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
 #include "expression/lqp_column_expression.hpp"
 #include "expression/lqp_subquery_expression.hpp"
 #include "expression/pqp_column_expression.hpp"
@@ -31,6 +33,7 @@
 #include "insert_node.hpp"
 #include "join_node.hpp"
 #include "limit_node.hpp"
+#include "lossless_cast.hpp"
 #include "operators/aggregate_hash.hpp"
 #include "operators/alias_operator.hpp"
 #include "operators/change_meta_table.hpp"
@@ -41,6 +44,7 @@
 #include "operators/index_scan.hpp"
 #include "operators/insert.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -51,11 +55,13 @@
 #include "operators/maintenance/drop_view.hpp"
 #include "operators/operator_join_predicate.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "operators/primary_key_index_scan.hpp"
 #include "operators/product.hpp"
 #include "operators/projection.hpp"
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "operators/update.hpp"
@@ -64,6 +70,8 @@
 #include "projection_node.hpp"
 #include "sort_node.hpp"
 #include "static_table_node.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "stored_table_node.hpp"
 #include "union_node.hpp"
 #include "update_node.hpp"
@@ -161,6 +169,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node(
       return _translate_predicate_node_to_table_scan(predicate_node, input_operator);
     case ScanType::IndexScan:
       return _translate_predicate_node_to_index_scan(predicate_node, input_operator);
+    case ScanType::PrimaryKeyIndexScan:
+      return _translate_predicate_node_to_primary_key_index_scan(predicate_node, input_operator);
   }
 
   Fail("Invalid enum value");
@@ -206,20 +216,33 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(node->left_input());
   const auto table_name = stored_table_node->table_name;
   const auto table = Hyrise::get().storage_manager.get_table(table_name);
+
+  // The IndexScanRule only chooses an IndexScan if the column has a GroupKey or an AdaptiveRadixTree index
+  auto index_type = SegmentIndexType::GroupKey;
+  for (const auto& index_statistics : table->indexes_statistics()) {
+    if (index_statistics.column_ids == column_ids && index_statistics.type == SegmentIndexType::AdaptiveRadixTree) {
+      index_type = SegmentIndexType::AdaptiveRadixTree;
+    }
+  }
+
   std::vector<ChunkID> indexed_chunks;
 
   const auto chunk_count = table->chunk_count();
   for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
     const auto chunk = table->get_chunk(chunk_id);
-    if (chunk && chunk->get_index(SegmentIndexType::GroupKey, column_ids)) {
+    if (!chunk) continue;
+
+    // Chunks that have not been encoded yet may have a mutable index instead of an AdaptiveRadixTreeIndex
+    if (chunk->get_index(index_type, column_ids) ||
+        (index_type == SegmentIndexType::AdaptiveRadixTree && chunk->get_mutable_index(column_id))) {
       indexed_chunks.emplace_back(chunk_id);
     }
   }
 
   // All chunks that have an index on column_ids are handled by an IndexScan. All other chunks are handled by
   // TableScan(s).
-  auto index_scan = std::make_shared<IndexScan>(input_operator, SegmentIndexType::GroupKey, column_ids,
-                                                predicate->predicate_condition, right_values, right_values2);
+  auto index_scan = std::make_shared<IndexScan>(input_operator, index_type, column_ids, predicate->predicate_condition,
+                                                right_values, right_values2);
 
   const auto table_scan = _translate_predicate_node_to_table_scan(node, input_operator);
 
@@ -233,6 +256,22 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_in
   return std::make_shared<UnionAll>(index_scan, table_scan);
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_predicate_node_to_primary_key_index_scan(
+    const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
+  // The IndexScanRule created a conjunction of `<column> = <value>` predicates in the order of the primary key columns
+  Assert(node->left_input()->type == LQPNodeType::StoredTable, "PrimaryKeyIndexScan must follow a StoredTableNode.");
+
+  auto key_expressions = std::vector<std::shared_ptr<AbstractExpression>>{};
+  for (const auto& key_predicate : flatten_logical_expressions(node->predicate(), LogicalOperator::And)) {
+    const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(key_predicate);
+    Assert(binary_predicate && binary_predicate->predicate_condition == PredicateCondition::Equals,
+           "Expected equality predicates for PrimaryKeyIndexScan");
+    key_expressions.emplace_back(_translate_expression(binary_predicate->right_operand(), node->left_input()));
+  }
+
+  return std::make_shared<PrimaryKeyIndexScan>(input_operator, key_expressions);
+}
+
 std::shared_ptr<TableScan> LQPTranslator::_translate_predicate_node_to_table_scan(
     const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const {
   return std::make_shared<TableScan>(input_operator, _translate_expression(node->predicate(), node->left_input()));
@@ -266,34 +305,8 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_projection_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_sort_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
   auto input_operator = translate_node(node->left_input());
-
-  /**
-   * Go through all the order descriptions and create a sort operator for each of them.
-   * Iterate in reverse because the sort operator does not support multiple columns, and instead relies on stable sort.
-   * We therefore sort by the n+1-th column before sorting by the n-th column.
-   */
-
-  std::shared_ptr<AbstractOperator> current_pqp = input_operator;
-  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
-  if (pqp_expressions.size() > 1) {
-    PerformanceWarning("Multiple ORDER BYs are executed one-by-one");
-  }
-
-  auto pqp_expression_iter = pqp_expressions.rbegin();
-  auto order_by_mode_iter = sort_node->order_by_modes.rbegin();
-
-  for (; pqp_expression_iter != pqp_expressions.rend(); ++pqp_expression_iter, ++order_by_mode_iter) {
-    const auto& pqp_expression = *pqp_expression_iter;
-    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
-    Assert(pqp_column_expression,
-           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
-
-    current_pqp = std::make_shared<Sort>(current_pqp, pqp_column_expression->column_id, *order_by_mode_iter);
-  }
-
-  return current_pqp;
+  return std::make_shared<Sort>(input_operator, _translate_sort_definitions(node));
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
@@ -325,6 +338,12 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   const auto& primary_join_predicate = join_predicates.front();
   std::vector<OperatorJoinPredicate> secondary_join_predicates(join_predicates.cbegin() + 1, join_predicates.cend());
 
+  if (join_node->join_mode == JoinMode::Inner && secondary_join_predicates.empty() &&
+      primary_join_predicate.predicate_condition == PredicateCondition::Equals) {
+    const auto index_join = _translate_join_node_to_index_join(join_node, primary_join_predicate);
+    if (index_join) return index_join;
+  }
+
   auto join_operator = std::shared_ptr<AbstractOperator>{};
 
   const auto left_data_type = join_node->join_predicates().front()->arguments[0]->data_type();
@@ -351,6 +370,81 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node(
   return join_operator;
 }
 
+std::shared_ptr<AbstractOperator> LQPTranslator::_translate_join_node_to_index_join(
+    const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& primary_join_predicate) const {
+  /**
+   * If one input is a (validated) StoredTableNode whose join column is indexed, a JoinIndex can look up each row of the
+   * other input (the probe side) in the index instead of reading the entire indexed table (index nested loop join).
+   *
+   * A PrimaryKeyIndex that consists of the join column is looked up once per probe side row. As JoinIndex checks the
+   * visibility of the rows it finds in this index, the StoredTableNode is translated without its ValidateNode, so that
+   * the indexed table is neither validated nor scanned. Otherwise, the chunk indexes on the join column are looked up
+   * once per probe side row and indexed chunk, and chunks without such an index are joined using a nested loop. Here,
+   * the ValidateNode is kept and JoinIndex uses the indexes of the chunks that the validated rows belong to.
+   *
+   * Lacking a proper cost model, the index join is only chosen if the estimated number of index lookups (plus the
+   * number of comparisons for chunks without an index) does not exceed the number of rows in the indexed table, which
+   * a JoinHash would have to materialize. Thus, the index join is used for small probe sides only.
+   */
+  const auto cardinality_estimator = CardinalityEstimator{};
+
+  for (const auto index_side : {IndexSide::Right, IndexSide::Left}) {
+    const auto index_side_node = index_side == IndexSide::Right ? join_node->right_input() : join_node->left_input();
+    const auto probe_side_node = index_side == IndexSide::Right ? join_node->left_input() : join_node->right_input();
+    const auto join_column_id = index_side == IndexSide::Right ? primary_join_predicate.column_ids.second
+                                                               : primary_join_predicate.column_ids.first;
+
+    const auto stored_table_node = std::dynamic_pointer_cast<StoredTableNode>(
+        index_side_node->type == LQPNodeType::Validate ? index_side_node->left_input() : index_side_node);
+    if (!stored_table_node) continue;
+
+    const auto join_column =
+        std::dynamic_pointer_cast<LQPColumnExpression>(index_side_node->column_expressions()[join_column_id]);
+    if (!join_column || join_column->column_reference.original_node() != stored_table_node) continue;
+    const auto indexed_column_ids = std::vector<ColumnID>{join_column->column_reference.original_column_id()};
+
+    const auto table = Hyrise::get().storage_manager.get_table(stored_table_node->table_name);
+    const auto primary_key_index = table->primary_key_index();
+    const auto uses_primary_key_index = primary_key_index && primary_key_index->column_ids() == indexed_column_ids;
+
+    auto lookups_per_probe_side_row = Cardinality{0};
+    if (uses_primary_key_index) {
+      lookups_per_probe_side_row = 1;
+    } else {
+      const auto indexes_statistics = table->indexes_statistics();
+      const auto has_chunk_indexes =
+          std::any_of(indexes_statistics.cbegin(), indexes_statistics.cend(),
+                      [&](const auto& index_statistics) { return index_statistics.column_ids == indexed_column_ids; });
+      if (!has_chunk_indexes) continue;
+
+      const auto chunk_count = table->chunk_count();
+      for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+        const auto chunk = table->get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        if (chunk->get_indexes(indexed_column_ids).empty()) {
+          lookups_per_probe_side_row += static_cast<Cardinality>(chunk->size());
+        } else {
+          ++lookups_per_probe_side_row;
+        }
+      }
+    }
+
+    const auto probe_side_row_count = cardinality_estimator.estimate_cardinality(probe_side_node);
+    if (probe_side_row_count * lookups_per_probe_side_row > static_cast<Cardinality>(table->row_count())) continue;
+
+    const auto index_side_operator = translate_node(uses_primary_key_index ? stored_table_node : index_side_node);
+    if (index_side == IndexSide::Right) {
+      return std::make_shared<JoinIndex>(translate_node(probe_side_node), index_side_operator, JoinMode::Inner,
+                                         primary_join_predicate, std::vector<OperatorJoinPredicate>{}, index_side);
+    }
+    return std::make_shared<JoinIndex>(index_side_operator, translate_node(probe_side_node), JoinMode::Inner,
+                                       primary_join_predicate, std::vector<OperatorJoinPredicate>{}, index_side);
+  }
+
+  return nullptr;
+}
+
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
   const auto aggregate_node = std::dynamic_pointer_cast<AggregateNode>(node);
@@ -392,10 +486,25 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_aggregate_node(
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_limit_node(
     const std::shared_ptr<AbstractLQPNode>& node) const {
-  const auto input_operator = translate_node(node->left_input());
   auto limit_node = std::dynamic_pointer_cast<LimitNode>(node);
-  return std::make_shared<Limit>(
-      input_operator, _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front());
+  const auto row_count_expression =
+      _translate_expressions({limit_node->num_rows_expression()}, node->left_input()).front();
+
+  // ORDER BY ... LIMIT n with a small, constant n is executed as a TopK, which does not sort the entire input. If the
+  // SortNode has other outputs, it needs to be translated anyway and we stick to Sort + Limit.
+  const auto& input_node = node->left_input();
+  if (input_node->type == LQPNodeType::Sort && input_node->output_count() == 1) {
+    if (const auto value_expression = std::dynamic_pointer_cast<ValueExpression>(row_count_expression)) {
+      const auto row_count = lossless_variant_cast<int64_t>(value_expression->value);
+      if (row_count && *row_count >= 0 && static_cast<size_t>(*row_count) <= TopK::MAX_ROW_COUNT) {
+        const auto input_operator = translate_node(input_node->left_input());
+        return std::make_shared<TopK>(input_operator, _translate_sort_definitions(input_node), row_count_expression);
+      }
+    }
+  }
+
+  const auto input_operator = translate_node(node->left_input());
+  return std::make_shared<Limit>(input_operator, row_count_expression);
 }
 
 std::shared_ptr<AbstractOperator> LQPTranslator::_translate_insert_node(
@@ -521,6 +630,27 @@ std::shared_ptr<AbstractOperator> LQPTranslator::_translate_dummy_table_node(
   return std::make_shared<TableWrapper>(Projection::dummy_table());
 }
 
+std::vector<SortColumnDefinition> LQPTranslator::_translate_sort_definitions(
+    const std::shared_ptr<AbstractLQPNode>& node) const {
+  const auto sort_node = std::dynamic_pointer_cast<SortNode>(node);
+  const auto& pqp_expressions = _translate_expressions(sort_node->node_expressions, node->left_input());
+
+  auto sort_definitions = std::vector<SortColumnDefinition>{};
+  sort_definitions.reserve(pqp_expressions.size());
+
+  auto order_by_mode_iter = sort_node->order_by_modes.begin();
+  for (const auto& pqp_expression : pqp_expressions) {
+    const auto pqp_column_expression = std::dynamic_pointer_cast<PQPColumnExpression>(pqp_expression);
+    Assert(pqp_column_expression,
+           "Sort Expression '"s + pqp_expression->as_column_name() + "' must be available as column, LQP is invalid");
+
+    sort_definitions.emplace_back(pqp_column_expression->column_id, *order_by_mode_iter);
+    ++order_by_mode_iter;
+  }
+
+  return sort_definitions;
+}
+
 std::shared_ptr<AbstractExpression> LQPTranslator::_translate_expression(
     const std::shared_ptr<AbstractExpression>& lqp_expression, const std::shared_ptr<AbstractLQPNode>& node) const {
   auto pqp_expression = lqp_expression->deep_copy();
@@ -2,16 +2,19 @@
 
 #include <memory>
 #include <unordered_map>
+#include <vector>
 
 #include "abstract_lqp_node.hpp"
 #include "all_type_variant.hpp"
 #include "operators/abstract_operator.hpp"
+#include "types.hpp"
 
 namespace opossum {
 
 class AbstractOperator;
 class TransactionContext;
 class AbstractExpression;
+class JoinNode;
 class PredicateNode;
 class TableScan;
 struct OperatorScanPredicate;
@@ -35,12 +38,16 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_predicate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_predicate_node_to_index_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
+  std::shared_ptr<AbstractOperator> _translate_predicate_node_to_primary_key_index_scan(
+      const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<TableScan> _translate_predicate_node_to_table_scan(
       const std::shared_ptr<PredicateNode>& node, const std::shared_ptr<AbstractOperator>& input_operator) const;
   std::shared_ptr<AbstractOperator> _translate_alias_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_projection_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_sort_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_join_node(const std::shared_ptr<AbstractLQPNode>& node) const;
+  std::shared_ptr<AbstractOperator> _translate_join_node_to_index_join(
+      const std::shared_ptr<JoinNode>& join_node, const OperatorJoinPredicate& primary_join_predicate) const;
   std::shared_ptr<AbstractOperator> _translate_aggregate_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_limit_node(const std::shared_ptr<AbstractLQPNode>& node) const;
   std::shared_ptr<AbstractOperator> _translate_insert_node(const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -65,6 +72,9 @@ class LQPTranslator {
   std::shared_ptr<AbstractOperator> _translate_create_prepared_plan_node(
       const std::shared_ptr<AbstractLQPNode>& node) const;
 
+  // Translate the expressions and order by modes of a SortNode into the sort definitions of a Sort or TopK operator
+  std::vector<SortColumnDefinition> _translate_sort_definitions(const std::shared_ptr<AbstractLQPNode>& node) const;
+
   // Translate LQP- to PQPExpressions
   std::shared_ptr<AbstractExpression> _translate_expression(const std::shared_ptr<AbstractExpression>& lqp_expression,
                                                             const std::shared_ptr<AbstractLQPNode>& node) const;
@@ -14,7 +14,7 @@ namespace opossum {
 
 class AbstractExpression;
 
-enum class ScanType : uint8_t { TableScan, IndexScan };
+enum class ScanType : uint8_t { TableScan, IndexScan, PrimaryKeyIndexScan };
 
 /**
  * This node type represents a filter.
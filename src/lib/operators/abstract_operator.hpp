@@ -32,12 +32,14 @@ enum class OperatorType {
   JoinSortMerge,
   JoinVerification,
   Limit,
+  PrimaryKeyIndexScan,
   Print,
   Product,
   Projection,
   Sort,
   TableScan,
   TableWrapper,
+  TopK,
   UnionAll,
   UnionPositions,
   Update,
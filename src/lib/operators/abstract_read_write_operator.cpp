@@ -51,6 +51,12 @@ void AbstractReadWriteOperator::rollback_records() {
   _state = ReadWriteOperatorState::RolledBack;
 }
 
+void AbstractReadWriteOperator::write_log_records(LogEntryWriter& log_entry_writer) const {
+  Assert(_state == ReadWriteOperatorState::Committed, "Only the records of committed operators can be logged.");
+
+  _on_write_log_records(log_entry_writer);
+}
+
 bool AbstractReadWriteOperator::execute_failed() const {
   return _state == ReadWriteOperatorState::Failed || _state == ReadWriteOperatorState::RolledBack;
 }
@@ -13,6 +13,8 @@
 
 namespace opossum {
 
+class LogEntryWriter;
+
 enum class ReadWriteOperatorState {
   Pending,     // The operator has been instantiated.
   Executed,    // Execution succeeded.
@@ -48,6 +50,11 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   void rollback_records();
 
+  /**
+   * Serializes the committed changes into the log entry of the transaction if logging is enabled (see LogManager).
+   */
+  void write_log_records(LogEntryWriter& log_entry_writer) const;
+
   /**
    * Returns true if a previous call to _on_execute produced an error.
    */
@@ -80,6 +87,12 @@ class AbstractReadWriteOperator : public AbstractOperator {
    */
   virtual void _on_rollback_records() = 0;
 
+  /**
+   * Called by write_log_records. Operators that only delegate their changes to other read/write operators registered
+   * in the same transaction (e.g., Update) do not need to write log records.
+   */
+  virtual void _on_write_log_records(LogEntryWriter& log_entry_writer) const {}
+
   /**
    * This method is used in sub classes in their _on_execute() method.
    *
@@ -1,7 +1,12 @@
 #include "aggregate_hash.hpp"
 
+#include <algorithm>
+#include <array>
+#include <atomic>
 #include <cmath>
 #include <memory>
+#include <mutex>
+#include <numeric>
 #include <optional>
 #include <string>
 #include <unordered_map>
@@ -18,61 +23,299 @@
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
 #include "storage/create_iterable_from_segment.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
-#include "utils/aligned_size.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
 
 namespace {
 using namespace opossum;  // NOLINT
 
-// Given an AggregateKey key, and a RowId row_id where this AggregateKey was encountered, this first checks if the
-// AggregateKey was seen before. If not, a new aggregate result is inserted into results and connected to the row id.
-// This is important so that we can reconstruct the original values later. In any case, a reference to the result is
-// returned so that result information, such as the aggregate's count or sum, can be modified by the caller.
-template <typename ResultIds, typename Results, typename AggregateKey>
-typename Results::reference get_or_add_result(ResultIds& result_ids, Results& results, const AggregateKey& key,
-                                              const RowID& row_id) {
-  // Get the result id for the current key or add it to the id map
-  if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-    if (results.empty()) {
-      results.emplace_back();
-      results[0].row_id = row_id;
-    }
-    return results[0];
-  } else {
-    auto it = result_ids.find(key);
-    if (it != result_ids.end()) return results[it->second];
+// The merge phase uses up to 2^MAX_RADIX_BITS partitions
+constexpr auto MAX_RADIX_BITS = size_t{6};
+
+// Assigns a group to one of the 2^radix_bits partitions of the merge phase. As std::hash is the identity for integers,
+// the hash is multiplied with 2^64 / phi (Fibonacci hashing) so that the upper bits, which select the partition,
+// depend on all bits of the key.
+template <typename AggregateKey>
+size_t radix_partition(const AggregateKey& key, const size_t radix_bits) {
+  if (radix_bits == 0) return 0;
 
-    auto result_id = results.size();
+  const auto hash = static_cast<uint64_t>(std::hash<AggregateKey>{}(key));
+  return static_cast<size_t>((hash * uint64_t{11'400'714'819'323'198'485u}) >> (64 - radix_bits));
+}
 
-    result_ids.emplace_hint(it, key, result_id);
+// The pre-aggregation numbers the groups of a chunk via an array indexed by the combined ValueIDs of the GROUP BY
+// segments if there are at most MAX_DENSE_GROUP_COUNT combinations
+constexpr auto MAX_DENSE_GROUP_COUNT = size_t{1} << 16;
+
+// If the values of the segment are stored in a dictionary-encoded segment, returns that segment. If the segment is a
+// ReferenceSegment that references a single chunk (as produced by the TableScan), the referenced positions are
+// returned as well. Otherwise, the returned segment is nullptr.
+std::pair<std::shared_ptr<const BaseDictionarySegment>, std::shared_ptr<const PosList>> resolve_dictionary_segment(
+    const std::shared_ptr<const BaseSegment>& segment) {
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    const auto& pos_list = reference_segment->pos_list();
+    if (pos_list->empty() || !pos_list->references_single_chunk()) return {};
+
+    const auto referenced_chunk = reference_segment->referenced_table()->get_chunk(pos_list->common_chunk_id());
+    const auto referenced_segment = referenced_chunk->get_segment(reference_segment->referenced_column_id());
+    return {std::dynamic_pointer_cast<const BaseDictionarySegment>(referenced_segment), pos_list};
+  }
 
-    // If it was added to the id map, add the current row id to the result list so that we can revert the
-    // value(s) -> key mapping
-    results.emplace_back();
-    results[result_id].row_id = row_id;
+  return {std::dynamic_pointer_cast<const BaseDictionarySegment>(segment), nullptr};
+}
 
-    return results[result_id];
+// If all GROUP BY segments of a chunk are dictionary-encoded, the ValueIDs of a row identify its group within the
+// chunk. For each row, the ValueIDs are combined into a single index in [0, count), similar to the digits of a number.
+struct DenseGroupIndices {
+  std::vector<uint32_t> indices;
+  size_t count;
+};
+
+std::optional<DenseGroupIndices> compute_dense_group_indices(const Chunk& chunk,
+                                                             const std::vector<ColumnID>& groupby_column_ids) {
+  auto dictionary_segments =
+      std::vector<std::pair<std::shared_ptr<const BaseDictionarySegment>, std::shared_ptr<const PosList>>>{};
+  auto count = size_t{1};
+  for (const auto column_id : groupby_column_ids) {
+    auto dictionary_segment_and_positions = resolve_dictionary_segment(chunk.get_segment(column_id));
+    if (!dictionary_segment_and_positions.first) return std::nullopt;
+
+    // The ValueIDs of a segment range from 0 to its null_value_id
+    count *= static_cast<size_t>(dictionary_segment_and_positions.first->null_value_id()) + 1;
+    if (count > MAX_DENSE_GROUP_COUNT) return std::nullopt;
+
+    dictionary_segments.emplace_back(std::move(dictionary_segment_and_positions));
   }
+
+  auto dense_group_indices = DenseGroupIndices{std::vector<uint32_t>(chunk.size()), count};
+  for (const auto& dictionary_segment_and_positions : dictionary_segments) {
+    const auto& dictionary_segment = *dictionary_segment_and_positions.first;
+    const auto base = static_cast<uint32_t>(dictionary_segment.null_value_id()) + 1;
+
+    auto chunk_offset = ChunkOffset{0};
+    const auto iterable = create_iterable_from_attribute_vector(dictionary_segment);
+    iterable.for_each(dictionary_segment_and_positions.second, [&](const auto& position) {
+      auto& index = dense_group_indices.indices[chunk_offset];
+      index = index * base + static_cast<uint32_t>(position.value());
+      ++chunk_offset;
+    });
+  }
+
+  return dense_group_indices;
 }
 
-template <typename AggregateKey>
-const AggregateKey& get_aggregate_key([[maybe_unused]] const KeysPerChunk<AggregateKey>& keys_per_chunk,
-                                      [[maybe_unused]] const ChunkID chunk_id,
-                                      [[maybe_unused]] const ChunkOffset chunk_offset) {
-  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-    const auto& hash_keys = keys_per_chunk[chunk_id];
+// Creates one result per group of a chunk and remembers the position where the group was encountered first. This is
+// important so that we can reconstruct the GROUP BY values later.
+template <typename Results>
+void initialize_results(Results& results, const PosList& group_row_ids) {
+  results.resize(group_row_ids.size());
+  for (auto group_id = size_t{0}; group_id < group_row_ids.size(); ++group_id) {
+    results[group_id].row_id = group_row_ids[group_id];
+  }
+}
+
+// Assigns IDs to the GROUP BY values of a column that cannot be used as an AggregateKeyEntry directly. The map is
+// shared by the pre-aggregation jobs of all chunks, each of which looks up every distinct value of its chunk only once.
+// It is sharded by the hash of the values so that concurrent jobs rarely wait for each other.
+struct BaseGroupByIdMap {
+  virtual ~BaseGroupByIdMap() = default;
+};
+
+template <typename ColumnDataType>
+class GroupByIdMap : public BaseGroupByIdMap {
+ public:
+  explicit GroupByIdMap(const AggregateKeyEntry first_id) : _next_id(first_id) {}
+
+  AggregateKeyEntry get_id(const ColumnDataType& value) {
+    auto& shard = _shards[radix_partition(value, SHARD_BITS)];
+
+    std::lock_guard<std::mutex> lock(shard.mutex);
+    const auto [it, inserted] = shard.ids.try_emplace(value, AggregateKeyEntry{0});
+    if (inserted) it->second = _next_id++;
+    return it->second;
+  }
 
-    return hash_keys[chunk_offset];
+ private:
+  static constexpr auto SHARD_BITS = size_t{6};
+
+  struct alignas(64) Shard {
+    std::mutex mutex;
+    std::unordered_map<ColumnDataType, AggregateKeyEntry> ids;
+  };
+
+  std::array<Shard, size_t{1} << SHARD_BITS> _shards;
+  std::atomic<AggregateKeyEntry> _next_id;
+};
+
+// We want to fill keys[chunk_offset] with something that uniquely identifies the group into which that position
+// belongs. There are a couple of options here (cf. AggregateHash::_on_execute):
+//
+// 0 GROUP BY columns:   No partitioning needed; we don't reach this point because of the check for EmptyAggregateKey
+// 1 GROUP BY column:    The AggregateKey is one dimensional, i.e., the same as AggregateKeyEntry
+// > 1 GROUP BY columns: The AggregateKey is multi-dimensional. The value in keys[chunk_offset] is subscripted with the
+//                       index of the GROUP BY columns (not the same as the GROUP BY column_id)
+//
+// To generate a unique identifier, we map the value found in the respective GROUP BY column to a unique uint64_t. The
+// value 0 is reserved for NULL. As the keys of different chunks are compared in the merge phase, the identifiers have
+// to be the same for all chunks.
+//
+// This has the cost of a hashmap lookup for each row and each GROUP BY column. The lookups in the shared id_map are
+// limited to the distinct values of the chunk by a chunk-local map. There are some cases in which we can avoid the
+// lookups altogether. These make use of the fact that we can only have 2^64 - 2*2^32 values in a table (due to
+// INVALID_VALUE_ID and INVALID_CHUNK_OFFSET limiting the range of RowIDs).
+//
+// (1) For types smaller than AggregateKeyEntry, such as int32_t, their value range can be immediately mapped into
+//     uint64_t. We cannot do the same for int64_t because we need to account for NULL values.
+// (2) For strings not longer than five characters, there are 1+2^(1*8)+2^(2*8)+2^(3*8)+2^(4*8) potential values.
+//     We can immediately map these into a numerical representation by reinterpreting their byte storage as an
+//     integer. The calculation is described below. Note that this is done on a per-string basis and does not
+//     require all strings in the given column to be that short.
+// (3) For DictionarySegments, the ID is determined once per value in the dictionary. The IDs of the rows are then
+//     looked up using their ValueIDs.
+template <typename AggregateKey, typename ColumnDataType>
+void write_groupby_keys(const std::shared_ptr<const BaseSegment>& segment, const size_t group_column_index,
+                        GroupByIdMap<ColumnDataType>* id_map, AggregateKeys<AggregateKey>& keys) {
+  const auto write_id = [&](const ChunkOffset chunk_offset, const AggregateKeyEntry id) {
+    if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
+      keys[chunk_offset] = id;
+    } else {
+      keys[chunk_offset][group_column_index] = id;
+    }
+  };
+
+  if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
+    // For values with a smaller type than AggregateKeyEntry, we can use the value itself as an AggregateKeyEntry. We
+    // cannot do this for types with the same size as AggregateKeyEntry as we need to have a special NULL value. By
+    // using the value itself, we can save us the effort of looking up the id_map.
+    const auto int_to_uint = [](const int32_t value) {
+      // We need to convert a potentially negative int32_t value into the uint64_t space. We do not care about
+      // preserving the value, just its uniqueness. Subtract the minimum value in int32_t (which is negative itself) to
+      // get a positive number.
+      const auto shifted_value = static_cast<int64_t>(value) - std::numeric_limits<int32_t>::min();
+      DebugAssert(shifted_value >= 0, "Type conversion failed");
+      return static_cast<uint64_t>(shifted_value);
+    };
+
+    ChunkOffset chunk_offset{0};
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      write_id(chunk_offset, position.is_null() ? AggregateKeyEntry{0} : int_to_uint(position.value()) + 1);
+      ++chunk_offset;
+    });
   } else {
-    // We have to return a reference to something, so we create a static EmptyAggregateKey here which is used by
-    // every call.
-    static EmptyAggregateKey empty_aggregate_key;
-    return empty_aggregate_key;
+    /*
+    Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
+    The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
+    */
+    DebugAssert(id_map, "Expected an id_map for the GROUP BY column");
+
+    // Caches the IDs of the values that were already looked up in the shared id_map
+    auto local_ids = std::unordered_map<ColumnDataType, AggregateKeyEntry>{};
+
+    // Returns the ID of a value that is not NULL. If the values of the segment are known to be distinct, the
+    // chunk-local map is skipped.
+    const auto get_id = [&](const ColumnDataType& value, const bool distinct) {
+      if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {  // NOLINT
+        const auto& string = value;
+        if (string.size() < 5) {
+          static_assert(std::is_same_v<AggregateKeyEntry, uint64_t>, "Calculation only valid for uint64_t");
+
+          const auto char_to_uint = [](const char in, const uint bits) {
+            // chars may be signed or unsigned. For the calculation as described below, we need signed chars.
+            return static_cast<uint64_t>(*reinterpret_cast<const uint8_t*>(&in)) << bits;
+          };
+
+          switch (string.size()) {
+              // Optimization for short strings (see above):
+              //
+              // NULL:              0
+              // str.length() == 0: 1
+              // str.length() == 1: 2 + (uint8_t) str            // maximum: 257 (2 + 0xff)
+              // str.length() == 2: 258 + (uint16_t) str         // maximum: 65'793 (258 + 0xffff)
+              // str.length() == 3: 65'794 + (uint24_t) str      // maximum: 16'843'009
+              // str.length() == 4: 16'843'010 + (uint32_t) str  // maximum: 4'311'810'305
+              // str.length() >= 5: map-based identifiers, starting at 5'000'000'000 for better distinction
+              //
+              // This could be extended to longer strings if the size of the input table (and thus the maximum number
+              // of distinct strings) is taken into account. For now, let's not make it even more complicated.
+
+            case 0:
+              return uint64_t{1};
+
+            case 1:
+              return uint64_t{2} + char_to_uint(string[0], 0);
+
+            case 2:
+              return uint64_t{258} + char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
+
+            case 3:
+              return uint64_t{65'794} + char_to_uint(string[2], 16) + char_to_uint(string[1], 8) +
+                     char_to_uint(string[0], 0);
+
+            case 4:
+              return uint64_t{16'843'010} + char_to_uint(string[3], 24) + char_to_uint(string[2], 16) +
+                     char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
+          }
+        }
+      }
+
+      // Could not take the shortcut above, either because we don't have a string or because it is too long
+      if (distinct) return id_map->get_id(value);
+
+      const auto it = local_ids.find(value);
+      if (it != local_ids.end()) return it->second;
+
+      const auto id = id_map->get_id(value);
+      local_ids.emplace(value, id);
+      return id;
+    };
+
+    // If the values are stored in a DictionarySegment, we get the ID once per value in the dictionary instead of once
+    // per row. For each row, the ID is then looked up using its ValueID.
+    const auto dictionary_segment_and_positions = resolve_dictionary_segment(segment);
+    const auto dictionary_segment =
+        std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(dictionary_segment_and_positions.first);
+    if (dictionary_segment) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+
+      // The null_value_id is the size of the dictionary. NULL values get the ID 0.
+      auto id_per_value_id = std::vector<AggregateKeyEntry>(dictionary.size() + 1, AggregateKeyEntry{0});
+      for (auto value_id = size_t{0}; value_id < dictionary.size(); ++value_id) {
+        id_per_value_id[value_id] = get_id(dictionary[value_id], true);
+      }
+
+      ChunkOffset chunk_offset{0};
+      const auto iterable = create_iterable_from_attribute_vector(*dictionary_segment);
+      iterable.for_each(dictionary_segment_and_positions.second, [&](const auto& position) {
+        write_id(chunk_offset, id_per_value_id[position.value()]);
+        ++chunk_offset;
+      });
+      return;
+    }
+
+    ChunkOffset chunk_offset{0};
+    segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+      write_id(chunk_offset, position.is_null() ? AggregateKeyEntry{0} : get_id(position.value(), false));
+      ++chunk_offset;
+    });
   }
 }
 
+// The result of pre-aggregating a single chunk. Its groups are numbered in the order in which they were encountered.
+template <typename AggregateKey>
+struct PartialAggregation {
+  // The key of each group. Not filled if AggregateKey == EmptyAggregateKey.
+  AggregateKeys<AggregateKey> keys;
+
+  // One context per aggregate column, holding the partial results indexed by the chunk-local group ID
+  std::vector<std::shared_ptr<SegmentVisitorContext>> contexts;
+
+  // The chunk-local group IDs, radix-partitioned by the hash of the group's key
+  std::vector<std::vector<AggregateResultId>> group_ids_per_partition;
+};
+
 }  // namespace
 
 namespace opossum {
@@ -98,8 +341,8 @@ void AggregateHash::_on_set_parameters(const std::unordered_map<ParameterID, All
 void AggregateHash::_on_cleanup() { _contexts_per_column.clear(); }
 
 /*
-Visitor context for the AggregateVisitor. The AggregateResultContext can be used without knowing the
-AggregateKey, the AggregateContext is the "full" version.
+Visitor context for the AggregateVisitor. It holds the results of a single aggregate column, indexed by
+AggregateResultId.
 */
 template <typename ColumnDataType, typename AggregateType>
 struct AggregateResultContext : SegmentVisitorContext {
@@ -111,39 +354,107 @@ struct AggregateResultContext : SegmentVisitorContext {
   AggregateResults<ColumnDataType, AggregateType> results;
 };
 
-template <typename ColumnDataType, typename AggregateType, typename AggregateKey>
-struct AggregateContext : public AggregateResultContext<ColumnDataType, AggregateType> {
-  AggregateContext() {
-    auto allocator = AggregateResultIdMapAllocator<AggregateKey>{&this->buffer};
+// Merges two partial results of the same group, which were aggregated from different chunks
+template <typename ColumnDataType, AggregateFunction function,
+          typename AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType>
+void merge_aggregate_results(SegmentVisitorContext& source_context, SegmentVisitorContext& target_context,
+                             const std::vector<AggregateResultId>& source_ids,
+                             const std::vector<AggregateResultId>& target_ids) {
+  auto& source_results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(source_context).results;
+  auto& target_results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(target_context).results;
+
+  for (auto index = size_t{0}; index < source_ids.size(); ++index) {
+    auto& source = source_results[source_ids[index]];
+    const auto target_id = target_ids[index];
+
+    if (target_id == target_results.size()) {
+      // The group has not been seen before. The target keeps the position at which the group was encountered first.
+      target_results.emplace_back(std::move(source));
+      continue;
+    }
 
-    // Unused if AggregateKey == EmptyAggregateKey, but we initialize it anyway to reduce the number of diverging code
-    // paths.
-    // NOLINTNEXTLINE(clang-analyzer-core.CallAndMessage) - false warning: called C++ object (result_ids) is null
-    result_ids = std::make_unique<AggregateResultIdMap<AggregateKey>>(allocator);
-  }
+    auto& target = target_results[target_id];
+    target.aggregate_count += source.aggregate_count;
 
-  std::unique_ptr<AggregateResultIdMap<AggregateKey>> result_ids;
-};
+    if constexpr (function == AggregateFunction::Min) {
+      if (source.current_primary_aggregate &&
+          (!target.current_primary_aggregate ||
+           value_smaller(*source.current_primary_aggregate, *target.current_primary_aggregate))) {
+        target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+      }
+    } else if constexpr (function == AggregateFunction::Max) {
+      if (source.current_primary_aggregate &&
+          (!target.current_primary_aggregate ||
+           value_greater(*source.current_primary_aggregate, *target.current_primary_aggregate))) {
+        target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+      }
+    } else if constexpr (function == AggregateFunction::Sum || function == AggregateFunction::Avg) {
+      if (!source.current_primary_aggregate) continue;
+
+      if (target.current_primary_aggregate) {
+        *target.current_primary_aggregate += *source.current_primary_aggregate;
+      } else {
+        target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+      }
+    } else if constexpr (function == AggregateFunction::CountDistinct) {
+      target.distinct_values.merge(source.distinct_values);
+    } else if constexpr (function == AggregateFunction::StandardDeviationSample) {
+      if constexpr (std::is_arithmetic_v<AggregateType>) {
+        // See AggregateFunctionBuilder for the meaning of the secondary aggregates
+        if (source.current_secondary_aggregates.empty()) continue;
+
+        if (target.current_secondary_aggregates.empty()) {
+          target.current_secondary_aggregates = std::move(source.current_secondary_aggregates);
+          target.current_primary_aggregate = source.current_primary_aggregate;
+          continue;
+        }
+
+        // Combine the counts, means, and squared distances from the mean of both partial results
+        // https://en.wikipedia.org/wiki/Algorithms_for_calculating_variance#Parallel_algorithm
+        auto& count = target.current_secondary_aggregates[0];
+        auto& mean = target.current_secondary_aggregates[1];
+        auto& squared_distance_from_mean = target.current_secondary_aggregates[2];
+        const auto source_count = source.current_secondary_aggregates[0];
+        const auto source_mean = source.current_secondary_aggregates[1];
+        const auto source_squared_distance_from_mean = source.current_secondary_aggregates[2];
+
+        const auto combined_count = count + source_count;
+        const auto delta = source_mean - mean;
+        mean += delta * source_count / combined_count;
+        squared_distance_from_mean +=
+            source_squared_distance_from_mean + delta * delta * count * source_count / combined_count;
+        count = combined_count;
+
+        if (count > 1) {
+          const auto variance = squared_distance_from_mean / (count - 1);
+          target.current_primary_aggregate = std::sqrt(variance);
+        } else {
+          target.current_primary_aggregate = std::nullopt;
+        }
+      }
+    } else if constexpr (function == AggregateFunction::Any) {
+      if (!target.current_primary_aggregate) {
+        target.current_primary_aggregate = std::move(source.current_primary_aggregate);
+      }
+    }
+  }
+}
 
-template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                                       const KeysPerChunk<AggregateKey>& keys_per_chunk) {
+template <typename ColumnDataType, AggregateFunction function>
+void AggregateHash::_aggregate_segment(SegmentVisitorContext& context, const BaseSegment& base_segment,
+                                       const std::vector<AggregateResultId>& group_ids,
+                                       const PosList& group_row_ids) const {
   using AggregateType = typename AggregateTraits<ColumnDataType, function>::AggregateType;
 
   auto aggregator = AggregateFunctionBuilder<ColumnDataType, AggregateType, function>().get_aggregate_function();
 
-  auto& context = *std::static_pointer_cast<AggregateContext<ColumnDataType, AggregateType, AggregateKey>>(
-      _contexts_per_column[column_index]);
-
-  auto& result_ids = *context.result_ids;
-  auto& results = context.results;
+  auto& results = static_cast<AggregateResultContext<ColumnDataType, AggregateType>&>(context).results;
+  initialize_results(results, group_row_ids);
 
   ChunkOffset chunk_offset{0};
 
   segment_iterate<ColumnDataType>(base_segment, [&](const auto& position) {
-    auto& result =
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
+    auto& result = results[group_ids[chunk_offset]];
 
     /**
     * If the value is NULL, the current aggregate value does not change.
@@ -171,16 +482,6 @@ void AggregateHash::_aggregate_segment(ChunkID chunk_id, ColumnID column_index,
 
 template <typename AggregateKey>
 void AggregateHash::_aggregate() {
-  // We use monotonic_buffer_resource for the vector of vectors that hold the aggregate keys. That is so that we can
-  // save time when allocating and we can throw away everything in this temporary structure at once (once the resource
-  // gets deleted). Also, we use the scoped_allocator_adaptor to propagate the allocator to all inner vectors.
-  // This is suitable here because the amount of memory needed is known from the start. In other places with frequent
-  // reallocations, this might make less sense.
-  // We use boost over std because libc++ does not yet (July 2018) support monotonic_buffer_resource:
-  // https://libcxx.llvm.org/ts1z_status.html
-  using AggregateKeysAllocator =
-      boost::container::scoped_allocator_adaptor<PolymorphicAllocator<AggregateKeys<AggregateKey>>>;
-
   auto input_table = input_table_left();
 
   for ([[maybe_unused]] const auto& groupby_column_id : _groupby_column_ids) {
@@ -190,423 +491,331 @@ void AggregateHash::_aggregate() {
   // Check for invalid aggregates
   _validate_aggregates();
 
-  KeysPerChunk<AggregateKey> keys_per_chunk;
+  // The AggregateKeys of the rows are computed by the pre-aggregation job of their chunk (see write_groupby_keys). The
+  // IDs of values that cannot be used as an AggregateKeyEntry directly are shared between the chunks.
+  auto id_maps = std::vector<std::shared_ptr<BaseGroupByIdMap>>(_groupby_column_ids.size());
+  for (auto group_column_index = size_t{0}; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
+    resolve_data_type(input_table->column_data_type(_groupby_column_ids[group_column_index]), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      if constexpr (!std::is_same_v<ColumnDataType, int32_t>) {
+        // Strings shorter than five characters are stored without using the id_map. For that, we need to reserve the
+        // IDs used for short strings (see write_groupby_keys).
+        const auto first_id = std::is_same_v<ColumnDataType, pmr_string> ? AggregateKeyEntry{5'000'000'000}
+                                                                          : AggregateKeyEntry{1};
+        id_maps[group_column_index] = std::make_shared<GroupByIdMap<ColumnDataType>>(first_id);
+      }
+    });
+  }
 
-  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {  // NOLINT
-    /*
-    PARTITIONING PHASE
-    First we partition the input chunks by the given group key(s).
-    This is done by creating a vector that contains the AggregateKey for each row.
-    It is gradually built by visitors, one for each group segment.
-    */
+  /*
+  AGGREGATION PHASE
+  The aggregation is done in two steps so that all cores can be used, even if there is only a single GROUP BY column:
+
+  (1) Pre-aggregation: Each chunk is aggregated by its own job into chunk-local results. The job computes the
+      AggregateKeys of its rows (see write_groupby_keys) and numbers the groups of its chunk using a small hash map
+      that is bounded by the chunk size. If all GROUP BY segments of the chunk are dictionary-encoded and have few
+      distinct values, an array indexed by the ValueIDs replaces the hash map. Afterwards, the groups are
+      radix-partitioned by the hash of their key.
+  (2) Merge: Each partition is merged by its own job. As a group ends up in the same partition for all chunks, the
+      partitions can be merged independently of each other. Finally, the merged partitions are concatenated.
+
+  Partial results are always merged in the order of the chunks, so all aggregate columns list the groups in the same
+  order. If there is only one chunk, its results are used as they are.
+  */
+  const auto chunk_count = input_table->chunk_count();
 
-    const auto chunk_count = input_table->chunk_count();
-
-    {
-      // Allocate a temporary memory buffer, for more details see aggregate_hash.hpp
-      // This calculation assumes that we use std::vector<AggregateKeyEntry> - other data structures use less space, but
-      // that is fine
-      size_t needed_size_per_aggregate_key =
-          aligned_size<AggregateKey>() + _groupby_column_ids.size() * aligned_size<AggregateKeyEntry>();
-      size_t needed_size = aligned_size<KeysPerChunk<AggregateKey>>() +
-                           chunk_count * aligned_size<AggregateKeys<AggregateKey>>() +
-                           input_table->row_count() * needed_size_per_aggregate_key;
-      needed_size = static_cast<size_t>(needed_size * 1.1);  // Give it a little bit more, just in case
-
-      auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(needed_size);
-      auto allocator = AggregateKeysAllocator{PolymorphicAllocator<AggregateKeys<AggregateKey>>{&temp_buffer}};
-      allocator.allocate(1);  // Make sure that the buffer is initialized
-      const auto start_next_buffer_size = temp_buffer.next_buffer_size();
-
-      // Create the actual data structure
-      keys_per_chunk = KeysPerChunk<AggregateKey>{allocator};
-      keys_per_chunk.reserve(chunk_count);
-      for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-        const auto chunk = input_table->get_chunk(chunk_id);
-        if (!chunk) continue;
+  auto radix_bits = size_t{0};
+  if constexpr (!std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+    if (chunk_count > 1) {
+      const auto chunk_count_log2 = std::ceil(std::log2(static_cast<double>(chunk_count)));
+      radix_bits = std::min(MAX_RADIX_BITS, static_cast<size_t>(chunk_count_log2));
+    }
+  }
+  const auto partition_count = size_t{1} << radix_bits;
+
+  auto partial_aggregations = std::vector<PartialAggregation<AggregateKey>>{};
+  partial_aggregations.reserve(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    const auto partial_aggregation_id = partial_aggregations.size();
+    partial_aggregations.emplace_back();
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id, partial_aggregation_id]() {
+      auto& partial_aggregation = partial_aggregations[partial_aggregation_id];
+      const auto chunk_size = chunk->size();
 
+      // Assign a chunk-local group ID to each row
+      auto group_ids = std::vector<AggregateResultId>(chunk_size);
+      auto group_row_ids = PosList{};
+      partial_aggregation.group_ids_per_partition.resize(partition_count);
+
+      if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+        // All rows belong to the same group
+        if (chunk_size > 0) {
+          group_row_ids.emplace_back(RowID{chunk_id, ChunkOffset{0}});
+          partial_aggregation.group_ids_per_partition[0].emplace_back(0);
+        }
+      } else {
+        auto keys = AggregateKeys<AggregateKey>{};
         if constexpr (std::is_same_v<AggregateKey, std::vector<AggregateKeyEntry>>) {
-          keys_per_chunk.emplace_back(chunk->size(), AggregateKey(_groupby_column_ids.size()));
+          keys.resize(chunk_size, AggregateKey(_groupby_column_ids.size()));
         } else {
-          keys_per_chunk.emplace_back(chunk->size(), AggregateKey{});
+          keys.resize(chunk_size);
         }
-      }
 
-      // Make sure that we did not have to allocate more memory than originally computed
-      if (temp_buffer.next_buffer_size() != start_next_buffer_size) {
-        // The buffer sizes are increasing when the current buffer is full. We can use this to make sure that we
-        // allocated enough space from the beginning on. It would be more intuitive to compare current_buffer(), but
-        // this seems to be broken in boost: https://svn.boost.org/trac10/ticket/13639#comment:1
-        PerformanceWarning(std::string("needed_size ") + std::to_string(needed_size) +
-                           " was not enough and a second buffer was needed");
-      }
-    }
+        for (auto group_column_index = size_t{0}; group_column_index < _groupby_column_ids.size();
+             ++group_column_index) {
+          const auto groupby_column_id = _groupby_column_ids[group_column_index];
+          resolve_data_type(input_table->column_data_type(groupby_column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+            const auto id_map = static_cast<GroupByIdMap<ColumnDataType>*>(id_maps[group_column_index].get());
+            write_groupby_keys<AggregateKey>(chunk->get_segment(groupby_column_id), group_column_index, id_map,
+                                             keys);
+          });
+        }
 
-    // Now that we have the data structures in place, we can start the actual work. We want to fill
-    // keys_per_chunk[chunk_id][chunk_offset] with something that uniquely identifies the group into which that
-    // position belongs. There are a couple of options here (cf. AggregateHash::_on_execute):
-    //
-    // 0 GROUP BY columns:   No partitioning needed; we don't reach this point because of the check for
-    //                       EmptyAggregateKey above
-    // 1 GROUP BY column:    The AggregateKey is one dimensional, i.e., the same as AggregateKeyEntry
-    // > 1 GROUP BY columns: The AggregateKey is multi-dimensional. The value in
-    //                       keys_per_chunk[chunk_id][chunk_offset] is subscripted with the index of the GROUP BY
-    //                       columns (not the same as the GROUP BY column_id)
-    //
-    // To generate a unique identifier, we create a map from the value found in the respective GROUP BY column to
-    // a unique uint64_t. The value 0 is reserved for NULL.
-    //
-    // This has the cost of a hashmap lookup and potential insert for each row and each GROUP BY column. There are
-    // some cases in which we can avoid this. These make use of the fact that we can only have 2^64 - 2*2^32 values
-    // in a table (due to INVALID_VALUE_ID and INVALID_CHUNK_OFFSET limiting the range of RowIDs).
-    //
-    // (1) For types smaller than AggregateKeyEntry, such as int32_t, their value range can be immediately mapped into
-    //     uint64_t. We cannot do the same for int64_t because we need to account for NULL values.
-    // (2) For strings not longer than five characters, there are 1+2^(1*8)+2^(2*8)+2^(3*8)+2^(4*8) potential values.
-    //     We can immediately map these into a numerical representation by reinterpreting their byte storage as an
-    //     integer. The calculation is described below. Note that this is done on a per-string basis and does not
-    //     require all strings in the given column to be that short.
-
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
-    jobs.reserve(_groupby_column_ids.size());
-
-    for (size_t group_column_index = 0; group_column_index < _groupby_column_ids.size(); ++group_column_index) {
-      jobs.emplace_back(std::make_shared<JobTask>([&input_table, group_column_index, &keys_per_chunk, chunk_count,
-                                                   this]() {
-        const auto groupby_column_id = _groupby_column_ids.at(group_column_index);
-        const auto data_type = input_table->column_data_type(groupby_column_id);
-
-        resolve_data_type(data_type, [&](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          if constexpr (std::is_same_v<ColumnDataType, int32_t>) {
-            // For values with a smaller type than AggregateKeyEntry, we can use the value itself as an
-            // AggregateKeyEntry. We cannot do this for types with the same size as AggregateKeyEntry as we need to have
-            // a special NULL value. By using the value itself, we can save us the effort of building the id_map.
-            for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-              const auto chunk_in = input_table->get_chunk(chunk_id);
-              const auto base_segment = chunk_in->get_segment(groupby_column_id);
-              ChunkOffset chunk_offset{0};
-              segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
-                const auto int_to_uint = [](const int32_t value) {
-                  // We need to convert a potentially negative int32_t value into the uint64_t space. We do not care
-                  // about preserving the value, just its uniqueness. Subtract the minimum value in int32_t (which is
-                  // negative itself) to get a positive number.
-                  const auto shifted_value = static_cast<int64_t>(value) - std::numeric_limits<int32_t>::min();
-                  DebugAssert(shifted_value >= 0, "Type conversion failed");
-                  return static_cast<uint64_t>(shifted_value);
-                };
-
-                if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                  if (position.is_null()) {
-                    keys_per_chunk[chunk_id][chunk_offset] = 0;
-                  } else {
-                    keys_per_chunk[chunk_id][chunk_offset] = int_to_uint(position.value()) + 1;
-                  }
-                } else {
-                  if (position.is_null()) {
-                    keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0;
-                  } else {
-                    keys_per_chunk[chunk_id][chunk_offset][group_column_index] = int_to_uint(position.value()) + 1;
-                  }
-                }
-                ++chunk_offset;
-              });
+        // Adds a group for the row at chunk_offset, which is the first row of that group
+        const auto add_group = [&](const ChunkOffset chunk_offset) {
+          const auto group_id = group_row_ids.size();
+          const auto& key = keys[chunk_offset];
+          group_row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+          partial_aggregation.keys.emplace_back(key);
+          partial_aggregation.group_ids_per_partition[radix_partition(key, radix_bits)].emplace_back(group_id);
+          return group_id;
+        };
+
+        if (const auto dense_group_indices = compute_dense_group_indices(*chunk, _groupby_column_ids)) {
+          // Dictionary-encoded GROUP BY segments with few distinct values: Find the group of a row with an array
+          // lookup instead of hashing its key
+          auto group_id_per_index =
+              std::vector<AggregateResultId>(dense_group_indices->count, std::numeric_limits<AggregateResultId>::max());
+
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            auto& group_id = group_id_per_index[dense_group_indices->indices[chunk_offset]];
+            if (group_id == std::numeric_limits<AggregateResultId>::max()) {
+              group_id = add_group(chunk_offset);
             }
-          } else {
-            /*
-            Store unique IDs for equal values in the groupby column (similar to dictionary encoding).
-            The ID 0 is reserved for NULL values. The combined IDs build an AggregateKey for each row.
-            */
-
-            // This time, we have no idea how much space we need, so we take some memory and then rely on the automatic
-            // resizing. The size is quite random, but since single memory allocations do not cost too much, we rather
-            // allocate a bit too much.
-            auto temp_buffer = boost::container::pmr::monotonic_buffer_resource(1'000'000);
-            auto allocator = PolymorphicAllocator<std::pair<const ColumnDataType, AggregateKeyEntry>>{&temp_buffer};
-
-            auto id_map = std::unordered_map<ColumnDataType, AggregateKeyEntry, std::hash<ColumnDataType>,
-                                             std::equal_to<>, decltype(allocator)>(allocator);
-            AggregateKeyEntry id_counter = 1u;
-
-            if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {  // NOLINT
-              // We store strings shorter than five characters without using the id_map. For that, we need to reserve
-              // the IDs used for short strings (see below).
-              id_counter = 5'000'000'000;
+            group_ids[chunk_offset] = group_id;
+          }
+        } else {
+          auto result_ids = AggregateResultIdMap<AggregateKey>{};
+
+          for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+            const auto& key = keys[chunk_offset];
+
+            const auto it = result_ids.find(key);
+            if (it != result_ids.end()) {
+              group_ids[chunk_offset] = it->second;
+              continue;
             }
 
-            for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-              const auto chunk_in = input_table->get_chunk(chunk_id);
-              if (!chunk_in) continue;
-
-              const auto base_segment = chunk_in->get_segment(groupby_column_id);
-              ChunkOffset chunk_offset{0};
-              segment_iterate<ColumnDataType>(*base_segment, [&](const auto& position) {
-                if (position.is_null()) {
-                  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                    keys_per_chunk[chunk_id][chunk_offset] = 0u;
-                  } else {
-                    keys_per_chunk[chunk_id][chunk_offset][group_column_index] = 0u;
-                  }
-                } else {
-                  // We need to generate an ID that is unique for the value. In some cases, we can use an optimization,
-                  // in others, we can't. We need to somehow track whether we have found an ID or not. For this, we
-                  // first set `id` to its maximum value. If after all branches it is still that max value, no optimized
-                  // ID generation was applied and we need to generate the ID using the value->ID map.
-                  auto id = std::numeric_limits<AggregateKeyEntry>::max();
-
-                  if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {  // NOLINT
-                    const auto& string = position.value();
-                    if (string.size() < 5) {
-                      static_assert(std::is_same_v<AggregateKeyEntry, uint64_t>, "Calculation only valid for uint64_t");
-
-                      const auto char_to_uint = [](const char in, const uint bits) {
-                        // chars may be signed or unsigned. For the calculation as described below, we need signed
-                        // chars.
-                        return static_cast<uint64_t>(*reinterpret_cast<const uint8_t*>(&in)) << bits;
-                      };
-
-                      switch (string.size()) {
-                          // Optimization for short strings (see above):
-                          //
-                          // NULL:              0
-                          // str.length() == 0: 1
-                          // str.length() == 1: 2 + (uint8_t) str            // maximum: 257 (2 + 0xff)
-                          // str.length() == 2: 258 + (uint16_t) str         // maximum: 65'793 (258 + 0xffff)
-                          // str.length() == 3: 65'794 + (uint24_t) str      // maximum: 16'843'009
-                          // str.length() == 4: 16'843'010 + (uint32_t) str  // maximum: 4'311'810'305
-                          // str.length() >= 5: map-based identifiers, starting at 5'000'000'000 for better distinction
-                          //
-                          // This could be extended to longer strings if the size of the input table (and thus the
-                          // maximum number of distinct strings) is taken into account. For now, let's not make it even
-                          // more complicated.
-
-                        case 0: {
-                          id = uint64_t{1};
-                        } break;
-
-                        case 1: {
-                          id = uint64_t{2} + char_to_uint(string[0], 0);
-                        } break;
-
-                        case 2: {
-                          id = uint64_t{258} + char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
-                        } break;
-
-                        case 3: {
-                          id = uint64_t{65'794} + char_to_uint(string[2], 16) + char_to_uint(string[1], 8) +
-                               char_to_uint(string[0], 0);
-                        } break;
-
-                        case 4: {
-                          id = uint64_t{16'843'010} + char_to_uint(string[3], 24) + char_to_uint(string[2], 16) +
-                               char_to_uint(string[1], 8) + char_to_uint(string[0], 0);
-                        } break;
-                      }
-                    }
-                  }
-
-                  if (id == std::numeric_limits<AggregateKeyEntry>::max()) {
-                    // Could not take the shortcut above, either because we don't have a string or because it is too
-                    // long
-                    auto inserted = id_map.try_emplace(position.value(), id_counter);
-
-                    id = inserted.first->second;
-
-                    // if the id_map didn't have the value as a key and a new element was inserted
-                    if (inserted.second) ++id_counter;
-                  }
-
-                  if constexpr (std::is_same_v<AggregateKey, AggregateKeyEntry>) {
-                    keys_per_chunk[chunk_id][chunk_offset] = id;
-                  } else {
-                    keys_per_chunk[chunk_id][chunk_offset][group_column_index] = id;
-                  }
-                }
-
-                ++chunk_offset;
-              });
+            const auto group_id = add_group(chunk_offset);
+            result_ids.emplace_hint(it, key, group_id);
+            group_ids[chunk_offset] = group_id;
+          }
+        }
+      }
+
+      partial_aggregation.contexts = _create_aggregate_contexts();
+      _aggregate_chunk(*chunk, group_ids, group_row_ids, partial_aggregation.contexts);
+    }));
+    jobs.back()->schedule();
+  }
+
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  if (partial_aggregations.size() == 1) {
+    _contexts_per_column = std::move(partial_aggregations.front().contexts);
+    return;
+  }
+
+  // Create the contexts even if there are no chunks in the input, because _write_aggregate_output() needs them anyway
+  _contexts_per_column = _create_aggregate_contexts();
+  if (partial_aggregations.empty()) return;
+
+  const auto aggregate_column_count = _contexts_per_column.size();
+
+  // Merge the partial results partition by partition
+  auto contexts_per_partition = std::vector<std::vector<std::shared_ptr<SegmentVisitorContext>>>(partition_count);
+  auto group_count_per_partition = std::vector<size_t>(partition_count);
+
+  jobs.clear();
+  for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+      auto& partition_contexts = contexts_per_partition[partition_id];
+      partition_contexts = _create_aggregate_contexts();
+
+      // Maps the keys of the partition to their group ID within the partition
+      auto result_ids = AggregateResultIdMap<AggregateKey>{};
+      auto group_count = size_t{0};
+      auto target_ids = std::vector<AggregateResultId>{};
+
+      for (const auto& partial_aggregation : partial_aggregations) {
+        const auto& source_ids = partial_aggregation.group_ids_per_partition[partition_id];
+        target_ids.resize(source_ids.size());
+
+        for (auto index = size_t{0}; index < source_ids.size(); ++index) {
+          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
+            target_ids[index] = 0;
+            group_count = 1;
+          } else {
+            const auto& key = partial_aggregation.keys[source_ids[index]];
+
+            const auto it = result_ids.find(key);
+            if (it != result_ids.end()) {
+              target_ids[index] = it->second;
+            } else {
+              target_ids[index] = group_count;
+              result_ids.emplace_hint(it, key, group_count);
+              ++group_count;
             }
           }
-        });
-      }));
-      jobs.back()->schedule();
-    }
+        }
+
+        for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_column_count; ++aggregate_idx) {
+          _merge_aggregate_results(aggregate_idx, *partial_aggregation.contexts[aggregate_idx],
+                                   *partition_contexts[aggregate_idx], source_ids, target_ids);
+        }
+      }
 
-    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+      group_count_per_partition[partition_id] = group_count;
+    }));
+    jobs.back()->schedule();
   }
 
-  /*
-  AGGREGATION PHASE
-  */
-  _contexts_per_column = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-  if (_aggregates.empty()) {
-    /*
-    Insert a dummy context for the DISTINCT implementation.
-    That way, _contexts_per_column will always have at least one context with results.
-    This is important later on when we write the group keys into the table.
+  // Concatenate the partitions, one job per aggregate column
+  jobs.clear();
+  for (auto aggregate_idx = ColumnID{0}; aggregate_idx < aggregate_column_count; ++aggregate_idx) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, aggregate_idx]() {
+      auto first_target_id = AggregateResultId{0};
+      for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+        const auto group_count = group_count_per_partition[partition_id];
 
-    We choose int8_t for column type and aggregate type because it's small.
-    */
-    auto context = std::make_shared<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>();
-    _contexts_per_column.push_back(context);
+        auto source_ids = std::vector<AggregateResultId>(group_count);
+        std::iota(source_ids.begin(), source_ids.end(), AggregateResultId{0});
+        auto target_ids = std::vector<AggregateResultId>(group_count);
+        std::iota(target_ids.begin(), target_ids.end(), first_target_id);
+
+        _merge_aggregate_results(aggregate_idx, *contexts_per_partition[partition_id][aggregate_idx],
+                                 *_contexts_per_column[aggregate_idx], source_ids, target_ids);
+        first_target_id += group_count;
+      }
+    }));
+    jobs.back()->schedule();
   }
 
-  /**
-   * Create an AggregateContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate is
-   * created on. We do this here, and not in the per-chunk-loop below, because there might be no Chunks in the input
-   * and _write_aggregate_output() needs these contexts anyway.
-   */
-  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
-    const auto& aggregate = _aggregates[aggregate_idx];
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+}
+
+void AggregateHash::_aggregate_chunk(const Chunk& chunk, const std::vector<AggregateResultId>& group_ids,
+                                     const PosList& group_row_ids,
+                                     const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const {
+  if (_aggregates.empty()) {
+    /**
+     * DISTINCT implementation
+     *
+     * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
+     *
+     * For a query like "SELECT DISTINCT * FROM A;"
+     * we would assume that all columns from A are part of 'groupby_columns',
+     * respectively any columns that were specified in the projection.
+     * The optimizer is responsible to take care of passing in the correct columns.
+     *
+     * How does this operation work?
+     * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
+     * these vectors are used as keys when numbering the groups.
+     *
+     * At this point we've got all the different groups of the chunk. In order to reuse the aggregation
+     * implementation, we add a dummy AggregateResult per group.
+     * One could optimize here in the future.
+     *
+     * Obviously this implementation is also used for plain GroupBy's.
+     */
+    auto& results =
+        static_cast<AggregateResultContext<DistinctColumnType, DistinctAggregateType>&>(*contexts[0]).results;
+    initialize_results(results, group_row_ids);
+    return;
+  }
+
+  const auto input_table = input_table_left();
+
+  ColumnID aggregate_idx{0};
+  for (const auto& aggregate : _aggregates) {
+    /**
+     * Special COUNT(*) implementation.
+     * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
+     * We then go through the group IDs and count the occurrences of each group.
+     * The results are saved in the regular aggregate_count variable so that we don't need a
+     * specific output logic for COUNT(*).
+     */
 
     const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
     const auto input_column_id = pqp_column.column_id;
 
     if (input_column_id == INVALID_COLUMN_ID) {
       Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
-      auto context = std::make_shared<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>();
-      _contexts_per_column[aggregate_idx] = context;
-      continue;
-    }
-    auto data_type = input_table->column_data_type(input_column_id);
-    _contexts_per_column[aggregate_idx] =
-        _create_aggregate_context<AggregateKey>(data_type, aggregate->aggregate_function);
-  }
+      auto& results =
+          static_cast<AggregateResultContext<CountColumnType, CountAggregateType>&>(*contexts[aggregate_idx]).results;
+      initialize_results(results, group_row_ids);
 
-  // Process Chunks and perform aggregations
-  const auto chunk_count = input_table->chunk_count();
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-    const auto chunk_in = input_table->get_chunk(chunk_id);
-    if (!chunk_in) continue;
-
-    // Sometimes, gcc is really bad at accessing loop conditions only once, so we cache that here.
-    const auto input_chunk_size = chunk_in->size();
-
-    if (_aggregates.empty()) {
-      /**
-       * DISTINCT implementation
-       *
-       * In Opossum we handle the SQL keyword DISTINCT by grouping without aggregation.
-       *
-       * For a query like "SELECT DISTINCT * FROM A;"
-       * we would assume that all columns from A are part of 'groupby_columns',
-       * respectively any columns that were specified in the projection.
-       * The optimizer is responsible to take care of passing in the correct columns.
-       *
-       * How does this operation work?
-       * Distinct rows are retrieved by grouping by vectors of values. Similar as for the usual aggregation
-       * these vectors are used as keys in the 'column_results' map.
-       *
-       * At this point we've got all the different keys from the chunks and accumulate them in 'column_results'.
-       * In order to reuse the aggregation implementation, we add a dummy AggregateResult.
-       * One could optimize here in the future.
-       *
-       * Obviously this implementation is also used for plain GroupBy's.
-       */
-
-      auto context =
-          std::static_pointer_cast<AggregateContext<DistinctColumnType, DistinctAggregateType, AggregateKey>>(
-              _contexts_per_column[0]);
-
-      auto& result_ids = *context->result_ids;
-      auto& results = context->results;
-
-      for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-        // Make sure the value or combination of values is added to the list of distinct value(s)
-        get_or_add_result(result_ids, results, get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                          RowID{chunk_id, chunk_offset});
+      for (const auto group_id : group_ids) {
+        ++results[group_id].aggregate_count;
       }
-    } else {
-      ColumnID aggregate_idx{0};
-      for (const auto& aggregate : _aggregates) {
-        /**
-         * Special COUNT(*) implementation.
-         * Because COUNT(*) does not have a specific target column, we use the maximum ColumnID.
-         * We then go through the keys_per_chunk map and count the occurrences of each group key.
-         * The results are saved in the regular aggregate_count variable so that we don't need a
-         * specific output logic for COUNT(*).
-         */
-
-        const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
-        const auto input_column_id = pqp_column.column_id;
-
-        if (input_column_id == INVALID_COLUMN_ID) {
-          Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
-          auto context = std::static_pointer_cast<AggregateContext<CountColumnType, CountAggregateType, AggregateKey>>(
-              _contexts_per_column[aggregate_idx]);
-
-          auto& result_ids = *context->result_ids;
-          auto& results = context->results;
 
-          if constexpr (std::is_same_v<AggregateKey, EmptyAggregateKey>) {
-            // Not grouped by anything, simply count the number of rows
-            results.resize(1);
-            results[0].aggregate_count += input_chunk_size;
-          } else {
-            // count occurrences for each group key
-            for (ChunkOffset chunk_offset{0}; chunk_offset < input_chunk_size; chunk_offset++) {
-              auto& result = get_or_add_result(result_ids, results,
-                                               get_aggregate_key<AggregateKey>(keys_per_chunk, chunk_id, chunk_offset),
-                                               RowID{chunk_id, chunk_offset});
-              ++result.aggregate_count;
-            }
-          }
+      ++aggregate_idx;
+      continue;
+    }
 
-          ++aggregate_idx;
-          continue;
-        }
+    const auto base_segment = chunk.get_segment(input_column_id);
+    const auto data_type = input_table->column_data_type(input_column_id);
+    auto& context = *contexts[aggregate_idx];
 
-        auto base_segment = chunk_in->get_segment(input_column_id);
-        auto data_type = input_table->column_data_type(input_column_id);
-
-        /*
-        Invoke correct aggregator for each segment
-        */
-
-        resolve_data_type(data_type, [&, aggregate](auto type) {
-          using ColumnDataType = typename decltype(type)::type;
-
-          switch (aggregate->aggregate_function) {
-            case AggregateFunction::Min:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Min, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Max:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Max, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Sum:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Sum, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Avg:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Avg, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Count:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Count, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                         *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::CountDistinct:
-              _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::StandardDeviationSample:
-              _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample, AggregateKey>(
-                  chunk_id, aggregate_idx, *base_segment, keys_per_chunk);
-              break;
-            case AggregateFunction::Any:
-              _aggregate_segment<ColumnDataType, AggregateFunction::Any, AggregateKey>(chunk_id, aggregate_idx,
-                                                                                       *base_segment, keys_per_chunk);
-          }
-        });
+    /*
+    Invoke correct aggregator for each segment
+    */
 
-        ++aggregate_idx;
+    resolve_data_type(data_type, [&, aggregate](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      switch (aggregate->aggregate_function) {
+        case AggregateFunction::Min:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Min>(context, *base_segment, group_ids, group_row_ids);
+          break;
+        case AggregateFunction::Max:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Max>(context, *base_segment, group_ids, group_row_ids);
+          break;
+        case AggregateFunction::Sum:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Sum>(context, *base_segment, group_ids, group_row_ids);
+          break;
+        case AggregateFunction::Avg:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Avg>(context, *base_segment, group_ids, group_row_ids);
+          break;
+        case AggregateFunction::Count:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Count>(context, *base_segment, group_ids,
+                                                                       group_row_ids);
+          break;
+        case AggregateFunction::CountDistinct:
+          _aggregate_segment<ColumnDataType, AggregateFunction::CountDistinct>(context, *base_segment, group_ids,
+                                                                               group_row_ids);
+          break;
+        case AggregateFunction::StandardDeviationSample:
+          _aggregate_segment<ColumnDataType, AggregateFunction::StandardDeviationSample>(context, *base_segment,
+                                                                                         group_ids, group_row_ids);
+          break;
+        case AggregateFunction::Any:
+          _aggregate_segment<ColumnDataType, AggregateFunction::Any>(context, *base_segment, group_ids, group_row_ids);
       }
-    }
+    });
+
+    ++aggregate_idx;
   }
 }
 
@@ -935,7 +1144,6 @@ void AggregateHash::write_aggregate_output(ColumnID column_index) {
   _output_segments.push_back(output_segment);
 }
 
-template <typename AggregateKey>
 std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
     const DataType data_type, const AggregateFunction function) const {
   std::shared_ptr<SegmentVisitorContext> context;
@@ -943,49 +1151,133 @@ std::shared_ptr<SegmentVisitorContext> AggregateHash::_create_aggregate_context(
     using ColumnDataType = typename decltype(type)::type;
     switch (function) {
       case AggregateFunction::Min:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Min>::AggregateType>>();
         break;
       case AggregateFunction::Max:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Max>::AggregateType>>();
         break;
       case AggregateFunction::Sum:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Sum>::AggregateType>>();
         break;
       case AggregateFunction::Avg:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Avg>::AggregateType>>();
         break;
       case AggregateFunction::Count:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Count>::AggregateType>>();
         break;
       case AggregateFunction::CountDistinct:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType,
+            typename AggregateTraits<ColumnDataType, AggregateFunction::CountDistinct>::AggregateType>>();
         break;
       case AggregateFunction::StandardDeviationSample:
-        context = std::make_shared<AggregateContext<
+        context = std::make_shared<AggregateResultContext<
             ColumnDataType,
-            typename AggregateTraits<ColumnDataType, AggregateFunction::StandardDeviationSample>::AggregateType,
-            AggregateKey>>();
+            typename AggregateTraits<ColumnDataType, AggregateFunction::StandardDeviationSample>::AggregateType>>();
         break;
       case AggregateFunction::Any:
-        context = std::make_shared<AggregateContext<
-            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Any>::AggregateType,
-            AggregateKey>>();
+        context = std::make_shared<AggregateResultContext<
+            ColumnDataType, typename AggregateTraits<ColumnDataType, AggregateFunction::Any>::AggregateType>>();
         break;
     }
   });
   return context;
 }
 
+std::vector<std::shared_ptr<SegmentVisitorContext>> AggregateHash::_create_aggregate_contexts() const {
+  auto contexts = std::vector<std::shared_ptr<SegmentVisitorContext>>(_aggregates.size());
+
+  if (_aggregates.empty()) {
+    /*
+    Insert a dummy context for the DISTINCT implementation.
+    That way, there will always be at least one context with results.
+    This is important later on when we write the group keys into the table.
+
+    We choose int8_t for column type and aggregate type because it's small.
+    */
+    contexts.push_back(std::make_shared<AggregateResultContext<DistinctColumnType, DistinctAggregateType>>());
+  }
+
+  // Create an AggregateResultContext for each column in the input table that a normal (i.e. non-DISTINCT) aggregate
+  // is created on.
+  for (ColumnID aggregate_idx{0}; aggregate_idx < _aggregates.size(); ++aggregate_idx) {
+    const auto& aggregate = _aggregates[aggregate_idx];
+
+    const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+    const auto input_column_id = pqp_column.column_id;
+
+    if (input_column_id == INVALID_COLUMN_ID) {
+      Assert(aggregate->aggregate_function == AggregateFunction::Count, "Only COUNT may have an invalid ColumnID");
+      // SELECT COUNT(*) - we know the template arguments, so we don't need a visitor
+      contexts[aggregate_idx] = std::make_shared<AggregateResultContext<CountColumnType, CountAggregateType>>();
+      continue;
+    }
+    const auto data_type = input_table_left()->column_data_type(input_column_id);
+    contexts[aggregate_idx] = _create_aggregate_context(data_type, aggregate->aggregate_function);
+  }
+
+  return contexts;
+}
+
+void AggregateHash::_merge_aggregate_results(const ColumnID aggregate_idx, SegmentVisitorContext& source,
+                                             SegmentVisitorContext& target,
+                                             const std::vector<AggregateResultId>& source_ids,
+                                             const std::vector<AggregateResultId>& target_ids) const {
+  // The results of the DISTINCT implementation and of COUNT(*) only use the row_id and the aggregate_count, so they
+  // are merged like COUNT results.
+  if (_aggregates.empty()) {
+    merge_aggregate_results<DistinctColumnType, AggregateFunction::Count, DistinctAggregateType>(
+        source, target, source_ids, target_ids);
+    return;
+  }
+
+  const auto& aggregate = _aggregates[aggregate_idx];
+  const auto& pqp_column = static_cast<const PQPColumnExpression&>(*aggregate->argument());
+  const auto input_column_id = pqp_column.column_id;
+
+  if (input_column_id == INVALID_COLUMN_ID) {
+    merge_aggregate_results<CountColumnType, AggregateFunction::Count, CountAggregateType>(source, target, source_ids,
+                                                                                           target_ids);
+    return;
+  }
+
+  resolve_data_type(input_table_left()->column_data_type(input_column_id), [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+
+    switch (aggregate->aggregate_function) {
+      case AggregateFunction::Min:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Min>(source, target, source_ids, target_ids);
+        break;
+      case AggregateFunction::Max:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Max>(source, target, source_ids, target_ids);
+        break;
+      case AggregateFunction::Sum:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Sum>(source, target, source_ids, target_ids);
+        break;
+      case AggregateFunction::Avg:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Avg>(source, target, source_ids, target_ids);
+        break;
+      case AggregateFunction::Count:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Count>(source, target, source_ids, target_ids);
+        break;
+      case AggregateFunction::CountDistinct:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::CountDistinct>(source, target, source_ids,
+                                                                                  target_ids);
+        break;
+      case AggregateFunction::StandardDeviationSample:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::StandardDeviationSample>(source, target, source_ids,
+                                                                                            target_ids);
+        break;
+      case AggregateFunction::Any:
+        merge_aggregate_results<ColumnDataType, AggregateFunction::Any>(source, target, source_ids, target_ids);
+        break;
+    }
+  });
+}
+
 }  // namespace opossum
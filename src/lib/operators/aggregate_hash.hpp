@@ -19,6 +19,8 @@
 #include "bytell_hash_map.hpp"
 #include "expression/aggregate_expression.hpp"
 #include "resolve_type.hpp"
+#include "storage/chunk.hpp"
+#include "storage/pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/value_segment.hpp"
 #include "types.hpp"
@@ -83,9 +85,6 @@ struct EmptyAggregateKey {};
 template <typename AggregateKey>
 using AggregateKeys = std::vector<AggregateKey>;
 
-template <typename AggregateKey>
-using KeysPerChunk = pmr_vector<AggregateKeys<AggregateKey>>;
-
 /**
  * Types that are used for the special COUNT(*) and DISTINCT implementations
  */
@@ -126,11 +125,24 @@ class AggregateHash : public AbstractAggregateOperator {
 
   void _write_groupby_output(PosList& pos_list);
 
-  template <typename ColumnDataType, AggregateFunction function, typename AggregateKey>
-  void _aggregate_segment(ChunkID chunk_id, ColumnID column_index, const BaseSegment& base_segment,
-                          const KeysPerChunk<AggregateKey>& keys_per_chunk);
+  // Aggregates the rows of a chunk into the given contexts. group_ids holds the chunk-local group of each row,
+  // group_row_ids the position at which each group was encountered first.
+  void _aggregate_chunk(const Chunk& chunk, const std::vector<AggregateResultId>& group_ids,
+                        const PosList& group_row_ids,
+                        const std::vector<std::shared_ptr<SegmentVisitorContext>>& contexts) const;
+
+  template <typename ColumnDataType, AggregateFunction function>
+  void _aggregate_segment(SegmentVisitorContext& context, const BaseSegment& base_segment,
+                          const std::vector<AggregateResultId>& group_ids, const PosList& group_row_ids) const;
+
+  // Merges the partial results at source_ids into the results at target_ids. A target ID that equals the number of
+  // target results appends the source result.
+  void _merge_aggregate_results(ColumnID aggregate_idx, SegmentVisitorContext& source, SegmentVisitorContext& target,
+                                const std::vector<AggregateResultId>& source_ids,
+                                const std::vector<AggregateResultId>& target_ids) const;
+
+  std::vector<std::shared_ptr<SegmentVisitorContext>> _create_aggregate_contexts() const;
 
-  template <typename AggregateKey>
   std::shared_ptr<SegmentVisitorContext> _create_aggregate_context(const DataType data_type,
                                                                    const AggregateFunction function) const;
 
@@ -1,9 +1,13 @@
 #include "delete.hpp"
 
+#include <algorithm>
 #include <memory>
 #include <string>
 
 #include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "logging/log_entry_writer.hpp"
+#include "operators/get_table.hpp"
 #include "operators/validate.hpp"
 #include "statistics/table_statistics.hpp"
 #include "storage/reference_segment.hpp"
@@ -101,6 +105,8 @@ void Delete::_on_commit_records(const CommitID commit_id) {
       referenced_chunk->increase_invalid_row_count(1);
       // We do not unlock the rows so subsequent transactions properly fail when attempting to update these rows.
     }
+
+    referenced_table->schedule_table_statistics_refresh();
   }
 }
 
@@ -128,6 +134,49 @@ void Delete::_on_rollback_records() {
   }
 }
 
+void Delete::_on_write_log_records(LogEntryWriter& log_entry_writer) const {
+  if (_referencing_table->chunk_count() == 0) return;
+
+  const auto first_chunk = _referencing_table->get_chunk(ChunkID{0});
+  const auto first_segment = std::static_pointer_cast<const ReferenceSegment>(first_chunk->get_segment(ColumnID{0}));
+  const auto referenced_table = first_segment->referenced_table();
+  const auto table_name = _referenced_table_name(referenced_table);
+
+  for (ChunkID referencing_chunk_id{0}; referencing_chunk_id < _referencing_table->chunk_count();
+       ++referencing_chunk_id) {
+    const auto referencing_chunk = _referencing_table->get_chunk(referencing_chunk_id);
+    const auto referencing_segment =
+        std::static_pointer_cast<const ReferenceSegment>(referencing_chunk->get_segment(ColumnID{0}));
+    Assert(referencing_segment->referenced_table() == referenced_table,
+           "Cannot log deletes from more than one table at once");
+
+    log_entry_writer.write_delete(table_name, *referencing_segment->pos_list());
+  }
+}
+
+std::string Delete::_referenced_table_name(const std::shared_ptr<const Table>& referenced_table) const {
+  // The log refers to tables by their name, which the referenced table does not know. Usually, the rows to delete are
+  // read from the table by a GetTable, whose table name is used. Otherwise, the StorageManager is searched.
+  const auto& storage_manager = Hyrise::get().storage_manager;
+  for (auto op = input_left(); op; op = op->input_left()) {
+    const auto get_table = std::dynamic_pointer_cast<const GetTable>(op);
+    if (!get_table) continue;
+
+    const auto& table_name = get_table->table_name();
+    if (storage_manager.has_table(table_name) && storage_manager.get_table(table_name) == referenced_table) {
+      return table_name;
+    }
+    break;
+  }
+
+  const auto& tables = storage_manager.tables();
+  const auto table_iter = std::find_if(tables.cbegin(), tables.cend(), [&](const auto& name_and_table) {
+    return name_and_table.second == referenced_table;
+  });
+  Assert(table_iter != tables.cend(), "Cannot log deletes from a table that is not in the StorageManager");
+  return table_iter->first;
+}
+
 std::shared_ptr<AbstractOperator> Delete::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
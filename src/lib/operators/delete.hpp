@@ -28,8 +28,12 @@ class Delete : public AbstractReadWriteOperator {
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
   void _on_commit_records(const CommitID commit_id) override;
   void _on_rollback_records() override;
+  void _on_write_log_records(LogEntryWriter& log_entry_writer) const override;
 
  private:
+  // Name of the table in the StorageManager that the rows are deleted from, determined once per operator for the log
+  std::string _referenced_table_name(const std::shared_ptr<const Table>& referenced_table) const;
+
   TransactionID _transaction_id;
   std::shared_ptr<const Table> _referencing_table;
 };
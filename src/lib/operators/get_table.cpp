@@ -60,6 +60,29 @@ const std::vector<ChunkID>& GetTable::pruned_chunk_ids() const { return _pruned_
 
 const std::vector<ColumnID>& GetTable::pruned_column_ids() const { return _pruned_column_ids; }
 
+std::vector<ColumnID> GetTable::stored_column_ids() const {
+  const auto stored_table = Hyrise::get().storage_manager.get_table(_name);
+
+  auto stored_column_ids = std::vector<ColumnID>{};
+  stored_column_ids.reserve(stored_table->column_count() - _pruned_column_ids.size());
+  for (auto stored_column_id = ColumnID{0}; stored_column_id < stored_table->column_count(); ++stored_column_id) {
+    if (!std::binary_search(_pruned_column_ids.begin(), _pruned_column_ids.end(), stored_column_id)) {
+      stored_column_ids.emplace_back(stored_column_id);
+    }
+  }
+  return stored_column_ids;
+}
+
+bool GetTable::is_stored_chunk_included(const Table& stored_table, const ChunkID stored_chunk_id) const {
+  if (std::binary_search(_pruned_chunk_ids.begin(), _pruned_chunk_ids.end(), stored_chunk_id)) return false;
+
+  const auto chunk = stored_table.get_chunk(stored_chunk_id);
+  if (!chunk) return false;
+
+  return !transaction_context_is_set() || !chunk->get_cleanup_commit_id() ||
+         *chunk->get_cleanup_commit_id() > transaction_context()->snapshot_commit_id();
+}
+
 std::shared_ptr<AbstractOperator> GetTable::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -34,6 +34,19 @@ class GetTable : public AbstractReadOnlyOperator {
   const std::vector<ChunkID>& pruned_chunk_ids() const;
   const std::vector<ColumnID>& pruned_column_ids() const;
 
+  /**
+   * Operators that find rows of the stored table without scanning GetTable's result (e.g., PrimaryKeyIndexScan) use
+   * these to reference the same columns and to skip the same chunks as GetTable.
+   * @{
+   */
+  // Returns the ColumnID in the stored table for each column of GetTable's result
+  std::vector<ColumnID> stored_column_ids() const;
+
+  // Returns whether the rows of a chunk of the stored table may be part of GetTable's result, i.e., whether the chunk
+  // is neither pruned nor physically or (for the current transaction) logically deleted
+  bool is_stored_chunk_included(const Table& stored_table, const ChunkID stored_chunk_id) const;
+  /** @} */
+
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
@@ -1,6 +1,9 @@
 #include "index_scan.hpp"
 
 #include <algorithm>
+#include <optional>
+#include <utility>
+#include <vector>
 
 #include "expression/between_expression.hpp"
 
@@ -10,6 +13,7 @@
 #include "scheduler/job_task.hpp"
 
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/adaptive_radix_tree/mutable_adaptive_radix_tree_index.hpp"
 #include "storage/reference_segment.hpp"
 
 #include "utils/assert.hpp"
@@ -121,6 +125,12 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   auto matches_out = PosList{};
 
   const auto index = chunk->get_index(_index_type, _left_column_ids);
+  if (!index && _index_type == SegmentIndexType::AdaptiveRadixTree && _left_column_ids.size() == 1) {
+    // Chunks that have not been encoded yet are indexed by a mutable index instead
+    if (const auto mutable_index = chunk->get_mutable_index(_left_column_ids.front())) {
+      return _scan_mutable_index(chunk_id, *mutable_index);
+    }
+  }
   Assert(index, "Index of specified type not found for segment (vector).");
 
   switch (_predicate_condition) {
@@ -201,4 +211,57 @@ PosList IndexScan::_scan_chunk(const ChunkID chunk_id) {
   return matches_out;
 }
 
+PosList IndexScan::_scan_mutable_index(const ChunkID chunk_id, const MutableAdaptiveRadixTreeIndex& mutable_index) {
+  using Bound = MutableAdaptiveRadixTreeIndex::Bound;
+
+  // Each predicate condition is translated into one or two ranges of the index
+  auto ranges = std::vector<std::pair<std::optional<Bound>, std::optional<Bound>>>{};
+  const auto& value = _right_values.front();
+  switch (_predicate_condition) {
+    case PredicateCondition::Equals:
+      ranges.emplace_back(Bound{value, true}, Bound{value, true});
+      break;
+    case PredicateCondition::NotEquals:
+      ranges.emplace_back(std::nullopt, Bound{value, false});
+      ranges.emplace_back(Bound{value, false}, std::nullopt);
+      break;
+    case PredicateCondition::LessThan:
+      ranges.emplace_back(std::nullopt, Bound{value, false});
+      break;
+    case PredicateCondition::LessThanEquals:
+      ranges.emplace_back(std::nullopt, Bound{value, true});
+      break;
+    case PredicateCondition::GreaterThan:
+      ranges.emplace_back(Bound{value, false}, std::nullopt);
+      break;
+    case PredicateCondition::GreaterThanEquals:
+      ranges.emplace_back(Bound{value, true}, std::nullopt);
+      break;
+    case PredicateCondition::BetweenInclusive:
+      ranges.emplace_back(Bound{value, true}, Bound{_right_values2.front(), true});
+      break;
+    case PredicateCondition::BetweenLowerExclusive:
+      ranges.emplace_back(Bound{value, false}, Bound{_right_values2.front(), true});
+      break;
+    case PredicateCondition::BetweenUpperExclusive:
+      ranges.emplace_back(Bound{value, true}, Bound{_right_values2.front(), false});
+      break;
+    case PredicateCondition::BetweenExclusive:
+      ranges.emplace_back(Bound{value, false}, Bound{_right_values2.front(), false});
+      break;
+    default:
+      Fail("Unsupported comparison type encountered");
+  }
+
+  auto matches_out = PosList{};
+  matches_out.guarantee_single_chunk();
+  for (const auto& [lower, upper] : ranges) {
+    for (const auto chunk_offset : mutable_index.range(lower, upper)) {
+      matches_out.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return matches_out;
+}
+
 }  // namespace opossum
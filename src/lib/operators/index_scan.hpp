@@ -13,10 +13,14 @@ namespace opossum {
 
 class Table;
 class AbstractTask;
+class MutableAdaptiveRadixTreeIndex;
 
 /**
  * Operator that performs a predicate search using indexes
  *
+ * For SegmentIndexType::AdaptiveRadixTree, chunks that have not been encoded yet are searched using their mutable
+ * index (see MutableAdaptiveRadixTreeIndex).
+ *
  * Note: Scans only the set of chunks passed to the constructor
  */
 class IndexScan : public AbstractReadOnlyOperator {
@@ -41,6 +45,7 @@ class IndexScan : public AbstractReadOnlyOperator {
   void _validate_input();
   std::shared_ptr<AbstractTask> _create_job_and_schedule(const ChunkID chunk_id, std::mutex& output_mutex);
   PosList _scan_chunk(const ChunkID chunk_id);
+  PosList _scan_mutable_index(const ChunkID chunk_id, const MutableAdaptiveRadixTreeIndex& mutable_index);
 
  private:
   const SegmentIndexType _index_type;
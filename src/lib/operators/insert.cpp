@@ -7,8 +7,10 @@
 
 #include "concurrency/transaction_context.hpp"
 #include "hyrise.hpp"
+#include "logging/log_entry_writer.hpp"
 #include "resolve_type.hpp"
 #include "storage/base_encoded_segment.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 #include "utils/assert.hpp"
@@ -211,6 +213,22 @@ std::shared_ptr<const Table> Insert::_on_execute(std::shared_ptr<TransactionCont
     }
   }
 
+  /**
+   * 3. Add the rows to the primary key index and the mutable indexes of their chunks, now that their values are
+   *    written. Until this transaction commits, they are not visible to others, just like in the table.
+   */
+  const auto primary_key_index = _target_table->primary_key_index();
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    if (primary_key_index) {
+      primary_key_index->insert(target_chunk_range.chunk_id, target_chunk_range.begin_chunk_offset,
+                                target_chunk_range.end_chunk_offset);
+    }
+
+    const auto target_chunk = _target_table->get_chunk(target_chunk_range.chunk_id);
+    target_chunk->insert_into_mutable_indexes(target_chunk_range.begin_chunk_offset,
+                                              target_chunk_range.end_chunk_offset);
+  }
+
   return nullptr;
 }
 
@@ -228,6 +246,9 @@ void Insert::_on_commit_records(const CommitID cid) {
     // This fence ensures that the changes to TID (which are not sequentially consistent) are visible to other threads.
     std::atomic_thread_fence(std::memory_order_release);
   }
+
+  // The inserted rows are only sampled for the statistics once they are committed
+  _target_table->schedule_table_statistics_refresh();
 }
 
 void Insert::_on_rollback_records() {
@@ -271,6 +292,13 @@ void Insert::_on_rollback_records() {
   }
 }
 
+void Insert::_on_write_log_records(LogEntryWriter& log_entry_writer) const {
+  for (const auto& target_chunk_range : _target_chunk_ranges) {
+    log_entry_writer.write_insert(_target_table_name, *_target_table, target_chunk_range.chunk_id,
+                                  target_chunk_range.begin_chunk_offset, target_chunk_range.end_chunk_offset);
+  }
+}
+
 std::shared_ptr<AbstractOperator> Insert::_on_deep_copy(
     const std::shared_ptr<AbstractOperator>& copied_input_left,
     const std::shared_ptr<AbstractOperator>& copied_input_right) const {
@@ -305,19 +305,35 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
     //                           \                 /
     //                          Probing (actual Join)
 
-    std::vector<std::shared_ptr<AbstractTask>> jobs;
+    // For inner and semi joins, probe side rows without a join partner are not part of the output. Those that are
+    // ruled out by a Bloom filter on the build side values are already discarded when the probe side is materialized.
+    // As the filter is complete only after the build side is materialized, the materialization of the probe side
+    // has to wait for it. Thus, the filter is only used if the probe side is larger than the build side.
+    auto bloom_filter = std::unique_ptr<BloomFilter>{};
+    if ((_mode == JoinMode::Inner || _mode == JoinMode::Semi) &&
+        _probe_input_table->row_count() > _build_input_table->row_count()) {
+      bloom_filter = std::make_unique<BloomFilter>(_build_input_table->row_count());
+    }
 
-    /**
-     * 1.1 Schedule a JobTask for materialization, optional radix partitioning and hash table building for the build side
-     */
-    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+    const auto materialize_build_column = [&]() {
       if (keep_nulls_build_column) {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, true>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, bloom_filter.get());
       } else {
         materialized_build_column = materialize_input<BuildColumnType, HashedType, false>(
-            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits);
+            _build_input_table, _column_ids.first, histograms_build_column, _radix_bits, bloom_filter.get());
       }
+    };
+
+    if (bloom_filter) materialize_build_column();
+
+    std::vector<std::shared_ptr<AbstractTask>> jobs;
+
+    /**
+     * 1.1 Schedule a JobTask for materialization, optional radix partitioning and hash table building for the build side
+     */
+    jobs.emplace_back(std::make_shared<JobTask>([&]() {
+      if (!bloom_filter) materialize_build_column();
 
       if (_radix_bits > 0) {
         // radix partition the build table
@@ -356,10 +372,10 @@ class JoinHash::JoinHashImpl : public AbstractJoinOperatorImpl {
       // Materialize probe column.
       if (keep_nulls_probe_column) {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, true>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits);
+            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, nullptr, bloom_filter.get());
       } else {
         materialized_probe_column = materialize_input<ProbeColumnType, HashedType, false>(
-            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits);
+            _probe_input_table, _column_ids.second, histograms_probe_column, _radix_bits, nullptr, bloom_filter.get());
       }
 
       if (_radix_bits > 0) {
@@ -1,5 +1,8 @@
 #pragma once
 
+#include <atomic>
+#include <vector>
+
 #include <boost/container/small_vector.hpp>
 #include <boost/lexical_cast.hpp>
 #include <uninitialized_vector.hpp>
@@ -182,9 +185,63 @@ class PosHashTable {
   std::optional<std::vector<std::pair<HashedType, Offset>>> _values{std::nullopt};
 };
 
+// Bloom filter on the hashes of the build side values (see materialize_input()). It is passed sideways to the
+// materialization of the probe side, which discards the rows whose values certainly have no join partner before they
+// are radix partitioned and probed. The filter is register-blocked (Putze et al., "Cache-, Hash-, and Space-Efficient
+// Bloom Filters", WEA 2007): all bits of a value are set in the same 64-bit word, so that a lookup loads a single
+// word and tests all bits with one comparison. Values can be inserted concurrently.
+class BloomFilter {
+ public:
+  // With 16 bits per element and four bits per value, about 1% of the lookups of absent values are false positives
+  static constexpr auto BITS_PER_ELEMENT = size_t{16};
+
+  explicit BloomFilter(const size_t element_count) {
+    auto word_count = size_t{1};
+    while (word_count * 64 < element_count * BITS_PER_ELEMENT) word_count <<= 1;
+    _words = std::vector<std::atomic<uint64_t>>(word_count);
+    _word_index_mask = word_count - 1;
+  }
+
+  void insert(const Hash hash) {
+    const auto mixed_hash = _mix(hash);
+    _words[mixed_hash & _word_index_mask].fetch_or(_bit_mask(mixed_hash), std::memory_order_relaxed);
+  }
+
+  // Returns false if no value with this hash has been inserted. True is also returned for some absent values.
+  bool may_contain(const Hash hash) const {
+    const auto mixed_hash = _mix(hash);
+    const auto bit_mask = _bit_mask(mixed_hash);
+    return (_words[mixed_hash & _word_index_mask].load(std::memory_order_relaxed) & bit_mask) == bit_mask;
+  }
+
+ private:
+  // std::hash is the identity for integers, so the bits are mixed with the finalizer of MurmurHash3
+  static uint64_t _mix(uint64_t hash) {
+    hash ^= hash >> 33;
+    hash *= 0xff51afd7ed558ccdULL;
+    hash ^= hash >> 33;
+    hash *= 0xc4ceb9fe1a85ec53ULL;
+    hash ^= hash >> 33;
+    return hash;
+  }
+
+  // The word is selected by the lower bits of the mixed hash, the four bits within the word by the upper 24 bits
+  static uint64_t _bit_mask(const uint64_t mixed_hash) {
+    return (uint64_t{1} << ((mixed_hash >> 40) & 63)) | (uint64_t{1} << ((mixed_hash >> 46) & 63)) |
+           (uint64_t{1} << ((mixed_hash >> 52) & 63)) | (uint64_t{1} << ((mixed_hash >> 58) & 63));
+  }
+
+  std::vector<std::atomic<uint64_t>> _words;
+  size_t _word_index_mask;
+};
+
+// Materializes the join column of in_table. Values of the build side are inserted into output_bloom_filter, if given.
+// On the probe side, rows are discarded if input_bloom_filter rules out that their value occurs on the build side.
 template <typename T, typename HashedType, bool keep_null_values>
 RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table, const ColumnID column_id,
-                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits) {
+                                    std::vector<std::vector<size_t>>& histograms, const size_t radix_bits,
+                                    BloomFilter* const output_bloom_filter = nullptr,
+                                    const BloomFilter* const input_bloom_filter = nullptr) {
   // Retrieve input chunk_count as it might change during execution if we work on a non-reference table
   auto chunk_count = in_table->chunk_count();
 
@@ -244,29 +301,35 @@ RadixContainer<T> materialize_input(const std::shared_ptr<const Table>& in_table
             // double. See #1550 for details.
             const Hash hashed_value = hash_function(static_cast<HashedType>(value.value()));
 
-            /*
-            For ReferenceSegments we do not use the RowIDs from the referenced tables.
-            Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
-            values from different inputs (important for Multi Joins).
-            */
-            if constexpr (is_reference_segment_iterable_v<IterableType>) {
-              *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
-            } else {
-              *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
-            }
-            ++elements_iter;
+            if (value.is_null() || !input_bloom_filter || input_bloom_filter->may_contain(hashed_value)) {
+              /*
+              For ReferenceSegments we do not use the RowIDs from the referenced tables.
+              Instead, we use the index in the ReferenceSegment itself. This way we can later correctly dereference
+              values from different inputs (important for Multi Joins).
+              */
+              if constexpr (is_reference_segment_iterable_v<IterableType>) {
+                *elements_iter = PartitionedElement<T>{RowID{chunk_id, reference_chunk_offset}, value.value()};
+              } else {
+                *elements_iter = PartitionedElement<T>{RowID{chunk_id, value.chunk_offset()}, value.value()};
+              }
+              ++elements_iter;
 
-            // In case we care about NULL values, store the NULL flag
-            if constexpr (keep_null_values) {
-              if (value.is_null()) {
-                *null_values_iter = true;
+              // In case we care about NULL values, store the NULL flag
+              if constexpr (keep_null_values) {
+                if (value.is_null()) {
+                  *null_values_iter = true;
+                }
+                ++null_values_iter;
               }
-              ++null_values_iter;
-            }
 
-            if (radix_bits > 0) {
-              const Hash radix = hashed_value & radix_mask;
-              ++histogram[radix];
+              if (output_bloom_filter && !value.is_null()) {
+                output_bloom_filter->insert(hashed_value);
+              }
+
+              if (radix_bits > 0) {
+                const Hash radix = hashed_value & radix_mask;
+                ++histogram[radix];
+              }
             }
           }
 
@@ -9,14 +9,19 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "get_table.hpp"
+#include "hyrise.hpp"
 #include "join_nested_loop.hpp"
 #include "multi_predicate_join/multi_predicate_join_evaluator.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/index/abstract_index.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "type_comparison.hpp"
 #include "utils/assert.hpp"
 #include "utils/performance_warning.hpp"
+#include "validate.hpp"
 
 namespace opossum {
 
@@ -125,104 +130,114 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   _probe_pos_list = std::make_shared<PosList>();
   _index_pos_list = std::make_shared<PosList>();
 
-  auto pos_list_size_to_reserve =
-      std::max(uint64_t{100}, std::min(_probe_input_table->row_count(), _index_input_table->row_count()));
-
-  _probe_pos_list->reserve(pos_list_size_to_reserve);
-  _index_pos_list->reserve(pos_list_size_to_reserve);
-
   auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
 
-  auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
+  // Check whether the index side is the GetTable of a table whose PrimaryKeyIndex consists of the join column
+  auto primary_key_index_table = std::shared_ptr<const Table>{};
+  auto primary_key_index_table_column_ids = std::vector<ColumnID>{};
+  const auto index_side_get_table =
+      std::dynamic_pointer_cast<const GetTable>(_index_side == IndexSide::Left ? input_left() : input_right());
+  if (index_side_get_table && _mode == JoinMode::Inner && _secondary_predicates.empty() &&
+      _adjusted_primary_predicate.predicate_condition == PredicateCondition::Equals) {
+    const auto stored_table = Hyrise::get().storage_manager.get_table(index_side_get_table->table_name());
+    const auto stored_column_ids = index_side_get_table->stored_column_ids();
+    const auto primary_key_index = stored_table->primary_key_index();
+    if (primary_key_index &&
+        primary_key_index->column_ids() ==
+            std::vector<ColumnID>{stored_column_ids[_adjusted_primary_predicate.column_ids.second]}) {
+      primary_key_index_table = stored_table;
+      primary_key_index_table_column_ids = stored_column_ids;
+    }
+  }
 
-  if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
-      _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
-    // Scan all chunks for index input
+  if (primary_key_index_table) {  // INNER JOIN USING THE PRIMARY KEY INDEX
+    const auto& primary_key_index = *primary_key_index_table->primary_key_index();
+    _join_probe_chunks(true, [&](const ChunkID probe_chunk_id, ProbeChunkMatches& matches) {
+      _primary_key_index_join(probe_chunk_id, primary_key_index, *primary_key_index_table, *index_side_get_table,
+                              matches);
+    });
+    // All chunks of the index side are covered by the index
+    performance_data.chunks_scanned_with_index = _index_input_table->chunk_count();
+  } else {
+    // Determine the index (or the lack thereof) of each index side chunk once, so that the jobs only read them
     const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+    auto index_chunks = std::vector<IndexChunk>(chunk_count_index_input_table);
 
-      if (index_chunk->size() == 0) {
-        continue;
-      }
+    if (_mode == JoinMode::Inner && _index_input_table->type() == TableType::References &&
+        _secondary_predicates.empty()) {  // INNER REFERENCE JOIN
+      for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+        const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+        Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
-      const auto& reference_segment =
-          std::dynamic_pointer_cast<ReferenceSegment>(index_chunk->get_segment(_primary_predicate.column_ids.second));
-      Assert(reference_segment != nullptr,
-             "Non-empty index input table (reference table) has to have only reference segments.");
-      auto index_data_table = reference_segment->referenced_table();
-      const std::vector<ColumnID> index_data_table_column_ids{reference_segment->referenced_column_id()};
-      const auto& reference_segment_pos_list = reference_segment->pos_list();
+        if (index_chunk->size() == 0) {
+          index_chunks[index_chunk_id].skip = true;
+          continue;
+        }
 
-      if (reference_segment_pos_list->empty()) {
-        continue;
-      }
+        const auto& reference_segment = std::dynamic_pointer_cast<ReferenceSegment>(
+            index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second));
+        Assert(reference_segment != nullptr,
+               "Non-empty index input table (reference table) has to have only reference segments.");
+        auto index_data_table = reference_segment->referenced_table();
+        const std::vector<ColumnID> index_data_table_column_ids{reference_segment->referenced_column_id()};
+        const auto& reference_segment_pos_list = reference_segment->pos_list();
+
+        if (reference_segment_pos_list->empty()) {
+          index_chunks[index_chunk_id].skip = true;
+          continue;
+        }
 
-      if (reference_segment_pos_list->references_single_chunk()) {
-        const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
-        Assert(index_data_table_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-        const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
+        if (reference_segment_pos_list->references_single_chunk()) {
+          const auto index_data_table_chunk = index_data_table->get_chunk((*reference_segment_pos_list)[0].chunk_id);
+          Assert(index_data_table_chunk,
+                 "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+          const auto& indexes = index_data_table_chunk->get_indexes(index_data_table_column_ids);
+
+          if (!indexes.empty()) {
+            // We assume the first index to be efficient for our join
+            // as we do not want to spend time on evaluating the best index inside of this join loop
+            index_chunks[index_chunk_id].index = indexes.front();
+
+            auto sorted_reference_segment_pos_list = std::make_shared<PosList>(reference_segment_pos_list->begin(),
+                                                                                   reference_segment_pos_list->end());
+            std::sort(sorted_reference_segment_pos_list->begin(), sorted_reference_segment_pos_list->end());
+            index_chunks[index_chunk_id].sorted_reference_segment_pos_list = sorted_reference_segment_pos_list;
+            index_chunks[index_chunk_id].referenced_chunk_id = (*reference_segment_pos_list)[0].chunk_id;
+          }
+        }
+      }
+    } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
+      for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+        const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
+        Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+        const auto& indexes =
+            index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
         if (!indexes.empty()) {
           // We assume the first index to be efficient for our join
           // as we do not want to spend time on evaluating the best index inside of this join loop
-          const auto& index = indexes.front();
-
-          // Scan all chunks from the probe side input
-          const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-          for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-            const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-            Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-            const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-            segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-              _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index,
-                                                       reference_segment_pos_list);
-            });
-          }
-          performance_data.chunks_scanned_with_index++;
-        } else {
-          _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                                secondary_predicate_evaluator);
+          index_chunks[index_chunk_id].index = indexes.front();
         }
-      } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                              secondary_predicate_evaluator);
       }
     }
-  } else {  // DATA JOIN since only inner joins are supported for a reference table on the index side
-    // Scan all chunks for index input
-    const auto chunk_count_index_input_table = _index_input_table->chunk_count();
-    for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
-      const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
-      Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-      const auto& indexes =
-          index_chunk->get_indexes(std::vector<ColumnID>{_adjusted_primary_predicate.column_ids.second});
-
-      if (!indexes.empty()) {
-        // We assume the first index to be efficient for our join
-        // as we do not want to spend time on evaluating the best index inside of this join loop
-        const auto& index = indexes.front();
-
-        // Scan all chunks from the probe side input
-        const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
-        for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
-          const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-          Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-          const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-          segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
-            _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index);
-          });
-        }
+
+    for (const auto& index_chunk : index_chunks) {
+      if (index_chunk.skip) continue;
+      if (index_chunk.index) {
         performance_data.chunks_scanned_with_index++;
       } else {
-        _fallback_nested_loop(index_chunk_id, track_probe_matches, track_index_matches, is_semi_or_anti_join,
-                              secondary_predicate_evaluator);
+        performance_data.chunks_scanned_without_index++;
       }
     }
+    if (performance_data.chunks_scanned_without_index > 0) {
+      PerformanceWarning("Fallback nested loop used.");
+    }
+
+    // The matches of the index side rows are shared by all probe chunks, so they cannot be tracked in parallel
+    _join_probe_chunks(!track_index_matches, [&](const ChunkID probe_chunk_id, ProbeChunkMatches& matches) {
+      _join_probe_chunk(probe_chunk_id, index_chunks, track_probe_matches, track_index_matches, is_semi_or_anti_join,
+                        matches);
+    });
 
     _append_matches_non_inner(is_semi_or_anti_join);
   }
@@ -230,8 +245,21 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   // write output chunks
   Segments output_segments;
 
+  const auto write_index_side_output_segments = [&]() {
+    if (!primary_key_index_table) {
+      _write_output_segments(output_segments, _index_input_table, _index_pos_list);
+      return;
+    }
+
+    // The RowIDs found in the primary key index belong to the stored table, not to the result of GetTable
+    for (const auto stored_column_id : primary_key_index_table_column_ids) {
+      output_segments.emplace_back(
+          std::make_shared<ReferenceSegment>(primary_key_index_table, stored_column_id, _index_pos_list));
+    }
+  };
+
   if (_index_side == IndexSide::Left) {
-    _write_output_segments(output_segments, _index_input_table, _index_pos_list);
+    write_index_side_output_segments();
   } else {
     _write_output_segments(output_segments, _probe_input_table, _probe_pos_list);
   }
@@ -240,7 +268,7 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
     if (_index_side == IndexSide::Left) {
       _write_output_segments(output_segments, _probe_input_table, _probe_pos_list);
     } else {
-      _write_output_segments(output_segments, _index_input_table, _index_pos_list);
+      write_index_side_output_segments();
     }
   }
 
@@ -254,40 +282,143 @@ std::shared_ptr<const Table> JoinIndex::_on_execute() {
   return _build_output_table({std::make_shared<Chunk>(output_segments)});
 }
 
-void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
-                                      const bool track_index_matches, const bool is_semi_or_anti_join,
-                                      MultiPredicateJoinEvaluator& secondary_predicate_evaluator) {
-  PerformanceWarning("Fallback nested loop used.");
-  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+void JoinIndex::_join_probe_chunks(const bool parallelize,
+                                   const std::function<void(const ChunkID, ProbeChunkMatches&)>& join_probe_chunk) {
+  const auto chunk_count_probe_input_table = _probe_input_table->chunk_count();
+  auto matches_per_probe_chunk = std::vector<ProbeChunkMatches>(chunk_count_probe_input_table);
+
+  if (parallelize && chunk_count_probe_input_table > 1) {
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count_probe_input_table);
+    for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, probe_chunk_id]() {
+        join_probe_chunk(probe_chunk_id, matches_per_probe_chunk[probe_chunk_id]);
+      }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+  } else {
+    for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count_probe_input_table; ++probe_chunk_id) {
+      join_probe_chunk(probe_chunk_id, matches_per_probe_chunk[probe_chunk_id]);
+    }
+  }
+
+  // Stitch the matches of all probe chunks together
+  auto match_count = size_t{0};
+  for (const auto& matches : matches_per_probe_chunk) {
+    match_count += matches.probe_pos_list.size();
+  }
+  _probe_pos_list->reserve(match_count);
+  _index_pos_list->reserve(match_count);
+  _index_pos_dereferenced.reserve(match_count);
+
+  for (auto& matches : matches_per_probe_chunk) {
+    _probe_pos_list->insert(_probe_pos_list->end(), matches.probe_pos_list.begin(), matches.probe_pos_list.end());
+    _index_pos_list->insert(_index_pos_list->end(), matches.index_pos_list.begin(), matches.index_pos_list.end());
+    _index_pos_dereferenced.insert(_index_pos_dereferenced.end(), matches.index_pos_dereferenced.begin(),
+                                   matches.index_pos_dereferenced.end());
+    matches = ProbeChunkMatches{};
+  }
+}
+
+void JoinIndex::_join_probe_chunk(const ChunkID probe_chunk_id, const std::vector<IndexChunk>& index_chunks,
+                                  const bool track_probe_matches, const bool track_index_matches,
+                                  const bool is_semi_or_anti_join, ProbeChunkMatches& matches) {
+  const auto probe_chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(probe_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  const auto& probe_segment = probe_chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+
+  // The evaluator is not thread-safe, so every job needs its own
+  auto secondary_predicate_evaluator = MultiPredicateJoinEvaluator{*_probe_input_table, *_index_input_table, _mode, {}};
+
+  const auto chunk_count_index_input_table = static_cast<ChunkID>(index_chunks.size());
+  for (ChunkID index_chunk_id{0}; index_chunk_id < chunk_count_index_input_table; ++index_chunk_id) {
+    const auto& index_chunk = index_chunks[index_chunk_id];
+    if (index_chunk.skip) continue;
+
+    if (!index_chunk.index) {
+      _fallback_nested_loop(probe_chunk_id, index_chunk_id, track_probe_matches, track_index_matches,
+                            is_semi_or_anti_join, secondary_predicate_evaluator, matches);
+      continue;
+    }
+
+    segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+      if (index_chunk.sorted_reference_segment_pos_list) {
+        _reference_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id,
+                                                 index_chunk.referenced_chunk_id, index_chunk.index,
+                                                 *index_chunk.sorted_reference_segment_pos_list, matches);
+      } else {
+        _data_join_two_segments_using_index(probe_iter, probe_end, probe_chunk_id, index_chunk_id, index_chunk.index,
+                                            matches);
+      }
+    });
+  }
+}
 
+void JoinIndex::_fallback_nested_loop(const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                                      const bool track_probe_matches, const bool track_index_matches,
+                                      const bool is_semi_or_anti_join,
+                                      MultiPredicateJoinEvaluator& secondary_predicate_evaluator,
+                                      ProbeChunkMatches& matches) {
   const auto index_chunk = _index_input_table->get_chunk(index_chunk_id);
   Assert(index_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
   const auto& index_segment = index_chunk->get_segment(_adjusted_primary_predicate.column_ids.second);
-  const auto& index_pos_list_size_pre_fallback = _index_pos_list->size();
-
-  const auto chunk_count = _probe_input_table->chunk_count();
-  for (ChunkID probe_chunk_id{0}; probe_chunk_id < chunk_count; ++probe_chunk_id) {
-    const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
-    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
-
-    const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
-    JoinNestedLoop::JoinParams params{*_probe_pos_list,
-                                      *_index_pos_list,
-                                      _probe_matches[probe_chunk_id],
-                                      _index_matches[index_chunk_id],
-                                      track_probe_matches,
-                                      track_index_matches,
-                                      _mode,
-                                      _adjusted_primary_predicate.predicate_condition,
-                                      secondary_predicate_evaluator,
-                                      !is_semi_or_anti_join};
-    JoinNestedLoop::_join_two_untyped_segments(*probe_segment, *index_segment, probe_chunk_id, index_chunk_id, params);
-  }
-  const auto& index_pos_list_size_post_fallback = _index_pos_list->size();
-  const auto& count_index_positions = index_pos_list_size_post_fallback - index_pos_list_size_pre_fallback;
-  std::fill_n(std::back_inserter(_index_pos_dereferenced), count_index_positions, false);
-  performance_data.chunks_scanned_without_index++;
+
+  const auto probe_chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(probe_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+  const auto& probe_segment = probe_chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+
+  const auto index_pos_list_size_pre_fallback = matches.index_pos_list.size();
+
+  JoinNestedLoop::JoinParams params{matches.probe_pos_list,
+                                    matches.index_pos_list,
+                                    _probe_matches[probe_chunk_id],
+                                    _index_matches[index_chunk_id],
+                                    track_probe_matches,
+                                    track_index_matches,
+                                    _mode,
+                                    _adjusted_primary_predicate.predicate_condition,
+                                    secondary_predicate_evaluator,
+                                    !is_semi_or_anti_join};
+  JoinNestedLoop::_join_two_untyped_segments(*probe_segment, *index_segment, probe_chunk_id, index_chunk_id, params);
+
+  const auto count_index_positions = matches.index_pos_list.size() - index_pos_list_size_pre_fallback;
+  std::fill_n(std::back_inserter(matches.index_pos_dereferenced), count_index_positions, false);
+}
+
+void JoinIndex::_primary_key_index_join(const ChunkID probe_chunk_id, const PrimaryKeyIndex& primary_key_index,
+                                        const Table& stored_table, const GetTable& get_table,
+                                        ProbeChunkMatches& matches) {
+  const auto context = transaction_context_is_set() ? transaction_context() : nullptr;
+  const auto check_visibility = context && stored_table.uses_mvcc() == UseMvcc::Yes;
+
+  const auto chunk = _probe_input_table->get_chunk(probe_chunk_id);
+  Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+  const auto& probe_segment = chunk->get_segment(_adjusted_primary_predicate.column_ids.first);
+  segment_with_iterators(*probe_segment, [&](auto probe_iter, const auto probe_end) {
+    for (; probe_iter != probe_end; ++probe_iter) {
+      const auto probe_side_position = *probe_iter;
+      if (probe_side_position.is_null()) continue;
+
+      const auto index_row_ids = primary_key_index.lookup(std::vector<AllTypeVariant>{probe_side_position.value()});
+      for (const auto& index_row_id : index_row_ids) {
+        if (!get_table.is_stored_chunk_included(stored_table, index_row_id.chunk_id)) continue;
+
+        if (check_visibility) {
+          const auto mvcc_data = stored_table.get_chunk(index_row_id.chunk_id)->mvcc_data();
+          const auto chunk_offset = index_row_id.chunk_offset;
+          if (!Validate::is_row_visible(context->transaction_id(), context->snapshot_commit_id(),
+                                        mvcc_data->get_tid(chunk_offset), mvcc_data->get_begin_cid(chunk_offset),
+                                        mvcc_data->get_end_cid(chunk_offset))) {
+            continue;
+          }
+        }
+
+        matches.probe_pos_list.emplace_back(RowID{probe_chunk_id, probe_side_position.chunk_offset()});
+        matches.index_pos_list.emplace_back(index_row_id);
+      }
+    }
+  });
 }
 
 // join loop that joins two segments of two columns using an iterator for the probe side,
@@ -295,40 +426,42 @@ void JoinIndex::_fallback_nested_loop(const ChunkID index_chunk_id, const bool t
 template <typename ProbeIterator>
 void JoinIndex::_data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                                     const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                                    const std::shared_ptr<AbstractIndex>& index) {
+                                                    const std::shared_ptr<AbstractIndex>& index,
+                                                    ProbeChunkMatches& matches) {
   for (; probe_iter != probe_end; ++probe_iter) {
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
     for (const auto& [index_begin, index_end] : index_ranges) {
-      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id);
+      _append_matches(index_begin, index_end, probe_side_position.chunk_offset(), probe_chunk_id, index_chunk_id,
+                      matches);
     }
   }
 }
 
 template <typename ProbeIterator>
 void JoinIndex::_reference_join_two_segments_using_index(
-    ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-    const std::shared_ptr<AbstractIndex>& index, const std::shared_ptr<const PosList>& reference_segment_pos_list) {
+    ProbeIterator probe_iter, ProbeIterator probe_end, const ChunkID probe_chunk_id, const ChunkID referenced_chunk_id,
+    const std::shared_ptr<AbstractIndex>& index, const PosList& sorted_reference_segment_pos_list,
+    ProbeChunkMatches& matches) {
   for (; probe_iter != probe_end; ++probe_iter) {
     PosList index_scan_pos_list;
     const auto probe_side_position = *probe_iter;
     const auto index_ranges = _index_ranges_for_value(probe_side_position, index);
     for (const auto& [index_begin, index_end] : index_ranges) {
+      // The index belongs to the referenced data chunk, so its matches are RowIDs of the data table
       std::transform(index_begin, index_end, std::back_inserter(index_scan_pos_list),
-                     [index_chunk_id](ChunkOffset index_chunk_offset) {
-                       return RowID{index_chunk_id, index_chunk_offset};
+                     [referenced_chunk_id](ChunkOffset index_chunk_offset) {
+                       return RowID{referenced_chunk_id, index_chunk_offset};
                      });
     }
 
-    PosList mutable_ref_seg_pos_list(reference_segment_pos_list->size());
-    std::copy(reference_segment_pos_list->begin(), reference_segment_pos_list->end(), mutable_ref_seg_pos_list.begin());
-    std::sort(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end());
     std::sort(index_scan_pos_list.begin(), index_scan_pos_list.end());
 
     PosList index_table_matches{};
-    std::set_intersection(mutable_ref_seg_pos_list.begin(), mutable_ref_seg_pos_list.end(), index_scan_pos_list.begin(),
-                          index_scan_pos_list.end(), std::back_inserter(index_table_matches));
-    _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches);
+    std::set_intersection(sorted_reference_segment_pos_list.begin(), sorted_reference_segment_pos_list.end(),
+                          index_scan_pos_list.begin(), index_scan_pos_list.end(),
+                          std::back_inserter(index_table_matches));
+    _append_matches_dereferenced(probe_chunk_id, probe_side_position.chunk_offset(), index_table_matches, matches);
   }
 }
 
@@ -390,7 +523,7 @@ std::vector<IndexRange> JoinIndex::_index_ranges_for_value(const SegmentPosition
 
 void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
                                 const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                                const ChunkID index_chunk_id) {
+                                const ChunkID index_chunk_id, ProbeChunkMatches& matches) {
   const auto num_index_matches = std::distance(range_begin, range_end);
 
   if (num_index_matches == 0) {
@@ -404,9 +537,9 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
   }
 
   // we replicate the probe side value for each index side value
-  std::fill_n(std::back_inserter(*_probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
+  std::fill_n(std::back_inserter(matches.probe_pos_list), num_index_matches, RowID{probe_chunk_id, probe_chunk_offset});
 
-  std::transform(range_begin, range_end, std::back_inserter(*_index_pos_list),
+  std::transform(range_begin, range_end, std::back_inserter(matches.index_pos_list),
                  [index_chunk_id](ChunkOffset index_chunk_offset) {
                    return RowID{index_chunk_id, index_chunk_offset};
                  });
@@ -420,11 +553,11 @@ void JoinIndex::_append_matches(const AbstractIndex::Iterator& range_begin, cons
 }
 
 void JoinIndex::_append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                             const PosList& index_table_matches) {
+                                             const PosList& index_table_matches, ProbeChunkMatches& matches) {
   for (const auto& index_side_row_id : index_table_matches) {
-    _probe_pos_list->emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
-    _index_pos_list->emplace_back(index_side_row_id);
-    _index_pos_dereferenced.emplace_back(true);
+    matches.probe_pos_list.emplace_back(RowID{probe_chunk_id, probe_chunk_offset});
+    matches.index_pos_list.emplace_back(index_side_row_id);
+    matches.index_pos_dereferenced.emplace_back(true);
   }
 }
 
@@ -544,6 +677,7 @@ void JoinIndex::_on_cleanup() {
   _output_table.reset();
   _probe_pos_list.reset();
   _index_pos_list.reset();
+  _index_pos_dereferenced.clear();
   _probe_matches.clear();
   _index_matches.clear();
 }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <set>
 #include <string>
@@ -13,7 +14,9 @@
 
 namespace opossum {
 
+class GetTable;
 class MultiPredicateJoinEvaluator;
+class PrimaryKeyIndex;
 using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
 
 /**
@@ -27,6 +30,16 @@ using IndexRange = std::pair<AbstractIndex::Iterator, AbstractIndex::Iterator>;
    * scanned with index in the performance data.
    *
    * Note: An index needs to be present on the index side table in order to execute an index join.
+   *
+   * If the index side input is the GetTable of a table whose PrimaryKeyIndex consists of the join column, an inner
+   * equi-join probes this table-wide index once per probe side row instead of the chunk indexes. The index side output
+   * columns then reference the stored table. If the transaction context is set, only index side rows that are visible
+   * to the transaction are emitted, so that the index side does not need to be validated (see LQPTranslator).
+   *
+   * The chunks of the probe side are joined by one job each. Every job writes the matches of its probe chunk into
+   * separate PosLists, which are concatenated in the order of the probe chunks afterwards. As the matches of the index
+   * side rows are tracked for all probe chunks together, joins that emit unmatched index side rows are executed in a
+   * single job.
    */
 class JoinIndex : public AbstractJoinOperator {
  public:
@@ -54,20 +67,56 @@ class JoinIndex : public AbstractJoinOperator {
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  void _fallback_nested_loop(const ChunkID index_chunk_id, const bool track_probe_matches,
-                             const bool track_index_matches, const bool is_semi_or_anti_join,
-                             MultiPredicateJoinEvaluator& secondary_predicate_evaluator);
+  // Matches of one chunk of the probe side, written by the job that joins this chunk
+  struct ProbeChunkMatches {
+    PosList probe_pos_list;
+    PosList index_pos_list;
+    std::vector<bool> index_pos_dereferenced;
+  };
+
+  // Determines how the probe side is joined with one chunk of the index side
+  struct IndexChunk {
+    // Empty chunks of a reference table are not joined at all
+    bool skip{false};
+
+    // nullptr if the chunk has no index on the join column, in which case the fallback nested loop is used
+    std::shared_ptr<AbstractIndex> index;
+
+    // Only for reference tables: the sorted positions in the referenced data chunk that the index belongs to
+    std::shared_ptr<const PosList> sorted_reference_segment_pos_list;
+
+    // Only for reference tables: the ID of the referenced data chunk. It differs from the ID of the index side chunk,
+    // e.g., if the Validate that produced the reference table dropped empty chunks.
+    ChunkID referenced_chunk_id{INVALID_CHUNK_ID};
+  };
+
+  // Executes `join_probe_chunk` for all chunks of the probe side and concatenates the matches into the output PosLists
+  void _join_probe_chunks(const bool parallelize,
+                          const std::function<void(const ChunkID, ProbeChunkMatches&)>& join_probe_chunk);
+
+  void _join_probe_chunk(const ChunkID probe_chunk_id, const std::vector<IndexChunk>& index_chunks,
+                         const bool track_probe_matches, const bool track_index_matches,
+                         const bool is_semi_or_anti_join, ProbeChunkMatches& matches);
+
+  void _fallback_nested_loop(const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                             const bool track_probe_matches, const bool track_index_matches,
+                             const bool is_semi_or_anti_join,
+                             MultiPredicateJoinEvaluator& secondary_predicate_evaluator, ProbeChunkMatches& matches);
+
+  void _primary_key_index_join(const ChunkID probe_chunk_id, const PrimaryKeyIndex& primary_key_index,
+                               const Table& stored_table, const GetTable& get_table, ProbeChunkMatches& matches);
 
   template <typename ProbeIterator>
   void _data_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
                                            const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
-                                           const std::shared_ptr<AbstractIndex>& index);
+                                           const std::shared_ptr<AbstractIndex>& index, ProbeChunkMatches& matches);
 
   template <typename ProbeIterator>
   void _reference_join_two_segments_using_index(ProbeIterator probe_iter, ProbeIterator probe_end,
-                                                const ChunkID probe_chunk_id, const ChunkID index_chunk_id,
+                                                const ChunkID probe_chunk_id, const ChunkID referenced_chunk_id,
                                                 const std::shared_ptr<AbstractIndex>& index,
-                                                const std::shared_ptr<const PosList>& reference_segment_pos_list);
+                                                const PosList& sorted_reference_segment_pos_list,
+                                                ProbeChunkMatches& matches);
 
   template <typename SegmentPosition>
   std::vector<IndexRange> _index_ranges_for_value(const SegmentPosition probe_side_position,
@@ -75,10 +124,10 @@ class JoinIndex : public AbstractJoinOperator {
 
   void _append_matches(const AbstractIndex::Iterator& range_begin, const AbstractIndex::Iterator& range_end,
                        const ChunkOffset probe_chunk_offset, const ChunkID probe_chunk_id,
-                       const ChunkID index_chunk_id);
+                       const ChunkID index_chunk_id, ProbeChunkMatches& matches);
 
   void _append_matches_dereferenced(const ChunkID& probe_chunk_id, const ChunkOffset& probe_chunk_offset,
-                                    const PosList& index_table_matches);
+                                    const PosList& index_table_matches, ProbeChunkMatches& matches);
 
   void _append_matches_non_inner(const bool is_semi_or_anti_join);
 
@@ -8,6 +8,10 @@
 #include "expression/abstract_expression.hpp"
 
 namespace opossum {
+
+// Evaluates the row count expression of a Limit (or TopK) to the number of rows the output is limited to
+size_t evaluate_limit_row_count(const AbstractExpression& row_count_expression);
+
 // operator to limit the input to n rows
 class Limit : public AbstractReadOnlyOperator {
  public:
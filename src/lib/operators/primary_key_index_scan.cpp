@@ -0,0 +1,109 @@
+#include "primary_key_index_scan.hpp"
+
+#include <memory>
+#include <sstream>
+#include <string>
+#include <vector>
+
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/reference_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+namespace {
+
+AllTypeVariant evaluate_key_value(const AbstractExpression& key_expression) {
+  if (key_expression.type == ExpressionType::Value) {
+    return static_cast<const ValueExpression&>(key_expression).value;
+  }
+
+  if (key_expression.type == ExpressionType::CorrelatedParameter) {
+    const auto& value = static_cast<const CorrelatedParameterExpression&>(key_expression).value();
+    Assert(value, "Value of correlated parameter was not set");
+    return *value;
+  }
+
+  Fail("Expected a value or a correlated parameter as primary key value");
+}
+
+}  // namespace
+
+PrimaryKeyIndexScan::PrimaryKeyIndexScan(const std::shared_ptr<const AbstractOperator>& in,
+                                         const std::vector<std::shared_ptr<AbstractExpression>>& key_expressions)
+    : AbstractReadOnlyOperator{OperatorType::PrimaryKeyIndexScan, in}, _key_expressions{key_expressions} {}
+
+const std::string& PrimaryKeyIndexScan::name() const {
+  static const auto name = std::string{"PrimaryKeyIndexScan"};
+  return name;
+}
+
+std::string PrimaryKeyIndexScan::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << "(";
+  for (auto expression_idx = size_t{0}; expression_idx < _key_expressions.size(); ++expression_idx) {
+    if (expression_idx > 0) stream << ", ";
+    stream << _key_expressions[expression_idx]->as_column_name();
+  }
+  stream << ")";
+
+  return stream.str();
+}
+
+const std::vector<std::shared_ptr<AbstractExpression>>& PrimaryKeyIndexScan::key_expressions() const {
+  return _key_expressions;
+}
+
+std::shared_ptr<const Table> PrimaryKeyIndexScan::_on_execute() {
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(input_left());
+  Assert(get_table, "PrimaryKeyIndexScan expects a GetTable as input");
+
+  const auto stored_table = Hyrise::get().storage_manager.get_table(get_table->table_name());
+  const auto primary_key_index = stored_table->primary_key_index();
+  Assert(primary_key_index, "PrimaryKeyIndexScan requires a table with a primary key index");
+  Assert(_key_expressions.size() == primary_key_index->column_ids().size(),
+         "Expected one key expression per primary key column");
+
+  auto key = std::vector<AllTypeVariant>{};
+  key.reserve(_key_expressions.size());
+  for (const auto& key_expression : _key_expressions) {
+    key.emplace_back(evaluate_key_value(*key_expression));
+  }
+
+  auto pos_list = std::make_shared<PosList>();
+  for (const auto& row_id : primary_key_index->lookup(key)) {
+    if (get_table->is_stored_chunk_included(*stored_table, row_id.chunk_id)) {
+      pos_list->emplace_back(row_id);
+    }
+  }
+
+  auto output_table = std::make_shared<Table>(input_table_left()->column_definitions(), TableType::References);
+  if (pos_list->empty()) return output_table;
+
+  auto output_segments = Segments{};
+  for (const auto stored_column_id : get_table->stored_column_ids()) {
+    output_segments.emplace_back(std::make_shared<ReferenceSegment>(stored_table, stored_column_id, pos_list));
+  }
+  output_table->append_chunk(output_segments);
+
+  return output_table;
+}
+
+std::shared_ptr<AbstractOperator> PrimaryKeyIndexScan::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<PrimaryKeyIndexScan>(copied_input_left, expressions_deep_copy(_key_expressions));
+}
+
+void PrimaryKeyIndexScan::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expressions_set_parameters(_key_expressions, parameters);
+}
+
+}  // namespace opossum
@@ -0,0 +1,49 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractExpression;
+
+/**
+ * Operator that finds the rows with the given primary key values using the PrimaryKeyIndex of a stored table. This
+ * replaces a conjunction of equality predicates on all primary key columns (see IndexScanRule).
+ *
+ * The input must be the GetTable of the indexed table. Its result is not scanned, but it defines the columns and
+ * chunks that are part of the output: The output references the stored table directly and contains the same columns
+ * as the input. Like all data tables, it contains rows that may be invisible to the transaction, so a Validate is
+ * needed for MVCC.
+ *
+ * Each key expression is either a value or a correlated parameter, so the operator can be used in prepared plans and
+ * correlated subqueries. The key expressions are given in the order of PrimaryKeyIndex::column_ids().
+ */
+class PrimaryKeyIndexScan : public AbstractReadOnlyOperator {
+ public:
+  PrimaryKeyIndexScan(const std::shared_ptr<const AbstractOperator>& in,
+                      const std::vector<std::shared_ptr<AbstractExpression>>& key_expressions);
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+  const std::vector<std::shared_ptr<AbstractExpression>>& key_expressions() const;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+ private:
+  const std::vector<std::shared_ptr<AbstractExpression>> _key_expressions;
+};
+
+}  // namespace opossum
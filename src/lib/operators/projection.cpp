@@ -3,6 +3,7 @@
 #include <algorithm>
 #include <functional>
 #include <memory>
+#include <mutex>
 #include <numeric>
 #include <string>
 #include <utility>
@@ -12,6 +13,9 @@
 #include "expression/expression_utils.hpp"
 #include "expression/pqp_column_expression.hpp"
 #include "expression/value_expression.hpp"
+#include "hyrise.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
@@ -61,18 +65,25 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       ExpressionEvaluator::populate_uncorrelated_subquery_results_cache(expressions);
 
   auto column_is_nullable = std::vector<bool>(expressions.size(), false);
+  auto column_is_nullable_mutex = std::mutex{};
 
   /**
-   * Perform the projection
+   * Perform the projection. Each chunk is projected by its own job. The jobs write the output segments to the position
+   * of their chunk, so that the order of the chunks is preserved.
    */
   auto output_chunk_segments = std::vector<Segments>(input_table.chunk_count());
 
   const auto chunk_count_input_table = input_table.chunk_count();
-  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count_input_table);
+
+  const auto project_chunk = [&](const ChunkID chunk_id) {
     const auto input_chunk = input_table.get_chunk(chunk_id);
     Assert(input_chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
     auto output_segments = Segments{expressions.size()};
+    auto chunk_column_is_nullable = std::vector<bool>(expressions.size(), false);
 
     ExpressionEvaluator evaluator(input_table_left(), chunk_id, uncorrelated_subquery_results);
 
@@ -83,8 +94,7 @@ std::shared_ptr<const Table> Projection::_on_execute() {
       if (expression->type == ExpressionType::PQPColumn && forward_columns) {
         const auto pqp_column_expression = std::static_pointer_cast<PQPColumnExpression>(expression);
         output_segments[column_id] = input_chunk->get_segment(pqp_column_expression->column_id);
-        column_is_nullable[column_id] =
-            column_is_nullable[column_id] || input_table.column_is_nullable(pqp_column_expression->column_id);
+        chunk_column_is_nullable[column_id] = input_table.column_is_nullable(pqp_column_expression->column_id);
       } else if (expression->type == ExpressionType::PQPColumn && !forward_columns) {
         // The current column will be returned without any logical modifications. As other columns do get modified (and
         // returned as a ValueSegment), all segments (including this one) need to become ValueSegments. This segment is
@@ -186,19 +196,31 @@ std::shared_ptr<const Table> Projection::_on_execute() {
             }
 
             output_segments[column_id] = std::move(value_segment);
-            column_is_nullable[column_id] = has_null;
+            chunk_column_is_nullable[column_id] = has_null;
           }
         });
       } else {
         auto output_segment = evaluator.evaluate_expression_to_segment(*expression);
-        column_is_nullable[column_id] = column_is_nullable[column_id] || output_segment->is_nullable();
+        chunk_column_is_nullable[column_id] = output_segment->is_nullable();
         output_segments[column_id] = std::move(output_segment);
       }
     }
 
     output_chunk_segments[chunk_id] = std::move(output_segments);
+
+    std::lock_guard<std::mutex> lock(column_is_nullable_mutex);
+    for (auto column_id = ColumnID{0}; column_id < expressions.size(); ++column_id) {
+      column_is_nullable[column_id] = column_is_nullable[column_id] || chunk_column_is_nullable[column_id];
+    }
+  };
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count_input_table; ++chunk_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&project_chunk, chunk_id]() { project_chunk(chunk_id); }));
+    jobs.back()->schedule();
   }
 
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
   /**
    * Determine the TableColumnDefinitions and build the output table
    */
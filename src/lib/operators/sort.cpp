@@ -1,260 +1,323 @@
 #include "sort.hpp"
 
-#include <functional>
+#include <algorithm>
 #include <memory>
+#include <numeric>
+#include <queue>
+#include <sstream>
 #include <string>
 #include <unordered_map>
 #include <utility>
 #include <vector>
 
-#include "storage/reference_segment.hpp"
+#include "hyrise.hpp"
+#include "operators/sort/normalized_sort_keys.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
 #include "storage/segment_accessor.hpp"
 #include "storage/segment_iterate.hpp"
 #include "storage/value_segment.hpp"
 
-namespace opossum {
-
-Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id, const OrderByMode order_by_mode,
-           const size_t output_chunk_size)
-    : AbstractReadOnlyOperator(OperatorType::Sort, in),
-      _column_id(column_id),
-      _order_by_mode(order_by_mode),
-      _output_chunk_size(output_chunk_size) {}
+namespace {
 
-ColumnID Sort::column_id() const { return _column_id; }
+using namespace opossum;  // NOLINT
 
-OrderByMode Sort::order_by_mode() const { return _order_by_mode; }
+// Lower bound for the number of rows that are merged by a single merge job. Smaller inputs are merged by one job.
+constexpr auto MIN_ROWS_PER_MERGE_PARTITION = size_t{1'000'000};
 
-const std::string& Sort::name() const {
-  static const auto name = std::string{"Sort"};
-  return name;
-}
-
-std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
-    const std::shared_ptr<AbstractOperator>& copied_input_left,
-    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
-  return std::make_shared<Sort>(copied_input_left, _column_id, _order_by_mode, _output_chunk_size);
-}
+// Number of samples taken per merge partition to determine the splitters between the partitions. The more samples we
+// take, the more evenly sized the partitions become.
+constexpr auto SAMPLES_PER_MERGE_PARTITION = size_t{32};
 
-void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
-
-std::shared_ptr<const Table> Sort::_on_execute() {
-  _impl = make_unique_by_data_type<AbstractReadOnlyOperatorImpl, SortImpl>(
-      input_table_left()->column_data_type(_column_id), input_table_left(), _column_id, _order_by_mode,
-      _output_chunk_size);
-  return _impl->_on_execute();
-}
-
-void Sort::_on_cleanup() { _impl.reset(); }
-
-// This class fulfills only the materialization task for a sorted row_id_value_vector.
-template <typename SortColumnType>
-class Sort::SortImplMaterializeOutput {
+/**
+ * Each row's sort keys are encoded as one normalized key (see NormalizedSortKeys), so that comparing two rows usually
+ * is a single memcmp. Rows are numbered in the order of the input table, which makes the sort stable even though
+ * std::sort is used.
+ */
+class SortImpl {
  public:
-  // creates a new table with reference segments
-  SortImplMaterializeOutput(const std::shared_ptr<const Table>& in,
-                            const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>>& id_value_map,
-                            const size_t output_chunk_size)
-      : _table_in(in), _output_chunk_size(output_chunk_size), _row_id_value_vector(id_value_map) {}
+  SortImpl(const std::shared_ptr<const Table>& table_in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
+      : _table_in(table_in), _sort_definitions(sort_definitions), _output_chunk_size(output_chunk_size) {
+    for (const auto& sort_definition : _sort_definitions) {
+      _keys.add_column(_table_in->column_data_type(sort_definition.column), sort_definition.order_by_mode);
+    }
+  }
 
   std::shared_ptr<Table> execute() {
-    // First we create a new table as the output
-    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+    const auto chunk_count = _table_in->chunk_count();
 
-    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+    // Rows of chunk i are stored at [_run_begins[i], _run_begins[i + 1]) in the row-indexed vectors
+    _run_begins.resize(chunk_count + 1, 0);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      const auto chunk = _table_in->get_chunk(chunk_id);
+      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+      _run_begins[chunk_id + 1] = _run_begins[chunk_id] + chunk->size();
+    }
+
+    _row_count = _run_begins.back();
+    _keys.resize(_row_count);
+    _row_ids.resize(_row_count);
+    _run_rows.resize(_row_count);
+
+    // 1. Encode the keys of each chunk and sort it as a separate run
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(chunk_count);
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([this, chunk_id]() { _sort_run(chunk_id); }));
+      jobs.back()->schedule();
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
-    // After we created the output table and initialized the column structure, we can start adding values. Because the
-    // values are not ordered by input chunks anymore, we can't process them chunk by chunk. Instead the values are
-    // copied column by column for each output row. For each column in a row we visit the input segment with a reference
-    // to the output segment. This enables for the SortImplMaterializeOutput class to ignore the column types during the
-    // copying of the values.
-    const auto row_count_out = _row_id_value_vector->size();
+    // 2. Merge the sorted runs
+    _merge_runs();
 
-    // Ceiling of integer division
-    const auto div_ceil = [](auto x, auto y) { return (x + y - 1u) / y; };
+    // 3. Write the rows in sorted order
+    return _materialize_output();
+  }
 
-    const auto chunk_count_out = div_ceil(row_count_out, _output_chunk_size);
+ protected:
+  void _sort_run(const ChunkID chunk_id) {
+    const auto chunk = _table_in->get_chunk(chunk_id);
+    const auto run_begin = _run_begins[chunk_id];
+    const auto run_end = _run_begins[chunk_id + 1];
 
-    // Vector of segments for each chunk
-    std::vector<Segments> output_segments_by_chunk(chunk_count_out);
+    for (auto row = run_begin; row < run_end; ++row) {
+      _row_ids[row] = RowID{chunk_id, static_cast<ChunkOffset>(row - run_begin)};
+    }
 
-    // Materialize segment-wise
-    for (ColumnID column_id{0u}; column_id < output->column_count(); ++column_id) {
-      const auto column_data_type = output->column_data_type(column_id);
+    for (auto column_index = size_t{0}; column_index < _sort_definitions.size(); ++column_index) {
+      const auto column_id = _sort_definitions[column_index].column;
+      const auto& segment = *chunk->get_segment(column_id);
 
-      resolve_data_type(column_data_type, [&](auto type) {
+      resolve_data_type(_table_in->column_data_type(column_id), [&](auto type) {
         using ColumnDataType = typename decltype(type)::type;
 
-        auto chunk_it = output_segments_by_chunk.begin();
-        auto chunk_offset_out = 0u;
+        segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+          const auto row = run_begin + position.chunk_offset();
+          if (position.is_null()) {
+            _keys.set_null(row, column_index);
+          } else {
+            _keys.set_value(row, column_index, position.value());
+          }
+        });
+      });
+    }
 
-        auto value_segment_value_vector = pmr_vector<ColumnDataType>();
-        auto value_segment_null_vector = pmr_vector<bool>();
+    std::iota(_run_rows.begin() + run_begin, _run_rows.begin() + run_end, run_begin);
+    std::sort(_run_rows.begin() + run_begin, _run_rows.begin() + run_end,
+              [&](const size_t lhs, const size_t rhs) { return _less(lhs, rhs); });
+  }
 
-        value_segment_value_vector.reserve(row_count_out);
-        value_segment_null_vector.reserve(row_count_out);
+  // Splits the key domain into partitions by sampling splitters from the sorted runs. Each partition is then merged
+  // independently by one job, which looks up the partition boundaries in each run and performs a k-way merge.
+  void _merge_runs() {
+    auto runs = std::vector<std::pair<size_t, size_t>>{};
+    for (auto run_index = size_t{0}; run_index + 1 < _run_begins.size(); ++run_index) {
+      if (_run_begins[run_index] != _run_begins[run_index + 1]) {
+        runs.emplace_back(_run_begins[run_index], _run_begins[run_index + 1]);
+      }
+    }
 
-        auto segment_ptr_and_accessor_by_chunk_id =
-            std::unordered_map<ChunkID, std::pair<std::shared_ptr<const BaseSegment>,
-                                                  std::shared_ptr<AbstractSegmentAccessor<ColumnDataType>>>>();
-        segment_ptr_and_accessor_by_chunk_id.reserve(row_count_out);
+    if (runs.size() <= 1) {
+      _sorted_rows = std::move(_run_rows);
+      return;
+    }
 
-        for (auto row_index = 0u; row_index < row_count_out; ++row_index) {
-          const auto [chunk_id, chunk_offset] = _row_id_value_vector->at(row_index).first;
+    _sorted_rows.resize(_row_count);
 
-          auto& segment_ptr_and_typed_ptr_pair = segment_ptr_and_accessor_by_chunk_id[chunk_id];
-          auto& base_segment = segment_ptr_and_typed_ptr_pair.first;
-          auto& accessor = segment_ptr_and_typed_ptr_pair.second;
+    const auto partition_count = std::max(size_t{1}, _row_count / MIN_ROWS_PER_MERGE_PARTITION);
+    const auto sample_count = std::min(_row_count, partition_count * SAMPLES_PER_MERGE_PARTITION);
 
-          if (!base_segment) {
-            base_segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
-            accessor = create_segment_accessor<ColumnDataType>(base_segment);
-          }
+    auto samples = std::vector<size_t>(sample_count);
+    for (auto sample_index = size_t{0}; sample_index < sample_count; ++sample_index) {
+      samples[sample_index] = _run_rows[sample_index * _row_count / sample_count];
+    }
+    std::sort(samples.begin(), samples.end(), [&](const size_t lhs, const size_t rhs) { return _less(lhs, rhs); });
 
-          // If the input segment is not a ReferenceSegment, we can take a fast(er) path
-          if (accessor) {
-            const auto typed_value = accessor->access(chunk_offset);
-            const auto is_null = !typed_value;
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : typed_value.value());
-            value_segment_null_vector.push_back(is_null);
-          } else {
-            const auto value = (*base_segment)[chunk_offset];
-            const auto is_null = variant_is_null(value);
-            value_segment_value_vector.push_back(is_null ? ColumnDataType{} : boost::get<ColumnDataType>(value));
-            value_segment_null_vector.push_back(is_null);
+    // A partition covers all rows that are not smaller than its lower splitter and smaller than its upper splitter.
+    // std::nullopt stands for the beginning or the end of the key domain.
+    auto splitters = std::vector<std::optional<size_t>>{std::nullopt};
+    for (auto partition_id = size_t{1}; partition_id < partition_count; ++partition_id) {
+      splitters.emplace_back(samples[partition_id * sample_count / partition_count]);
+    }
+    splitters.emplace_back(std::nullopt);
+
+    const auto partition_bound = [&](const std::pair<size_t, size_t>& run, const std::optional<size_t>& splitter,
+                                     const size_t default_bound) {
+      if (!splitter) return default_bound;
+      const auto iter = std::lower_bound(_run_rows.cbegin() + run.first, _run_rows.cbegin() + run.second, *splitter,
+                                         [&](const size_t lhs, const size_t rhs) { return _less(lhs, rhs); });
+      return static_cast<size_t>(std::distance(_run_rows.cbegin(), iter));
+    };
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(partition_count);
+    for (auto partition_id = size_t{0}; partition_id < partition_count; ++partition_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, partition_id]() {
+        // Cursors (current position, end position) into the runs, ordered as a min-heap by the current row
+        using Cursor = std::pair<size_t, size_t>;
+        const auto cursor_greater = [&](const Cursor& lhs, const Cursor& rhs) {
+          return _less(_run_rows[rhs.first], _run_rows[lhs.first]);
+        };
+        auto cursors = std::priority_queue<Cursor, std::vector<Cursor>, decltype(cursor_greater)>{cursor_greater};
+
+        // All rows of earlier partitions are written before this partition's rows
+        auto output_position = size_t{0};
+        for (const auto& run : runs) {
+          const auto partition_begin = partition_bound(run, splitters[partition_id], run.first);
+          const auto partition_end = partition_bound(run, splitters[partition_id + 1], run.second);
+          output_position += partition_begin - run.first;
+          if (partition_begin != partition_end) {
+            cursors.emplace(partition_begin, partition_end);
           }
+        }
 
-          ++chunk_offset_out;
-
-          // Check if value segment is full
-          if (chunk_offset_out >= _output_chunk_size) {
-            chunk_offset_out = 0u;
-            auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                                std::move(value_segment_null_vector));
-            chunk_it->push_back(value_segment);
-            value_segment_value_vector = pmr_vector<ColumnDataType>();
-            value_segment_null_vector = pmr_vector<bool>();
-            ++chunk_it;
+        while (!cursors.empty()) {
+          auto cursor = cursors.top();
+          cursors.pop();
+          _sorted_rows[output_position++] = _run_rows[cursor.first];
+          ++cursor.first;
+          if (cursor.first != cursor.second) {
+            cursors.emplace(cursor);
           }
         }
+      }));
+      jobs.back()->schedule();
+    }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
+  }
 
-        // Last segment has not been added
-        if (chunk_offset_out > 0u) {
-          auto value_segment = std::make_shared<ValueSegment<ColumnDataType>>(std::move(value_segment_value_vector),
-                                                                              std::move(value_segment_null_vector));
-          chunk_it->push_back(value_segment);
+  std::shared_ptr<Table> _materialize_output() {
+    // We have decided against duplicating MVCC data in https://github.com/hyrise/hyrise/issues/408
+    auto output = std::make_shared<Table>(_table_in->column_definitions(), TableType::Data, _output_chunk_size);
+
+    const auto output_chunk_count = (_row_count + _output_chunk_size - 1) / _output_chunk_size;
+    auto output_segments_by_chunk = std::vector<Segments>(output_chunk_count);
+
+    auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    jobs.reserve(output_chunk_count);
+    for (auto output_chunk_id = size_t{0}; output_chunk_id < output_chunk_count; ++output_chunk_id) {
+      jobs.emplace_back(std::make_shared<JobTask>([&, output_chunk_id]() {
+        const auto row_begin = output_chunk_id * _output_chunk_size;
+        const auto row_end = std::min(row_begin + _output_chunk_size, _row_count);
+        auto& output_segments = output_segments_by_chunk[output_chunk_id];
+
+        const auto column_count = _table_in->column_count();
+        for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+          resolve_data_type(_table_in->column_data_type(column_id), [&](auto type) {
+            using ColumnDataType = typename decltype(type)::type;
+
+            auto values = pmr_vector<ColumnDataType>(row_end - row_begin);
+            auto null_values = pmr_vector<bool>(row_end - row_begin);
+
+            // Accessors are not thread-safe, so each job creates its own accessor per input chunk
+            auto accessor_by_chunk_id =
+                std::vector<std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>>(_table_in->chunk_count());
+
+            for (auto row = row_begin; row < row_end; ++row) {
+              const auto [chunk_id, chunk_offset] = _row_ids[_sorted_rows[row]];
+
+              auto& accessor = accessor_by_chunk_id[chunk_id];
+              if (!accessor) {
+                const auto& segment = _table_in->get_chunk(chunk_id)->get_segment(column_id);
+                accessor = create_segment_accessor<ColumnDataType>(segment);
+              }
+
+              const auto typed_value = accessor->access(chunk_offset);
+              if (typed_value) {
+                values[row - row_begin] = std::move(*typed_value);
+              } else {
+                null_values[row - row_begin] = true;
+              }
+            }
+
+            output_segments.emplace_back(
+                std::make_shared<ValueSegment<ColumnDataType>>(std::move(values), std::move(null_values)));
+          });
         }
-      });
+      }));
+      jobs.back()->schedule();
     }
+    Hyrise::get().scheduler()->wait_for_tasks(jobs);
 
+    const auto& primary_sort_definition = _sort_definitions.front();
     for (auto& segments : output_segments_by_chunk) {
       output->append_chunk(segments);
+      output->last_chunk()->set_ordered_by(
+          std::make_pair(primary_sort_definition.column, primary_sort_definition.order_by_mode));
     }
 
     return output;
   }
 
- protected:
+  bool _less(const size_t lhs, const size_t rhs) const { return _keys.less(lhs, rhs); }
+
   const std::shared_ptr<const Table> _table_in;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
-  const std::shared_ptr<std::vector<std::pair<RowID, SortColumnType>>> _row_id_value_vector;
-};
 
-// we need to use the impl pattern because the scan operator of the sort depends on the type of the column
-template <typename SortColumnType>
-class Sort::SortImpl : public AbstractReadOnlyOperatorImpl {
- public:
-  using RowIDValuePair = std::pair<RowID, SortColumnType>;
-
-  SortImpl(const std::shared_ptr<const Table>& table_in, const ColumnID column_id,
-           const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = 0)
-      : _table_in(table_in),
-        _column_id(column_id),
-        _order_by_mode(order_by_mode),
-        _output_chunk_size(output_chunk_size) {
-    // initialize a structure which can be sorted by std::sort
-    _row_id_value_vector = std::make_shared<std::vector<RowIDValuePair>>();
-    _null_value_rows = std::make_shared<std::vector<RowIDValuePair>>();
-  }
+  size_t _row_count{0};
+  std::vector<size_t> _run_begins;
 
- protected:
-  std::shared_ptr<const Table> _on_execute() override {
-    // 1. Prepare Sort: Creating rowid-value-Structure
-    _materialize_sort_column();
-
-    // 2. After we got our ValueRowID Map we sort the map by the value of the pair
-    if (_order_by_mode == OrderByMode::Ascending || _order_by_mode == OrderByMode::AscendingNullsLast) {
-      _sort_with_operator<std::less<>>();
-    } else {
-      _sort_with_operator<std::greater<>>();
-    }
+  // The keys and RowIDs are indexed by the position of a row in the input table
+  NormalizedSortKeys _keys;
+  std::vector<RowID> _row_ids;
 
-    // 2b. Insert null rows if necessary
-    if (!_null_value_rows->empty()) {
-      if (_order_by_mode == OrderByMode::AscendingNullsLast || _order_by_mode == OrderByMode::DescendingNullsLast) {
-        // NULLs last
-        _row_id_value_vector->insert(_row_id_value_vector->end(), _null_value_rows->begin(), _null_value_rows->end());
-      } else {
-        // NULLs first (default behavior)
-        _row_id_value_vector->insert(_row_id_value_vector->begin(), _null_value_rows->begin(), _null_value_rows->end());
-      }
-    }
-
-    // 3. Materialization of the result: We take the sorted ValueRowID Vector, create chunks fill them until they are
-    // full and create the next one. Each chunk is filled row by row.
-    auto materialization = std::make_shared<SortImplMaterializeOutput<SortColumnType>>(_table_in, _row_id_value_vector,
-                                                                                       _output_chunk_size);
-    auto output = materialization->execute();
+  // Row numbers, sorted per run (i.e., per input chunk) and after merging the runs
+  std::vector<size_t> _run_rows;
+  std::vector<size_t> _sorted_rows;
+};
 
-    const auto chunk_count = output->chunk_count();
-    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
-      output->get_chunk(chunk_id)->set_ordered_by(std::make_pair(_column_id, _order_by_mode));
-    }
+}  // namespace
 
-    return output;
-  }
+namespace opossum {
 
-  // completely materializes the sort column to create a vector of RowID-Value pairs
-  void _materialize_sort_column() {
-    auto& row_id_value_vector = *_row_id_value_vector;
-    row_id_value_vector.reserve(_table_in->row_count());
+Sort::Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const size_t output_chunk_size)
+    : AbstractReadOnlyOperator(OperatorType::Sort, in),
+      _sort_definitions(sort_definitions),
+      _output_chunk_size(output_chunk_size) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
 
-    auto& null_value_rows = *_null_value_rows;
+const std::vector<SortColumnDefinition>& Sort::sort_definitions() const { return _sort_definitions; }
 
-    const auto chunk_count = _table_in->chunk_count();
-    for (ChunkID chunk_id{0}; chunk_id < chunk_count; ++chunk_id) {
-      const auto chunk = _table_in->get_chunk(chunk_id);
-      Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+const std::string& Sort::name() const {
+  static const auto name = std::string{"Sort"};
+  return name;
+}
 
-      auto base_segment = chunk->get_segment(_column_id);
+std::string Sort::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
 
-      segment_iterate<SortColumnType>(*base_segment, [&](const auto& position) {
-        if (position.is_null()) {
-          null_value_rows.emplace_back(RowID{chunk_id, position.chunk_offset()}, SortColumnType{});
-        } else {
-          row_id_value_vector.emplace_back(RowID{chunk_id, position.chunk_offset()}, position.value());
-        }
-      });
-    }
+  std::stringstream stream;
+  stream << name() << separator << "{";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    const auto& sort_definition = _sort_definitions[definition_idx];
+    stream << "Column #" << sort_definition.column << " " << sort_definition.order_by_mode;
+    if (definition_idx + 1 < _sort_definitions.size()) stream << ", ";
   }
+  stream << "}";
 
-  template <typename Comparator>
-  void _sort_with_operator() {
-    Comparator comparator;
-    std::stable_sort(_row_id_value_vector->begin(), _row_id_value_vector->end(),
-                     [comparator](RowIDValuePair a, RowIDValuePair b) { return comparator(a.second, b.second); });
-  }
+  return stream.str();
+}
 
-  const std::shared_ptr<const Table> _table_in;
+std::shared_ptr<AbstractOperator> Sort::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<Sort>(copied_input_left, _sort_definitions, _output_chunk_size);
+}
 
-  // column to sort by
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
-  // chunk size of the materialized output
-  const size_t _output_chunk_size;
+void Sort::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {}
 
-  std::shared_ptr<std::vector<RowIDValuePair>> _row_id_value_vector;
-  std::shared_ptr<std::vector<RowIDValuePair>> _null_value_rows;
-};
+std::shared_ptr<const Table> Sort::_on_execute() {
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column < input_table_left()->column_count(), "Sort column out of range");
+  }
+
+  return SortImpl{input_table_left(), _sort_definitions, _output_chunk_size}.execute();
+}
 
 }  // namespace opossum
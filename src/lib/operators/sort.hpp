@@ -1,54 +1,42 @@
 #pragma once
 
-#include <algorithm>
-#include <functional>
 #include <memory>
 #include <string>
-#include <utility>
 #include <vector>
 
 #include "abstract_read_only_operator.hpp"
-#include "resolve_type.hpp"
-#include "storage/create_iterable_from_segment.hpp"
 #include "types.hpp"
 
 namespace opossum {
 
 /**
- * Operator to sort a table by a single column. This implements a stable sort, i.e., rows that share the same value will
- * maintain their relative order.
- * Multi-column sort is not supported yet. For now, you will have to sort by the secondary criterion, then by the first
+ * Operator to sort a table by one or more columns. This implements a stable sort, i.e., rows that share the same values
+ * in all sort columns will maintain their relative order.
+ *
+ * All sort keys of a row are encoded into a single, fixed-width normalized key that can be compared using memcmp (see
+ * NormalizedSortKeys). Each input chunk is sorted as a separate run within its own JobTask. Afterwards, the runs
+ * are split into key ranges that are merged in parallel, and the output chunks are materialized in parallel as well.
  */
 class Sort : public AbstractReadOnlyOperator {
  public:
   // The parameter chunk_size sets the chunk size of the output table, which will always be materialized
-  Sort(const std::shared_ptr<const AbstractOperator>& in, const ColumnID column_id,
-       const OrderByMode order_by_mode = OrderByMode::Ascending, const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
+  Sort(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const size_t output_chunk_size = Chunk::DEFAULT_SIZE);
 
-  ColumnID column_id() const;
-  OrderByMode order_by_mode() const;
+  // The first definition is the primary sort key, the second one is used to order rows with equal primary keys, etc.
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
 
   const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
 
  protected:
   std::shared_ptr<const Table> _on_execute() override;
-  void _on_cleanup() override;
   std::shared_ptr<AbstractOperator> _on_deep_copy(
       const std::shared_ptr<AbstractOperator>& copied_input_left,
       const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
   void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
 
-  // The operator is separated in three different classes. SortImpl is the common templated implementation of the
-  // operator. SortImpl* und SortImplMaterializeOutput are extra classes for the visitor pattern. They fulfill a certain
-  // task during the Sort process, as described later on.
-  template <typename SortColumnType>
-  class SortImpl;
-  template <typename SortColumnType>
-  class SortImplMaterializeOutput;
-
-  std::unique_ptr<AbstractReadOnlyOperatorImpl> _impl;
-  const ColumnID _column_id;
-  const OrderByMode _order_by_mode;
+  const std::vector<SortColumnDefinition> _sort_definitions;
   const size_t _output_chunk_size;
 };
 
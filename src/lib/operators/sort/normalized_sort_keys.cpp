@@ -0,0 +1,87 @@
+#include "normalized_sort_keys.hpp"
+
+#include "resolve_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+void NormalizedSortKeys::add_column(const DataType data_type, const OrderByMode order_by_mode) {
+  resolve_data_type(data_type, [&](auto type) {
+    using ColumnDataType = typename decltype(type)::type;
+    if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+      _add_column(order_by_mode, STRING_PREFIX_LENGTH, true);
+    } else {
+      _add_column(order_by_mode, sizeof(ColumnDataType), false);
+    }
+  });
+}
+
+void NormalizedSortKeys::add_value_id_column(const OrderByMode order_by_mode) {
+  _add_column(order_by_mode, sizeof(ValueID::base_type), false);
+}
+
+void NormalizedSortKeys::resize(const size_t row_count) {
+  _row_count = row_count;
+  _keys.resize(row_count * _key_width);
+  for (auto& string_values : _string_values) {
+    string_values.resize(row_count);
+  }
+}
+
+size_t NormalizedSortKeys::row_count() const { return _row_count; }
+
+void NormalizedSortKeys::set_null(const size_t row, const size_t column_index) {
+  const auto& column = _columns[column_index];
+  auto* const null_byte = _key(row) + column.offset;
+
+  *null_byte = column.nulls_last ? 1 : 0;
+  std::fill(null_byte + 1, null_byte + 1 + column.value_width, uint8_t{0});
+}
+
+bool NormalizedSortKeys::less(const size_t lhs_row, const size_t rhs_row) const {
+  const auto* const lhs_key = _key(lhs_row);
+  const auto* const rhs_key = _key(rhs_row);
+
+  auto compared_bytes = size_t{0};
+  for (const auto& column : _columns) {
+    if (!column.string_values_index) continue;
+
+    // Compare everything up to and including the string prefix. If the prefixes are equal, the full strings decide.
+    const auto prefix_end = column.offset + 1 + column.value_width;
+    const auto result = std::memcmp(lhs_key + compared_bytes, rhs_key + compared_bytes, prefix_end - compared_bytes);
+    if (result != 0) return result < 0;
+    compared_bytes = prefix_end;
+
+    const auto& string_values = _string_values[*column.string_values_index];
+    const auto& lhs_string = string_values[lhs_row];
+    const auto& rhs_string = string_values[rhs_row];
+    if (lhs_string != rhs_string) {
+      return column.descending ? lhs_string > rhs_string : lhs_string < rhs_string;
+    }
+  }
+
+  const auto result = std::memcmp(lhs_key + compared_bytes, rhs_key + compared_bytes, _key_width - compared_bytes);
+  if (result != 0) return result < 0;
+
+  return lhs_row < rhs_row;
+}
+
+void NormalizedSortKeys::_add_column(const OrderByMode order_by_mode, const size_t value_width, const bool is_string) {
+  DebugAssert(_row_count == 0, "Columns have to be added before rows");
+
+  auto column = Column{};
+  column.descending = order_by_mode == OrderByMode::Descending || order_by_mode == OrderByMode::DescendingNullsLast;
+  column.nulls_last =
+      order_by_mode == OrderByMode::AscendingNullsLast || order_by_mode == OrderByMode::DescendingNullsLast;
+  column.offset = _key_width;
+  column.value_width = value_width;
+  if (is_string) {
+    column.string_values_index = _string_values.size();
+    _string_values.emplace_back();
+  }
+
+  _key_width += 1 + value_width;
+  _columns.emplace_back(column);
+}
+
+}  // namespace opossum
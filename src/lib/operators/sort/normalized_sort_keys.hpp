@@ -0,0 +1,131 @@
+#pragma once
+
+#include <algorithm>
+#include <cstring>
+#include <optional>
+#include <type_traits>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * NormalizedSortKeys stores the sort keys of a number of rows as fixed-width byte strings whose memcmp order matches
+ * the order defined by a list of sort columns. For each sort column, the key of a row consists of
+ *   - one byte that places NULLs before or after all other values (this byte is not inverted for descending orders),
+ *   - the value, encoded by encode_arithmetic_value() or as the zero-padded prefix of a string. For descending orders,
+ *     all bits of the value are inverted.
+ * Comparing two rows thus is a single memcmp unless string prefixes are equal. In that case, the full strings, which
+ * are kept separately, are compared before the remaining key bytes are looked at. Ties are broken by the row number,
+ * so that sorting rows that are numbered in their input order is stable.
+ *
+ * Instead of values, a sort column may also hold the ValueIDs of an order-preserving dictionary. Keys that use
+ * different dictionaries are not comparable.
+ *
+ * Different rows can be written concurrently, but the columns have to be added and resize() has to be called before.
+ */
+class NormalizedSortKeys {
+ public:
+  // Number of bytes of a string value that are stored in the key
+  static constexpr auto STRING_PREFIX_LENGTH = size_t{12};
+
+  void add_column(const DataType data_type, const OrderByMode order_by_mode);
+  void add_value_id_column(const OrderByMode order_by_mode);
+
+  void resize(const size_t row_count);
+  size_t row_count() const;
+
+  void set_null(const size_t row, const size_t column_index);
+
+  template <typename T>
+  void set_value(const size_t row, const size_t column_index, const T& value) {
+    const auto& column = _columns[column_index];
+    auto* const null_byte = _key(row) + column.offset;
+    auto* const value_begin = null_byte + 1;
+    auto* const value_end = value_begin + column.value_width;
+
+    *null_byte = column.nulls_last ? 0 : 1;
+
+    if constexpr (std::is_same_v<T, pmr_string>) {
+      const auto prefix_length = std::min(value.size(), column.value_width);
+      std::memcpy(value_begin, value.data(), prefix_length);
+      std::fill(value_begin + prefix_length, value_end, uint8_t{0});
+      _string_values[*column.string_values_index][row] = value;
+    } else if constexpr (std::is_same_v<T, ValueID>) {
+      encode_arithmetic_value(static_cast<ValueID::base_type>(value), value_begin);
+    } else {
+      encode_arithmetic_value(value, value_begin);
+    }
+
+    if (column.descending) {
+      std::transform(value_begin, value_end, value_begin, [](const uint8_t byte) { return ~byte; });
+    }
+  }
+
+  bool less(const size_t lhs_row, const size_t rhs_row) const;
+
+  // Encodes an arithmetic value so that the memcmp order of the encoded bytes matches the order of the values
+  template <typename T>
+  static void encode_arithmetic_value(const T value, uint8_t* destination) {
+    if constexpr (std::is_integral_v<T>) {
+      using UnsignedType = std::make_unsigned_t<T>;
+      auto bits = static_cast<UnsignedType>(value);
+      if constexpr (std::is_signed_v<T>) {
+        // Flipping the sign bit moves negative values below positive ones (two's complement)
+        bits ^= UnsignedType{1} << (sizeof(T) * 8 - 1);
+      }
+      _write_big_endian(bits, destination);
+    } else {
+      static_assert(std::is_floating_point_v<T>, "Unexpected type");
+      using UnsignedType = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+      constexpr auto SIGN_BIT = UnsignedType{1} << (sizeof(T) * 8 - 1);
+
+      // -0.0 and 0.0 compare as equal and thus have to be encoded identically
+      const auto normalized_value = value == T{0} ? T{0} : value;
+      auto bits = UnsignedType{};
+      std::memcpy(&bits, &normalized_value, sizeof(T));
+
+      // IEEE 754 values are stored as sign and magnitude. For negative values, flipping all bits orders larger
+      // magnitudes first. For positive values, setting the sign bit moves them above all negative values.
+      bits = (bits & SIGN_BIT) ? ~bits : (bits | SIGN_BIT);
+      _write_big_endian(bits, destination);
+    }
+  }
+
+ protected:
+  struct Column {
+    bool descending{false};
+    bool nulls_last{false};
+
+    // Offset of the NULL byte within the key. The value is stored in the following value_width bytes.
+    size_t offset{0};
+    size_t value_width{0};
+
+    // For string columns, the index of the full string values in _string_values
+    std::optional<size_t> string_values_index;
+  };
+
+  void _add_column(const OrderByMode order_by_mode, const size_t value_width, const bool is_string);
+
+  uint8_t* _key(const size_t row) { return &_keys[row * _key_width]; }
+  const uint8_t* _key(const size_t row) const { return &_keys[row * _key_width]; }
+
+  template <typename UnsignedType>
+  static void _write_big_endian(UnsignedType value, uint8_t* destination) {
+    for (auto byte_index = sizeof(UnsignedType); byte_index > 0; --byte_index) {
+      destination[byte_index - 1] = static_cast<uint8_t>(value & UnsignedType{0xFF});
+      value >>= 8;
+    }
+  }
+
+  std::vector<Column> _columns;
+  size_t _key_width{0};
+  size_t _row_count{0};
+
+  std::vector<uint8_t> _keys;
+  std::vector<std::vector<pmr_string>> _string_values;
+};
+
+}  // namespace opossum
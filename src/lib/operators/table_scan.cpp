@@ -22,10 +22,16 @@
 #include "hyrise.hpp"
 #include "lossless_cast.hpp"
 #include "operators/operator_scan_predicate.hpp"
+#include "resolve_type.hpp"
 #include "scheduler/abstract_task.hpp"
 #include "scheduler/job_task.hpp"
+#include "statistics/attribute_statistics.hpp"
+#include "statistics/statistics_objects/min_max_filter.hpp"
+#include "statistics/statistics_objects/range_filter.hpp"
 #include "storage/base_segment.hpp"
 #include "storage/chunk.hpp"
+#include "storage/compact_pos_list.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/reference_segment.hpp"
 #include "storage/table.hpp"
 #include "table_scan/column_between_table_scan_impl.hpp"
@@ -42,7 +48,8 @@ namespace opossum {
 
 TableScan::TableScan(const std::shared_ptr<const AbstractOperator>& in,
                      const std::shared_ptr<AbstractExpression>& predicate)
-    : AbstractReadOnlyOperator{OperatorType::TableScan, in}, _predicate(predicate) {}
+    : AbstractReadOnlyOperator{OperatorType::TableScan, in, nullptr, std::make_unique<TableScan::PerformanceData>()},
+      _predicate(predicate) {}
 
 const std::shared_ptr<AbstractExpression>& TableScan::predicate() const { return _predicate; }
 
@@ -93,12 +100,19 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
   auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
   jobs.reserve(in_table->chunk_count() - excluded_chunk_set.size());
 
+  auto& performance_data = static_cast<PerformanceData&>(*_performance_data);
+
   const auto chunk_count = in_table->chunk_count();
   for (ChunkID chunk_id{0u}; chunk_id < chunk_count; ++chunk_id) {
     if (excluded_chunk_set.count(chunk_id)) continue;
     const auto chunk_in = in_table->get_chunk(chunk_id);
     Assert(chunk_in, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+    if (_can_prune_chunk(*chunk_in)) {
+      ++performance_data.chunks_pruned;
+      continue;
+    }
+
     // chunk_in – Copy by value since copy by reference is not possible due to the limited scope of the for-iteration.
     auto job_task = std::make_shared<JobTask>([this, chunk_id, chunk_in, &in_table, &output_mutex, &output_chunks]() {
       // The actual scan happens in the sub classes of BaseTableScanImpl
@@ -119,6 +133,9 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
        */
       if (in_table->type() == TableType::References) {
         auto filtered_pos_lists = std::map<std::shared_ptr<const PosList>, std::shared_ptr<PosList>>{};
+        auto filtered_compact_pos_lists =
+            std::map<std::shared_ptr<const CompactPosList>,
+                     std::pair<std::shared_ptr<const CompactPosList>, std::shared_ptr<const PosList>>>{};
 
         for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
           auto segment_in = chunk_in->get_segment(column_id);
@@ -126,11 +143,42 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
           auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(segment_in);
           DebugAssert(ref_segment_in, "All segments should be of type ReferenceSegment.");
 
-          const auto pos_list_in = ref_segment_in->pos_list();
-
           const auto table_out = ref_segment_in->referenced_table();
           const auto column_id_out = ref_segment_in->referenced_column_id();
 
+          // CompactPosLists are filtered without materializing them. As they reference a single chunk in increasing
+          // order and the matches are in increasing order, the result can be compacted again.
+          if (const auto& compact_pos_list_in = ref_segment_in->compact_pos_list()) {
+            const auto [filtered_it, inserted] = filtered_compact_pos_lists.try_emplace(compact_pos_list_in);
+            auto& [filtered_compact_pos_list, filtered_pos_list] = filtered_it->second;
+
+            if (inserted) {
+              const auto referenced_chunk_id = compact_pos_list_in->chunk_id();
+              auto pos_list = std::make_shared<PosList>(matches_out->size());
+              pos_list->guarantee_single_chunk();
+
+              size_t offset = 0;
+              for (const auto& match : *matches_out) {
+                (*pos_list)[offset] = RowID{referenced_chunk_id, compact_pos_list_in->chunk_offset(match.chunk_offset)};
+                ++offset;
+              }
+
+              filtered_compact_pos_list =
+                  CompactPosList::try_compact(*pos_list, table_out->get_chunk(referenced_chunk_id)->size());
+              if (!filtered_compact_pos_list) filtered_pos_list = std::move(pos_list);
+            }
+
+            if (filtered_compact_pos_list) {
+              out_segments.push_back(
+                  std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_compact_pos_list));
+            } else {
+              out_segments.push_back(std::make_shared<ReferenceSegment>(table_out, column_id_out, filtered_pos_list));
+            }
+            continue;
+          }
+
+          const auto pos_list_in = ref_segment_in->pos_list();
+
           auto& filtered_pos_list = filtered_pos_lists[pos_list_in];
 
           if (!filtered_pos_list) {
@@ -152,9 +200,17 @@ std::shared_ptr<const Table> TableScan::_on_execute() {
         }
       } else {
         matches_out->guarantee_single_chunk();
+
+        // If the matches are a range of the chunk (e.g., the entire chunk) or dense enough for a bitmap, the output
+        // segments reference them through a CompactPosList, which later operators can iterate sequentially.
+        const auto compact_matches_out = CompactPosList::try_compact(*matches_out, chunk_in->size());
+
         for (ColumnID column_id{0u}; column_id < in_table->column_count(); ++column_id) {
-          auto ref_segment_out = std::make_shared<ReferenceSegment>(in_table, column_id, matches_out);
-          out_segments.push_back(ref_segment_out);
+          if (compact_matches_out) {
+            out_segments.push_back(std::make_shared<ReferenceSegment>(in_table, column_id, compact_matches_out));
+          } else {
+            out_segments.push_back(std::make_shared<ReferenceSegment>(in_table, column_id, matches_out));
+          }
         }
       }
 
@@ -336,6 +392,104 @@ std::unique_ptr<AbstractTableScanImpl> TableScan::create_impl() const {
   return std::make_unique<ExpressionEvaluatorTableScanImpl>(input_table_left(), resolved_predicate);
 }
 
+bool TableScan::_can_prune_chunk(const Chunk& chunk) const {
+  // Only predicates comparing a column to values can be checked against the chunk's statistics. The values have
+  // already been cast to the column's data type in create_impl().
+  auto column_id = INVALID_COLUMN_ID;
+  auto predicate_condition = PredicateCondition::Equals;
+  auto value = AllTypeVariant{};
+  auto value2 = std::optional<AllTypeVariant>{};
+
+  if (const auto column_vs_value_impl = dynamic_cast<const ColumnVsValueTableScanImpl*>(_impl.get())) {
+    column_id = column_vs_value_impl->column_id();
+    predicate_condition = column_vs_value_impl->predicate_condition;
+    value = column_vs_value_impl->value;
+  } else if (const auto between_impl = dynamic_cast<const ColumnBetweenTableScanImpl*>(_impl.get())) {
+    column_id = between_impl->column_id();
+    predicate_condition = between_impl->predicate_condition;
+    value = between_impl->left_value;
+    value2 = between_impl->right_value;
+  } else {
+    return false;
+  }
+
+  if (variant_is_null(value) || (value2 && variant_is_null(*value2))) return false;
+
+  // Find the stored chunk and column the statistics and the dictionary belong to
+  auto stored_chunk = std::shared_ptr<const Chunk>{};
+  auto stored_column_id = column_id;
+  auto segment = chunk.get_segment(column_id);
+  if (const auto reference_segment = std::dynamic_pointer_cast<const ReferenceSegment>(segment)) {
+    auto stored_chunk_id = INVALID_CHUNK_ID;
+    if (const auto& compact_pos_list = reference_segment->compact_pos_list()) {
+      stored_chunk_id = compact_pos_list->chunk_id();
+    } else {
+      const auto& pos_list = *reference_segment->pos_list();
+      if (!pos_list.references_single_chunk() || pos_list.empty() || pos_list[0].is_null()) return false;
+      stored_chunk_id = pos_list[0].chunk_id;
+    }
+
+    stored_chunk = reference_segment->referenced_table()->get_chunk(stored_chunk_id);
+    if (!stored_chunk) return false;
+
+    stored_column_id = reference_segment->referenced_column_id();
+    segment = stored_chunk->get_segment(stored_column_id);
+  }
+  const auto& pruning_statistics = stored_chunk ? stored_chunk->pruning_statistics() : chunk.pruning_statistics();
+
+  auto can_prune = false;
+  resolve_data_type(segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    if (data_type_from_all_type_variant(value) != segment->data_type() ||
+        (value2 && data_type_from_all_type_variant(*value2) != segment->data_type())) {
+      return;
+    }
+
+    if (pruning_statistics) {
+      const auto& segment_statistics =
+          static_cast<const AttributeStatistics<ColumnDataType>&>(*(*pruning_statistics)[stored_column_id]);
+
+      // Range filters are only available for arithmetic (non-string) types.
+      if constexpr (std::is_arithmetic_v<ColumnDataType>) {  // NOLINT
+        if (segment_statistics.range_filter &&
+            segment_statistics.range_filter->does_not_contain(predicate_condition, value, value2)) {
+          can_prune = true;
+          return;
+        }
+      }
+
+      if (segment_statistics.min_max_filter) {
+        can_prune = segment_statistics.min_max_filter->does_not_contain(predicate_condition, value, value2);
+        return;
+      }
+    }
+
+    // Without a min/max filter (e.g., for mutable chunks or tables that are not registered in the StorageManager), a
+    // dictionary-encoded segment still tells us its bounds, as the dictionary is sorted.
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<ColumnDataType>>(segment)) {
+      const auto& dictionary = *dictionary_segment->dictionary();
+      if (dictionary.empty()) {
+        // All values are NULL, so none of them matches the predicate
+        can_prune = true;
+        return;
+      }
+
+      const auto dictionary_bounds = MinMaxFilter<ColumnDataType>{dictionary.front(), dictionary.back()};
+      can_prune = dictionary_bounds.does_not_contain(predicate_condition, value, value2);
+    }
+  });
+
+  return can_prune;
+}
+
 void TableScan::_on_cleanup() { _impl.reset(); }
 
+void TableScan::PerformanceData::output_to_stream(std::ostream& stream, DescriptionMode description_mode) const {
+  OperatorPerformanceData::output_to_stream(stream, description_mode);
+
+  stream << (description_mode == DescriptionMode::SingleLine ? " / " : "\\n");
+  stream << std::to_string(chunks_pruned) << " chunks pruned at runtime";
+}
+
 }  // namespace opossum
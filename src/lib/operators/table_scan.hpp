@@ -8,12 +8,14 @@
 #include "abstract_read_only_operator.hpp"
 #include "all_parameter_variant.hpp"
 #include "expression/abstract_expression.hpp"
+#include "operator_performance_data.hpp"
 #include "table_scan/abstract_table_scan_impl.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
 
+class Chunk;
 class Table;
 
 class TableScan : public AbstractReadOnlyOperator {
@@ -48,6 +50,13 @@ class TableScan : public AbstractReadOnlyOperator {
    */
   std::vector<ChunkID> excluded_chunk_ids;
 
+  struct PerformanceData : public OperatorPerformanceData {
+    // Chunks that were skipped at runtime because their pruning statistics or dictionaries show that no row matches
+    size_t chunks_pruned{0};
+
+    void output_to_stream(std::ostream& stream, DescriptionMode description_mode) const override;
+  };
+
  protected:
   std::shared_ptr<const Table> _on_execute() override;
 
@@ -65,6 +74,15 @@ class TableScan : public AbstractReadOnlyOperator {
   static std::shared_ptr<AbstractExpression> _resolve_uncorrelated_subqueries(
       const std::shared_ptr<AbstractExpression>& predicate);
 
+  /**
+   * The ChunkPruningRule cannot prune chunks for predicates with placeholders or correlated parameters, as their
+   * values are only known at runtime. Once the parameters are bound and the _impl is created, we check the pruning
+   * statistics (min/max and range filters) and, for dictionary-encoded segments, the dictionary bounds of each chunk
+   * before spawning a job for it. For reference tables, this is possible if a chunk only references a single chunk,
+   * which is the case for the output of GetTable and Validate.
+   */
+  bool _can_prune_chunk(const Chunk& chunk) const;
+
  private:
   const std::shared_ptr<AbstractExpression> _predicate;
 
@@ -19,6 +19,8 @@ AbstractDereferencedColumnTableScanImpl::AbstractDereferencedColumnTableScanImpl
     const PredicateCondition init_predicate_condition)
     : predicate_condition(init_predicate_condition), _in_table(in_table), _column_id(column_id) {}
 
+ColumnID AbstractDereferencedColumnTableScanImpl::column_id() const { return _column_id; }
+
 std::shared_ptr<PosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(const ChunkID chunk_id) const {
   const auto chunk = _in_table->get_chunk(chunk_id);
   const auto& segment = chunk->get_segment(_column_id);
@@ -36,6 +38,22 @@ std::shared_ptr<PosList> AbstractDereferencedColumnTableScanImpl::scan_chunk(con
 
 void AbstractDereferencedColumnTableScanImpl::_scan_reference_segment(const ReferenceSegment& segment,
                                                                       const ChunkID chunk_id, PosList& matches) const {
+  if (const auto& compact_pos_list = segment.compact_pos_list()) {
+    const auto chunk = segment.referenced_table()->get_chunk(compact_pos_list->chunk_id());
+    auto referenced_segment = chunk->get_segment(segment.referenced_column_id());
+
+    // Fastest path - the ReferenceSegment references an entire chunk, so its positions are the chunk offsets and we
+    // can scan the referenced segment without a position filter
+    if (compact_pos_list->is_range() && compact_pos_list->begin_chunk_offset() == 0 &&
+        compact_pos_list->size() == referenced_segment->size()) {
+      _scan_non_reference_segment(*referenced_segment, chunk_id, matches, nullptr);
+      return;
+    }
+
+    _scan_non_reference_segment(*referenced_segment, chunk_id, matches, compact_pos_list->materialize());
+    return;
+  }
+
   const auto& pos_list = segment.pos_list();
 
   if (pos_list->references_single_chunk() && !pos_list->empty()) {
@@ -10,6 +10,7 @@
 #include "storage/resolve_encoded_segment_type.hpp"
 #include "storage/segment_iterables/create_iterable_from_attribute_vector.hpp"
 #include "storage/segment_iterate.hpp"
+#include "value_id_scan_kernel.hpp"
 
 #include "resolve_type.hpp"
 #include "type_comparison.hpp"
@@ -120,20 +121,34 @@ void ColumnVsValueTableScanImpl::_scan_dictionary_segment(const BaseDictionarySe
     return;
   }
 
+  // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
+  // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
+  // dictionary.size() anyway.
+  const auto check_for_null = predicate_condition != PredicateCondition::Equals &&
+                              predicate_condition != PredicateCondition::LessThanEquals &&
+                              predicate_condition != PredicateCondition::LessThan;
+
   _with_operator_for_dict_segment_scan([&](auto predicate_comparator) {
+    // Unfiltered scans evaluate the predicate directly on the data of the compressed attribute vector
+    if (!position_filter) {
+      if (check_for_null) {
+        ValueIDScanKernel::scan<true>(*segment.attribute_vector(), predicate_comparator, search_value_id,
+                                      segment.null_value_id(), chunk_id, matches);
+      } else {
+        ValueIDScanKernel::scan<false>(*segment.attribute_vector(), predicate_comparator, search_value_id,
+                                       segment.null_value_id(), chunk_id, matches);
+      }
+      return;
+    }
+
     auto comparator = [predicate_comparator, search_value_id](const auto& position) {
       return predicate_comparator(position.value(), search_value_id);
     };
     iterable.with_iterators(position_filter, [&](auto it, auto end) {
-      // dictionary.size() represents a NULL in the AttributeVector. For some PredicateConditions, we can
-      // avoid explicitly checking for it, since the condition (e.g., LessThan) would never return true for
-      // dictionary.size() anyway.
-      if (predicate_condition == PredicateCondition::Equals ||
-          predicate_condition == PredicateCondition::LessThanEquals ||
-          predicate_condition == PredicateCondition::LessThan) {
-        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
-      } else {
+      if (check_for_null) {
         _scan_with_iterators<true>(comparator, it, end, chunk_id, matches);
+      } else {
+        _scan_with_iterators<false>(comparator, it, end, chunk_id, matches);
       }
     });
   });
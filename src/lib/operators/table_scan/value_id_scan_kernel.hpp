@@ -0,0 +1,179 @@
+#pragma once
+
+#ifdef __AVX512VL__
+#include <x86intrin.h>
+#endif
+
+#include <algorithm>
+#include <array>
+#include <limits>
+#include <type_traits>
+
+#include "storage/pos_list.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_packing.hpp"
+#include "storage/vector_compression/simd_bp128/simd_bp128_vector.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * @brief Scans the attribute vector of a dictionary segment for a ValueID predicate (e.g., value_id < 17)
+ *
+ * Instead of walking the attribute vector through the generic iterators, the kernel works directly on the data of
+ * FixedSizeByteAlignedVectors and on blocks of 128 values decoded from SimdBp128Vectors. The ValueIDs are compared in
+ * the width of the compressed vector, so that the compiler can evaluate the predicate for 32 (uint8_t) down to 8
+ * (uint32_t) values per AVX2 instruction. The result of a block of BLOCK_SIZE values is a bitmask, which is then
+ * compacted into the PosList. On machines with AVX-512 VL, the compaction uses the compress instruction, otherwise, the
+ * set bits are visited one by one. Blocks without matches cost a single branch.
+ *
+ * Only unfiltered scans are supported, i.e., the attribute vector is scanned from the first to the last position.
+ */
+class ValueIDScanKernel {
+ public:
+  static constexpr auto BLOCK_SIZE = size_t{32};
+
+  /**
+   * @param comparator       a binary functor comparing a ValueID from the vector to the search ValueID
+   * @param search_value_id  must be representable in the width of the compressed vector, which is the case for all
+   *                         ValueIDs up to (and including) the null_value_id
+   */
+  template <bool CheckForNull, typename Comparator>
+  static void scan(const BaseCompressedVector& attribute_vector, const Comparator& comparator,
+                   const ValueID search_value_id, const ValueID null_value_id, const ChunkID chunk_id,
+                   PosList& matches) {
+    resolve_compressed_vector_type(attribute_vector, [&](const auto& vector) {
+      using VectorType = std::decay_t<decltype(vector)>;
+
+      if constexpr (std::is_same_v<VectorType, SimdBp128Vector>) {
+        _scan_simd_bp128_vector<CheckForNull>(vector, comparator, search_value_id, null_value_id, chunk_id, matches);
+      } else {
+        scan_values<CheckForNull>(vector.data(), vector.size(), ChunkOffset{0}, comparator, search_value_id,
+                                  null_value_id, chunk_id, matches);
+      }
+    });
+  }
+
+  // Scans `count` ValueIDs, the first of which is located at `first_chunk_offset`
+  template <bool CheckForNull, typename Comparator, typename UnsignedIntType>
+  static void scan_values(const UnsignedIntType* values, const size_t count, const ChunkOffset first_chunk_offset,
+                          const Comparator& comparator, const ValueID search_value_id, const ValueID null_value_id,
+                          const ChunkID chunk_id, PosList& matches) {
+    DebugAssert(static_cast<ValueID::base_type>(search_value_id) <= std::numeric_limits<UnsignedIntType>::max() &&
+                    static_cast<ValueID::base_type>(null_value_id) <= std::numeric_limits<UnsignedIntType>::max(),
+                "ValueIDs do not fit into the width of the compressed vector");
+    const auto typed_search_value_id = static_cast<UnsignedIntType>(search_value_id);
+    const auto typed_null_value_id = static_cast<UnsignedIntType>(null_value_id);
+
+    // As in AbstractTableScanImpl::_simd_scan_with_iterators, we do not emplace_back matches, but resize the PosList
+    // and write the chunk offsets of the matches into the next positions. The chunk ID is already set by the resize.
+    auto matches_out_index = matches.size();
+    matches.resize(matches.size() + BLOCK_SIZE, RowID{chunk_id, 0});
+
+    auto block_begin = size_t{0};
+    for (; block_begin + BLOCK_SIZE <= count; block_begin += BLOCK_SIZE) {
+      const auto* const block = values + block_begin;
+
+      // Fill `mask` with 1s at positions where the condition is fulfilled. We only use the compiler pragmas of OpenMP
+      // (-fopenmp-simd), not its runtime.
+      auto mask = uint32_t{0};
+
+      // NOLINTNEXTLINE
+      {}  // clang-format off
+      #pragma omp simd reduction(|:mask) safelen(BLOCK_SIZE)
+      // clang-format on
+      for (auto index = size_t{0}; index < BLOCK_SIZE; ++index) {
+        const auto value_id = block[index];
+        mask |= static_cast<uint32_t>((!CheckForNull | (value_id != typed_null_value_id)) &
+                                      comparator(value_id, typed_search_value_id))
+                << index;
+      }
+
+      if (!mask) continue;
+
+      const auto block_first_chunk_offset = static_cast<ChunkOffset>(first_chunk_offset + block_begin);
+#ifdef __AVX512VL__
+      // Compress the offsets of each group of eight values so that the offsets of the matches are moved to the front
+      // and write all eight of them. Offsets of non-matches behind the matches are overwritten by the next group.
+      for (auto group_begin = size_t{0}; group_begin < BLOCK_SIZE; group_begin += 8) {
+        const auto group_mask = static_cast<unsigned char>(mask >> group_begin);
+        const auto offsets = _mm256_add_epi32(
+            _mm256_set1_epi32(static_cast<int>(block_first_chunk_offset + group_begin)),
+            _mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7));
+        const auto compressed_offsets = _mm256_maskz_compress_epi32(group_mask, offsets);
+        const auto* const compressed_offsets_array = reinterpret_cast<const ChunkOffset*>(&compressed_offsets);
+
+        // NOLINTNEXTLINE
+        {}  // clang-format off
+        #pragma omp simd safelen(8)
+        // clang-format on
+        for (auto index = size_t{0}; index < 8; ++index) {
+          matches[matches_out_index + index].chunk_offset = compressed_offsets_array[index];
+        }
+        matches_out_index += __builtin_popcount(group_mask);
+      }
+#else
+      // Visit the set bits one by one, clearing the lowest set bit in each iteration
+      while (mask) {
+        matches[matches_out_index++].chunk_offset = block_first_chunk_offset + __builtin_ctz(mask);
+        mask &= mask - 1;
+      }
+#endif
+
+      // Grow the PosList more aggressively than its default behavior as the potentially wasted space is only
+      // ephemeral.
+      if (matches_out_index + BLOCK_SIZE >= matches.size()) {
+        matches.resize((BLOCK_SIZE + matches.size()) * 3, RowID{chunk_id, 0});
+      }
+    }
+
+    matches.resize(matches_out_index);
+
+    // Remainder that does not fill an entire block
+    for (auto index = block_begin; index < count; ++index) {
+      const auto value_id = values[index];
+      if ((!CheckForNull || value_id != typed_null_value_id) && comparator(value_id, typed_search_value_id)) {
+        matches.emplace_back(RowID{chunk_id, static_cast<ChunkOffset>(first_chunk_offset + index)});
+      }
+    }
+  }
+
+ private:
+  // Decodes the SimdBp128Vector block by block (see SimdBp128Decompressor for the layout) and scans each block.
+  template <bool CheckForNull, typename Comparator>
+  static void _scan_simd_bp128_vector(const SimdBp128Vector& vector, const Comparator& comparator,
+                                      const ValueID search_value_id, const ValueID null_value_id,
+                                      const ChunkID chunk_id, PosList& matches) {
+    using Packing = SimdBp128Packing;
+    static_assert(Packing::block_size % BLOCK_SIZE == 0, "Decoded blocks should consist of entire kernel blocks");
+
+    const auto* const data = vector.data();
+    const auto size = vector.size();
+
+    alignas(16) auto meta_info = std::array<uint8_t, Packing::blocks_in_meta_block>{};
+    alignas(16) auto decoded_block = std::array<uint32_t, Packing::block_size>{};
+
+    auto data_offset = size_t{0};
+    for (auto meta_block_begin = size_t{0}; meta_block_begin < size; meta_block_begin += Packing::meta_block_size) {
+      Packing::read_meta_info(data + data_offset, meta_info.data());
+      ++data_offset;
+
+      for (auto block_index = size_t{0}; block_index < Packing::blocks_in_meta_block; ++block_index) {
+        const auto block_begin = meta_block_begin + block_index * Packing::block_size;
+        if (block_begin >= size) break;
+
+        const auto bit_size = meta_info[block_index];
+        Packing::unpack_block(data + data_offset, decoded_block.data(), bit_size);
+        data_offset += bit_size;
+
+        const auto count = std::min(size_t{Packing::block_size}, size - block_begin);
+        scan_values<CheckForNull>(decoded_block.data(), count, static_cast<ChunkOffset>(block_begin), comparator,
+                                  search_value_id, null_value_id, chunk_id, matches);
+      }
+    }
+  }
+};
+
+}  // namespace opossum
@@ -0,0 +1,280 @@
+#include "top_k.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <numeric>
+#include <sstream>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "expression/expression_utils.hpp"
+#include "hyrise.hpp"
+#include "limit.hpp"
+#include "operators/sort/normalized_sort_keys.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/abstract_task.hpp"
+#include "scheduler/job_task.hpp"
+#include "storage/base_dictionary_segment.hpp"
+#include "storage/reference_segment.hpp"
+#include "storage/segment_accessor.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/vector_compression/resolve_compressed_vector_type.hpp"
+
+namespace opossum {
+
+TopK::TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+           const std::shared_ptr<AbstractExpression>& row_count_expression)
+    : AbstractReadOnlyOperator(OperatorType::TopK, in),
+      _sort_definitions(sort_definitions),
+      _row_count_expression(row_count_expression) {
+  Assert(!_sort_definitions.empty(), "Expected at least one sort criterion");
+}
+
+const std::vector<SortColumnDefinition>& TopK::sort_definitions() const { return _sort_definitions; }
+
+std::shared_ptr<AbstractExpression> TopK::row_count_expression() const { return _row_count_expression; }
+
+const std::string& TopK::name() const {
+  static const auto name = std::string{"TopK"};
+  return name;
+}
+
+std::string TopK::description(DescriptionMode description_mode) const {
+  const auto separator = description_mode == DescriptionMode::MultiLine ? "\n" : " ";
+
+  std::stringstream stream;
+  stream << name() << separator << _row_count_expression->as_column_name() << separator << "{";
+  for (auto definition_idx = size_t{0}; definition_idx < _sort_definitions.size(); ++definition_idx) {
+    const auto& sort_definition = _sort_definitions[definition_idx];
+    stream << "Column #" << sort_definition.column << " " << sort_definition.order_by_mode;
+    if (definition_idx + 1 < _sort_definitions.size()) stream << ", ";
+  }
+  stream << "}";
+
+  return stream.str();
+}
+
+std::shared_ptr<AbstractOperator> TopK::_on_deep_copy(
+    const std::shared_ptr<AbstractOperator>& copied_input_left,
+    const std::shared_ptr<AbstractOperator>& copied_input_right) const {
+  return std::make_shared<TopK>(copied_input_left, _sort_definitions, _row_count_expression->deep_copy());
+}
+
+void TopK::_on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) {
+  expression_set_parameters(_row_count_expression, parameters);
+}
+
+void TopK::_on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) {
+  expression_set_transaction_context(_row_count_expression, transaction_context);
+}
+
+std::shared_ptr<const Table> TopK::_on_execute() {
+  const auto input_table = input_table_left();
+  for (const auto& sort_definition : _sort_definitions) {
+    Assert(sort_definition.column < input_table->column_count(), "Sort column out of range");
+  }
+
+  const auto row_count = evaluate_limit_row_count(*_row_count_expression);
+  if (row_count == 0) {
+    return _write_output({});
+  }
+
+  // 1. Determine the candidates of each chunk
+  const auto chunk_count = input_table->chunk_count();
+  auto candidates_per_chunk = std::vector<std::vector<ChunkOffset>>(chunk_count);
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = input_table->get_chunk(chunk_id);
+    Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
+
+    jobs.emplace_back(std::make_shared<JobTask>([&, chunk, chunk_id]() {
+      candidates_per_chunk[chunk_id] = _top_k_of_chunk(*chunk, row_count);
+    }));
+    jobs.back()->schedule();
+  }
+  Hyrise::get().scheduler()->wait_for_tasks(jobs);
+
+  // 2. Merge the candidates. They are collected in the order of the input so that the order of equal rows is kept.
+  auto candidates = std::vector<RowID>{};
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    for (const auto chunk_offset : candidates_per_chunk[chunk_id]) {
+      candidates.emplace_back(RowID{chunk_id, chunk_offset});
+    }
+  }
+
+  return _write_output(_top_k_of_candidates(candidates, row_count));
+}
+
+std::vector<ChunkOffset> TopK::_top_k_of_chunk(const Chunk& chunk, const size_t row_count) const {
+  const auto chunk_size = chunk.size();
+  if (chunk_size <= row_count) {
+    auto chunk_offsets = std::vector<ChunkOffset>(chunk_size);
+    std::iota(chunk_offsets.begin(), chunk_offsets.end(), ChunkOffset{0});
+    return chunk_offsets;
+  }
+
+  // Dictionaries are sorted, so comparing the ValueIDs of two rows of the same chunk is equivalent to comparing their
+  // values
+  auto keys = NormalizedSortKeys{};
+  for (const auto& sort_definition : _sort_definitions) {
+    const auto segment = chunk.get_segment(sort_definition.column);
+    if (std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+      keys.add_value_id_column(sort_definition.order_by_mode);
+    } else {
+      keys.add_column(segment->data_type(), sort_definition.order_by_mode);
+    }
+  }
+  keys.resize(chunk_size);
+
+  for (auto column_index = size_t{0}; column_index < _sort_definitions.size(); ++column_index) {
+    const auto segment = chunk.get_segment(_sort_definitions[column_index].column);
+
+    if (const auto dictionary_segment = std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+      const auto null_value_id = dictionary_segment->null_value_id();
+      resolve_compressed_vector_type(*dictionary_segment->attribute_vector(), [&](const auto& attribute_vector) {
+        auto chunk_offset = ChunkOffset{0};
+        for (auto iter = attribute_vector.cbegin(); iter != attribute_vector.cend(); ++iter, ++chunk_offset) {
+          const auto value_id = static_cast<ValueID>(*iter);
+          if (value_id == null_value_id) {
+            keys.set_null(chunk_offset, column_index);
+          } else {
+            keys.set_value(chunk_offset, column_index, value_id);
+          }
+        }
+      });
+      continue;
+    }
+
+    resolve_data_type(segment->data_type(), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+      segment_iterate<ColumnDataType>(*segment, [&](const auto& position) {
+        if (position.is_null()) {
+          keys.set_null(position.chunk_offset(), column_index);
+        } else {
+          keys.set_value(position.chunk_offset(), column_index, position.value());
+        }
+      });
+    });
+  }
+
+  // The heap's top is the largest of the row_count smallest rows seen so far
+  const auto less = [&](const ChunkOffset lhs, const ChunkOffset rhs) { return keys.less(lhs, rhs); };
+  auto heap = std::vector<ChunkOffset>{};
+  heap.reserve(row_count);
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+    if (heap.size() < row_count) {
+      heap.emplace_back(chunk_offset);
+      std::push_heap(heap.begin(), heap.end(), less);
+    } else if (less(chunk_offset, heap.front())) {
+      std::pop_heap(heap.begin(), heap.end(), less);
+      heap.back() = chunk_offset;
+      std::push_heap(heap.begin(), heap.end(), less);
+    }
+  }
+
+  std::sort(heap.begin(), heap.end());
+  return heap;
+}
+
+std::vector<RowID> TopK::_top_k_of_candidates(const std::vector<RowID>& candidates, const size_t row_count) const {
+  const auto input_table = input_table_left();
+
+  // ValueIDs of different chunks are not comparable, so the candidates are compared by their values
+  auto keys = NormalizedSortKeys{};
+  for (const auto& sort_definition : _sort_definitions) {
+    keys.add_column(input_table->column_data_type(sort_definition.column), sort_definition.order_by_mode);
+  }
+  keys.resize(candidates.size());
+
+  for (auto column_index = size_t{0}; column_index < _sort_definitions.size(); ++column_index) {
+    const auto column_id = _sort_definitions[column_index].column;
+
+    resolve_data_type(input_table->column_data_type(column_id), [&](auto type) {
+      using ColumnDataType = typename decltype(type)::type;
+
+      // Candidates are ordered by their RowIDs, so we need one accessor at a time
+      auto accessor = std::unique_ptr<AbstractSegmentAccessor<ColumnDataType>>{};
+      auto accessor_chunk_id = INVALID_CHUNK_ID;
+
+      for (auto candidate_idx = size_t{0}; candidate_idx < candidates.size(); ++candidate_idx) {
+        const auto& [chunk_id, chunk_offset] = candidates[candidate_idx];
+        if (chunk_id != accessor_chunk_id) {
+          accessor = create_segment_accessor<ColumnDataType>(input_table->get_chunk(chunk_id)->get_segment(column_id));
+          accessor_chunk_id = chunk_id;
+        }
+
+        const auto value = accessor->access(chunk_offset);
+        if (value) {
+          keys.set_value(candidate_idx, column_index, *value);
+        } else {
+          keys.set_null(candidate_idx, column_index);
+        }
+      }
+    });
+  }
+
+  auto candidate_indices = std::vector<size_t>(candidates.size());
+  std::iota(candidate_indices.begin(), candidate_indices.end(), size_t{0});
+
+  const auto output_row_count = std::min(row_count, candidates.size());
+  std::partial_sort(candidate_indices.begin(), candidate_indices.begin() + output_row_count, candidate_indices.end(),
+                    [&](const size_t lhs, const size_t rhs) { return keys.less(lhs, rhs); });
+
+  auto row_ids = std::vector<RowID>(output_row_count);
+  for (auto output_idx = size_t{0}; output_idx < output_row_count; ++output_idx) {
+    row_ids[output_idx] = candidates[candidate_indices[output_idx]];
+  }
+  return row_ids;
+}
+
+std::shared_ptr<const Table> TopK::_write_output(const std::vector<RowID>& row_ids) const {
+  const auto input_table = input_table_left();
+  const auto column_count = input_table->column_count();
+
+  auto output_chunks = std::vector<std::shared_ptr<Chunk>>{};
+  for (auto output_begin = size_t{0}; output_begin < row_ids.size(); output_begin += Chunk::DEFAULT_SIZE) {
+    const auto output_end = std::min(output_begin + Chunk::DEFAULT_SIZE, row_ids.size());
+
+    auto output_segments = Segments{};
+    output_segments.reserve(column_count);
+
+    if (input_table->type() == TableType::Data) {
+      // All output segments share one PosList into the input table
+      const auto pos_list = std::make_shared<PosList>(row_ids.begin() + output_begin, row_ids.begin() + output_end);
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        output_segments.emplace_back(std::make_shared<ReferenceSegment>(input_table, column_id, pos_list));
+      }
+    } else {
+      // Forward the RowIDs that the input's ReferenceSegments point to
+      for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+        auto pos_list = std::make_shared<PosList>(output_end - output_begin);
+        auto referenced_segment = std::shared_ptr<const ReferenceSegment>{};
+
+        for (auto output_idx = output_begin; output_idx < output_end; ++output_idx) {
+          const auto& [chunk_id, chunk_offset] = row_ids[output_idx];
+          const auto input_segment = std::static_pointer_cast<const ReferenceSegment>(
+              input_table->get_chunk(chunk_id)->get_segment(column_id));
+          DebugAssert(!referenced_segment || (referenced_segment->referenced_table() ==
+                                                  input_segment->referenced_table() &&
+                                              referenced_segment->referenced_column_id() ==
+                                                  input_segment->referenced_column_id()),
+                      "Expected all ReferenceSegments of a column to reference the same column");
+          referenced_segment = input_segment;
+          (*pos_list)[output_idx - output_begin] = (*input_segment->pos_list())[chunk_offset];
+        }
+
+        output_segments.emplace_back(std::make_shared<ReferenceSegment>(
+            referenced_segment->referenced_table(), referenced_segment->referenced_column_id(), pos_list));
+      }
+    }
+
+    output_chunks.emplace_back(std::make_shared<Chunk>(std::move(output_segments)));
+  }
+
+  return std::make_shared<Table>(input_table->column_definitions(), TableType::References, std::move(output_chunks));
+}
+
+}  // namespace opossum
@@ -0,0 +1,61 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "abstract_read_only_operator.hpp"
+#include "expression/abstract_expression.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+/**
+ * Operator that returns the first n rows of its input when ordered by one or more columns. It produces the same result
+ * as a Sort followed by a Limit (including the stable order of rows with equal keys), but does not sort the entire
+ * input. Instead, each input chunk is processed by a JobTask that keeps the n smallest rows of that chunk in a bounded
+ * heap. Sort columns that are dictionary-encoded are compared by their ValueIDs within the chunk. Afterwards, the
+ * candidates of all chunks are merged by their values.
+ *
+ * The output references the rows of the input table (or, for reference tables, the rows they point to).
+ */
+class TopK : public AbstractReadOnlyOperator {
+ public:
+  // For larger row counts, the per-chunk heaps and the merge of their candidates become more expensive than sorting
+  // the entire input. The LQPTranslator only replaces Sort + Limit with a TopK up to this row count.
+  static constexpr auto MAX_ROW_COUNT = size_t{10'000};
+
+  TopK(const std::shared_ptr<const AbstractOperator>& in, const std::vector<SortColumnDefinition>& sort_definitions,
+       const std::shared_ptr<AbstractExpression>& row_count_expression);
+
+  const std::vector<SortColumnDefinition>& sort_definitions() const;
+  std::shared_ptr<AbstractExpression> row_count_expression() const;
+
+  const std::string& name() const override;
+  std::string description(DescriptionMode description_mode) const override;
+
+ protected:
+  std::shared_ptr<const Table> _on_execute() override;
+  std::shared_ptr<AbstractOperator> _on_deep_copy(
+      const std::shared_ptr<AbstractOperator>& copied_input_left,
+      const std::shared_ptr<AbstractOperator>& copied_input_right) const override;
+  void _on_set_parameters(const std::unordered_map<ParameterID, AllTypeVariant>& parameters) override;
+
+  void _on_set_transaction_context(const std::weak_ptr<TransactionContext>& transaction_context) override;
+
+  // Returns the offsets of the (at most) row_count smallest rows of the chunk, in ascending order of their offsets
+  std::vector<ChunkOffset> _top_k_of_chunk(const Chunk& chunk, const size_t row_count) const;
+
+  // Orders the candidate rows by their values and returns the (at most) row_count smallest ones, in output order
+  std::vector<RowID> _top_k_of_candidates(const std::vector<RowID>& candidates, const size_t row_count) const;
+
+  // Creates a reference table that contains the given rows of the input table
+  std::shared_ptr<const Table> _write_output(const std::vector<RowID>& row_ids) const;
+
+ private:
+  const std::vector<SortColumnDefinition> _sort_definitions;
+  std::shared_ptr<AbstractExpression> _row_count_expression;
+};
+
+}  // namespace opossum
@@ -9,6 +9,7 @@
 #include "hyrise.hpp"
 #include "operators/delete.hpp"
 #include "scheduler/job_task.hpp"
+#include "storage/compact_pos_list.hpp"
 #include "storage/reference_segment.hpp"
 #include "utils/assert.hpp"
 
@@ -150,6 +151,7 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
 
     Segments output_segments;
     auto pos_list_out = std::make_shared<const PosList>();
+    auto compact_pos_list_out = std::shared_ptr<const CompactPosList>{};
     PosList temp_pos_list;
     auto referenced_table = std::shared_ptr<const Table>();
     const auto ref_segment_in = std::dynamic_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(ColumnID{0}));
@@ -163,36 +165,59 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
       referenced_table = ref_segment_in->referenced_table();
       DebugAssert(referenced_table->uses_mvcc(), "Trying to use Validate on a table that has no MVCC data");
 
-      const auto& pos_list_in = ref_segment_in->pos_list();
-      if (pos_list_in->references_single_chunk() && !pos_list_in->empty()) {
-        // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only once.
-        const auto referenced_chunk = referenced_table->get_chunk(pos_list_in->common_chunk_id());
-        auto mvcc_data = referenced_chunk->mvcc_data();
+      if (const auto& compact_pos_list_in = ref_segment_in->compact_pos_list()) {
+        // Fastest path - a CompactPosList references a single chunk and is validated without materializing it.
+        const auto referenced_chunk_id = compact_pos_list_in->chunk_id();
+        const auto referenced_chunk = referenced_table->get_chunk(referenced_chunk_id);
 
         if (_can_use_chunk_shortcut && _is_entire_chunk_visible(referenced_chunk, snapshot_commit_id)) {
-          // We can reuse the old PosList since it is entirely visible.
-          pos_list_out = pos_list_in;
+          compact_pos_list_out = compact_pos_list_in;
         } else {
+          const auto mvcc_data = referenced_chunk->mvcc_data();
           temp_pos_list.guarantee_single_chunk();
+          compact_pos_list_in->for_each([&](const auto chunk_offset) {
+            if (opossum::is_row_visible(our_tid, snapshot_commit_id, chunk_offset, *mvcc_data)) {
+              temp_pos_list.emplace_back(RowID{referenced_chunk_id, chunk_offset});
+            }
+          });
+
+          compact_pos_list_out = CompactPosList::try_compact(temp_pos_list, referenced_chunk->size());
+          if (!compact_pos_list_out) pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
+        }
+      } else {
+        const auto& pos_list_in = ref_segment_in->pos_list();
+        if (pos_list_in->references_single_chunk() && !pos_list_in->empty()) {
+          // Fast path - we are looking at a single referenced chunk and thus need to get the MVCC data vector only
+          // once.
+          const auto referenced_chunk = referenced_table->get_chunk(pos_list_in->common_chunk_id());
+          auto mvcc_data = referenced_chunk->mvcc_data();
+
+          if (_can_use_chunk_shortcut && _is_entire_chunk_visible(referenced_chunk, snapshot_commit_id)) {
+            // We can reuse the old PosList since it is entirely visible.
+            pos_list_out = pos_list_in;
+          } else {
+            temp_pos_list.guarantee_single_chunk();
+            for (auto row_id : *pos_list_in) {
+              if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
+                temp_pos_list.emplace_back(row_id);
+              }
+            }
+            pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
+          }
+
+        } else {
+          // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every
+          // row.
           for (auto row_id : *pos_list_in) {
+            const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
+
+            auto mvcc_data = referenced_chunk->mvcc_data();
             if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
               temp_pos_list.emplace_back(row_id);
             }
           }
           pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
         }
-
-      } else {
-        // Slow path - we are looking at multiple referenced chunks and need to get the MVCC data vector for every row.
-        for (auto row_id : *pos_list_in) {
-          const auto referenced_chunk = referenced_table->get_chunk(row_id.chunk_id);
-
-          auto mvcc_data = referenced_chunk->mvcc_data();
-          if (opossum::is_row_visible(our_tid, snapshot_commit_id, row_id.chunk_offset, *mvcc_data)) {
-            temp_pos_list.emplace_back(row_id);
-          }
-        }
-        pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
       }
 
       // Construct the actual ReferenceSegment objects and add them to the chunk.
@@ -200,8 +225,13 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
         const auto reference_segment =
             std::static_pointer_cast<const ReferenceSegment>(chunk_in->get_segment(column_id));
         const auto referenced_column_id = reference_segment->referenced_column_id();
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+        if (compact_pos_list_out) {
+          output_segments.push_back(
+              std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, compact_pos_list_out));
+        } else {
+          output_segments.push_back(
+              std::make_shared<ReferenceSegment>(referenced_table, referenced_column_id, pos_list_out));
+        }
       }
 
       // Otherwise we have a non-reference Segment and simply iterate over all rows to build a poslist.
@@ -211,33 +241,37 @@ void Validate::_validate_chunks(const std::shared_ptr<const Table>& in_table, co
       DebugAssert(chunk_in->has_mvcc_data(), "Trying to use Validate on a table that has no MVCC data");
 
       const auto mvcc_data = chunk_in->mvcc_data();
-      temp_pos_list.guarantee_single_chunk();
+      const auto chunk_size = chunk_in->size();
 
       if (_can_use_chunk_shortcut && _is_entire_chunk_visible(chunk_in, snapshot_commit_id)) {
-        const auto chunk_size = chunk_in->size();
-        temp_pos_list.resize(chunk_size);
-        for (auto chunk_offset = 0u; chunk_offset < chunk_size; ++chunk_offset) {
-          temp_pos_list[chunk_offset] = RowID{chunk_id, chunk_offset};
-        }
+        // The entire chunk is referenced by a range instead of a materialized PosList
+        compact_pos_list_out = std::make_shared<const CompactPosList>(chunk_id, ChunkOffset{0}, chunk_size);
       } else {
         // Generate pos_list_out.
-        auto chunk_size = chunk_in->size();  // The compiler fails to optimize this in the for clause :(
+        temp_pos_list.guarantee_single_chunk();
         for (auto i = 0u; i < chunk_size; i++) {
           if (opossum::is_row_visible(our_tid, snapshot_commit_id, i, *mvcc_data)) {
             temp_pos_list.emplace_back(RowID{chunk_id, i});
           }
         }
+
+        compact_pos_list_out = CompactPosList::try_compact(temp_pos_list, chunk_size);
+        if (!compact_pos_list_out) pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
       }
-      pos_list_out = std::make_shared<const PosList>(std::move(temp_pos_list));
 
       // Create actual ReferenceSegment objects.
       for (ColumnID column_id{0}; column_id < chunk_in->column_count(); ++column_id) {
-        auto ref_segment_out = std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out);
-        output_segments.push_back(ref_segment_out);
+        if (compact_pos_list_out) {
+          output_segments.push_back(
+              std::make_shared<ReferenceSegment>(referenced_table, column_id, compact_pos_list_out));
+        } else {
+          output_segments.push_back(std::make_shared<ReferenceSegment>(referenced_table, column_id, pos_list_out));
+        }
       }
     }
 
-    if (!pos_list_out->empty() > 0) {
+    const auto output_row_count = compact_pos_list_out ? compact_pos_list_out->size() : pos_list_out->size();
+    if (output_row_count > 0) {
       std::lock_guard<std::mutex> lock(output_mutex);
       output_chunks.emplace_back(std::make_shared<Chunk>(output_segments));
     }
@@ -3,18 +3,26 @@
 #include <algorithm>
 #include <iostream>
 #include <memory>
+#include <optional>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include "all_parameter_variant.hpp"
 #include "constant_mappings.hpp"
 #include "cost_estimation/abstract_cost_estimator.hpp"
+#include "expression/binary_predicate_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/logical_expression.hpp"
+#include "expression/lqp_column_expression.hpp"
+#include "hyrise.hpp"
 #include "logical_query_plan/abstract_lqp_node.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
 #include "logical_query_plan/predicate_node.hpp"
 #include "logical_query_plan/stored_table_node.hpp"
 #include "operators/operator_scan_predicate.hpp"
 #include "statistics/cardinality_estimator.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "utils/assert.hpp"
 
 namespace opossum {
@@ -28,12 +36,40 @@ constexpr float INDEX_SCAN_SELECTIVITY_THRESHOLD = 0.01f;
 // The number is taken from: Fast Lookups for In-Memory Column Stores: Group-Key Indices, Lookup and Maintenance.
 constexpr float INDEX_SCAN_ROW_COUNT_THRESHOLD = 1000.0f;
 
+namespace {
+
+// If `predicate` is `<column> = <value or correlated parameter>` (in any order) on a column of the StoredTableNode,
+// returns the ColumnID of the column in the stored table and the predicate in this order
+std::optional<std::pair<ColumnID, std::shared_ptr<AbstractExpression>>> primary_key_predicate(
+    const std::shared_ptr<AbstractExpression>& predicate, const StoredTableNode& stored_table_node) {
+  const auto binary_predicate = std::dynamic_pointer_cast<BinaryPredicateExpression>(predicate);
+  if (!binary_predicate || binary_predicate->predicate_condition != PredicateCondition::Equals) return std::nullopt;
+
+  for (const auto& [column, value] : {std::pair{binary_predicate->left_operand(), binary_predicate->right_operand()},
+                                      std::pair{binary_predicate->right_operand(), binary_predicate->left_operand()}}) {
+    const auto column_expression = std::dynamic_pointer_cast<LQPColumnExpression>(column);
+    if (!column_expression || column_expression->column_reference.original_node().get() != &stored_table_node) {
+      continue;
+    }
+    if (value->type != ExpressionType::Value && value->type != ExpressionType::CorrelatedParameter) continue;
+
+    return std::pair{column_expression->column_reference.original_column_id(),
+                     std::make_shared<BinaryPredicateExpression>(PredicateCondition::Equals, column, value)};
+  }
+
+  return std::nullopt;
+}
+
+}  // namespace
+
 void IndexScanRule::apply_to(const std::shared_ptr<AbstractLQPNode>& root) const {
   DebugAssert(cost_estimator, "IndexScanRule requires cost estimator to be set");
   Assert(root->type == LQPNodeType::Root, "ExpressionReductionRule needs root to hold onto");
 
   visit_lqp(root, [&](const auto& node) {
     if (node->type == LQPNodeType::Predicate) {
+      if (_apply_primary_key_index_scan(node)) return LQPVisitation::DoNotVisitInputs;
+
       const auto& child = node->left_input();
 
       if (child->type == LQPNodeType::StoredTable) {
@@ -57,7 +93,10 @@ bool IndexScanRule::_is_index_scan_applicable(const IndexStatistics& index_stati
                                               const std::shared_ptr<PredicateNode>& predicate_node) const {
   if (!_is_single_segment_index(index_statistics)) return false;
 
-  if (index_statistics.type != SegmentIndexType::GroupKey) return false;
+  if (index_statistics.type != SegmentIndexType::GroupKey &&
+      index_statistics.type != SegmentIndexType::AdaptiveRadixTree) {
+    return false;
+  }
 
   const auto operator_predicates =
       OperatorScanPredicate::from_expression(*predicate_node->predicate(), *predicate_node);
@@ -85,4 +124,65 @@ bool IndexScanRule::_is_single_segment_index(const IndexStatistics& index_statis
   return index_statistics.column_ids.size() == 1;
 }
 
+bool IndexScanRule::_apply_primary_key_index_scan(const std::shared_ptr<AbstractLQPNode>& node) {
+  // Collect the chain of PredicateNodes down to the StoredTableNode. As predicates are moved within the chain, only its
+  // topmost node may be used by multiple outputs.
+  auto predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto chain_node = node;
+  while (chain_node->type == LQPNodeType::Predicate) {
+    if (chain_node != node && chain_node->output_count() > 1) return false;
+    predicate_nodes.emplace_back(std::static_pointer_cast<PredicateNode>(chain_node));
+    chain_node = chain_node->left_input();
+  }
+  if (chain_node->type != LQPNodeType::StoredTable) return false;
+
+  const auto stored_table_node = std::static_pointer_cast<StoredTableNode>(chain_node);
+  const auto primary_key_index =
+      Hyrise::get().storage_manager.get_table(stored_table_node->table_name)->primary_key_index();
+  if (!primary_key_index) return false;
+
+  // Find an equality predicate for each primary key column
+  const auto& primary_key_column_ids = primary_key_index->column_ids();
+  auto key_predicate_nodes = std::vector<std::shared_ptr<PredicateNode>>{};
+  auto key_predicates = std::vector<std::shared_ptr<AbstractExpression>>(primary_key_column_ids.size());
+  for (const auto& predicate_node : predicate_nodes) {
+    const auto key_predicate = primary_key_predicate(predicate_node->predicate(), *stored_table_node);
+    if (!key_predicate) continue;
+
+    const auto key_column_iter =
+        std::find(primary_key_column_ids.begin(), primary_key_column_ids.end(), key_predicate->first);
+    if (key_column_iter == primary_key_column_ids.end()) continue;
+
+    auto& key_column_predicate = key_predicates[std::distance(primary_key_column_ids.begin(), key_column_iter)];
+    if (key_column_predicate) continue;
+
+    key_column_predicate = key_predicate->second;
+    key_predicate_nodes.emplace_back(predicate_node);
+  }
+  if (key_predicate_nodes.size() != primary_key_column_ids.size()) return false;
+
+  // Replace the topmost of these PredicateNodes with a single one that holds the conjunction of the key predicates in
+  // the order of the primary key columns, remove the others, and move it down to the StoredTableNode
+  const auto primary_key_predicate_node =
+      PredicateNode::make(inflate_logical_expressions(key_predicates, LogicalOperator::And));
+  primary_key_predicate_node->scan_type = ScanType::PrimaryKeyIndexScan;
+
+  lqp_replace_node(key_predicate_nodes.front(), primary_key_predicate_node);
+  for (auto key_predicate_node_idx = size_t{1}; key_predicate_node_idx < key_predicate_nodes.size();
+       ++key_predicate_node_idx) {
+    lqp_remove_node(key_predicate_nodes[key_predicate_node_idx]);
+  }
+
+  if (primary_key_predicate_node->left_input() != stored_table_node) {
+    auto lowest_predicate_node = primary_key_predicate_node->left_input();
+    while (lowest_predicate_node->left_input() != stored_table_node) {
+      lowest_predicate_node = lowest_predicate_node->left_input();
+    }
+    lqp_remove_node(primary_key_predicate_node);
+    lqp_insert_node(lowest_predicate_node, LQPInputSide::Left, primary_key_predicate_node);
+  }
+
+  return true;
+}
+
 }  // namespace opossum
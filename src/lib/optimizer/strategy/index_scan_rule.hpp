@@ -22,7 +22,13 @@ class PredicateNode;
  * For now this rule is only applicable to single-column indexes. Multi-column predicates (i.e. WHERE a < b) are also
  * not supported. We also assume that if chunks have an index, all of them are of the same type, we do not mix GroupKey
  * and ART indexes. In addition, chains of IndexScans are not possible since an IndexScan's input must be a GetTable.
- * Currently, only GroupKeyIndexes are supported.
+ * Currently, GroupKeyIndexes and AdaptiveRadixTreeIndexes are supported. The latter includes the mutable indexes of
+ * chunks that have not been encoded yet (see MutableAdaptiveRadixTreeIndex).
+ *
+ * If the table has a PrimaryKeyIndex, a chain of PredicateNodes on the StoredTableNode whose equality predicates
+ * (`<column> = <value or correlated parameter>`) cover all primary key columns is rewritten: These predicates are
+ * merged into a single PredicateNode directly on the StoredTableNode, whose ScanType is set to PrimaryKeyIndexScan.
+ * As such a lookup returns at most a few rows, neither the selectivity nor the row count thresholds apply.
  */
 
 class IndexScanRule : public AbstractRule {
@@ -33,6 +39,9 @@ class IndexScanRule : public AbstractRule {
   bool _is_index_scan_applicable(const IndexStatistics& index_statistics,
                                  const std::shared_ptr<PredicateNode>& predicate_node) const;
   static bool _is_single_segment_index(const IndexStatistics& index_statistics);
+
+  // Returns whether the chain of PredicateNodes starting at `node` was rewritten into a PrimaryKeyIndexScan
+  static bool _apply_primary_key_index_scan(const std::shared_ptr<AbstractLQPNode>& node);
 };
 
 }  // namespace opossum
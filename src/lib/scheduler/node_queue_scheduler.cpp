@@ -8,6 +8,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "work_stealing_deque.hpp"
 #include "worker.hpp"
 
 #include "uid_allocator.hpp"
@@ -31,7 +32,10 @@ void NodeQueueScheduler::begin() {
   _workers.reserve(Hyrise::get().topology.num_cpus());
   _queues.reserve(Hyrise::get().topology.nodes().size());
 
-  for (auto node_id = NodeID{0}; node_id < Hyrise::get().topology.nodes().size(); node_id++) {
+  const auto node_count = Hyrise::get().topology.nodes().size();
+  auto workers_by_node = std::vector<std::vector<std::shared_ptr<Worker>>>(node_count);
+
+  for (auto node_id = NodeID{0}; node_id < node_count; node_id++) {
     auto queue = std::make_shared<TaskQueue>(node_id);
 
     _queues.emplace_back(queue);
@@ -40,6 +44,29 @@ void NodeQueueScheduler::begin() {
 
     for (auto& topology_cpu : topology_node.cpus) {
       _workers.emplace_back(std::make_shared<Worker>(queue, _worker_id_allocator->allocate(), topology_cpu.cpu_id));
+      workers_by_node[node_id].emplace_back(_workers.back());
+    }
+  }
+
+  // Workers steal from the other workers of their own node first, as their data is likely in NUMA-local memory.
+  // Afterwards, they try the workers of the following nodes. Each worker starts with its successor, so that idle
+  // workers do not all try to steal from the same victim.
+  for (auto node_id = NodeID{0}; node_id < node_count; node_id++) {
+    const auto& node_workers = workers_by_node[node_id];
+    for (auto worker_idx = size_t{0}; worker_idx < node_workers.size(); ++worker_idx) {
+      auto victim_deques = std::vector<std::shared_ptr<WorkStealingDeque>>{};
+      victim_deques.reserve(_workers.size() - 1);
+
+      for (auto node_offset = size_t{0}; node_offset < node_count; ++node_offset) {
+        const auto& victim_workers = workers_by_node[(node_id + node_offset) % node_count];
+        for (auto victim_offset = size_t{0}; victim_offset < victim_workers.size(); ++victim_offset) {
+          const auto& victim_worker = victim_workers[(worker_idx + 1 + victim_offset) % victim_workers.size()];
+          if (victim_worker == node_workers[worker_idx]) continue;
+          victim_deques.emplace_back(victim_worker->deque());
+        }
+      }
+
+      node_workers[worker_idx]->set_victim_deques(victim_deques);
     }
   }
 
@@ -71,6 +98,10 @@ void NodeQueueScheduler::finish() {
     for ([[maybe_unused]] auto& queue : _queues) {
       DebugAssert(queue->empty(), "NodeQueueScheduler bug: Queue wasn't empty even though all tasks finished");
     }
+    for ([[maybe_unused]] auto& worker : _workers) {
+      DebugAssert(worker->deque()->empty(),
+                  "NodeQueueScheduler bug: Deque wasn't empty even though all tasks finished");
+    }
   }
 
   _active = false;
@@ -88,6 +119,8 @@ bool NodeQueueScheduler::active() const { return _active; }
 
 const std::vector<std::shared_ptr<TaskQueue>>& NodeQueueScheduler::queues() const { return _queues; }
 
+const std::vector<std::shared_ptr<Worker>>& NodeQueueScheduler::workers() const { return _workers; }
+
 void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID preferred_node_id,
                                   SchedulePriority priority) {
   /**
@@ -101,15 +134,16 @@ void NodeQueueScheduler::schedule(std::shared_ptr<AbstractTask> task, NodeID pre
 
   if (!task->is_ready()) return;
 
-  // Lookup node id for current worker.
   if (preferred_node_id == CURRENT_NODE_ID) {
     auto worker = Worker::get_this_thread_worker();
     if (worker) {
-      preferred_node_id = worker->queue()->node_id();
-    } else {
-      // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
-      preferred_node_id = NodeID{0};
+      // Tasks scheduled from within a worker go to its deque, from which idle workers can steal them
+      worker->enqueue(task, priority);
+      return;
     }
+
+    // TODO(all): Actually, this should be ANY_NODE_ID, LIGHT_LOAD_NODE or something
+    preferred_node_id = NodeID{0};
   }
 
   DebugAssert(!(static_cast<size_t>(preferred_node_id) >= _queues.size()),
@@ -56,18 +56,19 @@ namespace opossum {
  *
  * WORK STEALING
  *
- * Currently, a simple work stealing is implemented. Work stealing is useful to avoid idle workers (and therefore
- * idle CPUs) while there are still tasks in the system that need to be processed. A worker gets idle if it can not
- * pull a ready task. This occurs in two cases:
- *  1) all tasks in the queue are not ready
- *  2) the queue is empty
- * In both cases the current worker is checking another queue for a ready task. Checking another queue means accessing
- * another node (remote node). As of the physical distance of nodes, accessing a remote nodes is ~1.6 times slower than
- * accessing a local node. [1]
- * Therefore, the current worker fetches a task from a remote queue (without removing it). Then, the current worker
- * is sleeping some milliseconds to give any local worker of the remote node the chance to pull that task. If no local
- * worker of the remote node pulled the task, the current worker is pulling the task and therefore steals it.
- * Afterwards, the current worker is checking its local queue gain.
+ * Besides the TaskQueue of its node, each worker owns a lock-free WorkStealingDeque. Tasks that are scheduled by a
+ * task running on a worker (e.g., the JobTasks of an operator) are pushed to that worker's deque. The owner takes
+ * tasks from the bottom of its deque (LIFO), so that it works on data that is still in its caches, while other workers
+ * steal from the top (FIFO). Tasks that are not stealable, and tasks scheduled from outside the scheduler, are added
+ * to a TaskQueue instead.
+ *
+ * A worker gets idle if neither its deque nor the TaskQueue of its node contains a ready task. It then tries to steal
+ * from the deques of the other workers of its node, followed by the workers of the other nodes. Accessing a remote
+ * node is ~1.6 times slower than accessing a local node [1], which is why local victims are preferred. Finally, it
+ * checks the other nodes' TaskQueues for stealable tasks. If no task is found, the worker spins for a few rounds
+ * before it waits on its node's TaskQueue until it is notified about new tasks or a timeout occurs.
+ *
+ * The number of executed and stolen tasks is tracked per worker (see workers()).
  *
  * [1] http://frankdenneman.nl/2016/07/13/numa-deep-dive-4-local-memory-optimization/
  */
@@ -96,6 +97,8 @@ class NodeQueueScheduler : public AbstractScheduler {
 
   const std::vector<std::shared_ptr<TaskQueue>>& queues() const override;
 
+  const std::vector<std::shared_ptr<Worker>>& workers() const;
+
   /**
    * @param task
    * @param preferred_node_id The Task will be initially added to this node, but might get stolen by other Nodes later
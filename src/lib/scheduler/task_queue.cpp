@@ -11,8 +11,10 @@ namespace opossum {
 TaskQueue::TaskQueue(NodeID node_id) : _node_id(node_id) {}
 
 bool TaskQueue::empty() const {
-  for (const auto& queue : _queues) {
-    if (!queue.empty()) return false;
+  for (const auto& queues : {&_stealable_queues, &_non_stealable_queues}) {
+    for (const auto& queue : *queues) {
+      if (!queue.empty()) return false;
+    }
   }
   return true;
 }
@@ -26,15 +28,19 @@ void TaskQueue::push(const std::shared_ptr<AbstractTask>& task, uint32_t priorit
   if (!task->try_mark_as_enqueued()) return;
 
   task->set_node_id(_node_id);
-  _queues[priority].push(task);
+  if (task->is_stealable()) {
+    _stealable_queues[priority].push(task);
+  } else {
+    _non_stealable_queues[priority].push(task);
+  }
 
-  new_task.notify_one();
+  notify_waiting_worker();
 }
 
 std::shared_ptr<AbstractTask> TaskQueue::pull() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
-    if (queue.try_pop(task)) {
+  for (auto priority = uint32_t{0}; priority < NUM_PRIORITY_LEVELS; ++priority) {
+    if (_non_stealable_queues[priority].try_pop(task) || _stealable_queues[priority].try_pop(task)) {
       return task;
     }
   }
@@ -43,16 +49,24 @@ std::shared_ptr<AbstractTask> TaskQueue::pull() {
 
 std::shared_ptr<AbstractTask> TaskQueue::steal() {
   std::shared_ptr<AbstractTask> task;
-  for (auto& queue : _queues) {
+  for (auto& queue : _stealable_queues) {
     if (queue.try_pop(task)) {
-      if (task->is_stealable()) {
-        return task;
-      } else {
-        queue.push(task);
-      }
+      return task;
     }
   }
   return nullptr;
 }
 
+void TaskQueue::wait_for_task(const std::chrono::microseconds timeout) {
+  auto unique_lock = std::unique_lock<std::mutex>{_lock};
+  ++_num_waiting_workers;
+  _new_task.wait_for(unique_lock, timeout);
+  --_num_waiting_workers;
+}
+
+void TaskQueue::notify_waiting_worker() {
+  if (_num_waiting_workers.load() == 0) return;
+  _new_task.notify_one();
+}
+
 }  // namespace opossum
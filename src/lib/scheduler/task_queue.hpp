@@ -4,8 +4,10 @@
 #include <tbb/concurrent_queue.h>
 #include <array>
 #include <atomic>
+#include <chrono>
 #include <condition_variable>
 #include <memory>
+#include <mutex>
 
 #include "types.hpp"
 
@@ -14,7 +16,11 @@ namespace opossum {
 class AbstractTask;
 
 /**
- * Holds a queue of AbstractTasks, usually one of these exists per node
+ * Holds a queue of AbstractTasks, usually one of these exists per node. Tasks that are scheduled by Workers are
+ * usually pushed to the WorkStealingDeque of that worker instead. The TaskQueue receives tasks that are scheduled from
+ * outside the scheduler, tasks that are scheduled for a specific node, and tasks that are not stealable.
+ *
+ * Idle workers of the node wait on the TaskQueue until new work becomes available.
  */
 class TaskQueue {
  public:
@@ -34,23 +40,32 @@ class TaskQueue {
   std::shared_ptr<AbstractTask> pull();
 
   /**
-   * Returns a Tasks that is ready to be executed and removes it from one of the stealable queues
+   * Returns a stealable Task that is ready to be executed and removes it from the queue. Tasks that are not stealable
+   * are kept in separate queues, so that they are not touched here.
    */
   std::shared_ptr<AbstractTask> steal();
 
   /**
-   * Notifies one worker as soon as a new task gets pushed into the queue
+   * Blocks the calling worker until new work is announced via notify_waiting_worker() or the timeout expires
    */
-  std::condition_variable new_task;
+  void wait_for_task(const std::chrono::microseconds timeout);
 
   /**
-   * Mutex accessed by workers in order to notify them using condition variable
+   * Wakes up one of the workers that wait for tasks, if there is any. Called when a task is added to this queue or to
+   * the WorkStealingDeque of one of the node's workers.
    */
-  std::mutex lock;
+  void notify_waiting_worker();
 
  private:
   NodeID _node_id;
-  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _queues;
+  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _stealable_queues;
+  std::array<tbb::concurrent_queue<std::shared_ptr<AbstractTask>>, NUM_PRIORITY_LEVELS> _non_stealable_queues;
+
+  std::mutex _lock;
+  std::condition_variable _new_task;
+
+  // Allows notify_waiting_worker() to skip the condition variable if no worker is waiting
+  std::atomic<uint32_t> _num_waiting_workers{0};
 };
 
 }  // namespace opossum
@@ -0,0 +1,112 @@
+#include "work_stealing_deque.hpp"
+
+#include <memory>
+#include <utility>
+
+#include "abstract_task.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+WorkStealingDeque::Buffer::Buffer(const size_t init_capacity)
+    : capacity(init_capacity), slots(std::make_unique<Slot[]>(init_capacity)) {  // NOLINT(modernize-avoid-c-arrays)
+  Assert(capacity > 0 && (capacity & (capacity - 1)) == 0, "Capacity must be a power of two");
+}
+
+WorkStealingDeque::WorkStealingDeque(const size_t initial_capacity) {
+  _buffers.emplace_back(std::make_unique<Buffer>(initial_capacity));
+  _buffer.store(_buffers.back().get(), std::memory_order_relaxed);
+}
+
+WorkStealingDeque::~WorkStealingDeque() {
+  // Free the tasks that have not been taken
+  auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  for (auto index = _top.load(std::memory_order_relaxed); index < bottom; ++index) {
+    delete (*buffer)[index].load(std::memory_order_relaxed);
+  }
+}
+
+void WorkStealingDeque::push(const std::shared_ptr<AbstractTask>& task) {
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  const auto top = _top.load(std::memory_order_acquire);
+  auto* buffer = _buffer.load(std::memory_order_relaxed);
+
+  if (bottom - top > static_cast<int64_t>(buffer->capacity) - 1) {
+    buffer = _grow(buffer, top, bottom);
+  }
+
+  (*buffer)[bottom].store(new std::shared_ptr<AbstractTask>(task), std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_release);
+  _bottom.store(bottom + 1, std::memory_order_relaxed);
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::pop() {
+  const auto bottom = _bottom.load(std::memory_order_relaxed) - 1;
+  auto* const buffer = _buffer.load(std::memory_order_relaxed);
+  _bottom.store(bottom, std::memory_order_relaxed);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto top = _top.load(std::memory_order_relaxed);
+
+  if (top > bottom) {
+    // The deque was empty
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+    return nullptr;
+  }
+
+  auto* task = (*buffer)[bottom].load(std::memory_order_relaxed);
+  if (top == bottom) {
+    // This is the last task, thieves might try to take it as well
+    if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+      task = nullptr;
+    }
+    _bottom.store(bottom + 1, std::memory_order_relaxed);
+  }
+
+  if (!task) return nullptr;
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+std::shared_ptr<AbstractTask> WorkStealingDeque::steal() {
+  auto top = _top.load(std::memory_order_acquire);
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  const auto bottom = _bottom.load(std::memory_order_acquire);
+
+  if (top >= bottom) return nullptr;
+
+  auto* const buffer = _buffer.load(std::memory_order_acquire);
+  auto* const task = (*buffer)[top].load(std::memory_order_relaxed);
+  if (!_top.compare_exchange_strong(top, top + 1, std::memory_order_seq_cst, std::memory_order_relaxed)) {
+    // Lost the race against the owner or another thief
+    return nullptr;
+  }
+
+  auto result = std::move(*task);
+  delete task;
+  return result;
+}
+
+size_t WorkStealingDeque::size() const {
+  const auto top = _top.load(std::memory_order_relaxed);
+  const auto bottom = _bottom.load(std::memory_order_relaxed);
+  return bottom > top ? static_cast<size_t>(bottom - top) : 0;
+}
+
+bool WorkStealingDeque::empty() const { return size() == 0; }
+
+WorkStealingDeque::Buffer* WorkStealingDeque::_grow(Buffer* buffer, const int64_t top, const int64_t bottom) {
+  _buffers.emplace_back(std::make_unique<Buffer>(buffer->capacity * 2));
+  auto* const new_buffer = _buffers.back().get();
+
+  for (auto index = top; index < bottom; ++index) {
+    (*new_buffer)[index].store((*buffer)[index].load(std::memory_order_relaxed), std::memory_order_relaxed);
+  }
+
+  _buffer.store(new_buffer, std::memory_order_release);
+  return new_buffer;
+}
+
+}  // namespace opossum
@@ -0,0 +1,82 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class AbstractTask;
+
+/**
+ * Lock-free deque of tasks as described by Chase and Lev [1], using the memory orders proposed by Lê et al. [2].
+ *
+ * Each Worker owns one deque. Only the owner may push() and pop(), which both operate on the bottom end of the deque.
+ * Thus, the owner executes the task it spawned most recently first (LIFO), whose data is likely still in its caches.
+ * Other workers steal() from the top end (FIFO), i.e., they take the oldest tasks. Owner and thieves only contend for
+ * the last remaining task.
+ *
+ * When the deque is full, push() replaces its buffer with one of twice the size. Thieves might still read from the old
+ * buffer, so replaced buffers are only freed when the deque is destroyed.
+ *
+ * [1] Chase and Lev, "Dynamic Circular Work-Stealing Deque", SPAA 2005
+ * [2] Lê, Pop, Cohen, and Zappa Nardelli, "Correct and Efficient Work-Stealing for Weak Memory Models", PPoPP 2013
+ */
+class WorkStealingDeque : private Noncopyable {
+ public:
+  explicit WorkStealingDeque(const size_t initial_capacity = 1024);
+  ~WorkStealingDeque();
+
+  /**
+   * Adds a task to the bottom of the deque. Must only be called by the owner.
+   */
+  void push(const std::shared_ptr<AbstractTask>& task);
+
+  /**
+   * Removes and returns the task at the bottom of the deque, or nullptr if it is empty. Must only be called by the
+   * owner.
+   */
+  std::shared_ptr<AbstractTask> pop();
+
+  /**
+   * Removes and returns the task at the top of the deque. Can be called by any thread. Returns nullptr if the deque is
+   * empty or if another thread took the task first.
+   */
+  std::shared_ptr<AbstractTask> steal();
+
+  /**
+   * As other threads might concurrently modify the deque, the result is only a snapshot.
+   */
+  size_t size() const;
+  bool empty() const;
+
+ private:
+  // Tasks are stored as pointers to heap-allocated shared_ptrs, so that slots can be read and written atomically.
+  // Whoever successfully removes a task from the deque takes ownership of the shared_ptr and deletes it.
+  using Slot = std::atomic<std::shared_ptr<AbstractTask>*>;
+
+  struct Buffer {
+    explicit Buffer(const size_t init_capacity);
+
+    Slot& operator[](const int64_t index) { return slots[static_cast<size_t>(index) & (capacity - 1)]; }
+
+    const size_t capacity;
+    std::unique_ptr<Slot[]> slots;  // NOLINT(modernize-avoid-c-arrays)
+  };
+
+  // Copies the tasks in [top, bottom) into a buffer of twice the size and makes it the current buffer
+  Buffer* _grow(Buffer* buffer, const int64_t top, const int64_t bottom);
+
+  // top and bottom are modified by different threads and thus kept on separate cache lines
+  alignas(64) std::atomic<int64_t> _top{0};
+  alignas(64) std::atomic<int64_t> _bottom{0};
+  alignas(64) std::atomic<Buffer*> _buffer;
+
+  // Owns the current and all replaced buffers. Only accessed by the owner.
+  std::vector<std::unique_ptr<Buffer>> _buffers;
+};
+
+}  // namespace opossum
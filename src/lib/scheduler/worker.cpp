@@ -15,6 +15,7 @@
 #include "abstract_task.hpp"
 #include "hyrise.hpp"
 #include "task_queue.hpp"
+#include "work_stealing_deque.hpp"
 
 namespace {
 
@@ -25,7 +26,10 @@ namespace {
 thread_local std::weak_ptr<opossum::Worker> this_thread_worker;
 }  // namespace
 
-// The sleep time was determined experimentally
+// An idle worker first spins for WORKER_SPIN_ROUNDS, looking for work without giving up its CPU, as new tasks
+// often follow within microseconds (e.g., the next JobTasks of an operator). Afterwards, it waits on its TaskQueue for
+// at most WORKER_SLEEP_TIME. The sleep time was determined experimentally.
+static constexpr auto WORKER_SPIN_ROUNDS = uint32_t{64};
 static constexpr auto WORKER_SLEEP_TIME = std::chrono::microseconds(300);
 
 namespace opossum {
@@ -33,7 +37,7 @@ namespace opossum {
 std::shared_ptr<Worker> Worker::get_this_thread_worker() { return ::this_thread_worker.lock(); }
 
 Worker::Worker(const std::shared_ptr<TaskQueue>& queue, WorkerID id, CpuID cpu_id)
-    : _queue(queue), _id(id), _cpu_id(cpu_id) {}
+    : _queue(queue), _deque(std::make_shared<WorkStealingDeque>()), _id(id), _cpu_id(cpu_id) {}
 
 WorkerID Worker::id() const { return _id; }
 
@@ -41,6 +45,30 @@ std::shared_ptr<TaskQueue> Worker::queue() const { return _queue; }
 
 CpuID Worker::cpu_id() const { return _cpu_id; }
 
+std::shared_ptr<WorkStealingDeque> Worker::deque() const { return _deque; }
+
+void Worker::set_victim_deques(const std::vector<std::shared_ptr<WorkStealingDeque>>& victim_deques) {
+  _victim_deques = victim_deques;
+}
+
+void Worker::enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority) {
+  DebugAssert(get_this_thread_worker().get() == this, "Tasks can only be pushed to the deque of the current worker");
+
+  if (!task->is_stealable()) {
+    _queue->push(task, static_cast<uint32_t>(priority));
+    return;
+  }
+
+  // Someone else was first to enqueue this task? No problem!
+  if (!task->try_mark_as_enqueued()) return;
+
+  task->set_node_id(_queue->node_id());
+  _deque->push(task);
+
+  // Idle workers of this node can steal the task
+  _queue->notify_waiting_worker();
+}
+
 void Worker::operator()() {
   Assert(this_thread_worker.expired(), "Thread already has a worker");
 
@@ -54,35 +82,23 @@ void Worker::operator()() {
 }
 
 void Worker::_work() {
-  auto task = _queue->pull();
+  auto task = _deque->pop();
+  if (!task) task = _queue->pull();
+  if (!task) task = _steal_task();
 
   if (!task) {
-    // Simple work stealing without explicitly transferring data between nodes.
-    auto work_stealing_successful = false;
-    for (auto& queue : Hyrise::get().scheduler()->queues()) {
-      if (queue == _queue) {
-        continue;
-      }
-
-      task = queue->steal();
-      if (task) {
-        task->set_node_id(_queue->node_id());
-        work_stealing_successful = true;
-        break;
-      }
-    }
-
-    // If there is no ready task neither in our queue nor in any other, worker waits for a new task to be pushed to the
-    // own queue or returns after timer exceeded (whatever occurs first).
-    if (!work_stealing_successful) {
-      {
-        std::unique_lock<std::mutex> unique_lock(_queue->lock);
-        _queue->new_task.wait_for(unique_lock, WORKER_SLEEP_TIME);
-      }
-      return;
+    if (_num_idle_rounds < WORKER_SPIN_ROUNDS) {
+      ++_num_idle_rounds;
+      std::this_thread::yield();
+    } else {
+      // Wait for a new task to be pushed to the own queue or to a deque of this node, or until the timer is exceeded
+      // (whatever occurs first).
+      _queue->wait_for_task(WORKER_SLEEP_TIME);
     }
+    return;
   }
 
+  _num_idle_rounds = 0;
   task->execute();
 
   // This is part of the Scheduler shutdown system. Count the number of tasks a Worker executed to allow the
@@ -90,6 +106,33 @@ void Worker::_work() {
   _num_finished_tasks++;
 }
 
+std::shared_ptr<AbstractTask> Worker::_steal_task() {
+  auto task = std::shared_ptr<AbstractTask>{};
+
+  // The deques are ordered so that workers of the same node come first (see NodeQueueScheduler::begin())
+  for (const auto& victim_deque : _victim_deques) {
+    task = victim_deque->steal();
+    if (task) break;
+  }
+
+  // Simple work stealing from other nodes' queues without explicitly transferring data between nodes
+  if (!task) {
+    for (const auto& queue : Hyrise::get().scheduler()->queues()) {
+      if (queue == _queue) continue;
+
+      task = queue->steal();
+      if (task) break;
+    }
+  }
+
+  if (task) {
+    task->set_node_id(_queue->node_id());
+    _num_stolen_tasks++;
+  }
+
+  return task;
+}
+
 void Worker::start() { _thread = std::thread(&Worker::operator(), this); }
 
 void Worker::join() {
@@ -99,6 +142,8 @@ void Worker::join() {
 
 uint64_t Worker::num_finished_tasks() const { return _num_finished_tasks; }
 
+uint64_t Worker::num_stolen_tasks() const { return _num_stolen_tasks; }
+
 void Worker::_set_affinity() {
 #if HYRISE_NUMA_SUPPORT
   cpu_set_t cpuset;
@@ -10,11 +10,18 @@
 
 namespace opossum {
 
+class AbstractTask;
 class TaskQueue;
+class WorkStealingDeque;
 
 /**
  * To be executed on a separate Thread, fetches and executes tasks until the queue is empty AND the shutdown flag is set
  * Ideally there should be one Worker actively doing work per CPU, but multiple might be active occasionally
+ *
+ * Tasks that the worker schedules itself are pushed to its own WorkStealingDeque. The worker first executes the tasks
+ * of its deque (newest first), then the tasks of its node's TaskQueue. If both are empty, it steals the oldest task
+ * from the deque of another worker, preferring workers of the same node, or a stealable task from another node's
+ * TaskQueue. If there is no work at all, the worker spins for a few rounds before it waits on its TaskQueue.
  */
 class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable {
   friend class AbstractScheduler;
@@ -30,12 +37,29 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
   WorkerID id() const;
   std::shared_ptr<TaskQueue> queue() const;
   CpuID cpu_id() const;
+  std::shared_ptr<WorkStealingDeque> deque() const;
+
+  /**
+   * Sets the deques that this worker steals from, in the order in which they are tried. Has to be called before
+   * start().
+   */
+  void set_victim_deques(const std::vector<std::shared_ptr<WorkStealingDeque>>& victim_deques);
+
+  /**
+   * Enqueues a task that has been scheduled by (a task running on) this worker. Stealable tasks are pushed to the
+   * worker's deque, where the priority is not considered as the newest task is executed first anyway. Other tasks are
+   * pushed to the node's TaskQueue. Must only be called from this worker's thread.
+   */
+  void enqueue(const std::shared_ptr<AbstractTask>& task, SchedulePriority priority);
 
   void start();
   void join();
 
   uint64_t num_finished_tasks() const;
 
+  // Number of tasks that this worker took from other workers' deques or from other nodes' TaskQueues
+  uint64_t num_stolen_tasks() const;
+
   void operator=(const Worker&) = delete;
   void operator=(Worker&&) = delete;
 
@@ -67,11 +91,19 @@ class Worker : public std::enable_shared_from_this<Worker>, private Noncopyable
    */
   void _set_affinity();
 
+  std::shared_ptr<AbstractTask> _steal_task();
+
   std::shared_ptr<TaskQueue> _queue;
+  std::shared_ptr<WorkStealingDeque> _deque;
+  std::vector<std::shared_ptr<WorkStealingDeque>> _victim_deques;
   WorkerID _id;
   CpuID _cpu_id;
   std::thread _thread;
   std::atomic<uint64_t> _num_finished_tasks{0};
+  std::atomic<uint64_t> _num_stolen_tasks{0};
+
+  // Number of consecutive calls to _work() that did not find a task. Only accessed by the worker's thread.
+  uint32_t _num_idle_rounds{0};
 };
 
 }  // namespace opossum
@@ -6,6 +6,9 @@ namespace opossum {
 // avoid magic numbers.
 static constexpr auto LENGTH_FIELD_SIZE = 4u;
 
+// Special protocol version number in the startup packet that the client uses to request SSL
+static constexpr auto SSL_REQUEST_CODE = 80877103u;
+
 // Documentation of the message types can be found here:
 // https://www.postgresql.org/docs/12/protocol-message-formats.html
 enum class PostgresMessageType : unsigned char {
@@ -1,5 +1,7 @@
 #include "postgres_protocol_handler.hpp"
 
+#include "session_stream.hpp"
+
 namespace opossum {
 
 template <typename SocketType>
@@ -8,9 +10,6 @@ PostgresProtocolHandler<SocketType>::PostgresProtocolHandler(const std::shared_p
 
 template <typename SocketType>
 uint32_t PostgresProtocolHandler<SocketType>::read_startup_packet_header() {
-  // Special SSL version number that we catch to deny SSL support
-  constexpr auto SSL_REQUEST_CODE = 80877103u;
-
   const auto body_length = _read_buffer.template get_value<uint32_t>();
   const auto protocol_version = _read_buffer.template get_value<uint32_t>();
 
@@ -89,7 +88,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description_header(const uint
 
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_row_description(const std::string& column_name, const uint32_t object_id,
-                                                               const int16_t type_width) {
+                                                               const int16_t type_width, const FormatCode format_code) {
   _write_buffer.put_string(column_name);
   // This field contains the table ID (OID in postgres). We have to set it in order to fulfill the protocol
   // specification. We do not know what it's good for.
@@ -99,7 +98,7 @@ void PostgresProtocolHandler<SocketType>::send_row_description(const std::string
   _write_buffer.template put_value<int32_t>(object_id);   // Object id of type
   _write_buffer.template put_value<int16_t>(type_width);  // Data type size
   _write_buffer.template put_value<int32_t>(-1);          // No modifier
-  _write_buffer.template put_value<int16_t>(0u);          // Text format
+  _write_buffer.template put_value<int16_t>(static_cast<int16_t>(format_code));
 }
 
 template <typename SocketType>
@@ -132,6 +131,11 @@ void PostgresProtocolHandler<SocketType>::send_data_row(
   }
 }
 
+template <typename SocketType>
+void PostgresProtocolHandler<SocketType>::send_serialized_data_rows(const std::string& data_rows) {
+  _write_buffer.put_string(data_rows, HasNullTerminator::No);
+}
+
 template <typename SocketType>
 void PostgresProtocolHandler<SocketType>::send_command_complete(const std::string& command_complete_message) {
   const auto packet_size = LENGTH_FIELD_SIZE + command_complete_message.size() + 1u /* null terminator */;
@@ -207,11 +211,16 @@ PreparedStatementDetails PostgresProtocolHandler<SocketType>::read_bind_packet()
 
   const auto num_result_column_format_codes = _read_buffer.template get_value<int16_t>();
 
+  auto result_formats = std::vector<FormatCode>{};
+  result_formats.reserve(num_result_column_format_codes);
   for (auto i = 0; i < num_result_column_format_codes; i++) {
-    Assert(_read_buffer.template get_value<int16_t>() == 0, "Assuming all result columns to be in text format (0)");
+    const auto format_code = _read_buffer.template get_value<int16_t>();
+    AssertInput(format_code == 0 || format_code == 1,
+                "Unknown result column format code " + std::to_string(format_code));
+    result_formats.emplace_back(static_cast<FormatCode>(format_code));
   }
 
-  return {statement_name, portal, parameter_values};
+  return {statement_name, portal, parameter_values, result_formats};
 }
 
 template <typename SocketType>
@@ -272,7 +281,7 @@ void PostgresProtocolHandler<SocketType>::_ssl_deny() {
   _write_buffer.flush();
 }
 
-template class PostgresProtocolHandler<Socket>;
+template class PostgresProtocolHandler<SessionStream>;
 // For testing purposes only. stream_descriptor is used to write data to file
 template class PostgresProtocolHandler<boost::asio::posix::stream_descriptor>;
 
@@ -11,11 +11,14 @@ namespace opossum {
 
 using ErrorMessage = std::unordered_map<PostgresMessageType, std::string>;
 
-// This struct stores a prepared statement's name, its portal used and the specified parameters.
+// This struct stores a prepared statement's name, its portal used, the specified parameters, and the formats requested
+// for the result columns. An empty list of result formats means that all columns are sent as text, a single format
+// applies to all columns.
 struct PreparedStatementDetails {
   std::string statement_name;
   std::string portal;
   std::vector<AllTypeVariant> parameters;
+  std::vector<FormatCode> result_formats;
 };
 
 // This class extracts information from client messages and serializes the response data according to the PostgreSQL
@@ -39,14 +42,20 @@ class PostgresProtocolHandler {
   // Read first byte of next packet to determine its type
   PostgresMessageType read_packet_type();
 
+  // Returns true if data has been received from the client but not been read yet
+  bool has_received_data() const { return _read_buffer.size() > 0; }
+
   // Read SQL query packet
   std::string read_query_packet();
 
   // Send query result
   void send_row_description_header(const uint32_t total_column_name_length, const uint16_t column_count);
-  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width);
+  void send_row_description(const std::string& column_name, const uint32_t object_id, const int16_t type_width,
+                            const FormatCode format_code = FormatCode::Text);
   void send_data_row(const std::vector<std::optional<std::string>>& values_as_strings,
                      const uint32_t string_length_sum);
+  // Send DataRow messages that have already been serialized, see ResultSerializer
+  void send_serialized_data_rows(const std::string& data_rows);
   void send_command_complete(const std::string& command_complete_message);
 
   // Messages for parsing prepared statements
@@ -1,12 +1,66 @@
 #include "result_serializer.hpp"
-#include "lossy_cast.hpp"
+
+#include <algorithm>
+#include <array>
+#include <charconv>
+#include <cstring>
+#include <iterator>
+#include <type_traits>
+
+#include <boost/lexical_cast.hpp>
+
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "session_stream.hpp"
+#include "storage/segment_iterate.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Appends an arithmetic value in network byte order (big endian)
+template <typename T>
+void append_network_value(std::string& buffer, const T value) {
+  static_assert(std::is_arithmetic_v<T>, "Only arithmetic values can be converted to network byte order");
+
+  using BitsType = std::conditional_t<sizeof(T) == 2, uint16_t, std::conditional_t<sizeof(T) == 4, uint32_t, uint64_t>>;
+  static_assert(sizeof(BitsType) == sizeof(T), "Unexpected size of value");
+
+  auto bits = BitsType{};
+  std::memcpy(&bits, &value, sizeof(T));
+  for (auto byte_idx = sizeof(T); byte_idx > 0; --byte_idx) {
+    buffer.push_back(static_cast<char>(bits >> ((byte_idx - 1) * 8)));
+  }
+}
+
+// Appends the length-prefixed text representation of a numerical value, which is what lossy_variant_cast<pmr_string>
+// used to produce
+template <typename T>
+void append_value_as_text(std::string& buffer, const T value) {
+  if constexpr (std::is_integral_v<T>) {
+    auto characters = std::array<char, 24>{};
+    const auto [end, error_code] = std::to_chars(characters.data(), characters.data() + characters.size(), value);
+    DebugAssert(error_code == std::errc{}, "Could not convert integer to string");
+    const auto length = static_cast<size_t>(end - characters.data());
+    append_network_value(buffer, static_cast<int32_t>(length));
+    buffer.append(characters.data(), length);
+  } else {
+    const auto value_as_string = boost::lexical_cast<std::string>(value);
+    append_network_value(buffer, static_cast<int32_t>(value_as_string.size()));
+    buffer.append(value_as_string);
+  }
+}
+
+}  // namespace
 
 namespace opossum {
 
 template <typename SocketType>
 void ResultSerializer::send_table_description(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_formats) {
   // Calculate sum of length of all column names
   uint32_t column_name_length_sum = 0;
   for (auto& column_name : table->column_names()) {
@@ -47,46 +101,124 @@ void ResultSerializer::send_table_description(
       case DataType::Null:
         Fail("Bad DataType");
     }
-    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width);
+    postgres_protocol_handler->send_row_description(table->column_name(column_id), object_id, type_width,
+                                                    column_format(result_formats, column_id));
   }
 }
 
 template <typename SocketType>
 void ResultSerializer::send_query_response(
     const std::shared_ptr<const Table>& table,
-    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler) {
-  auto values_as_strings = std::vector<std::optional<std::string>>(table->column_count());
-
+    const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+    const std::vector<FormatCode>& result_formats) {
   const auto chunk_count = table->chunk_count();
 
-  // Iterate over each chunk in result table
-  for (ChunkID chunk_id{0}; chunk_id < chunk_count; chunk_id++) {
-    const auto chunk = table->get_chunk(chunk_id);
-    const auto chunk_size = chunk->size();
+  auto serialized_chunks = std::vector<std::string>(chunk_count);
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>(chunk_count);
 
-    const auto column_count = table->column_count();
-    auto segments = Segments(column_count);
-    for (auto column_id = ColumnID{0}; column_id < column_count; column_id++) {
-      segments[column_id] = chunk->get_segment(column_id);
-    }
+  const auto schedule_serialization = [&](const ChunkID chunk_id) {
+    jobs[chunk_id] = std::make_shared<JobTask>([&, chunk_id]() {
+      serialized_chunks[chunk_id] = serialize_chunk(*table->get_chunk(chunk_id), result_formats);
+    });
+    jobs[chunk_id]->schedule();
+  };
 
-    // Iterate over each row in chunk
-    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
-      auto string_length_sum = 0;
-      // Iterate over each attribute in row
-      for (auto segment_id = ColumnID{0}; segment_id < column_count; segment_id++) {
-        const auto attribute_value = (*segments[segment_id])[chunk_offset];
-        // The PostgreSQL protocol requires the conversion of values to strings
-        const auto string_value = lossy_variant_cast<pmr_string>(attribute_value);
-        if (string_value.has_value()) {
-          // Sum up string lengths for a row to save an extra loop during serialization
-          string_length_sum += string_value.value().size();
-        }
-        values_as_strings[segment_id] = string_value;
+  const auto initial_job_count = std::min(static_cast<size_t>(chunk_count), MAX_CHUNKS_IN_FLIGHT);
+  for (auto job_idx = size_t{0}; job_idx < initial_job_count; ++job_idx) {
+    schedule_serialization(ChunkID{static_cast<ChunkID::base_type>(job_idx)});
+  }
+
+  try {
+    for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+      Hyrise::get().scheduler()->wait_for_tasks(std::vector<std::shared_ptr<AbstractTask>>{jobs[chunk_id]});
+      jobs[chunk_id] = nullptr;
+
+      const auto next_job_idx = static_cast<size_t>(chunk_id) + MAX_CHUNKS_IN_FLIGHT;
+      if (next_job_idx < static_cast<size_t>(chunk_count)) {
+        schedule_serialization(ChunkID{static_cast<ChunkID::base_type>(next_job_idx)});
       }
-      postgres_protocol_handler->send_data_row(values_as_strings, string_length_sum);
+
+      postgres_protocol_handler->send_serialized_data_rows(serialized_chunks[chunk_id]);
+      serialized_chunks[chunk_id] = std::string{};
     }
+  } catch (...) {
+    // The jobs reference local variables, so they have to finish before we leave this method (e.g., because the
+    // client disconnected)
+    auto remaining_jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+    std::copy_if(jobs.begin(), jobs.end(), std::back_inserter(remaining_jobs), [](const auto& job) { return job; });
+    Hyrise::get().scheduler()->wait_for_tasks(remaining_jobs);
+    throw;
+  }
+}
+
+std::string ResultSerializer::serialize_chunk(const Chunk& chunk, const std::vector<FormatCode>& result_formats) {
+  const auto chunk_size = chunk.size();
+  const auto column_count = static_cast<uint16_t>(chunk.column_count());
+
+  // The values are serialized segment by segment (which avoids resolving the segment type and the data type for each
+  // value) into one buffer per row. Afterwards, the rows are prefixed with their DataRow header and concatenated.
+  auto rows = std::vector<std::string>(chunk_size);
+
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    const auto format_code = column_format(result_formats, column_id);
+    const auto& segment = *chunk.get_segment(column_id);
+
+    resolve_data_type(segment.data_type(), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+
+      segment_iterate<ColumnDataType>(segment, [&](const auto& position) {
+        auto& row = rows[position.chunk_offset()];
+
+        if (position.is_null()) {
+          // NULL values are represented by setting the value's length to -1
+          append_network_value(row, int32_t{-1});
+          return;
+        }
+
+        const auto& value = position.value();
+        if constexpr (std::is_same_v<ColumnDataType, pmr_string>) {
+          // Strings are identical in the text and the binary format
+          append_network_value(row, static_cast<int32_t>(value.size()));
+          row.append(value.data(), value.size());
+        } else {
+          if (format_code == FormatCode::Binary) {
+            append_network_value(row, static_cast<int32_t>(sizeof(ColumnDataType)));
+            append_network_value(row, value);
+          } else {
+            append_value_as_text(row, value);
+          }
+        }
+      });
+    });
+  }
+
+  auto data_rows_size = size_t{0};
+  for (const auto& row : rows) {
+    data_rows_size += sizeof(PostgresMessageType) + LENGTH_FIELD_SIZE + sizeof(uint16_t) + row.size();
+  }
+
+  auto data_rows = std::string{};
+  data_rows.reserve(data_rows_size);
+  for (const auto& row : rows) {
+    // The documentation of the fields in this message can be found at:
+    // https://www.postgresql.org/docs/12/static/protocol-message-formats.html
+    data_rows.push_back(static_cast<char>(PostgresMessageType::DataRow));
+    append_network_value(data_rows, static_cast<uint32_t>(LENGTH_FIELD_SIZE + sizeof(uint16_t) + row.size()));
+    append_network_value(data_rows, column_count);
+    data_rows.append(row);
   }
+
+  return data_rows;
+}
+
+FormatCode ResultSerializer::column_format(const std::vector<FormatCode>& result_formats, const ColumnID column_id) {
+  // See the description of the Bind message in https://www.postgresql.org/docs/12/protocol-message-formats.html
+  if (result_formats.empty()) return FormatCode::Text;
+  if (result_formats.size() == 1) return result_formats.front();
+
+  AssertInput(static_cast<size_t>(column_id) < result_formats.size(),
+              "Number of result format codes does not match the number of columns");
+  return result_formats[column_id];
 }
 
 std::string ResultSerializer::build_command_complete_message(const OperatorType root_operator_type,
@@ -112,18 +244,22 @@ std::string ResultSerializer::build_command_complete_message(const OperatorType
   }
 }
 
-template void ResultSerializer::send_table_description<Socket>(const std::shared_ptr<const Table>&,
-                                                               const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_table_description<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_table_description<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
-template void ResultSerializer::send_query_response<Socket>(const std::shared_ptr<const Table>&,
-                                                            const std::shared_ptr<PostgresProtocolHandler<Socket>>&);
+template void ResultSerializer::send_query_response<SessionStream>(
+    const std::shared_ptr<const Table>&, const std::shared_ptr<PostgresProtocolHandler<SessionStream>>&,
+    const std::vector<FormatCode>&);
 
 template void ResultSerializer::send_query_response<boost::asio::posix::stream_descriptor>(
     const std::shared_ptr<const Table>&,
-    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&);
+    const std::shared_ptr<PostgresProtocolHandler<boost::asio::posix::stream_descriptor>>&,
+    const std::vector<FormatCode>&);
 
 }  // namespace opossum
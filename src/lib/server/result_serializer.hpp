@@ -10,20 +10,35 @@ namespace opossum {
 // The ResultSerializer serializes the result data returned by Hyrise according to PostgreSQL Wire Protocol.
 class ResultSerializer {
  public:
-  // Serialize information about the result table
+  // Serialize information about the result table. result_formats contains the formats requested by the client in the
+  // Bind message (see PreparedStatementDetails).
   template <typename SocketType>
   static void send_table_description(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_formats = {});
 
+  // Serialize the values of the result table and send them row-wise. The chunks are serialized in parallel and each
+  // chunk is sent as soon as it and its predecessors have been serialized, so that writing to the socket overlaps with
+  // the serialization of the following chunks.
   template <typename SocketType>
-  // Cast attributes of the result table and send them row-wise
   static void send_query_response(
       const std::shared_ptr<const Table>& table,
-      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler);
+      const std::shared_ptr<PostgresProtocolHandler<SocketType>>& postgres_protocol_handler,
+      const std::vector<FormatCode>& result_formats = {});
+
+  // Serialize the rows of a chunk as a sequence of DataRow messages
+  static std::string serialize_chunk(const Chunk& chunk, const std::vector<FormatCode>& result_formats);
 
   // Build completion message after query execution containing the statement type and the number of rows affected
   static std::string build_command_complete_message(const OperatorType root_operator_type, const uint64_t row_count);
+
+  // Resolve the format of a column from the list of formats requested by the client
+  static FormatCode column_format(const std::vector<FormatCode>& result_formats, const ColumnID column_id);
+
+  // Number of chunks that are serialized ahead of the chunk that is currently sent. Limits the memory used for
+  // serialized data if the client reads slower than we serialize.
+  static constexpr auto MAX_CHUNKS_IN_FLIGHT = size_t{16};
 };
 
 }  // namespace opossum
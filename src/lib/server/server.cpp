@@ -4,27 +4,61 @@
 
 #include <iostream>
 #include <thread>
+#include <vector>
 
 namespace opossum {
 
 // Specified port (default: 5432) will be opened after initializing the _acceptor
 Server::Server(const boost::asio::ip::address& address, const uint16_t port,
-               const SendExecutionInfo send_execution_info)
-    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)), _send_execution_info(send_execution_info) {
+               const SendExecutionInfo send_execution_info, const uint32_t io_thread_count,
+               const uint32_t request_thread_count)
+    : _acceptor(_io_service, boost::asio::ip::tcp::endpoint(address, port)),
+      _send_execution_info(send_execution_info),
+      _io_thread_count(io_thread_count),
+      _request_thread_count(request_thread_count) {
+  Assert(_io_thread_count > 0, "Server needs at least one I/O thread");
+  Assert(_request_thread_count > 0, "Server needs at least one request thread");
   std::cout << "Server started at " << server_address() << " and port " << server_port() << std::endl
             << "Run 'psql -h localhost' to connect to the server" << std::endl;
 }
 
 void Server::run() {
   _accept_new_session();
+
+  auto threads = std::vector<std::thread>{};
+  threads.reserve(_io_thread_count - 1 + _request_thread_count);
+  const auto start_thread = [&](boost::asio::io_service& io_service, const std::string& thread_name) {
+    threads.emplace_back([&io_service, thread_name]() {
+#ifdef __APPLE__
+      pthread_setname_np(thread_name.c_str());
+#elif __linux__
+      pthread_setname_np(pthread_self(), thread_name.c_str());
+#endif
+      io_service.run();
+    });
+  };
+
+  for (auto thread_id = uint32_t{0}; thread_id < _request_thread_count; ++thread_id) {
+    start_thread(_request_io_service, "server_req_" + std::to_string(thread_id));
+  }
+
+  // The calling thread is one of the I/O threads
+  for (auto thread_id = uint32_t{1}; thread_id < _io_thread_count; ++thread_id) {
+    start_thread(_io_service, "server_io_" + std::to_string(thread_id));
+  }
+
   _io_service.run();
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
 }
 
 void Server::_accept_new_session() {
   // Create a new session. This will also open a new data socket in order to communicate with the client
   // For more information on TCP ports + Asio see:
   // https://www.gamedev.net/forums/topic/586557-boostasio-allowing-multiple-connections-to-a-single-server-socket/
-  auto new_session = std::make_shared<Session>(_io_service, _send_execution_info);
+  auto new_session = std::make_shared<Session>(_io_service, _request_io_service, _send_execution_info);
   _acceptor.async_accept(*(new_session->socket()),
                          boost::bind(&Server::_start_session, this, new_session, boost::asio::placeholders::error));
 }
@@ -32,17 +66,7 @@ void Server::_accept_new_session() {
 void Server::_start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error) {
   Assert(!error, error.message());
 
-  std::thread session_thread([new_session] {
-    const std::string thread_name = "server_p_" + std::to_string(new_session->socket()->remote_endpoint().port());
-#ifdef __APPLE__
-    pthread_setname_np(thread_name.c_str());
-#elif __linux__
-    pthread_setname_np(pthread_self(), thread_name.c_str());
-#endif
-    new_session->run();
-  });
-
-  session_thread.detach();
+  new_session->start();
   _accept_new_session();
 }
 
@@ -50,6 +74,9 @@ boost::asio::ip::address Server::server_address() const { return _acceptor.local
 
 uint16_t Server::server_port() const { return _acceptor.local_endpoint().port(); }
 
-void Server::shutdown() { _io_service.stop(); }
+void Server::shutdown() {
+  _io_service.stop();
+  _request_io_service.stop();
+}
 
 }  // namespace opossum
@@ -10,9 +10,11 @@ namespace opossum {
 
 /* In the following a short description of the classes used for the server implementation.
 
-*  Server - Opens and binds a server socket. Starts a new session per client.
+*  Server - Opens and binds a server socket. Starts a new session per client. A small pool of I/O threads accepts
+*           connections and waits for incoming data on all sessions' sockets. A pool of request threads handles the
+*           requests of the sessions.
 *  Session - Creates a data socket for client server communication. It is responsible for the message flow and holds
-*            session-specific data.
+*            session-specific data. Requests are handled by the request threads, queries are executed by the scheduler.
 *  PostgresProtocolHandler - This class operates on the message level. It serializes and de-serializes information from
 *                            messages.
 *  PostgresMessageTypes - Set of different message types supported by Hyrise.
@@ -29,9 +31,11 @@ namespace opossum {
 
 class Server {
  public:
-  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info);
+  Server(const boost::asio::ip::address& address, const uint16_t port, const SendExecutionInfo send_execution_info,
+         const uint32_t io_thread_count = DEFAULT_IO_THREAD_COUNT,
+         const uint32_t request_thread_count = DEFAULT_REQUEST_THREAD_COUNT);
 
-  // Start server to accept new sessions.
+  // Start server to accept new sessions. Blocks until shutdown() is called.
   void run();
 
   // Return the port the server is running on.
@@ -43,13 +47,29 @@ class Server {
   // Shutdown Hyrise server.
   void shutdown();
 
+  // The I/O threads only accept connections, receive messages, and send results, so that a few of them can serve many
+  // clients
+  static constexpr auto DEFAULT_IO_THREAD_COUNT = uint32_t{2};
+
+  // The request threads wait for the execution of queries, for commits, and for slow clients to receive their results.
+  // They do not execute queries themselves. A session occupies a request thread only while it handles requests, so
+  // that the server can serve more clients than it has request threads.
+  static constexpr auto DEFAULT_REQUEST_THREAD_COUNT = uint32_t{32};
+
  private:
   void _accept_new_session();
 
   void _start_session(const std::shared_ptr<Session>& new_session, const boost::system::error_code& error);
 
   boost::asio::io_service _io_service;
+  boost::asio::io_service _request_io_service;
+
+  // Keeps the request threads running while no requests are pending
+  boost::asio::io_service::work _request_work{_request_io_service};
+
   boost::asio::ip::tcp::acceptor _acceptor;
   const SendExecutionInfo _send_execution_info;
+  const uint32_t _io_thread_count;
+  const uint32_t _request_thread_count;
 };
 }  // namespace opossum
@@ -10,4 +10,7 @@ enum class HasNullTerminator : bool { Yes = true, No = false };
 
 enum class SendExecutionInfo : bool { Yes = true, No = false };
 
+// Format codes used by the PostgreSQL Wire Protocol for parameters and result columns
+enum class FormatCode : int16_t { Text = 0, Binary = 1 };
+
 }  // namespace opossum
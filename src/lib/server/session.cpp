@@ -7,37 +7,69 @@
 
 namespace opossum {
 
-Session::Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info)
-    : _socket(std::make_shared<Socket>(io_service)),
-      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<Socket>>(_socket)),
+Session::Session(boost::asio::io_service& io_service, boost::asio::io_service& request_io_service,
+                 const SendExecutionInfo send_execution_info)
+    : _request_io_service(request_io_service),
+      _socket(std::make_shared<Socket>(io_service)),
+      _stream(std::make_shared<SessionStream>(io_service, _socket)),
+      _postgres_protocol_handler(std::make_shared<PostgresProtocolHandler<SessionStream>>(_stream)),
       _send_execution_info(send_execution_info) {}
 
 std::shared_ptr<Socket> Session::socket() { return _socket; }
 
-void Session::run() {
+void Session::start() {
   // Set TCP_NODELAY in order to disable Nagle's algorithm. It handles congestion control in TCP networks. Therefore,
   // small packets are buffered and sent out later as one large packet. This might introduce a delay of up to 40 ms
   // which we have to avoid. Further reading: https://howdoesinternetwork.com/2015/nagles-algorithm
   _socket->set_option(boost::asio::ip::tcp::no_delay(true));
-  _establish_connection();
-  while (!_terminate_session) {
-    try {
-      _handle_request();
-    } catch (const ClientDisconnectException&) {
-      return;
-    } catch (const std::exception& e) {
-      std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
-                << e.what() << std::endl;
-      const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
-      _postgres_protocol_handler->send_error_message(error_message);
-      _postgres_protocol_handler->send_ready_for_query();
-      // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
-      // Messages that have already been received are processed further. A "sync" message makes the server send another
-      // "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as a new
-      // query arrives it must be set to false again to ensure correct message flow.
-      _sync_send_after_error = true;
+  _wait_for_requests();
+}
+
+void Session::_wait_for_requests() {
+  // The handler holds a shared_ptr to the session, which keeps it alive while the client is connected. It is not called
+  // if the client disconnects.
+  _stream->async_receive_messages([session = shared_from_this()]() {
+    session->_request_io_service.post([session]() { session->_handle_requests(); });
+  });
+}
+
+void Session::_handle_requests() {
+  try {
+    if (!_connection_established) {
+      _establish_connection();
+      _connection_established = true;
     }
+
+    // The client might have sent multiple messages at once (e.g., Parse, Bind, Execute, and Sync). All of them are
+    // handled before waiting for new messages. Some of them might have been moved to the read buffer already.
+    do {
+      try {
+        _handle_request();
+      } catch (const ClientDisconnectException&) {
+        throw;
+      } catch (const std::exception& e) {
+        std::cerr << "Exception in session with client port " << _socket->remote_endpoint().port() << ":" << std::endl
+                  << e.what() << std::endl;
+        const auto error_message = ErrorMessage{{PostgresMessageType::HumanReadableError, e.what()}};
+        _postgres_protocol_handler->send_error_message(error_message);
+        _postgres_protocol_handler->send_ready_for_query();
+        // In case of an error, an error message has to be send to the client followed by a "ReadyForQuery" message.
+        // Messages that have already been received are processed further. A "sync" message makes the server send
+        // another "ReadyForQuery" message. In order to avoid this, we set this flag for further operations. As soon as
+        // a new query arrives it must be set to false again to ensure correct message flow.
+        _sync_send_after_error = true;
+      }
+    } while (!_terminate_session && (_postgres_protocol_handler->has_received_data() || _stream->has_messages()));
+  } catch (const ClientDisconnectException&) {
+    return;
+  } catch (const boost::system::system_error&) {
+    // The connection broke, e.g., while the error message for an earlier exception was sent
+    return;
   }
+
+  if (_terminate_session) return;
+
+  _wait_for_requests();
 }
 
 void Session::_establish_connection() {
@@ -151,11 +183,11 @@ void Session::_handle_bind_command() {
   // Since bind and execute packet usually arrive together, we still have to handle the execute packet. Therefore,
   // we first store a nullptr in the portals map to signalize an error. However, if binding succeeds in the next step
   // this nullptr gets replaced by the correct pqp. Before executing the prepared statement we make a check for errors.
-  _portals.emplace(parameters.portal, nullptr);
+  _portals.emplace(parameters.portal, Portal{});
 
   const auto pqp = QueryHandler::bind_prepared_plan(parameters);
 
-  _portals[parameters.portal] = pqp;
+  _portals[parameters.portal] = Portal{pqp, parameters.result_formats};
   _postgres_protocol_handler->send_status_message(PostgresMessageType::BindComplete);
 
   // Ready for query + flush will be done after reading sync message
@@ -178,12 +210,13 @@ void Session::_handle_execute() {
 
   // In case of an error occured during binding there is no pqp available. Hence, early return here since there is
   // nothing to execute.
-  if (!portal_it->second) {
+  if (!portal_it->second.physical_plan) {
     _portals.erase(portal_it);
     return;
   }
 
-  const auto physical_plan = portal_it->second;
+  const auto physical_plan = portal_it->second.physical_plan;
+  const auto result_formats = portal_it->second.result_formats;
 
   if (portal_name.empty()) _portals.erase(portal_it);
 
@@ -195,8 +228,8 @@ void Session::_handle_execute() {
   uint64_t row_count = 0;
   // If there is no result table, e.g. after an INSERT command, we cannot send row data
   if (result_table) {
-    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler);
-    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler);
+    ResultSerializer::send_table_description(result_table, _postgres_protocol_handler, result_formats);
+    ResultSerializer::send_query_response(result_table, _postgres_protocol_handler, result_formats);
     row_count = result_table->row_count();
   } else {
     _postgres_protocol_handler->send_status_message(PostgresMessageType::NoDataResponse);
@@ -4,6 +4,7 @@
 #include "operators/abstract_operator.hpp"
 #include "postgres_protocol_handler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "session_stream.hpp"
 
 namespace opossum {
 
@@ -12,16 +13,31 @@ namespace opossum {
 // portals used for CURSOR operations are currently not supported by Hyrise. For further documentation see here:
 // https://www.postgresql.org/docs/12/protocol-overview.html#PROTOCOL-QUERY-CONCEPTS
 // Example usage can be found here: https://stackoverflow.com/questions/52479293/postgresql-refcursor-and-portal-name
-class Session {
+//
+// Sessions do not own a thread. The I/O threads of the server receive the client's messages asynchronously (see
+// SessionStream). Once complete messages have arrived, they are handled by one of the server's request threads. The
+// queries themselves are executed by the scheduler. Handling requests blocks the request thread while it waits for
+// commits and, if the client reads its results slowly, for the results to be sent (see SessionStream::write_some).
+// Thus, it does not run on the scheduler's workers. The responses are sent asynchronously by the I/O threads.
+// Afterwards, the session waits for new messages again. Thus, idle connections do not occupy any thread.
+class Session : public std::enable_shared_from_this<Session> {
  public:
-  explicit Session(boost::asio::io_service& io_service, const SendExecutionInfo send_execution_info);
+  // Socket operations run on `io_service`, requests are handled on `request_io_service`
+  Session(boost::asio::io_service& io_service, boost::asio::io_service& request_io_service,
+          const SendExecutionInfo send_execution_info);
 
-  // Start new session.
-  void run();
+  // Start new session. Returns immediately, the session keeps itself alive until the client disconnects.
+  void start();
 
   std::shared_ptr<Socket> socket();
 
  private:
+  // Asynchronously wait until the client has sent complete messages, then post _handle_requests() to the request threads.
+  void _wait_for_requests();
+
+  // Handle requests until the messages received from the client have been processed. Executed by a request thread.
+  void _handle_requests();
+
   // Establish new connection by exchanging parameters.
   void _establish_connection();
 
@@ -46,12 +62,21 @@ class Session {
   // Commit current transaction.
   void _sync();
 
+  boost::asio::io_service& _request_io_service;
   const std::shared_ptr<Socket> _socket;
-  const std::shared_ptr<PostgresProtocolHandler<Socket>> _postgres_protocol_handler;
+  const std::shared_ptr<SessionStream> _stream;
+  const std::shared_ptr<PostgresProtocolHandler<SessionStream>> _postgres_protocol_handler;
   const SendExecutionInfo _send_execution_info;
+  bool _connection_established = false;
   bool _terminate_session = false;
   bool _sync_send_after_error = false;
   std::shared_ptr<TransactionContext> _transaction;
-  std::unordered_map<std::string, std::shared_ptr<AbstractOperator>> _portals;
+
+  // A portal holds a bound prepared statement and the formats that the client requested for its result columns
+  struct Portal {
+    std::shared_ptr<AbstractOperator> physical_plan;
+    std::vector<FormatCode> result_formats;
+  };
+  std::unordered_map<std::string, Portal> _portals;
 };
 }  // namespace opossum
@@ -0,0 +1,134 @@
+#include "session_stream.hpp"
+
+#include <cstring>
+
+#include "postgres_message_type.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+SessionStream::SessionStream(boost::asio::io_service& io_service, const std::shared_ptr<Socket>& socket)
+    : _io_service(io_service), _socket(socket), _strand(io_service) {}
+
+void SessionStream::async_receive_messages(const std::function<void()>& handler) {
+  DebugAssert(!has_messages(), "Received messages have not been read yet");
+  _strand.post([stream = shared_from_this(), handler]() {
+    stream->_messages_received_handler = handler;
+    stream->_receive();
+  });
+}
+
+void SessionStream::_receive() {
+  // The client might have sent multiple messages at once, so that the next message has been received already
+  if (!_extract_complete_messages()) {
+    // The client violated the protocol. Drop the handler (which usually keeps the session alive) and close the
+    // connection once the session is gone.
+    _messages_received_handler = nullptr;
+    return;
+  }
+
+  if (has_messages()) {
+    // Reset the handler before calling it so that it does not keep the session alive while the stream is idle
+    const auto handler = std::move(_messages_received_handler);
+    _messages_received_handler = nullptr;
+    handler();
+    return;
+  }
+
+  _socket->async_read_some(
+      boost::asio::buffer(_receive_buffer),
+      _strand.wrap([stream = shared_from_this()](const boost::system::error_code& error_code, size_t bytes_read) {
+        // The client closed the connection or the server is shutting down
+        if (error_code) {
+          stream->_messages_received_handler = nullptr;
+          return;
+        }
+
+        stream->_received_data.append(stream->_receive_buffer.data(), bytes_read);
+        stream->_receive();
+      }));
+}
+
+bool SessionStream::_extract_complete_messages() {
+  auto message_begin = size_t{0};
+  while (true) {
+    // Regular messages start with their type, the startup packet does not have one. Both have a length field that
+    // includes itself, but not the type.
+    const auto type_size = _expect_startup_packet ? size_t{0} : sizeof(PostgresMessageType);
+    const auto header_size = type_size + LENGTH_FIELD_SIZE;
+    if (_received_data.size() - message_begin < header_size) break;
+
+    auto length = uint32_t{};
+    std::memcpy(&length, _received_data.data() + message_begin + type_size, sizeof(length));
+    length = ntohl(length);
+    if (length < LENGTH_FIELD_SIZE) return false;
+
+    const auto message_size = type_size + length;
+    if (_received_data.size() - message_begin < message_size) break;
+
+    if (_expect_startup_packet) {
+      auto protocol_version = uint32_t{};
+      if (length >= 2 * LENGTH_FIELD_SIZE) {
+        std::memcpy(&protocol_version, _received_data.data() + message_begin + LENGTH_FIELD_SIZE,
+                    sizeof(protocol_version));
+        protocol_version = ntohl(protocol_version);
+      }
+
+      if (protocol_version == SSL_REQUEST_CODE) {
+        // We currently do not support SSL. The client answers the denial with the actual startup packet. As the
+        // client waits for the denial, it is sent here instead of by the protocol handler. As the protocol handler has
+        // not written anything yet, the send queue is empty and write_some does not block the strand.
+        const auto ssl_no = PostgresMessageType::SslNo;
+        auto error_code = boost::system::error_code{};
+        write_some(boost::asio::buffer(&ssl_no, sizeof(ssl_no)), error_code);
+        message_begin += message_size;
+        continue;
+      }
+
+      _expect_startup_packet = false;
+    }
+
+    _messages.append(_received_data, message_begin, message_size);
+    message_begin += message_size;
+  }
+
+  _received_data.erase(0, message_begin);
+  return true;
+}
+
+void SessionStream::_send() {
+  {
+    std::lock_guard<std::mutex> lock(_send_mutex);
+    DebugAssert(_sending, "Sending was not started");
+
+    // The previously sent data (if any) has been written to the socket. Wake up writers that wait for the queue to
+    // drain.
+    _sending_data.clear();
+    _send_queue_drained.notify_all();
+
+    if (_send_queue.empty()) {
+      _sending = false;
+      return;
+    }
+    std::swap(_sending_data, _send_queue);
+  }
+
+  boost::asio::async_write(
+      *_socket, boost::asio::buffer(_sending_data),
+      _strand.wrap([stream = shared_from_this()](const boost::system::error_code& error_code, size_t) {
+        if (error_code) {
+          // The connection broke. Following writes of the protocol handler fail.
+          std::lock_guard<std::mutex> lock(stream->_send_mutex);
+          stream->_send_failed = true;
+          stream->_sending = false;
+          stream->_send_queue.clear();
+          stream->_sending_data.clear();
+          stream->_send_queue_drained.notify_all();
+          return;
+        }
+
+        stream->_send();
+      }));
+}
+
+}  // namespace opossum
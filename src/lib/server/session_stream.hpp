@@ -0,0 +1,132 @@
+#pragma once
+
+#include <array>
+#include <chrono>
+#include <condition_variable>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <string>
+
+#include "ring_buffer_iterator.hpp"
+#include "server_types.hpp"
+
+namespace opossum {
+
+// The SessionStream decouples the PostgresProtocolHandler of a Session from the network. All socket operations are
+// asynchronous and run on the server's I/O threads:
+//  - Data received from the client is split into messages. Only complete messages are handed to the protocol handler,
+//    so that reading a message never waits for the client. A client that sends a message only partially therefore
+//    does not occupy any thread.
+//  - Data written by the protocol handler is queued and sent in the background, so that writing overlaps with the
+//    execution and serialization of the query. The queue is bounded (see MAX_SEND_QUEUE_SIZE): once it is full,
+//    write_some blocks until the queued data has been sent. Thus, a client that reads its results slowly throttles the
+//    serialization of the results (see ResultSerializer::send_query_response) instead of making the server buffer
+//    them. As write_some blocks, the protocol handler must not be used on the scheduler's workers (see Session).
+//
+// For the protocol handler, the SessionStream is a synchronous stream (i.e., it provides read_some and write_some, as
+// used by boost::asio::read and boost::asio::write). Reading more data than has been received is an error.
+class SessionStream : public std::enable_shared_from_this<SessionStream> {
+ public:
+  SessionStream(boost::asio::io_service& io_service, const std::shared_ptr<Socket>& socket);
+
+  // Asynchronously receive data until at least one complete message is available. Then, `handler` is called on an I/O
+  // thread. If the client disconnects, `handler` is not called. Must not be called while messages are available.
+  void async_receive_messages(const std::function<void()>& handler);
+
+  // Returns true if complete messages have been received but not been read yet
+  bool has_messages() const { return _messages_read_position < _messages.size(); }
+
+  template <typename MutableBufferSequence>
+  size_t read_some(const MutableBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto unread_messages =
+        boost::asio::buffer(_messages.data() + _messages_read_position, _messages.size() - _messages_read_position);
+    const auto bytes_read = boost::asio::buffer_copy(buffers, unread_messages);
+    _messages_read_position += bytes_read;
+    if (_messages_read_position == _messages.size()) {
+      _messages.clear();
+      _messages_read_position = 0;
+    }
+
+    // The protocol handler requested more data than the messages contain
+    if (bytes_read == 0) error_code = boost::asio::error::eof;
+    return bytes_read;
+  }
+
+  template <typename ConstBufferSequence>
+  size_t write_some(const ConstBufferSequence& buffers, boost::system::error_code& error_code) {
+    const auto bytes_written = boost::asio::buffer_size(buffers);
+    {
+      std::unique_lock<std::mutex> lock(_send_mutex);
+      // Wait until the strand has sent enough data. The data is appended even if it exceeds the limit, so that the
+      // queue holds at most MAX_SEND_QUEUE_SIZE bytes plus the size of a single write.
+      while (!_send_failed && _queued_bytes() >= MAX_SEND_QUEUE_SIZE) {
+        // Once the server has been shut down, the I/O threads do not send the queued data anymore
+        if (_io_service.stopped()) {
+          _send_failed = true;
+          break;
+        }
+        _send_queue_drained.wait_for(lock, std::chrono::milliseconds{100});
+      }
+      if (_send_failed) {
+        error_code = boost::asio::error::broken_pipe;
+        return 0;
+      }
+
+      const auto previous_size = _send_queue.size();
+      _send_queue.resize(previous_size + bytes_written);
+      boost::asio::buffer_copy(boost::asio::buffer(_send_queue.data() + previous_size, bytes_written), buffers);
+
+      if (_sending) return bytes_written;
+      _sending = true;
+    }
+
+    _strand.post([stream = shared_from_this()]() { stream->_send(); });
+    return bytes_written;
+  }
+
+  // Number of bytes that may be queued (including the data that is currently sent) before write_some blocks
+  static constexpr auto MAX_SEND_QUEUE_SIZE = size_t{1'048'576};
+
+ private:
+  // Receive data from the socket until a complete message is available
+  void _receive();
+
+  // Move all complete messages from _received_data to _messages. Returns false if the client violated the protocol.
+  bool _extract_complete_messages();
+
+  // Send the queued data. Runs until the queue is empty.
+  void _send();
+
+  // Size of the data that has been written by the protocol handler but not been sent yet. Requires _send_mutex.
+  size_t _queued_bytes() const { return _send_queue.size() + _sending_data.size(); }
+
+  boost::asio::io_service& _io_service;
+  const std::shared_ptr<Socket> _socket;
+
+  // All socket operations are executed by this strand, so that they do not run concurrently
+  boost::asio::io_service::strand _strand;
+
+  std::function<void()> _messages_received_handler;
+
+  // Data received from the socket that does not form a complete message yet. Only accessed on the strand.
+  std::array<char, SERVER_BUFFER_SIZE> _receive_buffer;
+  std::string _received_data;
+  bool _expect_startup_packet = true;
+
+  // Complete messages that the protocol handler reads. They are filled by the strand while the protocol handler does
+  // not read (i.e., between async_receive_messages() and the call of the handler).
+  std::string _messages;
+  size_t _messages_read_position = 0;
+
+  // Data written by the protocol handler. _sending is true while the strand sends data. _sending_data is only modified
+  // while holding _send_mutex, so that writers can determine the number of queued bytes.
+  std::mutex _send_mutex;
+  std::condition_variable _send_queue_drained;
+  std::string _send_queue;
+  std::string _sending_data;
+  bool _sending = false;
+  bool _send_failed = false;
+};
+
+}  // namespace opossum
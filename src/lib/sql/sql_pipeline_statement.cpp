@@ -2,15 +2,24 @@
 
 #include <fstream>
 #include <iomanip>
+#include <unordered_map>
+#include <unordered_set>
 #include <utility>
 
 #include <boost/algorithm/string.hpp>
 
 #include "SQLParser.h"
 #include "create_sql_parser_error_message.hpp"
+#include "expression/abstract_predicate_expression.hpp"
+#include "expression/correlated_parameter_expression.hpp"
+#include "expression/expression_utils.hpp"
+#include "expression/lqp_subquery_expression.hpp"
+#include "expression/placeholder_expression.hpp"
 #include "expression/value_expression.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/lqp_utils.hpp"
+#include "logical_query_plan/predicate_node.hpp"
+#include "logical_query_plan/stored_table_node.hpp"
 #include "operators/export.hpp"
 #include "operators/import.hpp"
 #include "operators/maintenance/create_prepared_plan.hpp"
@@ -22,9 +31,154 @@
 #include "sql/sql_pipeline_builder.hpp"
 #include "sql/sql_plan_cache.hpp"
 #include "sql/sql_translator.hpp"
+#include "statistics/cardinality_estimator.hpp"
+#include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "utils/tracing/probes.hpp"
 
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// The predicates of statements that share an optimized LQP (see LQPCacheKey) are assigned to classes of selectivities
+// that differ by a factor of ten. The last class holds all predicates that select less than 0.1% of their input.
+constexpr auto SELECTIVITY_CLASS_COUNT = uint8_t{4};
+
+uint8_t selectivity_class(const Cardinality input_row_count, const Cardinality output_row_count) {
+  auto class_idx = uint8_t{0};
+  auto class_bound = 0.1f;
+  while (class_idx + 1 < SELECTIVITY_CLASS_COUNT && output_row_count < input_row_count * class_bound) {
+    ++class_idx;
+    class_bound /= 10.0f;
+  }
+  return class_idx;
+}
+
+// Calls `functor(predicate_node, predicate, literal)` for each non-NULL literal that is compared with a non-literal
+// expression by a predicate of a PredicateNode, e.g., `17` in `WHERE id = 17`. Literals in subqueries, in LIKE
+// patterns, and in IN lists are not visited, as the optimizer rewrites predicates based on them. `literal` is a
+// reference to the argument of `predicate`, so that it can be replaced. The order of the calls only depends on the
+// structure of the LQP.
+template <typename Functor>
+void visit_parameterizable_literals(const std::shared_ptr<AbstractLQPNode>& lqp, const Functor& functor) {
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type != LQPNodeType::Predicate) return LQPVisitation::VisitInputs;
+
+    const auto& input = *node->left_input();
+    visit_expression(node->node_expressions[0], [&](auto& expression) {
+      // Expressions that the input provides as columns are not evaluated by this PredicateNode
+      if (input.find_column_id(*expression)) return ExpressionVisitation::DoNotVisitArguments;
+
+      if (expression->type == ExpressionType::Logical) return ExpressionVisitation::VisitArguments;
+      if (expression->type != ExpressionType::Predicate) return ExpressionVisitation::DoNotVisitArguments;
+
+      switch (static_cast<const AbstractPredicateExpression&>(*expression).predicate_condition) {
+        case PredicateCondition::Equals:
+        case PredicateCondition::NotEquals:
+        case PredicateCondition::LessThan:
+        case PredicateCondition::LessThanEquals:
+        case PredicateCondition::GreaterThan:
+        case PredicateCondition::GreaterThanEquals:
+        case PredicateCondition::BetweenInclusive:
+        case PredicateCondition::BetweenLowerExclusive:
+        case PredicateCondition::BetweenUpperExclusive:
+        case PredicateCondition::BetweenExclusive:
+          break;
+        default:
+          return ExpressionVisitation::DoNotVisitArguments;
+      }
+
+      auto& arguments = expression->arguments;
+      const auto compares_non_literal = std::any_of(arguments.begin(), arguments.end(), [](const auto& argument) {
+        return argument->type != ExpressionType::Value;
+      });
+      if (!compares_non_literal) return ExpressionVisitation::DoNotVisitArguments;
+
+      for (auto& argument : arguments) {
+        if (argument->type == ExpressionType::Value &&
+            !variant_is_null(static_cast<const ValueExpression&>(*argument).value)) {
+          functor(node, expression, argument);
+        }
+      }
+
+      return ExpressionVisitation::DoNotVisitArguments;
+    });
+
+    return LQPVisitation::VisitInputs;
+  });
+}
+
+// Returns a ParameterID that is not used in the LQP or in any of its subqueries
+ParameterID unused_parameter_id(const std::shared_ptr<AbstractLQPNode>& lqp) {
+  auto parameter_id = ParameterID{0};
+  const auto use_parameter_id = [&](const ParameterID used_parameter_id) {
+    parameter_id = std::max(parameter_id, ParameterID{static_cast<size_t>(used_parameter_id) + 1});
+  };
+
+  for (const auto& subplan_root : lqp_find_subplan_roots(lqp)) {
+    visit_lqp(subplan_root, [&](const auto& node) {
+      for (const auto& expression : node->node_expressions) {
+        visit_expression(expression, [&](const auto& sub_expression) {
+          if (const auto parameter = std::dynamic_pointer_cast<CorrelatedParameterExpression>(sub_expression)) {
+            use_parameter_id(parameter->parameter_id);
+          } else if (const auto placeholder = std::dynamic_pointer_cast<PlaceholderExpression>(sub_expression)) {
+            use_parameter_id(placeholder->parameter_id);
+          } else if (const auto subquery = std::dynamic_pointer_cast<LQPSubqueryExpression>(sub_expression)) {
+            for (const auto subquery_parameter_id : subquery->parameter_ids) {
+              use_parameter_id(subquery_parameter_id);
+            }
+          }
+          return ExpressionVisitation::VisitArguments;
+        });
+      }
+      return LQPVisitation::VisitInputs;
+    });
+  }
+
+  return parameter_id;
+}
+
+// An optimized LQP can only be shared between statements with different literals if the optimizer did not make any
+// decisions that are only valid for the literals it was optimized with: All literals must still be part of the plan,
+// no chunks must have been pruned, and the literals must only be used by PredicateNodes that are not translated into
+// IndexScans, as only TableScans and PrimaryKeyIndexScans can be bound to parameters.
+bool optimized_lqp_is_parameterizable(const std::shared_ptr<AbstractLQPNode>& lqp,
+                                      const std::vector<std::shared_ptr<AbstractExpression>>& literals) {
+  auto unknown_literals = std::unordered_set<const AbstractExpression*>{};
+  for (const auto& literal : literals) {
+    unknown_literals.emplace(literal.get());
+  }
+  const auto all_literals = unknown_literals;
+
+  auto parameterizable = true;
+  visit_lqp(lqp, [&](const auto& node) {
+    if (node->type == LQPNodeType::StoredTable &&
+        !static_cast<const StoredTableNode&>(*node).pruned_chunk_ids().empty()) {
+      parameterizable = false;
+    }
+
+    const auto can_bind_parameters = node->type == LQPNodeType::Predicate &&
+                                     static_cast<const PredicateNode&>(*node).scan_type != ScanType::IndexScan;
+
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (all_literals.count(sub_expression.get())) {
+          unknown_literals.erase(sub_expression.get());
+          if (!can_bind_parameters) parameterizable = false;
+          return ExpressionVisitation::DoNotVisitArguments;
+        }
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+
+    return parameterizable ? LQPVisitation::VisitInputs : LQPVisitation::DoNotVisitInputs;
+  });
+
+  return parameterizable && unknown_literals.empty();
+}
+
+}  // namespace
+
 namespace opossum {
 
 SQLPipelineStatement::SQLPipelineStatement(const std::string& sql, std::shared_ptr<hsql::SQLParserResult> parsed_sql,
@@ -104,23 +258,71 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
     return _optimized_logical_plan;
   }
 
-  // Handle logical query plan if statement has been cached
-  if (lqp_cache) {
-    if (const auto cached_plan = lqp_cache->try_get(_sql_string)) {
-      const auto plan = *cached_plan;
-      DebugAssert(plan, "Optimized logical query plan retrieved from cache is empty.");
-      // MVCC-enabled and MVCC-disabled LQPs will evict each other
-      if (lqp_is_validated(plan) == (_use_mvcc == UseMvcc::Yes)) {
-        // Copy the LQP for reuse as the LQPTranslator might modify mutable fields (e.g., cached column_expressions)
-        // and concurrent translations might conflict.
-        _optimized_logical_plan = plan->deep_copy();
+  auto unoptimized_lqp = get_unoptimized_logical_plan();
+
+  // Look up the optimized LQP of a statement with the same unoptimized LQP, apart from the literals of the predicates
+  // (see LQPCacheKey). `literals` are the literals of the unoptimized LQP that are replaced by `parameters` in the key.
+  auto cache_key = std::optional<LQPCacheKey>{};
+  auto literals = std::vector<std::shared_ptr<AbstractExpression>>{};
+  auto parameters = std::vector<std::shared_ptr<AbstractExpression>>{};
+  if (lqp_cache && _translation_info.cacheable) {
+    visit_parameterizable_literals(unoptimized_lqp, [&](const auto& node, const auto& predicate, auto& literal) {
+      literals.emplace_back(literal);
+    });
+
+    cache_key.emplace();
+    cache_key->lqp = unoptimized_lqp->deep_copy();
+    auto parameter_id = unused_parameter_id(unoptimized_lqp);
+    visit_parameterizable_literals(cache_key->lqp, [&](const auto& node, const auto& predicate, auto& literal) {
+      const auto& value = static_cast<const ValueExpression&>(*literal).value;
+      literal = std::make_shared<CorrelatedParameterExpression>(
+          parameter_id, CorrelatedParameterExpression::ReferencedExpressionInfo{literal->data_type(), "?"});
+      parameters.emplace_back(literal);
+      cache_key->literals.emplace_back(value);
+      _parameters.emplace(parameter_id, value);
+      ++parameter_id;
+    });
+
+    // The plan might have been cached for exactly these literals...
+    if (const auto cached_plan = lqp_cache->try_get(*cache_key)) {
+      DebugAssert(*cached_plan, "Optimized logical query plan retrieved from cache is empty.");
+      // Copy the LQP for reuse as the LQPTranslator might modify mutable fields (e.g., cached column_expressions)
+      // and concurrent translations might conflict.
+      _optimized_logical_plan = (*cached_plan)->deep_copy();
+      _parameters.clear();
+      return _optimized_logical_plan;
+    }
+
+    // ...or for all literals whose predicates have the same selectivity classes. Each predicate is estimated on its
+    // input in the unoptimized LQP, so that the estimation does not depend on the order the optimizer chooses.
+    if (!literals.empty()) {
+      const auto cardinality_estimator = CardinalityEstimator{};
+      auto predicate_classes = std::unordered_map<std::shared_ptr<AbstractExpression>, uint8_t>{};
+      visit_parameterizable_literals(unoptimized_lqp, [&](const auto& node, const auto& predicate, auto& literal) {
+        auto predicate_class_iter = predicate_classes.find(predicate);
+        if (predicate_class_iter == predicate_classes.end()) {
+          const auto& input = node->left_input();
+          const auto input_statistics = cardinality_estimator.estimate_statistics(input);
+          const auto output_statistics =
+              CardinalityEstimator::estimate_predicate_node(*PredicateNode::make(predicate, input), input_statistics);
+          predicate_class_iter =
+              predicate_classes
+                  .emplace(predicate, selectivity_class(input_statistics->row_count, output_statistics->row_count))
+                  .first;
+        }
+        cache_key->selectivity_classes.emplace_back(predicate_class_iter->second);
+      });
+      cache_key->literals.clear();
+
+      if (const auto cached_plan = lqp_cache->try_get(*cache_key)) {
+        DebugAssert(*cached_plan, "Optimized logical query plan retrieved from cache is empty.");
+        // The literals of this statement are bound to the parameters of the cached plan in get_physical_plan()
+        _optimized_logical_plan = (*cached_plan)->deep_copy();
         return _optimized_logical_plan;
       }
     }
   }
 
-  auto unoptimized_lqp = get_unoptimized_logical_plan();
-
   const auto started = std::chrono::high_resolution_clock::now();
 
   // The optimizer works on the original unoptimized LQP nodes. After optimizing, the unoptimized version is also
@@ -128,16 +330,53 @@ const std::shared_ptr<AbstractLQPNode>& SQLPipelineStatement::get_optimized_logi
   // As the unoptimized LQP is only used for visualization, we can afford to recreate it if necessary.
   _unoptimized_logical_plan = nullptr;
 
-  _optimized_logical_plan = _optimizer->optimize(std::move(unoptimized_lqp));
+  auto optimized_lqp = _optimizer->optimize(std::move(unoptimized_lqp));
 
   const auto done = std::chrono::high_resolution_clock::now();
   _metrics->optimization_duration = std::chrono::duration_cast<std::chrono::nanoseconds>(done - started);
 
   // Cache newly created plan for the according sql statement
-  if (lqp_cache && _translation_info.cacheable) {
-    lqp_cache->set(_sql_string, _optimized_logical_plan);
+  if (cache_key) {
+    if (!literals.empty() && optimized_lqp_is_parameterizable(optimized_lqp, literals)) {
+      // The optimizer was given the actual literals. In the plan that is shared with other statements, they are
+      // replaced by the parameters of the cache key. This statement uses a copy that still contains its literals.
+      _optimized_logical_plan = optimized_lqp->deep_copy();
+
+      auto parameter_by_literal = std::unordered_map<const AbstractExpression*, std::shared_ptr<AbstractExpression>>{};
+      for (auto literal_idx = size_t{0}; literal_idx < literals.size(); ++literal_idx) {
+        parameter_by_literal.emplace(literals[literal_idx].get(), parameters[literal_idx]);
+      }
+
+      visit_lqp(optimized_lqp, [&](const auto& node) {
+        for (auto& expression : node->node_expressions) {
+          visit_expression(expression, [&](auto& sub_expression) {
+            const auto parameter_iter = parameter_by_literal.find(sub_expression.get());
+            if (parameter_iter == parameter_by_literal.end()) return ExpressionVisitation::VisitArguments;
+            sub_expression = parameter_iter->second->deep_copy();
+            return ExpressionVisitation::DoNotVisitArguments;
+          });
+        }
+        return LQPVisitation::VisitInputs;
+      });
+
+      lqp_cache->set(*cache_key, optimized_lqp);
+    } else {
+      _optimized_logical_plan = optimized_lqp;
+
+      cache_key->selectivity_classes.clear();
+      cache_key->literals.clear();
+      for (const auto& literal : literals) {
+        cache_key->literals.emplace_back(static_cast<const ValueExpression&>(*literal).value);
+      }
+      lqp_cache->set(*cache_key, _optimized_logical_plan);
+    }
+  } else {
+    _optimized_logical_plan = optimized_lqp;
   }
 
+  // This statement's plan contains its literals, there is nothing to bind
+  _parameters.clear();
+
   return _optimized_logical_plan;
 }
 
@@ -176,6 +415,9 @@ const std::shared_ptr<AbstractOperator>& SQLPipelineStatement::get_physical_plan
     // Reset time to exclude previous pipeline steps
     started = std::chrono::high_resolution_clock::now();
     _physical_plan = LQPTranslator{}.translate_node(lqp);
+
+    // If the optimized LQP is shared with other statements, it contains parameters instead of our literals
+    if (!_parameters.empty()) _physical_plan->set_parameters(_parameters);
   }
 
   done = std::chrono::high_resolution_clock::now();
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <string>
+#include <unordered_map>
 
 #include "SQLParserResult.h"
 #include "cache/cache.hpp"
@@ -44,6 +45,11 @@ enum class SQLPipelineStatus {
  *  If a physical plan for an SQL statement is in the SQLPhysicalPlanCache, it will be used instead of translating the
  *  optimized LQP (get_optimized_logical_plans()) into a PQP. Thus, in this case, the optimized LQP and PQP could be
  *  different.
+ *
+ * NOTE:
+ *  The SQLLogicalPlanCache shares optimized LQPs between statements that only differ in the literals of their
+ *  predicates (see LQPCacheKey). If the optimized LQP was retrieved from such a shared plan, it contains parameters in
+ *  place of these literals. The literals of the statement are bound to the parameters of the PQP.
  */
 class SQLPipelineStatement : public Noncopyable {
  public:
@@ -121,6 +127,9 @@ class SQLPipelineStatement : public Noncopyable {
   bool _query_has_output{true};
   TranslationInfo _translation_info;
 
+  // Literals of the statement that are bound to the parameters of an optimized LQP shared with other statements
+  std::unordered_map<ParameterID, AllTypeVariant> _parameters;
+
   std::shared_ptr<SQLPipelineStatementMetrics> _metrics;
 
   // Delete temporary tables
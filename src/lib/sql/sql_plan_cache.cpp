@@ -0,0 +1,26 @@
+#include "sql_plan_cache.hpp"
+
+#include "boost/functional/hash.hpp"
+
+#include "logical_query_plan/abstract_lqp_node.hpp"
+
+namespace opossum {
+
+bool LQPCacheKey::operator==(const LQPCacheKey& rhs) const {
+  return literals == rhs.literals && selectivity_classes == rhs.selectivity_classes && *lqp == *rhs.lqp;
+}
+
+}  // namespace opossum
+
+namespace std {
+
+size_t hash<opossum::LQPCacheKey>::operator()(const opossum::LQPCacheKey& key) const {
+  auto hash = key.lqp->hash();
+  for (const auto& literal : key.literals) {
+    boost::hash_combine(hash, std::hash<opossum::AllTypeVariant>{}(literal));
+  }
+  boost::hash_range(hash, key.selectivity_classes.begin(), key.selectivity_classes.end());
+  return hash;
+}
+
+}  // namespace std
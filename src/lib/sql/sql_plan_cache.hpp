@@ -2,7 +2,9 @@
 
 #include <memory>
 #include <string>
+#include <vector>
 
+#include "all_type_variant.hpp"
 #include "cache/cache.hpp"
 
 namespace opossum {
@@ -10,7 +12,40 @@ namespace opossum {
 class AbstractOperator;
 class AbstractLQPNode;
 
+/**
+ * Key of the SQLLogicalPlanCache, created by the SQLPipelineStatement from the unoptimized LQP of a statement.
+ *
+ * To share optimized plans between statements that only differ in the literals of their predicates (e.g., `WHERE
+ * id = 17` and `WHERE id = 18`), the literals that are compared with a column are replaced by parameters in `lqp`. An
+ * optimized plan is cached either
+ *  - with the literals replaced by the same parameters, so that it is used for all statements with the same `lqp` whose
+ *    predicates fall into the same `selectivity_classes`. The parameters are bound to the literals of each statement
+ *    that uses the plan. Or,
+ *  - if the optimizer made decisions that are only valid for the literals of the statement (e.g., it pruned chunks),
+ *    for these `literals` only.
+ */
+struct LQPCacheKey {
+  std::shared_ptr<AbstractLQPNode> lqp;
+
+  // Values of the parameters of `lqp`, empty if the plan is cached for all literals
+  std::vector<AllTypeVariant> literals;
+
+  // Selectivity class of each parameterized predicate, empty if the plan is cached for specific literals
+  std::vector<uint8_t> selectivity_classes;
+
+  bool operator==(const LQPCacheKey& rhs) const;
+};
+
 using SQLPhysicalPlanCache = Cache<std::shared_ptr<AbstractOperator>, std::string>;
-using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, std::string>;
+using SQLLogicalPlanCache = Cache<std::shared_ptr<AbstractLQPNode>, LQPCacheKey>;
 
 }  // namespace opossum
+
+namespace std {
+
+template <>
+struct hash<opossum::LQPCacheKey> {
+  size_t operator()(const opossum::LQPCacheKey& key) const;
+};
+
+}  // namespace std
@@ -90,9 +90,13 @@ EqualDistinctCountHistogram<T>::EqualDistinctCountHistogram(std::vector<T>&& bin
 template <typename T>
 std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_column(
     const Table& table, const ColumnID column_id, const BinID max_bin_count, const HistogramDomain<T>& domain) {
-  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
+  return from_distribution(value_distribution_from_column(table, column_id, domain), max_bin_count);
+}
 
-  const auto value_distribution = value_distribution_from_column(table, column_id, domain);
+template <typename T>
+std::shared_ptr<EqualDistinctCountHistogram<T>> EqualDistinctCountHistogram<T>::from_distribution(
+    std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count) {
+  Assert(max_bin_count > 0, "max_bin_count must be greater than zero ");
 
   if (value_distribution.empty()) {
     return nullptr;
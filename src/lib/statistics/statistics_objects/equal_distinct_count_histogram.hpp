@@ -36,6 +36,14 @@ class EqualDistinctCountHistogram : public AbstractHistogram<T> {
                                                                      const BinID max_bin_count,
                                                                      const HistogramDomain<T>& domain = {});
 
+  /**
+   * Create an EqualDistinctCountHistogram from the occurrence counts of the distinct values, sorted by value
+   * @param max_bin_count   Desired number of bins. Less might be created, but never more. Must not be zero.
+   * @return                nullptr if value_distribution is empty
+   */
+  static std::shared_ptr<EqualDistinctCountHistogram<T>> from_distribution(
+      std::vector<std::pair<T, HistogramCountType>>&& value_distribution, const BinID max_bin_count);
+
   std::string name() const override;
   std::shared_ptr<AbstractHistogram<T>> clone() const override;
   HistogramCountType total_distinct_count() const override;
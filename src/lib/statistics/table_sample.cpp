@@ -0,0 +1,404 @@
+#include "table_sample.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <random>
+#include <tuple>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include "attribute_statistics.hpp"
+#include "hyrise.hpp"
+#include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
+#include "statistics/statistics_objects/equal_distinct_count_histogram.hpp"
+#include "statistics/statistics_objects/generic_histogram.hpp"
+#include "statistics/statistics_objects/null_value_ratio_statistics.hpp"
+#include "storage/segment_iterate.hpp"
+#include "storage/table.hpp"
+#include "table_statistics.hpp"
+#include "utils/assert.hpp"
+
+namespace {
+
+using namespace opossum;  // NOLINT
+
+// Number of times a distinct value occurs in the sample and the number of rows of the table it stands for
+struct SampledValueCount {
+  size_t sample_count{0};
+  HistogramCountType estimated_count{0};
+};
+
+/**
+ * Builds a histogram with bins of (about) the same number of distinct sampled values, like the
+ * EqualDistinctCountHistogram. As the number of distinct values in the table differs per bin, a GenericHistogram is
+ * returned.
+ */
+template <typename T>
+std::shared_ptr<GenericHistogram<T>> histogram_from_sample(
+    const std::vector<std::pair<T, SampledValueCount>>& value_distribution, const BinID max_bin_count) {
+  const auto bin_count = std::min(static_cast<BinID>(value_distribution.size()), max_bin_count);
+  const auto distinct_count_per_bin = value_distribution.size() / bin_count;
+  const auto bin_count_with_extra_value = value_distribution.size() % bin_count;
+
+  auto bin_minima = std::vector<T>(bin_count);
+  auto bin_maxima = std::vector<T>(bin_count);
+  auto bin_heights = std::vector<HistogramCountType>(bin_count);
+  auto bin_distinct_counts = std::vector<HistogramCountType>(bin_count);
+
+  auto begin_value_idx = size_t{0};
+  for (auto bin_idx = BinID{0}; bin_idx < bin_count; ++bin_idx) {
+    const auto end_value_idx =
+        begin_value_idx + distinct_count_per_bin + (bin_idx < bin_count_with_extra_value ? 1 : 0);
+
+    auto sample_count = size_t{0};
+    auto height = HistogramCountType{0};
+    auto singleton_count = size_t{0};
+    for (auto value_idx = begin_value_idx; value_idx < end_value_idx; ++value_idx) {
+      const auto& value_count = value_distribution[value_idx].second;
+      sample_count += value_count.sample_count;
+      height += value_count.estimated_count;
+      if (value_count.sample_count == 1) ++singleton_count;
+    }
+
+    // GEE estimator: Values that occur more than once in the sample are likely to be all there is of them. Each value
+    // that occurs only once stands for sqrt(height / sample_count) distinct values.
+    const auto sample_distinct_count = static_cast<HistogramCountType>(end_value_idx - begin_value_idx);
+    const auto estimated_distinct_count = std::sqrt(height / static_cast<HistogramCountType>(sample_count)) *
+                                              static_cast<HistogramCountType>(singleton_count) +
+                                          sample_distinct_count - static_cast<HistogramCountType>(singleton_count);
+
+    bin_minima[bin_idx] = value_distribution[begin_value_idx].first;
+    bin_maxima[bin_idx] = value_distribution[end_value_idx - 1].first;
+    bin_heights[bin_idx] = height;
+    bin_distinct_counts[bin_idx] = std::max(std::min(estimated_distinct_count, height), sample_distinct_count);
+
+    begin_value_idx = end_value_idx;
+  }
+
+  return std::make_shared<GenericHistogram<T>>(std::move(bin_minima), std::move(bin_maxima), std::move(bin_heights),
+                                               std::move(bin_distinct_counts));
+}
+
+}  // namespace
+
+namespace opossum {
+
+/**
+ * Type-erased sample of the values of one column, kept per chunk
+ */
+class BaseColumnSample {
+ public:
+  virtual ~BaseColumnSample() = default;
+
+  // Replaces the sample of a chunk with the values at the given positions, or with the first chunk_size values if
+  // positions is nullptr. The segment of a mutable chunk might have grown since chunk_size was determined.
+  virtual void sample_chunk(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset chunk_size,
+                            const std::shared_ptr<const PosList>& positions) = 0;
+
+  virtual void remove_chunk(const ChunkID chunk_id) = 0;
+
+  // @param chunk_weights   Number of rows of the table that each sampled row of a chunk stands for
+  virtual std::shared_ptr<BaseAttributeStatistics> attribute_statistics(
+      const std::vector<HistogramCountType>& chunk_weights, const Cardinality row_count,
+      const BinID max_bin_count) const = 0;
+};
+
+template <typename T>
+class ColumnSample : public BaseColumnSample {
+ public:
+  void sample_chunk(const ChunkID chunk_id, const BaseSegment& segment, const ChunkOffset chunk_size,
+                    const std::shared_ptr<const PosList>& positions) override {
+    if (static_cast<size_t>(chunk_id) >= _values.size()) _values.resize(chunk_id + 1);
+
+    auto& values = _values[chunk_id];
+    values.clear();
+
+    const auto add_value = [&](const auto& position) {
+      if (!position.is_null()) values.emplace_back(position.value());
+    };
+
+    if (positions) {
+      values.reserve(positions->size());
+      segment_iterate_filtered<T>(segment, positions, add_value);
+    } else {
+      values.reserve(chunk_size);
+      segment_with_iterators<T>(segment, [&](auto it, const auto end) {
+        DebugAssert(std::distance(it, end) >= static_cast<std::ptrdiff_t>(chunk_size), "Segment shrank");
+        const auto sampled_end = it + chunk_size;
+        for (; it != sampled_end; ++it) add_value(*it);
+      });
+    }
+    values.shrink_to_fit();
+  }
+
+  void remove_chunk(const ChunkID chunk_id) override {
+    if (static_cast<size_t>(chunk_id) >= _values.size()) return;
+
+    _values[chunk_id] = {};
+  }
+
+  std::shared_ptr<BaseAttributeStatistics> attribute_statistics(const std::vector<HistogramCountType>& chunk_weights,
+                                                                const Cardinality row_count,
+                                                                const BinID max_bin_count) const override {
+    const auto domain = HistogramDomain<T>{};
+    auto value_counts = std::unordered_map<T, SampledValueCount>{};
+    auto is_complete_sample = true;
+
+    for (auto chunk_id = ChunkID{0}; chunk_id < _values.size(); ++chunk_id) {
+      if (_values[chunk_id].empty()) continue;
+
+      const auto weight = chunk_weights[chunk_id];
+      if (weight != 1.0f) is_complete_sample = false;
+
+      for (const auto& value : _values[chunk_id]) {
+        auto& value_count = [&]() -> SampledValueCount& {
+          // NOLINTNEXTLINE clang-tidy is crazy and sees a "potentially unintended semicolon" here...
+          if constexpr (std::is_same_v<T, pmr_string>) {
+            // Do "contains()" check first to avoid the string copy incurred by string_to_domain() where possible
+            if (!domain.contains(value)) return value_counts[domain.string_to_domain(value)];
+          }
+          return value_counts[value];
+        }();
+
+        ++value_count.sample_count;
+        value_count.estimated_count += weight;
+      }
+    }
+
+    const auto output_column_statistics = std::make_shared<AttributeStatistics<T>>();
+
+    if (value_counts.empty()) {
+      // The column contains only NULLs or the table is empty
+      output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(1.0f));
+      return output_column_statistics;
+    }
+
+    auto histogram = std::shared_ptr<AbstractHistogram<T>>{};
+    if (is_complete_sample) {
+      auto value_distribution = std::vector<std::pair<T, HistogramCountType>>{};
+      value_distribution.reserve(value_counts.size());
+      for (const auto& [value, value_count] : value_counts) {
+        value_distribution.emplace_back(value, value_count.estimated_count);
+      }
+      std::sort(value_distribution.begin(), value_distribution.end(),
+                [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+      histogram = EqualDistinctCountHistogram<T>::from_distribution(std::move(value_distribution), max_bin_count);
+    } else {
+      auto value_distribution =
+          std::vector<std::pair<T, SampledValueCount>>{value_counts.begin(), value_counts.end()};
+      std::sort(value_distribution.begin(), value_distribution.end(),
+                [&](const auto& lhs, const auto& rhs) { return lhs.first < rhs.first; });
+
+      histogram = histogram_from_sample(value_distribution, max_bin_count);
+    }
+    output_column_statistics->set_statistics_object(histogram);
+
+    // Use the insight that the histogram will only contain non-null values to generate the NullValueRatio property
+    const auto null_value_ratio = std::max(0.0f, 1.0f - histogram->total_count() / row_count);
+    output_column_statistics->set_statistics_object(std::make_shared<NullValueRatioStatistics>(null_value_ratio));
+
+    return output_column_statistics;
+  }
+
+ protected:
+  // Sampled non-NULL values per chunk. The number of NULLs follows from the number of rows the sample represents.
+  std::vector<std::vector<T>> _values;
+};
+
+TableSample::TableSample(const Table& table, const size_t target_row_count)
+    : _target_row_count(target_row_count),
+      _sampling_rate(std::min(1.0, static_cast<double>(target_row_count) /
+                                       static_cast<double>(std::max(table.row_count(), uint64_t{1})))) {
+  Assert(_target_row_count > 0, "Target row count must be greater than zero");
+  Assert(table.type() == TableType::Data, "Only data tables can be sampled");
+
+  const auto column_count = table.column_count();
+  _column_samples.reserve(column_count);
+  for (auto column_id = ColumnID{0}; column_id < column_count; ++column_id) {
+    resolve_data_type(table.column_data_type(column_id), [&](const auto data_type_t) {
+      using ColumnDataType = typename decltype(data_type_t)::type;
+      _column_samples.emplace_back(std::make_shared<ColumnSample<ColumnDataType>>());
+    });
+  }
+
+  update(table);
+}
+
+TableSample::~TableSample() = default;
+
+bool TableSample::update(const Table& table) {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  auto is_changed = false;
+
+  const auto table_row_count = table.row_count();
+  if (static_cast<double>(table_row_count) * _sampling_rate > 2.0 * static_cast<double>(_target_row_count)) {
+    _sampling_rate = static_cast<double>(_target_row_count) / static_cast<double>(table_row_count);
+    for (auto& sampled_chunk : _sampled_chunks) {
+      if (sampled_chunk) sampled_chunk->chunk_size = 0;
+    }
+  }
+
+  // Determine which rows of which chunks are sampled. The values are then sampled in parallel for each column.
+  auto chunks_to_sample = std::vector<std::tuple<ChunkID, ChunkOffset, std::shared_ptr<const PosList>>>{};
+
+  const auto chunk_count = table.chunk_count();
+  _sampled_chunks.resize(chunk_count);
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = table.get_chunk(chunk_id);
+    auto& sampled_chunk = _sampled_chunks[chunk_id];
+
+    if (!chunk) {
+      if (sampled_chunk) {
+        for (const auto& column_sample : _column_samples) {
+          column_sample->remove_chunk(chunk_id);
+        }
+        sampled_chunk.reset();
+        is_changed = true;
+      }
+      continue;
+    }
+
+    // Chunks only have to be sampled again if they grew, had rows that were not committed yet, or had rows invalidated
+    // since they were sampled. The invalid row count is read before the MVCC data, so that a Delete committing in
+    // between is noticed by the next update.
+    const auto chunk_size = chunk->size();
+    const auto invalid_row_count = chunk->invalid_row_count();
+    if (sampled_chunk && sampled_chunk->chunk_size == chunk_size && sampled_chunk->pending_row_count == 0 &&
+        sampled_chunk->invalid_row_count == invalid_row_count) {
+      continue;
+    }
+
+    // Rows are only sampled if their Insert has committed (before that, they might not even be written yet) and they
+    // have not been deleted or rolled back
+    const auto mvcc_data = chunk->mvcc_data();
+    const auto is_pending = [&](const ChunkOffset chunk_offset) {
+      return mvcc_data->get_begin_cid(chunk_offset) == MvccData::MAX_COMMIT_ID &&
+             mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID;
+    };
+    const auto is_live = [&](const ChunkOffset chunk_offset) {
+      return !mvcc_data || (mvcc_data->get_begin_cid(chunk_offset) != MvccData::MAX_COMMIT_ID &&
+                            mvcc_data->get_end_cid(chunk_offset) == MvccData::MAX_COMMIT_ID);
+    };
+
+    auto row_count = chunk_size;
+    auto pending_row_count = ChunkOffset{0};
+    if (mvcc_data) {
+      row_count = 0;
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        if (is_live(chunk_offset)) {
+          ++row_count;
+        } else if (is_pending(chunk_offset)) {
+          ++pending_row_count;
+        }
+      }
+    }
+
+    auto positions = std::shared_ptr<PosList>{};
+    const auto add_position = [&](const ChunkOffset chunk_offset) {
+      if (is_live(chunk_offset)) positions->emplace_back(RowID{chunk_id, chunk_offset});
+    };
+
+    const auto target_sample_row_count =
+        static_cast<ChunkOffset>(std::ceil(static_cast<double>(chunk_size) * _sampling_rate));
+    if (target_sample_row_count < chunk_size) {
+      // Take one block of consecutive rows from each of the equally sized strata of the chunk. Seed the random engine
+      // with the ChunkID, so that the same table always gets the same statistics.
+      positions = std::make_shared<PosList>();
+      positions->reserve(target_sample_row_count);
+
+      const auto block_count = (target_sample_row_count + BLOCK_SIZE - 1) / BLOCK_SIZE;
+      const auto stratum_size = static_cast<ChunkOffset>(chunk_size / block_count);
+      auto random_engine = std::mt19937{chunk_id};
+
+      auto remaining_row_count = target_sample_row_count;
+      for (auto block_idx = ChunkOffset{0}; block_idx < block_count; ++block_idx) {
+        const auto block_size = std::min({BLOCK_SIZE, remaining_row_count, stratum_size});
+        const auto stratum_begin = static_cast<ChunkOffset>(block_idx * stratum_size);
+        const auto block_begin = static_cast<ChunkOffset>(
+            stratum_begin + std::uniform_int_distribution<ChunkOffset>{0, stratum_size - block_size}(random_engine));
+
+        for (auto chunk_offset = block_begin; chunk_offset < block_begin + block_size; ++chunk_offset) {
+          add_position(chunk_offset);
+        }
+        remaining_row_count -= block_size;
+      }
+    } else if (row_count < chunk_size) {
+      positions = std::make_shared<PosList>();
+      positions->reserve(row_count);
+      for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; ++chunk_offset) {
+        add_position(chunk_offset);
+      }
+    }
+
+    if (positions) positions->guarantee_single_chunk();
+
+    const auto sample_row_count = positions ? static_cast<ChunkOffset>(positions->size()) : chunk_size;
+    sampled_chunk = SampledChunk{chunk_size, invalid_row_count, pending_row_count, row_count, sample_row_count};
+    chunks_to_sample.emplace_back(chunk_id, chunk_size, std::move(positions));
+    is_changed = true;
+  }
+
+  if (chunks_to_sample.empty()) return is_changed;
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_column_samples.size());
+  for (auto column_id = ColumnID{0}; column_id < _column_samples.size(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      for (const auto& [chunk_id, chunk_size, positions] : chunks_to_sample) {
+        // A chunk that was removed in the meantime is dropped from the sample by the next update
+        const auto chunk = table.get_chunk(chunk_id);
+        if (!chunk) continue;
+
+        _column_samples[column_id]->sample_chunk(chunk_id, *chunk->get_segment(column_id), chunk_size,
+                                                 positions);
+      }
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return true;
+}
+
+std::shared_ptr<TableStatistics> TableSample::table_statistics() const {
+  const auto lock = std::lock_guard<std::mutex>{_mutex};
+
+  auto row_count = size_t{0};
+  auto chunk_weights = std::vector<HistogramCountType>(_sampled_chunks.size());
+  for (auto chunk_id = ChunkID{0}; chunk_id < _sampled_chunks.size(); ++chunk_id) {
+    const auto& sampled_chunk = _sampled_chunks[chunk_id];
+    if (!sampled_chunk) continue;
+
+    row_count += sampled_chunk->row_count;
+    if (sampled_chunk->sample_row_count > 0) {
+      chunk_weights[chunk_id] = static_cast<HistogramCountType>(sampled_chunk->row_count) /
+                                static_cast<HistogramCountType>(sampled_chunk->sample_row_count);
+    }
+  }
+
+  /**
+   * Determine bin count, within mostly arbitrarily chosen bounds: 5 (for tables with <=2k rows) up to 100 bins
+   * (for tables with >= 200m rows) are created.
+   */
+  const auto histogram_bin_count = std::min<size_t>(100, std::max<size_t>(5, row_count / 2'000));
+
+  auto column_statistics = std::vector<std::shared_ptr<BaseAttributeStatistics>>(_column_samples.size());
+
+  auto jobs = std::vector<std::shared_ptr<AbstractTask>>{};
+  jobs.reserve(_column_samples.size());
+  for (auto column_id = ColumnID{0}; column_id < _column_samples.size(); ++column_id) {
+    jobs.emplace_back(std::make_shared<JobTask>([&, column_id]() {
+      column_statistics[column_id] = _column_samples[column_id]->attribute_statistics(
+          chunk_weights, static_cast<Cardinality>(row_count), histogram_bin_count);
+    }));
+  }
+  Hyrise::get().scheduler()->schedule_and_wait_for_tasks(jobs);
+
+  return std::make_shared<TableStatistics>(std::move(column_statistics), static_cast<Cardinality>(row_count));
+}
+
+}  // namespace opossum
@@ -0,0 +1,74 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseColumnSample;
+class Table;
+class TableStatistics;
+
+/**
+ * Sample of the rows of a Table from which its TableStatistics are built (see TableStatistics::from_table() and
+ * Table::maintain_table_statistics()).
+ *
+ * Building the histograms from all rows of a table stalls adding large tables. Instead, blocks of consecutive rows are
+ * sampled from equally sized strata of each chunk, so that about `target_row_count` rows of the table are sampled.
+ * Tables with up to `target_row_count` rows are sampled completely, so their statistics are exact. For tables that are
+ * actually sampled, the bin heights are scaled up and the distinct counts per bin are estimated with the GEE estimator
+ * (Charikar et al., "Towards Estimation Error Guarantees for Distinct Values", PODS 2000).
+ *
+ * The sample is kept per chunk so that it can be maintained incrementally: update() only samples the chunks that were
+ * added, that grew, or that had rows invalidated since the last update, and drops the samples of removed chunks. Only
+ * rows whose inserting transaction has committed and that have not been deleted by a committed transaction are
+ * sampled. When the table has grown so much that the sample exceeds twice the target row count, the sampling rate is
+ * reduced and all chunks are sampled anew.
+ */
+class TableSample : private Noncopyable {
+ public:
+  static constexpr auto DEFAULT_TARGET_ROW_COUNT = size_t{100'000};
+
+  // Rows are sampled in blocks of this many consecutive rows, which is cheaper than sampling single rows
+  static constexpr auto BLOCK_SIZE = ChunkOffset{32};
+
+  explicit TableSample(const Table& table, const size_t target_row_count = DEFAULT_TARGET_ROW_COUNT);
+  ~TableSample();
+
+  // Samples the chunks that were added or modified since the last update and drops the samples of removed chunks.
+  // Returns whether the sample changed.
+  bool update(const Table& table);
+
+  // Builds the statistics from the samples of all chunks
+  std::shared_ptr<TableStatistics> table_statistics() const;
+
+ protected:
+  struct SampledChunk {
+    // Size of the chunk and its invalid row count when it was sampled
+    ChunkOffset chunk_size;
+    ChunkOffset invalid_row_count;
+
+    // Number of rows whose inserting transaction had not committed yet when the chunk was sampled
+    ChunkOffset pending_row_count;
+
+    // Number of rows that the sample represents, i.e., the committed rows that had not been deleted when the chunk was
+    // sampled
+    ChunkOffset row_count;
+
+    ChunkOffset sample_row_count;
+  };
+
+  const size_t _target_row_count;
+  double _sampling_rate;
+
+  std::vector<std::optional<SampledChunk>> _sampled_chunks;
+  std::vector<std::shared_ptr<BaseColumnSample>> _column_samples;
+
+  mutable std::mutex _mutex;
+};
+
+}  // namespace opossum
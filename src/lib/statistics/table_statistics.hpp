@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "all_type_variant.hpp"
+#include "table_sample.hpp"
 
 namespace opossum {
 
@@ -21,10 +22,11 @@ class Table;
 class TableStatistics {
  public:
   /**
-   * Creates statistics objects for cardinality estimation for all Columns in @param table. See implementation for
-   * which statistics objects are created.
+   * Creates statistics objects for cardinality estimation for all Columns in @param table from a sample of about
+   * @param target_sample_row_count rows. See TableSample for which statistics objects are created.
    */
-  static std::shared_ptr<TableStatistics> from_table(const Table& table);
+  static std::shared_ptr<TableStatistics> from_table(
+      const Table& table, const size_t target_sample_row_count = TableSample::DEFAULT_TARGET_ROW_COUNT);
 
   TableStatistics(std::vector<std::shared_ptr<BaseAttributeStatistics>>&& init_column_statistics,
                   const Cardinality init_row_count);
@@ -9,8 +9,11 @@
 #include <utility>
 #include <vector>
 
+#include "base_dictionary_segment.hpp"
 #include "base_segment.hpp"
 #include "index/abstract_index.hpp"
+#include "index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "index/adaptive_radix_tree/mutable_adaptive_radix_tree_index.hpp"
 #include "reference_segment.hpp"
 #include "resolve_type.hpp"
 #include "utils/assert.hpp"
@@ -19,7 +22,9 @@ namespace opossum {
 
 Chunk::Chunk(Segments segments, const std::shared_ptr<MvccData>& mvcc_data,
              const std::optional<PolymorphicAllocator<Chunk>>& alloc, Indexes indexes)
-    : _segments(std::move(segments)), _mvcc_data(mvcc_data), _indexes(std::move(indexes)) {
+    : _segments(std::move(segments)),
+      _mvcc_data(mvcc_data),
+      _indexes(std::make_shared<const Indexes>(std::move(indexes))) {
   DebugAssert(!_segments.empty(),
               "Chunks without Segments are not legal, as the row count of such a Chunk cannot be determined");
 
@@ -66,6 +71,9 @@ void Chunk::append(const std::vector<AllTypeVariant>& values) {
     DebugAssert(base_value_segment, "Can't append to segment that is not a ValueSegment");
     base_value_segment->append(*value_it);
   }
+
+  const auto chunk_offset = static_cast<ChunkOffset>(size() - 1);
+  insert_into_mutable_indexes(chunk_offset, chunk_offset + 1);
 }
 
 std::shared_ptr<BaseSegment> Chunk::get_segment(ColumnID column_id) const {
@@ -86,8 +94,9 @@ std::shared_ptr<MvccData> Chunk::mvcc_data() const { return _mvcc_data; }
 
 std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(
     const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
+  const auto indexes = std::atomic_load(&_indexes);
   auto result = std::vector<std::shared_ptr<AbstractIndex>>();
-  std::copy_if(_indexes.cbegin(), _indexes.cend(), std::back_inserter(result),
+  std::copy_if(indexes->cbegin(), indexes->cend(), std::back_inserter(result),
                [&](const auto& index) { return index->is_index_for(segments); });
   return result;
 }
@@ -117,11 +126,12 @@ std::vector<std::shared_ptr<AbstractIndex>> Chunk::get_indexes(const std::vector
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_type,
                                                 const std::vector<std::shared_ptr<const BaseSegment>>& segments) const {
-  auto index_it = std::find_if(_indexes.cbegin(), _indexes.cend(), [&](const auto& index) {
+  const auto indexes = std::atomic_load(&_indexes);
+  auto index_it = std::find_if(indexes->cbegin(), indexes->cend(), [&](const auto& index) {
     return index->is_index_for(segments) && index->type() == index_type;
   });
 
-  return (index_it == _indexes.cend()) ? nullptr : *index_it;
+  return (index_it == indexes->cend()) ? nullptr : *index_it;
 }
 
 std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_type,
@@ -131,9 +141,97 @@ std::shared_ptr<AbstractIndex> Chunk::get_index(const SegmentIndexType index_typ
 }
 
 void Chunk::remove_index(const std::shared_ptr<AbstractIndex>& index) {
-  auto it = std::find(_indexes.cbegin(), _indexes.cend(), index);
-  DebugAssert(it != _indexes.cend(), "Trying to remove a non-existing index");
-  _indexes.erase(it);
+  const auto lock = std::lock_guard<std::mutex>{_indexes_mutex};
+
+  auto new_indexes = std::make_shared<Indexes>(*_indexes);
+  auto it = std::find(new_indexes->cbegin(), new_indexes->cend(), index);
+  DebugAssert(it != new_indexes->cend(), "Trying to remove a non-existing index");
+  new_indexes->erase(it);
+  std::atomic_store(&_indexes, std::shared_ptr<const Indexes>{new_indexes});
+}
+
+void Chunk::_add_index(const std::shared_ptr<AbstractIndex>& index) {
+  const auto lock = std::lock_guard<std::mutex>{_indexes_mutex};
+
+  auto new_indexes = std::make_shared<Indexes>(*_indexes);
+  new_indexes->emplace_back(index);
+  std::atomic_store(&_indexes, std::shared_ptr<const Indexes>{new_indexes});
+}
+
+std::shared_ptr<MutableAdaptiveRadixTreeIndex> Chunk::get_mutable_index(const ColumnID column_id) const {
+  const auto mutable_indexes = std::atomic_load(&_mutable_indexes);
+  if (!mutable_indexes) return nullptr;
+
+  for (const auto& [indexed_column_id, mutable_index] : *mutable_indexes) {
+    if (indexed_column_id == column_id) return mutable_index;
+  }
+  return nullptr;
+}
+
+std::shared_ptr<MutableAdaptiveRadixTreeIndex> Chunk::create_mutable_index(const ColumnID column_id) {
+  Assert(!get_mutable_index(column_id), "Column already has a mutable index");
+
+  const auto mutable_index = std::make_shared<MutableAdaptiveRadixTreeIndex>(get_segment(column_id));
+
+  const auto lock = std::lock_guard<std::mutex>{_indexes_mutex};
+  const auto mutable_indexes = _mutable_indexes;
+  auto new_mutable_indexes = mutable_indexes ? std::make_shared<MutableIndexes>(*mutable_indexes)
+                                             : std::make_shared<MutableIndexes>();
+  new_mutable_indexes->emplace_back(column_id, mutable_index);
+  std::atomic_store(&_mutable_indexes, std::shared_ptr<const MutableIndexes>{new_mutable_indexes});
+
+  return mutable_index;
+}
+
+void Chunk::insert_into_mutable_indexes(const ChunkOffset begin_chunk_offset,
+                                        const ChunkOffset end_chunk_offset) const {
+  const auto mutable_indexes = std::atomic_load(&_mutable_indexes);
+  if (!mutable_indexes) return;
+
+  for (const auto& column_id_and_mutable_index : *mutable_indexes) {
+    column_id_and_mutable_index.second->insert(begin_chunk_offset, end_chunk_offset);
+  }
+}
+
+void Chunk::freeze_mutable_indexes() {
+  const auto mutable_indexes = std::atomic_load(&_mutable_indexes);
+  if (!mutable_indexes) return;
+
+  // The AdaptiveRadixTreeIndex only supports dictionary-encoded segments, other segments are no longer indexed once
+  // they were replaced. As the mutable index already holds the rows ordered by value, the frozen index is built from
+  // it. This happens without holding the lock, as the frozen indexes are only published below.
+  auto frozen_indexes = std::vector<std::shared_ptr<AbstractIndex>>{};
+  for (const auto& [column_id, mutable_index] : *mutable_indexes) {
+    const auto segment = get_segment(column_id);
+    const auto segment_was_replaced = segment != mutable_index->indexed_segment();
+    if (segment_was_replaced && std::dynamic_pointer_cast<const BaseDictionarySegment>(segment)) {
+      frozen_indexes.emplace_back(std::make_shared<AdaptiveRadixTreeIndex>(segment, *mutable_index));
+    }
+  }
+
+  const auto lock = std::lock_guard<std::mutex>{_indexes_mutex};
+
+  // The new indexes are added before the mutable indexes are removed so that concurrent readers always find one of
+  // them
+  if (!frozen_indexes.empty()) {
+    auto new_indexes = std::make_shared<Indexes>(*_indexes);
+    new_indexes->insert(new_indexes->end(), frozen_indexes.begin(), frozen_indexes.end());
+    std::atomic_store(&_indexes, std::shared_ptr<const Indexes>{new_indexes});
+  }
+
+  // Mutable indexes whose segment was not replaced are still valid
+  auto remaining_mutable_indexes = std::make_shared<MutableIndexes>();
+  for (const auto& [column_id, mutable_index] : *_mutable_indexes) {
+    if (get_segment(column_id) == mutable_index->indexed_segment()) {
+      remaining_mutable_indexes->emplace_back(column_id, mutable_index);
+    }
+  }
+
+  if (remaining_mutable_indexes->empty()) {
+    std::atomic_store(&_mutable_indexes, std::shared_ptr<const MutableIndexes>{});
+  } else {
+    std::atomic_store(&_mutable_indexes, std::shared_ptr<const MutableIndexes>{remaining_mutable_indexes});
+  }
 }
 
 bool Chunk::references_exactly_one_table() const {
@@ -142,7 +240,7 @@ bool Chunk::references_exactly_one_table() const {
   auto first_segment = std::dynamic_pointer_cast<const ReferenceSegment>(get_segment(ColumnID{0}));
   if (!first_segment) return false;
   auto first_referenced_table = first_segment->referenced_table();
-  auto first_pos_list = first_segment->pos_list();
+  const auto& first_compact_pos_list = first_segment->compact_pos_list();
 
   for (ColumnID column_id{1}; column_id < column_count(); ++column_id) {
     const auto segment = std::dynamic_pointer_cast<const ReferenceSegment>(get_segment(column_id));
@@ -150,7 +248,9 @@ bool Chunk::references_exactly_one_table() const {
 
     if (first_referenced_table != segment->referenced_table()) return false;
 
-    if (first_pos_list != segment->pos_list()) return false;
+    // Compare the CompactPosLists first, so that they do not need to be materialized
+    if (first_compact_pos_list != segment->compact_pos_list()) return false;
+    if (!first_compact_pos_list && first_segment->pos_list() != segment->pos_list()) return false;
   }
 
   return true;
@@ -158,7 +258,7 @@ bool Chunk::references_exactly_one_table() const {
 
 void Chunk::migrate(boost::container::pmr::memory_resource* memory_source) {
   // Migrating chunks with indexes is not implemented yet.
-  if (!_indexes.empty()) {
+  if (!std::atomic_load(&_indexes)->empty() || std::atomic_load(&_mutable_indexes)) {
     Fail("Cannot migrate Chunk with Indexes.");
   }
 
@@ -5,9 +5,11 @@
 #include <algorithm>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include <optional>
 #include <shared_mutex>
 #include <string>
+#include <utility>
 #include <vector>
 
 #include <boost/container/pmr/memory_resource.hpp>
@@ -24,6 +26,7 @@ namespace opossum {
 class AbstractIndex;
 class BaseSegment;
 class BaseAttributeStatistics;
+class MutableAdaptiveRadixTreeIndex;
 
 using Segments = pmr_vector<std::shared_ptr<BaseSegment>>;
 using Indexes = pmr_vector<std::shared_ptr<AbstractIndex>>;
@@ -109,7 +112,7 @@ class Chunk : private Noncopyable {
                 "All segments must be part of the chunk.");
 
     auto index = std::make_shared<Index>(segments_to_index);
-    _indexes.emplace_back(index);
+    _add_index(index);
     return index;
   }
 
@@ -121,6 +124,24 @@ class Chunk : private Noncopyable {
 
   void remove_index(const std::shared_ptr<AbstractIndex>& index);
 
+  /**
+   * Mutable indexes (see MutableAdaptiveRadixTreeIndex) cover ValueSegments that are still appended to. append() and
+   * the Insert operator add new rows to them. Once the chunk is encoded, freeze_mutable_indexes() replaces them with
+   * AdaptiveRadixTreeIndexes.
+   * @{
+   */
+  // Returns nullptr if the column has no mutable index
+  std::shared_ptr<MutableAdaptiveRadixTreeIndex> get_mutable_index(const ColumnID column_id) const;
+  std::shared_ptr<MutableAdaptiveRadixTreeIndex> create_mutable_index(const ColumnID column_id);
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset), whose values must have been written, to all mutable indexes
+  void insert_into_mutable_indexes(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) const;
+
+  // Creates an AdaptiveRadixTreeIndex from each mutable index whose segment was replaced by a DictionarySegment and
+  // removes the mutable indexes of all replaced segments
+  void freeze_mutable_indexes();
+  /** @} */
+
   void migrate(boost::container::pmr::memory_resource* memory_source);
 
   bool references_exactly_one_table() const;
@@ -179,13 +200,22 @@ class Chunk : private Noncopyable {
   void finalize();
 
  private:
+  using MutableIndexes = std::vector<std::pair<ColumnID, std::shared_ptr<MutableAdaptiveRadixTreeIndex>>>;
+
   std::vector<std::shared_ptr<const BaseSegment>> _get_segments_for_ids(const std::vector<ColumnID>& column_ids) const;
 
+  void _add_index(const std::shared_ptr<AbstractIndex>& index);
+
  private:
   PolymorphicAllocator<Chunk> _alloc;
   Segments _segments;
   std::shared_ptr<MvccData> _mvcc_data;
-  Indexes _indexes;
+  // Indexes can be added and removed while the chunk is read, e.g., by the ChunkCompressionTask (see
+  // freeze_mutable_indexes()). Thus, the lists of indexes are never modified but replaced atomically (copy-on-write).
+  // Modifications are serialized by _indexes_mutex, so that concurrent modifications are not lost.
+  std::shared_ptr<const Indexes> _indexes;
+  std::shared_ptr<const MutableIndexes> _mutable_indexes;
+  std::mutex _indexes_mutex;
   std::optional<ChunkPruningStatistics> _pruning_statistics;
   bool _is_mutable = true;
   std::optional<std::pair<ColumnID, OrderByMode>> _ordered_by;
@@ -105,6 +105,7 @@ void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::
   }
 
   generate_chunk_pruning_statistics(chunk);
+  chunk->freeze_mutable_indexes();
 }
 
 void ChunkEncoder::encode_chunk(const std::shared_ptr<Chunk>& chunk, const std::vector<DataType>& column_data_types,
@@ -125,6 +126,8 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
     const auto& chunk_encoding_spec = chunk_encoding_specs.at(chunk_id);
     encode_chunk(chunk, column_data_types, chunk_encoding_spec);
   }
+
+  table->schedule_table_statistics_refresh();
 }
 
 void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std::vector<ChunkID>& chunk_ids,
@@ -138,6 +141,8 @@ void ChunkEncoder::encode_chunks(const std::shared_ptr<Table>& table, const std:
 
     encode_chunk(chunk, column_data_types, segment_encoding_spec);
   }
+
+  table->schedule_table_statistics_refresh();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -153,6 +158,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
     const auto chunk_encoding_spec = chunk_encoding_specs[chunk_id];
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  table->schedule_table_statistics_refresh();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -168,6 +175,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, chunk_encoding_spec);
   }
+
+  table->schedule_table_statistics_refresh();
 }
 
 void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
@@ -181,6 +190,8 @@ void ChunkEncoder::encode_all_chunks(const std::shared_ptr<Table>& table,
 
     encode_chunk(chunk, column_types, segment_encoding_spec);
   }
+
+  table->schedule_table_statistics_refresh();
 }
 
 }  // namespace opossum
@@ -0,0 +1,104 @@
+#include "compact_pos_list.hpp"
+
+#include <algorithm>
+#include <memory>
+#include <utility>
+
+namespace opossum {
+
+CompactPosList::CompactPosList(const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                               const ChunkOffset end_chunk_offset)
+    : _chunk_id(chunk_id), _begin_chunk_offset(begin_chunk_offset), _size(end_chunk_offset - begin_chunk_offset) {
+  Assert(chunk_id != INVALID_CHUNK_ID, "CompactPosLists cannot reference NULL values");
+  Assert(begin_chunk_offset <= end_chunk_offset, "Invalid range of chunk offsets");
+}
+
+CompactPosList::CompactPosList(const ChunkID chunk_id, std::vector<uint64_t>&& bitmap)
+    : _chunk_id(chunk_id), _bitmap(std::move(bitmap)) {
+  Assert(chunk_id != INVALID_CHUNK_ID, "CompactPosLists cannot reference NULL values");
+
+  _ranks.reserve(_bitmap.size());
+  for (const auto word : _bitmap) {
+    _ranks.emplace_back(_size);
+    _size += static_cast<ChunkOffset>(__builtin_popcountll(word));
+  }
+
+  // An empty bitmap would be taken for a range
+  if (_bitmap.empty()) _bitmap.emplace_back(0);
+}
+
+std::shared_ptr<const CompactPosList> CompactPosList::try_compact(const PosList& pos_list,
+                                                                  const ChunkOffset chunk_size) {
+  if (pos_list.empty()) return nullptr;
+
+  const auto chunk_id = pos_list[0].chunk_id;
+  if (chunk_id == INVALID_CHUNK_ID) return nullptr;
+
+  const auto pos_list_size = static_cast<ChunkOffset>(pos_list.size());
+  const auto pos_list_memory_usage = pos_list_size * sizeof(RowID);
+
+  // Consecutive rows are stored as a range. As the chunk offsets are unique, the list is a range if its first and
+  // last chunk offsets are pos_list_size - 1 apart and it is sorted.
+  const auto begin_chunk_offset = pos_list[0].chunk_offset;
+  const auto end_chunk_offset = pos_list[pos_list_size - 1].chunk_offset + 1;
+  if (end_chunk_offset - begin_chunk_offset == pos_list_size) {
+    for (auto pos_list_offset = ChunkOffset{0}; pos_list_offset < pos_list_size; ++pos_list_offset) {
+      const auto& row_id = pos_list[pos_list_offset];
+      if (row_id.chunk_id != chunk_id || row_id.chunk_offset != begin_chunk_offset + pos_list_offset) return nullptr;
+    }
+    return std::make_shared<const CompactPosList>(chunk_id, begin_chunk_offset, end_chunk_offset);
+  }
+
+  // Otherwise, a bitmap is used if it takes less memory. It needs 12 bytes (bitmap and rank) per 64 rows of the chunk.
+  const auto word_count = (chunk_size + 63) / 64;
+  if (word_count * (sizeof(uint64_t) + sizeof(ChunkOffset)) >= pos_list_memory_usage) return nullptr;
+
+  auto bitmap = std::vector<uint64_t>(word_count);
+  auto previous_chunk_offset = ChunkOffset{0};
+  for (auto pos_list_offset = ChunkOffset{0}; pos_list_offset < pos_list_size; ++pos_list_offset) {
+    const auto& row_id = pos_list[pos_list_offset];
+    if (row_id.chunk_id != chunk_id || row_id.chunk_offset >= chunk_size) return nullptr;
+    if (pos_list_offset > 0 && row_id.chunk_offset <= previous_chunk_offset) return nullptr;
+
+    bitmap[row_id.chunk_offset / 64] |= uint64_t{1} << (row_id.chunk_offset % 64);
+    previous_chunk_offset = row_id.chunk_offset;
+  }
+
+  return std::make_shared<const CompactPosList>(chunk_id, std::move(bitmap));
+}
+
+ChunkOffset CompactPosList::chunk_offset(const ChunkOffset pos_list_offset) const {
+  DebugAssert(pos_list_offset < _size, "pos_list_offset out of range");
+  if (is_range()) return _begin_chunk_offset + pos_list_offset;
+
+  // Find the word that contains the row and the row within that word
+  const auto rank_it = std::upper_bound(_ranks.begin(), _ranks.end(), pos_list_offset) - 1;
+  const auto word_idx = static_cast<size_t>(std::distance(_ranks.begin(), rank_it));
+  auto word = _bitmap[word_idx];
+  for (auto skipped_row_count = _ranks[word_idx]; skipped_row_count < pos_list_offset; ++skipped_row_count) {
+    word &= word - 1;
+  }
+  return static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+}
+
+const std::shared_ptr<const PosList>& CompactPosList::materialize() const {
+  std::call_once(_materialize_flag, [&]() {
+    auto pos_list = std::make_shared<PosList>();
+    pos_list->guarantee_single_chunk();
+    pos_list->reserve(_size);
+    for_each([&](const auto chunk_offset) { pos_list->emplace_back(RowID{_chunk_id, chunk_offset}); });
+    // Stored atomically, as memory_usage() reads it without waiting for the materialization
+    std::atomic_store(&_materialized_pos_list, std::shared_ptr<const PosList>{std::move(pos_list)});
+  });
+  return _materialized_pos_list;
+}
+
+size_t CompactPosList::memory_usage() const {
+  auto memory_usage = sizeof(*this) + _bitmap.capacity() * sizeof(uint64_t) + _ranks.capacity() * sizeof(ChunkOffset);
+  if (const auto materialized_pos_list = std::atomic_load(&_materialized_pos_list)) {
+    memory_usage += materialized_pos_list->size() * sizeof(RowID);
+  }
+  return memory_usage;
+}
+
+}  // namespace opossum
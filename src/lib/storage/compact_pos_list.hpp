@@ -0,0 +1,107 @@
+#pragma once
+
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "storage/pos_list.hpp"
+#include "types.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * A position list that references rows of a single chunk in increasing order without materializing a RowID (8 bytes)
+ * per row. The rows are either given as
+ *  - a range of chunk offsets, e.g., an entire chunk, or
+ *  - a bitmap with one bit per row of the chunk, which is smaller than a PosList if more than about 2% of the rows of
+ *    the chunk are referenced.
+ *
+ * ReferenceSegments can store a CompactPosList instead of a PosList. Their iterables and accessors use it directly, so
+ * that, e.g., entire chunks are iterated sequentially instead of through a position filter. Code that needs a PosList
+ * gets it from ReferenceSegment::pos_list(), which materializes the CompactPosList once and shares the result.
+ */
+class CompactPosList : private Noncopyable {
+ public:
+  // References the rows [begin_chunk_offset, end_chunk_offset) of the chunk
+  CompactPosList(const ChunkID chunk_id, const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  // References the rows whose bit is set in the bitmap (bit `chunk_offset % 64` of word `chunk_offset / 64`)
+  CompactPosList(const ChunkID chunk_id, std::vector<uint64_t>&& bitmap);
+
+  // Returns a CompactPosList with the same positions as `pos_list` if it takes less memory than `pos_list`, nullptr
+  // otherwise. `pos_list` must reference rows of a single chunk of `chunk_size` rows (i.e., contain no NULLs), for
+  // example the matches of a scan on a data chunk. Lists that are not sorted by chunk offset are never compacted.
+  static std::shared_ptr<const CompactPosList> try_compact(const PosList& pos_list, const ChunkOffset chunk_size);
+
+  ChunkID chunk_id() const { return _chunk_id; }
+  ChunkOffset size() const { return _size; }
+
+  // Returns whether the rows are given as a range, i.e., all rows from begin_chunk_offset() to
+  // begin_chunk_offset() + size() are referenced
+  bool is_range() const { return _bitmap.empty(); }
+  ChunkOffset begin_chunk_offset() const {
+    DebugAssert(is_range(), "Only ranges have a fixed begin_chunk_offset");
+    return _begin_chunk_offset;
+  }
+
+  // Returns the chunk offset of the `pos_list_offset`-th referenced row. This takes constant time for ranges and
+  // logarithmic time for bitmaps.
+  ChunkOffset chunk_offset(const ChunkOffset pos_list_offset) const;
+
+  // Returns the chunk offset of the referenced row after the one at `chunk_offset`, which has to be referenced
+  ChunkOffset next_chunk_offset(const ChunkOffset chunk_offset) const {
+    if (is_range()) return chunk_offset + 1;
+
+    auto word_idx = (chunk_offset + 1) / 64;
+    if (word_idx >= _bitmap.size()) return chunk_offset + 1;
+    auto word = _bitmap[word_idx] & (~uint64_t{0} << ((chunk_offset + 1) % 64));
+    while (!word) {
+      ++word_idx;
+      if (word_idx == _bitmap.size()) return static_cast<ChunkOffset>(word_idx * 64);
+      word = _bitmap[word_idx];
+    }
+    return static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word));
+  }
+
+  // Calls `functor(chunk_offset)` for all referenced rows in increasing order
+  template <typename Functor>
+  void for_each(const Functor& functor) const {
+    if (is_range()) {
+      for (auto chunk_offset = _begin_chunk_offset; chunk_offset < _begin_chunk_offset + _size; ++chunk_offset) {
+        functor(chunk_offset);
+      }
+      return;
+    }
+
+    const auto word_count = _bitmap.size();
+    for (auto word_idx = size_t{0}; word_idx < word_count; ++word_idx) {
+      auto word = _bitmap[word_idx];
+      while (word) {
+        functor(static_cast<ChunkOffset>(word_idx * 64 + __builtin_ctzll(word)));
+        word &= word - 1;
+      }
+    }
+  }
+
+  // Returns a PosList with the same positions. It is created on the first call, later calls return the same PosList.
+  const std::shared_ptr<const PosList>& materialize() const;
+
+  size_t memory_usage() const;
+
+ private:
+  const ChunkID _chunk_id;
+  ChunkOffset _begin_chunk_offset{0};
+  ChunkOffset _size{0};
+
+  std::vector<uint64_t> _bitmap;
+
+  // Number of set bits in the bitmap before each of its words, used to find the n-th referenced row
+  std::vector<ChunkOffset> _ranks;
+
+  // Set once by materialize(). memory_usage() might read it concurrently, so it is written with std::atomic_store().
+  mutable std::once_flag _materialize_flag;
+  mutable std::shared_ptr<const PosList> _materialized_pos_list;
+};
+
+}  // namespace opossum
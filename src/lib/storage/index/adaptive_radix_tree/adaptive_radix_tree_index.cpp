@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "adaptive_radix_tree_nodes.hpp"
+#include "mutable_adaptive_radix_tree_index.hpp"
 #include "storage/base_dictionary_segment.hpp"
 #include "storage/index/abstract_index.hpp"
 #include "storage/vector_compression/resolve_compressed_vector_type.hpp"
@@ -53,6 +54,44 @@ AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr
   _root = _bulk_insert(pairs_to_insert);
 }
 
+AdaptiveRadixTreeIndex::AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment_to_index,
+                                               const MutableAdaptiveRadixTreeIndex& mutable_index)
+    : AbstractIndex{get_index_type_of<AdaptiveRadixTreeIndex>()},
+      _indexed_segment(std::dynamic_pointer_cast<const BaseDictionarySegment>(segment_to_index)) {
+  Assert(static_cast<bool>(_indexed_segment), "AdaptiveRadixTree only works with dictionary segments for now");
+
+  const auto row_count = _indexed_segment->size();
+  auto is_indexed = std::vector<bool>(row_count);
+
+  std::vector<std::pair<BinaryComparable, ChunkOffset>> pairs_to_insert;
+  pairs_to_insert.reserve(row_count);
+
+  auto value_id = ValueID{0};
+  auto sorted_chunk_offsets = std::vector<ChunkOffset>{};
+  mutable_index.for_each_value([&](const std::vector<ChunkOffset>& chunk_offsets) {
+    // Rows can be inserted into the mutable index out of order, but the rows of a value are listed in order here
+    sorted_chunk_offsets = chunk_offsets;
+    std::sort(sorted_chunk_offsets.begin(), sorted_chunk_offsets.end());
+
+    const auto key = BinaryComparable(value_id);
+    for (const auto chunk_offset : sorted_chunk_offsets) {
+      DebugAssert(chunk_offset < row_count, "Mutable index contains rows that are not part of the segment");
+      pairs_to_insert.emplace_back(key, chunk_offset);
+      is_indexed[chunk_offset] = true;
+    }
+    ++value_id;
+  });
+  Assert(value_id == _indexed_segment->null_value_id(), "Mutable index does not match the dictionary");
+
+  // NULL values are not part of the mutable index
+  _null_positions.reserve(row_count - pairs_to_insert.size());
+  for (auto chunk_offset = ChunkOffset{0}; chunk_offset < row_count; ++chunk_offset) {
+    if (!is_indexed[chunk_offset]) _null_positions.emplace_back(chunk_offset);
+  }
+
+  _root = _bulk_insert(pairs_to_insert);
+}
+
 AbstractIndex::Iterator AdaptiveRadixTreeIndex::_lower_bound(const std::vector<AllTypeVariant>& values) const {
   Assert((values.size() == 1), "Adaptive Radix Tree Index expects exactly one input value");
   // the caller is responsible for not passing a NULL value
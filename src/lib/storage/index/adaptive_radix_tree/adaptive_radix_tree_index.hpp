@@ -13,6 +13,7 @@ namespace opossum {
 class BaseSegment;
 class ARTNode;
 class BaseDictionarySegment;
+class MutableAdaptiveRadixTreeIndex;
 
 /**
  * The AdaptiveRadixTreeIndex (ART) currently works on single DictionarySegments. Conceptually it also works on
@@ -45,6 +46,12 @@ class AdaptiveRadixTreeIndex : public AbstractIndex {
 
   explicit AdaptiveRadixTreeIndex(const std::vector<std::shared_ptr<const BaseSegment>>& segments_to_index);
 
+  // Creates the index on a dictionary-encoded segment from a MutableAdaptiveRadixTreeIndex on the ValueSegment that the
+  // segment was encoded from (see Chunk::freeze_mutable_indexes()). As the mutable index lists the distinct values in
+  // ascending order, the n-th value has the ValueID n, so the attribute vector does not need to be read.
+  AdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment_to_index,
+                         const MutableAdaptiveRadixTreeIndex& mutable_index);
+
   AdaptiveRadixTreeIndex(AdaptiveRadixTreeIndex&&) = default;
 
   virtual ~AdaptiveRadixTreeIndex() = default;
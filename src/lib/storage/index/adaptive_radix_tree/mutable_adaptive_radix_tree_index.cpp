@@ -0,0 +1,500 @@
+#include "mutable_adaptive_radix_tree_index.hpp"
+
+#include <tbb/concurrent_vector.h>
+
+#include <algorithm>
+#include <array>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "lossless_cast.hpp"
+#include "resolve_type.hpp"
+#include "storage/value_segment.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+/**
+ * The nodes of the MutableAdaptiveRadixTreeIndex. Only the insert path, which holds the index's mutex, calls the
+ * non-const methods, while lookups may concurrently call the const ones.
+ */
+class MutableARTNode : private Noncopyable {
+ public:
+  virtual ~MutableARTNode() = default;
+
+  virtual bool is_leaf() const = 0;
+};
+
+class MutableARTLeaf final : public MutableARTNode {
+ public:
+  MutableARTLeaf(std::vector<uint8_t>&& key, const ChunkOffset chunk_offset) : _key(std::move(key)) {
+    _chunk_offsets.push_back(chunk_offset);
+  }
+
+  bool is_leaf() const final { return true; }
+
+  const std::vector<uint8_t>& key() const { return _key; }
+
+  void append(const ChunkOffset chunk_offset) {
+    _chunk_offsets.push_back(chunk_offset);
+    _size.fetch_add(1, std::memory_order_release);
+  }
+
+  void append_chunk_offsets_to(std::vector<ChunkOffset>& chunk_offsets) const {
+    // The concurrent_vector does not move its elements when it grows, so the first _size elements can be read while
+    // another element is appended
+    const auto size = _size.load(std::memory_order_acquire);
+    for (auto chunk_offset_idx = size_t{0}; chunk_offset_idx < size; ++chunk_offset_idx) {
+      chunk_offsets.emplace_back(_chunk_offsets[chunk_offset_idx]);
+    }
+  }
+
+ private:
+  const std::vector<uint8_t> _key;
+  tbb::concurrent_vector<ChunkOffset> _chunk_offsets;
+  std::atomic<size_t> _size{1};
+};
+
+class MutableARTInnerNode : public MutableARTNode {
+ public:
+  using Children = std::vector<std::pair<uint8_t, MutableARTNode*>>;
+
+  bool is_leaf() const final { return false; }
+
+  // Returns the slot that holds the child for the partial key, or nullptr if there is no such child
+  virtual std::atomic<MutableARTNode*>* child_slot(const uint8_t partial_key) = 0;
+
+  // Tries to add a child without replacing the node, returns false if this is not possible
+  virtual bool try_add_child(const uint8_t partial_key, MutableARTNode* child) = 0;
+
+  // Returns all children, ordered by their partial keys
+  virtual Children children() const = 0;
+
+  // Calls the function for all children with a partial key in [from, to], ordered by their partial keys
+  virtual void for_each_child(const uint8_t from, const uint8_t to,
+                              const std::function<void(uint8_t, const MutableARTNode&)>& function) const = 0;
+};
+
+/**
+ * Node with up to 4 or 16 children, whose partial keys are stored in a sorted array. To add a child, the node is
+ * copied. Only the child pointers may change, when a child is replaced.
+ */
+template <size_t capacity>
+class MutableARTSortedNode final : public MutableARTInnerNode {
+ public:
+  explicit MutableARTSortedNode(const Children& children) : _child_count(children.size()) {
+    DebugAssert(_child_count <= capacity, "Too many children for node");
+    for (auto child_idx = size_t{0}; child_idx < _child_count; ++child_idx) {
+      _partial_keys[child_idx] = children[child_idx].first;
+      _children[child_idx].store(children[child_idx].second, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<MutableARTNode*>* child_slot(const uint8_t partial_key) final {
+    const auto partial_keys_end = _partial_keys.cbegin() + _child_count;
+    const auto partial_key_iter = std::find(_partial_keys.cbegin(), partial_keys_end, partial_key);
+    if (partial_key_iter == partial_keys_end) return nullptr;
+    return &_children[std::distance(_partial_keys.cbegin(), partial_key_iter)];
+  }
+
+  bool try_add_child(const uint8_t partial_key, MutableARTNode* child) final { return false; }
+
+  Children children() const final {
+    auto children = Children{};
+    for (auto child_idx = size_t{0}; child_idx < _child_count; ++child_idx) {
+      children.emplace_back(_partial_keys[child_idx], _children[child_idx].load(std::memory_order_relaxed));
+    }
+    return children;
+  }
+
+  void for_each_child(const uint8_t from, const uint8_t to,
+                      const std::function<void(uint8_t, const MutableARTNode&)>& function) const final {
+    for (auto child_idx = size_t{0}; child_idx < _child_count; ++child_idx) {
+      const auto partial_key = _partial_keys[child_idx];
+      if (partial_key < from) continue;
+      if (partial_key > to) break;
+      function(partial_key, *_children[child_idx].load(std::memory_order_acquire));
+    }
+  }
+
+ private:
+  const size_t _child_count;
+  std::array<uint8_t, capacity> _partial_keys{};
+  std::array<std::atomic<MutableARTNode*>, capacity> _children{};
+};
+
+/**
+ * Node with up to 48 children. A child is added by first storing it and then publishing its position in
+ * _index_to_child.
+ */
+class MutableARTNode48 final : public MutableARTInnerNode {
+ public:
+  static constexpr auto CAPACITY = size_t{48};
+
+  explicit MutableARTNode48(const Children& children) {
+    DebugAssert(children.size() <= CAPACITY, "Too many children for node");
+    for (auto& child_idx : _index_to_child) {
+      child_idx.store(INVALID_INDEX, std::memory_order_relaxed);
+    }
+    for (const auto& [partial_key, child] : children) {
+      try_add_child(partial_key, child);
+    }
+  }
+
+  std::atomic<MutableARTNode*>* child_slot(const uint8_t partial_key) final {
+    const auto child_idx = _index_to_child[partial_key].load(std::memory_order_relaxed);
+    if (child_idx == INVALID_INDEX) return nullptr;
+    return &_children[child_idx];
+  }
+
+  bool try_add_child(const uint8_t partial_key, MutableARTNode* child) final {
+    if (_child_count == CAPACITY) return false;
+
+    _children[_child_count].store(child, std::memory_order_release);
+    _index_to_child[partial_key].store(static_cast<uint8_t>(_child_count), std::memory_order_release);
+    ++_child_count;
+    return true;
+  }
+
+  Children children() const final {
+    auto children = Children{};
+    for (auto partial_key = size_t{0}; partial_key < _index_to_child.size(); ++partial_key) {
+      const auto child_idx = _index_to_child[partial_key].load(std::memory_order_relaxed);
+      if (child_idx == INVALID_INDEX) continue;
+      children.emplace_back(static_cast<uint8_t>(partial_key), _children[child_idx].load(std::memory_order_relaxed));
+    }
+    return children;
+  }
+
+  void for_each_child(const uint8_t from, const uint8_t to,
+                      const std::function<void(uint8_t, const MutableARTNode&)>& function) const final {
+    for (auto partial_key = size_t{from}; partial_key <= to; ++partial_key) {
+      const auto child_idx = _index_to_child[partial_key].load(std::memory_order_acquire);
+      if (child_idx == INVALID_INDEX) continue;
+      function(static_cast<uint8_t>(partial_key), *_children[child_idx].load(std::memory_order_acquire));
+    }
+  }
+
+ private:
+  static constexpr auto INVALID_INDEX = uint8_t{255};
+
+  // Only accessed by inserts
+  size_t _child_count{0};
+
+  std::array<std::atomic<uint8_t>, 256> _index_to_child{};
+  std::array<std::atomic<MutableARTNode*>, CAPACITY> _children{};
+};
+
+/**
+ * Node with up to 256 children, which are directly addressed by their partial key.
+ */
+class MutableARTNode256 final : public MutableARTInnerNode {
+ public:
+  explicit MutableARTNode256(const Children& children) {
+    for (const auto& [partial_key, child] : children) {
+      _children[partial_key].store(child, std::memory_order_relaxed);
+    }
+  }
+
+  std::atomic<MutableARTNode*>* child_slot(const uint8_t partial_key) final {
+    if (!_children[partial_key].load(std::memory_order_relaxed)) return nullptr;
+    return &_children[partial_key];
+  }
+
+  bool try_add_child(const uint8_t partial_key, MutableARTNode* child) final {
+    _children[partial_key].store(child, std::memory_order_release);
+    return true;
+  }
+
+  Children children() const final {
+    auto children = Children{};
+    for (auto partial_key = size_t{0}; partial_key < _children.size(); ++partial_key) {
+      const auto child = _children[partial_key].load(std::memory_order_relaxed);
+      if (child) children.emplace_back(static_cast<uint8_t>(partial_key), child);
+    }
+    return children;
+  }
+
+  void for_each_child(const uint8_t from, const uint8_t to,
+                      const std::function<void(uint8_t, const MutableARTNode&)>& function) const final {
+    for (auto partial_key = size_t{from}; partial_key <= to; ++partial_key) {
+      const auto child = _children[partial_key].load(std::memory_order_acquire);
+      if (child) function(static_cast<uint8_t>(partial_key), *child);
+    }
+  }
+
+ private:
+  std::array<std::atomic<MutableARTNode*>, 256> _children{};
+};
+
+namespace {
+
+template <typename UnsignedInteger>
+void append_big_endian(std::vector<uint8_t>& key, const UnsignedInteger value) {
+  for (auto byte_idx = sizeof(UnsignedInteger); byte_idx > 0; --byte_idx) {
+    key.emplace_back(static_cast<uint8_t>(value >> ((byte_idx - 1) * 8)));
+  }
+}
+
+/**
+ * Transforms a value into a byte string so that comparing the byte strings lexicographically gives the same order as
+ * comparing the values. No key of a data type is a prefix of another key of the same data type, so lookups can stop
+ * at the first differing byte and leaves can be placed at the first byte that distinguishes them from all other keys.
+ */
+template <typename T>
+std::vector<uint8_t> binary_comparable_key(const T& value) {
+  auto key = std::vector<uint8_t>{};
+
+  if constexpr (std::is_same_v<T, pmr_string>) {
+    // Strings are terminated by 0x00 0x00. To keep this unambiguous, 0x00 characters are escaped as 0x00 0xFF.
+    key.reserve(value.size() + 2);
+    for (const auto character : value) {
+      key.emplace_back(static_cast<uint8_t>(character));
+      if (character == '\0') key.emplace_back(uint8_t{0xFF});
+    }
+    key.emplace_back(uint8_t{0});
+    key.emplace_back(uint8_t{0});
+  } else if constexpr (std::is_integral_v<T>) {
+    // Flipping the sign bit orders negative values before positive ones
+    using Unsigned = std::make_unsigned_t<T>;
+    constexpr auto sign_bit = Unsigned{1} << (sizeof(T) * 8 - 1);
+    append_big_endian(key, static_cast<Unsigned>(static_cast<Unsigned>(value) ^ sign_bit));
+  } else {
+    static_assert(std::is_floating_point_v<T>, "Unexpected data type");
+
+    // For positive values, the sign bit is set. For negative values, all bits are flipped so that a larger magnitude
+    // gives a smaller key. -0.0 is treated as 0.0, as they are equal.
+    using Bits = std::conditional_t<sizeof(T) == sizeof(uint32_t), uint32_t, uint64_t>;
+    constexpr auto sign_bit = Bits{1} << (sizeof(T) * 8 - 1);
+    const auto normalized_value = value == T{0} ? T{0} : value;
+    auto bits = Bits{};
+    std::memcpy(&bits, &normalized_value, sizeof(T));
+    append_big_endian(key, (bits & sign_bit) ? static_cast<Bits>(~bits) : static_cast<Bits>(bits | sign_bit));
+  }
+
+  return key;
+}
+
+struct RangeQuery {
+  const std::optional<std::vector<uint8_t>>& lower_key;
+  const bool lower_is_inclusive;
+  const std::optional<std::vector<uint8_t>>& upper_key;
+  const bool upper_is_inclusive;
+  std::vector<ChunkOffset>& chunk_offsets;
+};
+
+// Collects the chunk offsets in the subtree. `is_lower_tight` (`is_upper_tight`) states that the prefix of all keys in
+// the subtree is equal to the lower (upper) key up to depth. If it is not, the subtree lies completely above (below)
+// the bound.
+void collect_range(const MutableARTNode& node, const size_t depth, const bool is_lower_tight, const bool is_upper_tight,
+                   const RangeQuery& query) {
+  if (node.is_leaf()) {
+    const auto& leaf = static_cast<const MutableARTLeaf&>(node);
+    const auto& key = leaf.key();
+
+    if (query.lower_key) {
+      const auto is_below_lower = query.lower_is_inclusive ? key < *query.lower_key : key <= *query.lower_key;
+      if (is_below_lower) return;
+    }
+    if (query.upper_key) {
+      const auto is_above_upper = query.upper_is_inclusive ? key > *query.upper_key : key >= *query.upper_key;
+      if (is_above_upper) return;
+    }
+
+    leaf.append_chunk_offsets_to(query.chunk_offsets);
+    return;
+  }
+
+  // As no key is a prefix of another one, an inner node on the path of a bound is above the bound's last byte
+  DebugAssert(!is_lower_tight || depth < query.lower_key->size(), "Lower key is a prefix of an indexed key");
+  DebugAssert(!is_upper_tight || depth < query.upper_key->size(), "Upper key is a prefix of an indexed key");
+
+  const auto from = is_lower_tight ? (*query.lower_key)[depth] : std::numeric_limits<uint8_t>::min();
+  const auto to = is_upper_tight ? (*query.upper_key)[depth] : std::numeric_limits<uint8_t>::max();
+  if (from > to) return;
+
+  static_cast<const MutableARTInnerNode&>(node).for_each_child(
+      from, to, [&](const uint8_t partial_key, const MutableARTNode& child) {
+        collect_range(child, depth + 1, is_lower_tight && partial_key == from, is_upper_tight && partial_key == to,
+                      query);
+      });
+}
+
+// Visits the leaves of the subtree in the order of their keys
+void for_each_leaf(const MutableARTNode& node, const std::function<void(const MutableARTLeaf&)>& function) {
+  if (node.is_leaf()) {
+    function(static_cast<const MutableARTLeaf&>(node));
+    return;
+  }
+
+  static_cast<const MutableARTInnerNode&>(node).for_each_child(
+      std::numeric_limits<uint8_t>::min(), std::numeric_limits<uint8_t>::max(),
+      [&](const uint8_t, const MutableARTNode& child) { for_each_leaf(child, function); });
+}
+
+}  // namespace
+
+MutableAdaptiveRadixTreeIndex::MutableAdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment)
+    : _indexed_segment(segment) {
+  Assert(std::dynamic_pointer_cast<const BaseValueSegment>(_indexed_segment),
+         "MutableAdaptiveRadixTreeIndex only works with ValueSegments");
+
+  insert(ChunkOffset{0}, static_cast<ChunkOffset>(_indexed_segment->size()));
+}
+
+MutableAdaptiveRadixTreeIndex::~MutableAdaptiveRadixTreeIndex() = default;
+
+const std::shared_ptr<const BaseSegment>& MutableAdaptiveRadixTreeIndex::indexed_segment() const {
+  return _indexed_segment;
+}
+
+void MutableAdaptiveRadixTreeIndex::insert(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset) {
+  const auto lock = std::lock_guard<std::mutex>{_insert_mutex};
+
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto& value_segment = static_cast<const ValueSegment<ColumnDataType>&>(*_indexed_segment);
+    const auto& values = value_segment.values();
+    for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+      if (value_segment.is_null(chunk_offset)) continue;
+      _insert(binary_comparable_key(values[chunk_offset]), chunk_offset);
+    }
+  });
+}
+
+std::vector<ChunkOffset> MutableAdaptiveRadixTreeIndex::range(const std::optional<Bound>& lower,
+                                                              const std::optional<Bound>& upper) const {
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+
+  const auto root = _root.load(std::memory_order_acquire);
+  if (!root) return chunk_offsets;
+
+  const auto lower_key = lower ? std::optional<Key>{_key(lower->value)} : std::nullopt;
+  const auto upper_key = upper ? std::optional<Key>{_key(upper->value)} : std::nullopt;
+  const auto query = RangeQuery{lower_key, lower && lower->is_inclusive, upper_key, upper && upper->is_inclusive,
+                                chunk_offsets};
+
+  collect_range(*root, 0, lower_key.has_value(), upper_key.has_value(), query);
+
+  return chunk_offsets;
+}
+
+void MutableAdaptiveRadixTreeIndex::for_each_value(
+    const std::function<void(const std::vector<ChunkOffset>&)>& function) const {
+  const auto root = _root.load(std::memory_order_acquire);
+  if (!root) return;
+
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  for_each_leaf(*root, [&](const MutableARTLeaf& leaf) {
+    chunk_offsets.clear();
+    leaf.append_chunk_offsets_to(chunk_offsets);
+    function(chunk_offsets);
+  });
+}
+
+MutableAdaptiveRadixTreeIndex::Key MutableAdaptiveRadixTreeIndex::_key(const AllTypeVariant& value) const {
+  Assert(!variant_is_null(value), "MutableAdaptiveRadixTreeIndex cannot look up NULL");
+
+  auto key = Key{};
+  resolve_data_type(_indexed_segment->data_type(), [&](const auto data_type_t) {
+    using ColumnDataType = typename decltype(data_type_t)::type;
+
+    const auto typed_value = lossless_variant_cast<ColumnDataType>(value);
+    Assert(typed_value, "Value cannot be represented in the data type of the indexed segment");
+    key = binary_comparable_key(*typed_value);
+  });
+  return key;
+}
+
+void MutableAdaptiveRadixTreeIndex::_insert(Key&& key, const ChunkOffset chunk_offset) {
+  // Only inserts, which hold the _insert_mutex, modify the slots. Thus, relaxed loads are sufficient here, while
+  // nodes are published with release stores so that lookups see them completely.
+  auto slot = &_root;
+  auto depth = size_t{0};
+
+  while (true) {
+    const auto node = slot->load(std::memory_order_relaxed);
+    if (!node) {
+      slot->store(_make_leaf(std::move(key), chunk_offset), std::memory_order_release);
+      return;
+    }
+
+    if (node->is_leaf()) {
+      auto& leaf = static_cast<MutableARTLeaf&>(*node);
+      const auto& leaf_key = leaf.key();
+      if (leaf_key == key) {
+        leaf.append(chunk_offset);
+        return;
+      }
+
+      // Lazy expansion: Replace the leaf with a chain of inner nodes for the common prefix of both keys and a node
+      // that distinguishes them. As no key is a prefix of another one, they differ before either of them ends.
+      auto mismatch_depth = depth;
+      while (leaf_key[mismatch_depth] == key[mismatch_depth]) ++mismatch_depth;
+
+      const auto leaf_partial_key = leaf_key[mismatch_depth];
+      const auto new_partial_key = key[mismatch_depth];
+      const auto new_leaf = _make_leaf(std::move(key), chunk_offset);
+
+      auto subtree = leaf_partial_key < new_partial_key
+                         ? _make_inner_node({{leaf_partial_key, node}, {new_partial_key, new_leaf}})
+                         : _make_inner_node({{new_partial_key, new_leaf}, {leaf_partial_key, node}});
+      for (auto chain_depth = mismatch_depth; chain_depth > depth; --chain_depth) {
+        subtree = _make_inner_node({{leaf_key[chain_depth - 1], subtree}});
+      }
+
+      slot->store(subtree, std::memory_order_release);
+      return;
+    }
+
+    auto& inner_node = static_cast<MutableARTInnerNode&>(*node);
+    const auto partial_key = key[depth];
+
+    if (const auto child_slot = inner_node.child_slot(partial_key)) {
+      slot = child_slot;
+      ++depth;
+      continue;
+    }
+
+    const auto new_leaf = _make_leaf(std::move(key), chunk_offset);
+    if (inner_node.try_add_child(partial_key, new_leaf)) return;
+
+    // The node cannot be modified in place, so it is replaced by a copy that contains the new child. If the node is
+    // full, the copy is a node of the next larger type.
+    auto children = inner_node.children();
+    const auto insert_position = std::upper_bound(
+        children.begin(), children.end(), partial_key,
+        [](const auto searched_partial_key, const auto& child) { return searched_partial_key < child.first; });
+    children.emplace(insert_position, partial_key, new_leaf);
+
+    slot->store(_make_inner_node(children), std::memory_order_release);
+    return;
+  }
+}
+
+MutableARTNode* MutableAdaptiveRadixTreeIndex::_make_leaf(Key&& key, const ChunkOffset chunk_offset) {
+  _nodes.emplace_back(std::make_unique<MutableARTLeaf>(std::move(key), chunk_offset));
+  return _nodes.back().get();
+}
+
+MutableARTNode* MutableAdaptiveRadixTreeIndex::_make_inner_node(
+    const std::vector<std::pair<uint8_t, MutableARTNode*>>& children) {
+  if (children.size() <= 4) {
+    _nodes.emplace_back(std::make_unique<MutableARTSortedNode<4>>(children));
+  } else if (children.size() <= 16) {
+    _nodes.emplace_back(std::make_unique<MutableARTSortedNode<16>>(children));
+  } else if (children.size() <= MutableARTNode48::CAPACITY) {
+    _nodes.emplace_back(std::make_unique<MutableARTNode48>(children));
+  } else {
+    _nodes.emplace_back(std::make_unique<MutableARTNode256>(children));
+  }
+  return _nodes.back().get();
+}
+
+}  // namespace opossum
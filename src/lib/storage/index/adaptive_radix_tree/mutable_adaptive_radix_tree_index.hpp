@@ -0,0 +1,85 @@
+#pragma once
+
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <utility>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class BaseSegment;
+class MutableARTNode;
+
+/**
+ * The chunk indexes (see AbstractIndex) are built once over the immutable segments of a chunk. Thus, the mutable chunk
+ * at the end of a table cannot be indexed and is always scanned, even though it holds the most recently inserted rows,
+ * which OLTP workloads access the most.
+ *
+ * The MutableAdaptiveRadixTreeIndex indexes a ValueSegment of a mutable chunk and is updated in place as rows are
+ * appended to the chunk (see Chunk::append() and the Insert operator). Once the ChunkCompressionTask has encoded the
+ * chunk, it is frozen into an AdaptiveRadixTreeIndex on the new DictionarySegment (see
+ * Chunk::freeze_mutable_indexes()).
+ *
+ * Like the AdaptiveRadixTreeIndex, it is a radix tree with nodes for up to 4, 16, 48, and 256 children. Instead of
+ * ValueIDs, which do not exist for ValueSegments, its keys are the values themselves, transformed into byte strings
+ * that compare like the values. A leaf is only expanded into inner nodes once a second key with the same prefix is
+ * inserted (lazy expansion).
+ *
+ * Lookups are latch-free, inserts are serialized by a mutex. An insert never modifies a node in a way that a
+ * concurrent lookup could observe in an inconsistent state: Nodes with 48 and 256 children publish new children with
+ * atomic stores, while nodes with 4 and 16 children are copied and atomically replaced in their parent when they gain
+ * a child. Replaced nodes are kept until the index is destroyed, so lookups never follow a dangling pointer.
+ *
+ * NULL values are not indexed. Like the other indexes, the index is not MVCC-aware, so rows that are not visible to a
+ * transaction have to be removed by the Validate operator.
+ */
+class MutableAdaptiveRadixTreeIndex : private Noncopyable {
+ public:
+  struct Bound {
+    AllTypeVariant value;
+    bool is_inclusive;
+  };
+
+  // Creates the index on a ValueSegment and adds its current rows
+  explicit MutableAdaptiveRadixTreeIndex(const std::shared_ptr<const BaseSegment>& segment);
+  ~MutableAdaptiveRadixTreeIndex();
+
+  const std::shared_ptr<const BaseSegment>& indexed_segment() const;
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset) of the segment, whose values must have been written
+  void insert(const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  // Returns the offsets of all rows with a value between the lower and the upper bound, ordered by value. A bound that
+  // is not set does not restrict the range. The values of the bounds must be losslessly castable to the data type of
+  // the segment.
+  std::vector<ChunkOffset> range(const std::optional<Bound>& lower, const std::optional<Bound>& upper) const;
+
+  // Calls the function once for each distinct value in ascending order, passing the offsets of the rows that hold it
+  void for_each_value(const std::function<void(const std::vector<ChunkOffset>&)>& function) const;
+
+ protected:
+  using Key = std::vector<uint8_t>;
+
+  Key _key(const AllTypeVariant& value) const;
+
+  void _insert(Key&& key, const ChunkOffset chunk_offset);
+
+  MutableARTNode* _make_leaf(Key&& key, const ChunkOffset chunk_offset);
+  MutableARTNode* _make_inner_node(const std::vector<std::pair<uint8_t, MutableARTNode*>>& children);
+
+  const std::shared_ptr<const BaseSegment> _indexed_segment;
+
+  std::atomic<MutableARTNode*> _root{nullptr};
+
+  // Owns all nodes, including those that were replaced and may still be read by concurrent lookups
+  std::vector<std::unique_ptr<MutableARTNode>> _nodes;
+  std::mutex _insert_mutex;
+};
+
+}  // namespace opossum
@@ -0,0 +1,118 @@
+#include "primary_key_index.hpp"
+
+#include <algorithm>
+#include <functional>
+#include <mutex>
+#include <vector>
+
+#include <boost/functional/hash.hpp>
+
+#include "hyrise.hpp"
+#include "lossless_cast.hpp"
+#include "storage/table.hpp"
+#include "utils/assert.hpp"
+
+namespace opossum {
+
+PrimaryKeyIndex::PrimaryKeyIndex(const Table& table, const std::vector<ColumnID>& column_ids)
+    : _table(table), _column_ids(column_ids) {
+  Assert(!_column_ids.empty(), "PrimaryKeyIndex requires at least one column");
+  Assert(_table.type() == TableType::Data, "PrimaryKeyIndex can only be created on data tables");
+  for (const auto column_id : _column_ids) {
+    Assert(column_id < _table.column_count(), "ColumnID out of range");
+  }
+
+  const auto chunk_count = _table.chunk_count();
+  for (auto chunk_id = ChunkID{0}; chunk_id < chunk_count; ++chunk_id) {
+    const auto chunk = _table.get_chunk(chunk_id);
+    if (!chunk) continue;
+
+    insert(chunk_id, ChunkOffset{0}, chunk->size());
+  }
+}
+
+const std::vector<ColumnID>& PrimaryKeyIndex::column_ids() const { return _column_ids; }
+
+void PrimaryKeyIndex::insert(const ChunkID chunk_id, const ChunkOffset begin_chunk_offset,
+                             const ChunkOffset end_chunk_offset) {
+  const auto chunk = _table.get_chunk(chunk_id);
+  Assert(chunk, "Cannot index rows of a physically deleted chunk");
+
+  // Rows whose end_cid is not after the oldest snapshot are invisible for all current and future transactions. The
+  // last commit ID is read first: A transaction that starts after it was read has a snapshot of at least this commit
+  // ID, even if it is missing from the active snapshots read afterwards. Reading the active snapshots first instead
+  // would miss a transaction that starts in between and overestimate the oldest snapshot.
+  const auto& transaction_manager = Hyrise::get().transaction_manager;
+  const auto last_commit_id = transaction_manager.last_commit_id();
+  const auto lowest_active_snapshot_commit_id = transaction_manager.get_lowest_active_snapshot_commit_id();
+  const auto oldest_snapshot_commit_id =
+      std::min(last_commit_id, lowest_active_snapshot_commit_id.value_or(last_commit_id));
+
+  for (auto chunk_offset = begin_chunk_offset; chunk_offset < end_chunk_offset; ++chunk_offset) {
+    auto key = Key{};
+    key.reserve(_column_ids.size());
+    for (const auto column_id : _column_ids) {
+      key.emplace_back((*chunk->get_segment(column_id))[chunk_offset]);
+    }
+
+    const auto key_hash = KeyHash{}(key);
+    auto& shard = _shard(key_hash);
+
+    const auto lock = std::unique_lock<std::shared_mutex>{shard.mutex};
+    auto& row_ids = shard.row_ids_by_key[std::move(key)];
+    row_ids.erase(std::remove_if(row_ids.begin(), row_ids.end(),
+                                 [&](const auto& row_id) { return _is_row_dead(row_id, oldest_snapshot_commit_id); }),
+                  row_ids.end());
+    row_ids.emplace_back(RowID{chunk_id, chunk_offset});
+  }
+}
+
+std::vector<RowID> PrimaryKeyIndex::lookup(const std::vector<AllTypeVariant>& key) const {
+  Assert(key.size() == _column_ids.size(), "Expected one value per column of the PrimaryKeyIndex");
+
+  auto cast_key = Key{};
+  cast_key.reserve(key.size());
+  for (auto column_idx = size_t{0}; column_idx < key.size(); ++column_idx) {
+    if (variant_is_null(key[column_idx])) return {};
+
+    const auto cast_value = lossless_variant_cast(key[column_idx], _table.column_data_type(_column_ids[column_idx]));
+    if (!cast_value) return {};
+
+    cast_key.emplace_back(*cast_value);
+  }
+
+  const auto key_hash = KeyHash{}(cast_key);
+  const auto& shard = _shard(key_hash);
+
+  const auto lock = std::shared_lock<std::shared_mutex>{shard.mutex};
+  const auto iter = shard.row_ids_by_key.find(cast_key);
+  if (iter == shard.row_ids_by_key.end()) return {};
+
+  return iter->second;
+}
+
+size_t PrimaryKeyIndex::KeyHash::operator()(const Key& key) const {
+  auto hash = size_t{0};
+  for (const auto& value : key) {
+    boost::hash_combine(hash, std::hash<AllTypeVariant>{}(value));
+  }
+  return hash;
+}
+
+PrimaryKeyIndex::Shard& PrimaryKeyIndex::_shard(const size_t key_hash) { return _shards[key_hash % SHARD_COUNT]; }
+
+const PrimaryKeyIndex::Shard& PrimaryKeyIndex::_shard(const size_t key_hash) const {
+  return _shards[key_hash % SHARD_COUNT];
+}
+
+bool PrimaryKeyIndex::_is_row_dead(const RowID& row_id, const CommitID oldest_snapshot_commit_id) const {
+  const auto chunk = _table.get_chunk(row_id.chunk_id);
+  if (!chunk) return true;
+
+  // Rows of tables without MVCC data are never deleted
+  if (!chunk->has_mvcc_data()) return false;
+
+  return chunk->mvcc_data()->get_end_cid(row_id.chunk_offset) <= oldest_snapshot_commit_id;
+}
+
+}  // namespace opossum
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <array>
+#include <shared_mutex>
+#include <unordered_map>
+#include <vector>
+
+#include "all_type_variant.hpp"
+#include "types.hpp"
+
+namespace opossum {
+
+class Table;
+
+/**
+ * A hash index over the primary key of a table. Unlike the chunk indexes (see AbstractIndex), which are created per
+ * chunk and have to be probed one by one, it covers all chunks of the table, including those appended after it was
+ * created. Thus, a point lookup on the primary key is a single hash lookup, independent of the number of chunks.
+ *
+ * The index is maintained by the Insert operator (and thus by Update, which inserts the new versions of the rows).
+ * Deleting a row only sets its end_cid, so the index is not modified by deletes. Instead, the index is MVCC-aware in
+ * the same way as the table: It maps a key to all rows that had this key at some point, and lookups return these rows
+ * as candidates. Which of them are visible to a transaction is decided by the Validate operator (or by the operator
+ * using the index, see JoinIndex). Rows that are invisible for all current and future transactions, i.e., deleted
+ * rows, rolled-back inserts, and rows in physically deleted chunks, are removed lazily once the same key is inserted
+ * again.
+ *
+ * The index is concurrent: It is partitioned into shards by the hash of the key, each of which is protected by a
+ * shared mutex. Lookups only acquire a shared lock on one shard, inserts an exclusive one.
+ *
+ * NOTE: Like the constraint it is based on, the index does NOT ENFORCE uniqueness. Inserting a duplicate key adds
+ * another candidate row.
+ */
+class PrimaryKeyIndex : private Noncopyable {
+ public:
+  // Creates the index over the given columns and adds all rows that are currently in the table
+  PrimaryKeyIndex(const Table& table, const std::vector<ColumnID>& column_ids);
+
+  const std::vector<ColumnID>& column_ids() const;
+
+  // Adds the rows [begin_chunk_offset, end_chunk_offset) of the given chunk, whose values must have been written
+  void insert(const ChunkID chunk_id, const ChunkOffset begin_chunk_offset, const ChunkOffset end_chunk_offset);
+
+  // Returns the candidate rows for the given key, which contains one value per column in the order of column_ids().
+  // The values are cast to the data types of the columns. No row is returned for a NULL value or a value that cannot
+  // be represented in the data type of its column.
+  std::vector<RowID> lookup(const std::vector<AllTypeVariant>& key) const;
+
+  static constexpr auto SHARD_COUNT = size_t{64};
+
+ protected:
+  using Key = std::vector<AllTypeVariant>;
+
+  struct KeyHash {
+    size_t operator()(const Key& key) const;
+  };
+
+  struct Shard {
+    mutable std::shared_mutex mutex;
+    std::unordered_map<Key, std::vector<RowID>, KeyHash> row_ids_by_key;
+  };
+
+  Shard& _shard(const size_t key_hash);
+  const Shard& _shard(const size_t key_hash) const;
+
+  // Returns whether the row is invisible for all transactions with a snapshot commit ID of at least
+  // `oldest_snapshot_commit_id`
+  bool _is_row_dead(const RowID& row_id, const CommitID oldest_snapshot_commit_id) const;
+
+  const Table& _table;
+  const std::vector<ColumnID> _column_ids;
+
+  std::array<Shard, SHARD_COUNT> _shards;
+};
+
+}  // namespace opossum
@@ -26,9 +26,26 @@ ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& reference
   Assert(pos->size() <= Chunk::MAX_SIZE, "PosList exceeds Chunk::MAX_SIZE");
 }
 
+ReferenceSegment::ReferenceSegment(const std::shared_ptr<const Table>& referenced_table,
+                                   const ColumnID referenced_column_id,
+                                   const std::shared_ptr<const CompactPosList>& compact_pos_list)
+    : BaseSegment(referenced_table->column_data_type(referenced_column_id)),
+      _referenced_table(referenced_table),
+      _referenced_column_id(referenced_column_id),
+      _compact_pos_list(compact_pos_list) {
+  Assert(_referenced_column_id < _referenced_table->column_count(), "ColumnID out of range");
+  Assert(referenced_table->type() == TableType::Data, "Referenced table must be Data Table");
+  Assert(compact_pos_list->chunk_id() < referenced_table->chunk_count(), "ChunkID out of range");
+}
+
 AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) const {
   PerformanceWarning("operator[] used");
 
+  if (_compact_pos_list) {
+    const auto chunk = _referenced_table->get_chunk(_compact_pos_list->chunk_id());
+    return (*chunk->get_segment(_referenced_column_id))[_compact_pos_list->chunk_offset(chunk_offset)];
+  }
+
   const auto row_id = (*_pos_list)[chunk_offset];
 
   if (row_id.is_null()) return NULL_VALUE;
@@ -38,11 +55,19 @@ AllTypeVariant ReferenceSegment::operator[](const ChunkOffset chunk_offset) cons
   return (*chunk->get_segment(_referenced_column_id))[row_id.chunk_offset];
 }
 
-const std::shared_ptr<const PosList>& ReferenceSegment::pos_list() const { return _pos_list; }
+const std::shared_ptr<const PosList>& ReferenceSegment::pos_list() const {
+  if (_compact_pos_list) return _compact_pos_list->materialize();
+  return _pos_list;
+}
+
+const std::shared_ptr<const CompactPosList>& ReferenceSegment::compact_pos_list() const { return _compact_pos_list; }
 const std::shared_ptr<const Table>& ReferenceSegment::referenced_table() const { return _referenced_table; }
 ColumnID ReferenceSegment::referenced_column_id() const { return _referenced_column_id; }
 
-ChunkOffset ReferenceSegment::size() const { return static_cast<ChunkOffset>(_pos_list->size()); }
+ChunkOffset ReferenceSegment::size() const {
+  if (_compact_pos_list) return _compact_pos_list->size();
+  return static_cast<ChunkOffset>(_pos_list->size());
+}
 
 std::shared_ptr<BaseSegment> ReferenceSegment::copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
   // ReferenceSegments are considered as intermediate datastructures and are
@@ -52,6 +77,7 @@ std::shared_ptr<BaseSegment> ReferenceSegment::copy_using_allocator(const Polymo
 
 size_t ReferenceSegment::memory_usage(const MemoryUsageCalculationMode) const {
   // Ignoring MemoryUsageCalculationMode because accurate calculation is efficient.
+  if (_compact_pos_list) return sizeof(*this) + _compact_pos_list->memory_usage();
   return sizeof(*this) + _pos_list->size() * sizeof(decltype(_pos_list)::element_type::value_type);
 }
 
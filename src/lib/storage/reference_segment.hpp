@@ -8,6 +8,7 @@
 #include <vector>
 
 #include "base_segment.hpp"
+#include "storage/compact_pos_list.hpp"
 #include "storage/pos_list.hpp"
 #include "table.hpp"
 #include "types.hpp"
@@ -24,11 +25,21 @@ class ReferenceSegment : public BaseSegment {
   ReferenceSegment(const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
                    const std::shared_ptr<const PosList>& pos);
 
+  // creates a reference segment whose positions are given as a CompactPosList
+  ReferenceSegment(const std::shared_ptr<const Table>& referenced_table, const ColumnID referenced_column_id,
+                   const std::shared_ptr<const CompactPosList>& compact_pos_list);
+
   AllTypeVariant operator[](const ChunkOffset chunk_offset) const override;
 
   ChunkOffset size() const final;
 
+  // If the segment was created with a CompactPosList, the PosList is materialized on the first call. Code that can
+  // handle CompactPosLists should check compact_pos_list() first.
   const std::shared_ptr<const PosList>& pos_list() const;
+
+  // Returns the CompactPosList if the segment was created with one, nullptr otherwise
+  const std::shared_ptr<const CompactPosList>& compact_pos_list() const;
+
   const std::shared_ptr<const Table>& referenced_table() const;
 
   ColumnID referenced_column_id() const;
@@ -44,8 +55,9 @@ class ReferenceSegment : public BaseSegment {
 
   const ColumnID _referenced_column_id;
 
-  // The position list can be shared amongst multiple segments
+  // The position list can be shared amongst multiple segments. Exactly one of the two is set.
   const std::shared_ptr<const PosList> _pos_list;
+  const std::shared_ptr<const CompactPosList> _compact_pos_list;
 };
 
 }  // namespace opossum
@@ -29,6 +29,35 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
     const auto referenced_table = _segment.referenced_table();
     const auto referenced_column_id = _segment.referenced_column_id();
 
+    if (const auto& compact_pos_list = _segment.compact_pos_list()) {
+      // A CompactPosList references a single chunk without NULL values. If it starts at the beginning of the chunk and
+      // has no gaps, the chunk offsets are the same as the positions in the ReferenceSegment. In that case, we iterate
+      // sequentially over the referenced segment instead of accessing it through a position filter.
+      const auto referenced_segment =
+          referenced_table->get_chunk(compact_pos_list->chunk_id())->get_segment(referenced_column_id);
+
+      if (compact_pos_list->is_range() && compact_pos_list->begin_chunk_offset() == 0) {
+        _with_referenced_segment_iterable(*referenced_segment, [&](const auto& segment_iterable) {
+          segment_iterable.with_iterators([&](auto begin, const auto end) {
+            DebugAssert(std::distance(begin, end) >= static_cast<std::ptrdiff_t>(compact_pos_list->size()),
+                        "CompactPosList references rows beyond the end of the segment");
+            functor(begin, begin + compact_pos_list->size());
+          });
+        });
+        return;
+      }
+
+      const auto accessor = std::shared_ptr<AbstractSegmentAccessor<T>>{create_segment_accessor<T>(referenced_segment)};
+      const auto first_chunk_offset = compact_pos_list->size() > 0 ? compact_pos_list->chunk_offset(ChunkOffset{0})
+                                                                   : ChunkOffset{0};
+
+      auto begin = CompactPosListIterator{accessor, compact_pos_list, ChunkOffset{0}, first_chunk_offset};
+      auto end = CompactPosListIterator{accessor, compact_pos_list, compact_pos_list->size(), INVALID_CHUNK_OFFSET};
+
+      functor(begin, end);
+      return;
+    }
+
     const auto& pos_list = _segment.pos_list();
 
     const auto begin_it = pos_list->begin();
@@ -47,124 +76,137 @@ class ReferenceSegmentIterable : public SegmentIterable<ReferenceSegmentIterable
 
       auto referenced_segment = referenced_table->get_chunk(begin_it->chunk_id)->get_segment(referenced_column_id);
 
-      bool functor_was_called = false;
+      _with_referenced_segment_iterable(*referenced_segment, [&](const auto& segment_iterable) {
+        segment_iterable.with_iterators(pos_list, functor);
+      });
+    } else {
+      using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
+
+      auto accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
+
+      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, begin_it};
+      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, end_it};
+
+      functor(begin, end);
+    }
+  }
+
+  size_t _on_size() const { return _segment.size(); }
+
+ private:
+  const ReferenceSegment& _segment;
 
-      if constexpr (erase_reference_segment_type == EraseReferencedSegmentType::No) {
-        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_segment) {
-          using SegmentType = std::decay_t<decltype(typed_segment)>;
+ private:
+  // Calls `functor` with the iterable of the referenced segment. Unless the referenced segment type is erased, this is
+  // the iterable of the specific segment type.
+  template <typename Functor>
+  void _with_referenced_segment_iterable(const BaseSegment& referenced_segment, const Functor& functor) const {
+    bool functor_was_called = false;
 
-          // This is ugly, but it allows us to define segment types that we are not interested in and save a lot of
-          // compile time during development. While new segment types should be added here,
+    if constexpr (erase_reference_segment_type == EraseReferencedSegmentType::No) {
+      resolve_segment_type<T>(referenced_segment, [&](const auto& typed_segment) {
+        using SegmentType = std::decay_t<decltype(typed_segment)>;
+
+        // This is ugly, but it allows us to define segment types that we are not interested in and save a lot of
+        // compile time during development. While new segment types should be added here,
 #ifdef HYRISE_ERASE_DICTIONARY
-          if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) return;
+        if constexpr (std::is_same_v<SegmentType, DictionarySegment<T>>) return;
 #endif
 
 #ifdef HYRISE_ERASE_RUNLENGTH
-          if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) return;
+        if constexpr (std::is_same_v<SegmentType, RunLengthSegment<T>>) return;
 #endif
 
 #ifdef HYRISE_ERASE_FIXEDSTRINGDICTIONARY
-          if constexpr (std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) return;
+        if constexpr (std::is_same_v<SegmentType, FixedStringDictionarySegment<T>>) return;
 #endif
 
 #ifdef HYRISE_ERASE_FRAMEOFREFERENCE
-          if constexpr (std::is_same_v<T, int32_t>) {
-            if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
-          }
+        if constexpr (std::is_same_v<T, int32_t>) {
+          if constexpr (std::is_same_v<SegmentType, FrameOfReferenceSegment<T>>) return;
+        }
 #endif
 
-          // Always erase LZ4Segment accessors
-          if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) return;
+        // Always erase LZ4Segment accessors
+        if constexpr (std::is_same_v<SegmentType, LZ4Segment<T>>) return;
 
-          if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
-            const auto segment_iterable = create_iterable_from_segment<T>(typed_segment);
+        if constexpr (!std::is_same_v<SegmentType, ReferenceSegment>) {
+          functor(create_iterable_from_segment<T>(typed_segment));
 
-            segment_iterable.with_iterators(pos_list, functor);
-
-            functor_was_called = true;
-          } else {
-            Fail("Found ReferenceSegment pointing to ReferenceSegment");
-          }
-        });
-
-        if (!functor_was_called) {
-          PerformanceWarning("ReferenceSegmentIterable for referenced segment type erased by compile-time setting");
+          functor_was_called = true;
+        } else {
+          Fail("Found ReferenceSegment pointing to ReferenceSegment");
         }
+      });
 
-      } else {
-        PerformanceWarning("Using type-erased accessor as the ReferenceSegmentIterable is type-erased itself");
+      if (!functor_was_called) {
+        PerformanceWarning("ReferenceSegmentIterable for referenced segment type erased by compile-time setting");
       }
 
-      if (functor_was_called) return;
-
-      // The functor was not called yet, because we did not instantiate specialized code for the segment type.
-
-      const auto segment_iterable = create_any_segment_iterable<T>(*referenced_segment);
-      segment_iterable.with_iterators(pos_list, functor);
     } else {
-      using Accessors = std::vector<std::shared_ptr<AbstractSegmentAccessor<T>>>;
-
-      auto accessors = std::make_shared<Accessors>(referenced_table->chunk_count());
-
-      auto begin = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, begin_it};
-      auto end = MultipleChunkIterator{referenced_table, referenced_column_id, accessors, begin_it, end_it};
-
-      functor(begin, end);
+      PerformanceWarning("Using type-erased accessor as the ReferenceSegmentIterable is type-erased itself");
     }
-  }
 
-  size_t _on_size() const { return _segment.size(); }
+    if (functor_was_called) return;
 
- private:
-  const ReferenceSegment& _segment;
+    // The functor was not called yet, because we did not instantiate specialized code for the segment type.
+    functor(create_any_segment_iterable<T>(referenced_segment));
+  }
 
  private:
-  // The iterator for cases where we iterate over a single referenced chunk
-  template <typename Accessor>
-  class SingleChunkIterator : public BaseSegmentIterator<SingleChunkIterator<Accessor>, SegmentPosition<T>> {
+  // The iterator for ReferenceSegments with a CompactPosList that cannot be iterated sequentially
+  class CompactPosListIterator : public BaseSegmentIterator<CompactPosListIterator, SegmentPosition<T>> {
    public:
     using ValueType = T;
     using IterableType = ReferenceSegmentIterable<T, erase_reference_segment_type>;
-    using PosListIterator = PosList::const_iterator;
 
    public:
-    explicit SingleChunkIterator(const std::shared_ptr<Accessor>& accessor, const PosListIterator& begin_pos_list_it,
-                                 const PosListIterator& pos_list_it)
-        : _begin_pos_list_it{begin_pos_list_it}, _pos_list_it{pos_list_it}, _accessor{accessor} {}
+    explicit CompactPosListIterator(const std::shared_ptr<AbstractSegmentAccessor<T>>& accessor,
+                                    const std::shared_ptr<const CompactPosList>& compact_pos_list,
+                                    const ChunkOffset pos_list_offset, const ChunkOffset chunk_offset)
+        : _accessor{accessor},
+          _compact_pos_list{compact_pos_list},
+          _pos_list_offset{pos_list_offset},
+          _chunk_offset{chunk_offset} {}
 
    private:
     friend class boost::iterator_core_access;  // grants the boost::iterator_facade access to the private interface
 
-    void increment() { ++_pos_list_it; }
+    // The chunk offset of the next row is found without searching the CompactPosList
+    void increment() {
+      ++_pos_list_offset;
+      _chunk_offset = _compact_pos_list->next_chunk_offset(_chunk_offset);
+    }
 
-    void decrement() { --_pos_list_it; }
+    void decrement() { advance(-1); }
 
-    void advance(std::ptrdiff_t n) { _pos_list_it += n; }
+    void advance(std::ptrdiff_t n) {
+      _pos_list_offset += n;
+      _chunk_offset = _pos_list_offset < _compact_pos_list->size() ? _compact_pos_list->chunk_offset(_pos_list_offset)
+                                                                   : INVALID_CHUNK_OFFSET;
+    }
 
-    bool equal(const SingleChunkIterator& other) const { return _pos_list_it == other._pos_list_it; }
+    bool equal(const CompactPosListIterator& other) const { return _pos_list_offset == other._pos_list_offset; }
 
-    std::ptrdiff_t distance_to(const SingleChunkIterator& other) const { return other._pos_list_it - _pos_list_it; }
+    std::ptrdiff_t distance_to(const CompactPosListIterator& other) const {
+      return static_cast<std::ptrdiff_t>(other._pos_list_offset) - _pos_list_offset;
+    }
 
     SegmentPosition<T> dereference() const {
-      const auto pos_list_offset = static_cast<ChunkOffset>(std::distance(_begin_pos_list_it, _pos_list_it));
-
-      if (_pos_list_it->is_null()) return SegmentPosition<T>{T{}, true, pos_list_offset};
-
-      const auto& chunk_offset = _pos_list_it->chunk_offset;
-
-      const auto typed_value = _accessor->access(chunk_offset);
+      const auto typed_value = _accessor->access(_chunk_offset);
 
       if (typed_value) {
-        return SegmentPosition<T>{std::move(*typed_value), false, pos_list_offset};
+        return SegmentPosition<T>{std::move(*typed_value), false, _pos_list_offset};
       } else {
-        return SegmentPosition<T>{T{}, true, pos_list_offset};
+        return SegmentPosition<T>{T{}, true, _pos_list_offset};
       }
     }
 
    private:
-    PosListIterator _begin_pos_list_it;
-    PosListIterator _pos_list_it;
-    std::shared_ptr<Accessor> _accessor;
+    std::shared_ptr<AbstractSegmentAccessor<T>> _accessor;
+    std::shared_ptr<const CompactPosList> _compact_pos_list;
+    ChunkOffset _pos_list_offset;
+    ChunkOffset _chunk_offset;
   };
 
   // The iterator for cases where we potentially iterate over multiple referenced chunks
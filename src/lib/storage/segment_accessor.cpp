@@ -10,6 +10,22 @@ std::unique_ptr<AbstractSegmentAccessor<T>> CreateSegmentAccessor<T>::create(
   resolve_segment_type<T>(*segment, [&](const auto& typed_segment) {
     using SegmentType = std::decay_t<decltype(typed_segment)>;
     if constexpr (std::is_same_v<SegmentType, ReferenceSegment>) {
+      if (const auto& compact_pos_list = typed_segment.compact_pos_list()) {
+        auto referenced_segment = typed_segment.referenced_table()
+                                      ->get_chunk(compact_pos_list->chunk_id())
+                                      ->get_segment(typed_segment.referenced_column_id());
+        resolve_segment_type<T>(*referenced_segment, [&](const auto& typed_referenced_segment) {
+          using ReferencedSegment = std::decay_t<decltype(typed_referenced_segment)>;
+          if constexpr (!std::is_same_v<ReferencedSegment, ReferenceSegment>) {
+            accessor = std::make_unique<CompactReferenceSegmentAccessor<T, ReferencedSegment>>(
+                *compact_pos_list, typed_referenced_segment);
+          } else {
+            Fail("Encountered nested ReferenceSegments");
+          }
+        });
+        return;
+      }
+
       const auto& pos_list = *typed_segment.pos_list();
       if (pos_list.references_single_chunk() && !pos_list.empty()) {
         // If the pos list stores a NULL value, its chunk_id references a non-existing chunk. If all entries reference
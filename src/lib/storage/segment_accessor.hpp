@@ -121,6 +121,28 @@ class SingleChunkReferenceSegmentAccessor final : public AbstractSegmentAccessor
   const Segment& _segment;
 };
 
+// Accessor for ReferenceSegments whose positions are stored in a CompactPosList
+template <typename T, typename Segment>
+class CompactReferenceSegmentAccessor final : public AbstractSegmentAccessor<T> {
+ public:
+  explicit CompactReferenceSegmentAccessor(const CompactPosList& compact_pos_list, const Segment& segment)
+      : _compact_pos_list{compact_pos_list}, _segment(segment) {}
+
+  const std::optional<T> access(ChunkOffset offset) const final {
+    ++_accesses;
+    return _segment.get_typed_value(_compact_pos_list.chunk_offset(offset));
+  }
+
+  ~CompactReferenceSegmentAccessor() {
+    _segment.access_counter[SegmentAccessCounter::AccessType::Random] += _accesses;
+  }
+
+ protected:
+  mutable uint64_t _accesses{0};
+  const CompactPosList& _compact_pos_list;
+  const Segment& _segment;
+};
+
 // Accessor for ReferenceSegments that reference only NULL values
 template <typename T>
 class NullAccessor final : public AbstractSegmentAccessor<T> {
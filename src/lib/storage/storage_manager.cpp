@@ -12,7 +12,6 @@
 #include "operators/table_wrapper.hpp"
 #include "scheduler/job_task.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
-#include "statistics/table_statistics.hpp"
 #include "utils/assert.hpp"
 #include "utils/meta_table_manager.hpp"
 
@@ -29,8 +28,9 @@ void StorageManager::add_table(const std::string& name, std::shared_ptr<Table> t
     Assert(table->get_chunk(chunk_id)->has_mvcc_data(), "Table must have MVCC data.");
   }
 
-  // Create table statistics and chunk pruning statistics for added table.
-  table->set_table_statistics(TableStatistics::from_table(*table));
+  // Create table statistics, which are kept up to date as the table changes, and chunk pruning statistics for added
+  // table.
+  table->maintain_table_statistics();
   generate_chunk_pruning_statistics(table);
 
   _tables.emplace(name, std::move(table));
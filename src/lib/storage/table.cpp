@@ -10,8 +10,10 @@
 
 #include "concurrency/transaction_manager.hpp"
 #include "resolve_type.hpp"
+#include "scheduler/job_task.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/table_statistics.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
 #include "storage/segment_iterate.hpp"
 #include "types.hpp"
 #include "utils/assert.hpp"
@@ -148,6 +150,14 @@ void Table::append_mutable_chunk() {
   }
 
   append_chunk(segments, mvcc_data);
+
+  // Mutable chunks cannot have AdaptiveRadixTreeIndexes, so they get mutable indexes instead (see Chunk)
+  const auto chunk = get_chunk(ChunkID{chunk_count() - 1});
+  for (const auto& index_statistics : _indexes) {
+    if (index_statistics.type == SegmentIndexType::AdaptiveRadixTree && index_statistics.column_ids.size() == 1) {
+      chunk->create_mutable_index(index_statistics.column_ids.front());
+    }
+  }
 }
 
 uint64_t Table::row_count() const {
@@ -208,6 +218,8 @@ void Table::remove_chunk(ChunkID chunk_id) {
               "Physical delete of chunk prevented: Chunk needs to be fully invalidated before.");
   Assert(_type == TableType::Data, "Removing chunks from other tables than data tables is not intended yet.");
   std::atomic_store(&_chunks[chunk_id], std::shared_ptr<Chunk>(nullptr));
+
+  schedule_table_statistics_refresh();
 }
 
 void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvcc_data,  // NOLINT
@@ -231,6 +243,8 @@ void Table::append_chunk(const Segments& segments, std::shared_ptr<MvccData> mvc
 
   auto new_chunk_iter = _chunks.push_back(nullptr);
   std::atomic_store(&*new_chunk_iter, std::make_shared<Chunk>(segments, mvcc_data, alloc));
+
+  schedule_table_statistics_refresh();
 }
 
 std::vector<AllTypeVariant> Table::get_row(size_t row_idx) const {
@@ -289,10 +303,38 @@ std::vector<std::vector<AllTypeVariant>> Table::get_rows() const {
 
 std::unique_lock<std::mutex> Table::acquire_append_mutex() { return std::unique_lock<std::mutex>(*_append_mutex); }
 
-std::shared_ptr<TableStatistics> Table::table_statistics() const { return _table_statistics; }
+std::shared_ptr<TableStatistics> Table::table_statistics() const { return std::atomic_load(&_table_statistics); }
 
 void Table::set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics) {
-  _table_statistics = table_statistics;
+  std::atomic_store(&_table_statistics, table_statistics);
+}
+
+void Table::maintain_table_statistics(const size_t target_sample_row_count) {
+  Assert(_type == TableType::Data, "Table statistics can only be maintained for data tables");
+  Assert(!weak_from_this().expired(), "Table statistics can only be maintained for tables owned by a shared_ptr");
+
+  _table_sample = std::make_shared<TableSample>(*this, target_sample_row_count);
+  set_table_statistics(_table_sample->table_statistics());
+}
+
+void Table::schedule_table_statistics_refresh() const {
+  if (!_table_sample) return;
+
+  // A refresh that is scheduled but has not started yet will also see this change
+  if (_is_table_statistics_refresh_scheduled.exchange(true)) return;
+
+  const auto job = std::make_shared<JobTask>([weak_table = weak_from_this()]() {
+    const auto table = weak_table.lock();
+    if (!table) return;
+
+    // Serialize refreshes, so that older statistics never replace newer ones
+    const auto lock = std::lock_guard<std::mutex>{table->_table_statistics_refresh_mutex};
+    table->_is_table_statistics_refresh_scheduled = false;
+    if (table->_table_sample->update(*table)) {
+      std::atomic_store(&table->_table_statistics, table->_table_sample->table_statistics());
+    }
+  });
+  job->schedule();
 }
 
 std::vector<IndexStatistics> Table::indexes_statistics() const { return _indexes; }
@@ -331,6 +373,23 @@ void Table::add_soft_unique_constraint(const std::vector<ColumnID>& column_ids,
   }
 }
 
+void Table::create_primary_key_index() {
+  const auto primary_key_iter =
+      std::find_if(_constraint_definitions.begin(), _constraint_definitions.end(),
+                   [](const auto& constraint) { return constraint.is_primary_key == IsPrimaryKey::Yes; });
+  Assert(primary_key_iter != _constraint_definitions.end(), "Table has no primary key constraint");
+  Assert(!_primary_key_index, "Primary key index was already created");
+
+  _primary_key_index = std::make_shared<PrimaryKeyIndex>(*this, primary_key_iter->columns);
+}
+
+void Table::rebuild_primary_key_index() {
+  Assert(_primary_key_index, "Primary key index was not created");
+  _primary_key_index = std::make_shared<PrimaryKeyIndex>(*this, _primary_key_index->column_ids());
+}
+
+std::shared_ptr<PrimaryKeyIndex> Table::primary_key_index() const { return _primary_key_index; }
+
 size_t Table::memory_usage(const MemoryUsageCalculationMode mode) const {
   auto bytes = size_t{sizeof(*this)};
 
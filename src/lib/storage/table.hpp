@@ -1,14 +1,18 @@
 #pragma once
 
+#include <atomic>
 #include <memory>
 #include <mutex>
 #include <string>
+#include <type_traits>
 #include <utility>
 #include <vector>
 
 #include "base_segment.hpp"
+#include "base_value_segment.hpp"
 #include "boost/variant.hpp"
 #include "chunk.hpp"
+#include "statistics/table_sample.hpp"
 #include "storage/constraints/table_constraint_definition.hpp"
 #include "storage/index/index_statistics.hpp"
 #include "storage/table_column_definition.hpp"
@@ -18,12 +22,13 @@
 
 namespace opossum {
 
+class PrimaryKeyIndex;
 class TableStatistics;
 
 /**
  * A Table is partitioned horizontally into a number of chunks.
  */
-class Table : private Noncopyable {
+class Table : public std::enable_shared_from_this<Table>, private Noncopyable {
   friend class StorageTableTest;
 
  public:
@@ -172,6 +177,21 @@ class Table : private Noncopyable {
   std::shared_ptr<TableStatistics> table_statistics() const;
 
   void set_table_statistics(const std::shared_ptr<TableStatistics>& table_statistics);
+
+  /**
+   * Creates the table statistics from a sample of the table (see TableSample) and keeps them up to date: Whenever a
+   * chunk is appended, encoded, or removed, or a transaction that inserted or deleted rows commits, a background job
+   * samples the chunks that changed and replaces the statistics. The table must be owned by a shared_ptr and must not
+   * be modified concurrently while this is called.
+   */
+  void maintain_table_statistics(const size_t target_sample_row_count = TableSample::DEFAULT_TARGET_ROW_COUNT);
+
+  /**
+   * Schedules a background job that refreshes the maintained statistics, if any. Called whenever the rows of the
+   * table change. (The function is marked as const, as the Delete operator only holds const pointers to the tables it
+   * deletes from.)
+   */
+  void schedule_table_statistics_refresh() const;
   /** @} */
 
   std::vector<IndexStatistics> indexes_statistics() const;
@@ -185,6 +205,15 @@ class Table : private Noncopyable {
       auto chunk = std::atomic_load(&_chunks[chunk_id]);
       Assert(chunk, "Physically deleted chunk should not reach this point, see get_chunk / #1686.");
 
+      if constexpr (std::is_same_v<Index, AdaptiveRadixTreeIndex>) {
+        // Segments that are not encoded yet get a mutable index, which is frozen once the chunk is encoded
+        if (column_ids.size() == 1 &&
+            std::dynamic_pointer_cast<const BaseValueSegment>(chunk->get_segment(column_ids.front()))) {
+          chunk->create_mutable_index(column_ids.front());
+          continue;
+        }
+      }
+
       chunk->create_index<Index>(column_ids);
     }
     IndexStatistics index_statistics = {column_ids, name, index_type};
@@ -200,6 +229,22 @@ class Table : private Noncopyable {
   void add_soft_unique_constraint(const std::vector<ColumnID>& column_ids, const IsPrimaryKey is_primary_key);
   const std::vector<TableConstraintDefinition>& get_soft_unique_constraints() const;
 
+  /**
+   * Creates a table-wide hash index on the columns of the primary key constraint (see PrimaryKeyIndex). In contrast to
+   * the chunk indexes created by create_index(), it also covers chunks that are appended later. Like create_index(),
+   * it must not be called while the table is modified concurrently.
+   * @{
+   */
+  void create_primary_key_index();
+
+  // Replaces the primary key index by a new one over the current rows, e.g., after rows were modified without the
+  // Insert operator during recovery (see LogManager::recover)
+  void rebuild_primary_key_index();
+
+  // Returns nullptr if no primary key index was created
+  std::shared_ptr<PrimaryKeyIndex> primary_key_index() const;
+  /** @} */
+
   /**
    * For debugging purposes, makes an estimation about the memory used by this Table (including Chunk and Segments)
    */
@@ -224,8 +269,13 @@ class Table : private Noncopyable {
 
   std::vector<TableConstraintDefinition> _constraint_definitions;
 
-  std::shared_ptr<TableStatistics> _table_statistics;
+  mutable std::shared_ptr<TableStatistics> _table_statistics;
+  std::shared_ptr<TableSample> _table_sample;
+  mutable std::mutex _table_statistics_refresh_mutex;
+  mutable std::atomic_bool _is_table_statistics_refresh_scheduled{false};
+
   std::unique_ptr<std::mutex> _append_mutex;
   std::vector<IndexStatistics> _indexes;
+  std::shared_ptr<PrimaryKeyIndex> _primary_key_index;
 };
 }  // namespace opossum
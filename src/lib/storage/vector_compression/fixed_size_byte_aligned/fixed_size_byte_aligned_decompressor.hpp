@@ -9,18 +9,19 @@ namespace opossum {
 template <typename UnsignedIntType>
 class FixedSizeByteAlignedDecompressor : public BaseVectorDecompressor {
  public:
-  explicit FixedSizeByteAlignedDecompressor(const pmr_vector<UnsignedIntType>& data) : _data{data} {}
+  FixedSizeByteAlignedDecompressor(const UnsignedIntType* data, const size_t size) : _data{data}, _size{size} {}
   FixedSizeByteAlignedDecompressor(const FixedSizeByteAlignedDecompressor&) = default;
   FixedSizeByteAlignedDecompressor(FixedSizeByteAlignedDecompressor&&) = default;
 
-  FixedSizeByteAlignedDecompressor& operator=(const FixedSizeByteAlignedDecompressor& other) { return *this; }
-  FixedSizeByteAlignedDecompressor& operator=(FixedSizeByteAlignedDecompressor&& other) = default;
+  FixedSizeByteAlignedDecompressor& operator=(const FixedSizeByteAlignedDecompressor&) = default;
+  FixedSizeByteAlignedDecompressor& operator=(FixedSizeByteAlignedDecompressor&&) = default;
 
   uint32_t get(size_t i) final { return _data[i]; }
-  size_t size() const final { return _data.size(); }
+  size_t size() const final { return _size; }
 
  private:
-  const pmr_vector<UnsignedIntType>& _data;
+  const UnsignedIntType* _data;
+  size_t _size;
 };
 
 }  // namespace opossum
@@ -25,32 +25,43 @@ class FixedSizeByteAlignedVector : public CompressedVector<FixedSizeByteAlignedV
                 "UnsignedIntType must be any of the three listed unsigned integer types.");
 
  public:
-  explicit FixedSizeByteAlignedVector(pmr_vector<UnsignedIntType> data) : _data{std::move(data)} {}
+  explicit FixedSizeByteAlignedVector(pmr_vector<UnsignedIntType> data) : _owned_data{std::move(data)} {}
+
+  // Views the `size` values at `data` instead of owning them, e.g., in a memory-mapped file (see BinaryParser).
+  // `data_owner` keeps them alive.
+  FixedSizeByteAlignedVector(const UnsignedIntType* data, const size_t size, std::shared_ptr<const void> data_owner)
+      : _viewed_data{data}, _viewed_size{size}, _data_owner{std::move(data_owner)} {}
+
   ~FixedSizeByteAlignedVector() = default;
 
-  const pmr_vector<UnsignedIntType>& data() const { return _data; }
+  const UnsignedIntType* data() const { return _data_owner ? _viewed_data : _owned_data.data(); }
 
  public:
-  size_t on_size() const { return _data.size(); }
-  size_t on_data_size() const { return sizeof(UnsignedIntType) * _data.size(); }
+  size_t on_size() const { return _data_owner ? _viewed_size : _owned_data.size(); }
+  size_t on_data_size() const { return sizeof(UnsignedIntType) * on_size(); }
 
   auto on_create_base_decompressor() const {
-    return std::make_unique<FixedSizeByteAlignedDecompressor<UnsignedIntType>>(_data);
+    return std::make_unique<FixedSizeByteAlignedDecompressor<UnsignedIntType>>(data(), on_size());
   }
 
-  auto on_create_decompressor() const { return FixedSizeByteAlignedDecompressor<UnsignedIntType>(_data); }
+  auto on_create_decompressor() const { return FixedSizeByteAlignedDecompressor<UnsignedIntType>(data(), on_size()); }
 
-  auto on_begin() const { return _data.cbegin(); }
+  auto on_begin() const { return data(); }
 
-  auto on_end() const { return _data.cend(); }
+  auto on_end() const { return data() + on_size(); }
 
   std::unique_ptr<const BaseCompressedVector> on_copy_using_allocator(const PolymorphicAllocator<size_t>& alloc) const {
-    auto data_copy = pmr_vector<UnsignedIntType>{_data, alloc};
+    auto data_copy = pmr_vector<UnsignedIntType>{on_begin(), on_end(), alloc};
     return std::make_unique<FixedSizeByteAlignedVector<UnsignedIntType>>(std::move(data_copy));
   }
 
  private:
-  const pmr_vector<UnsignedIntType> _data;
+  const pmr_vector<UnsignedIntType> _owned_data;
+
+  // Only used if the values are viewed, i.e., if _data_owner is set
+  const UnsignedIntType* const _viewed_data{nullptr};
+  const size_t _viewed_size{0};
+  const std::shared_ptr<const void> _data_owner;
 };
 
 }  // namespace opossum
@@ -2,12 +2,19 @@
 
 namespace opossum {
 
-SimdBp128Vector::SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size) : _data{std::move(vector)}, _size{size} {}
+SimdBp128Vector::SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size)
+    : _owned_data{std::move(vector)}, _size{size} {}
 
-const pmr_vector<uint128_t>& SimdBp128Vector::data() const { return _data; }
+SimdBp128Vector::SimdBp128Vector(const uint128_t* data, size_t data_size, size_t size,
+                                 std::shared_ptr<const void> data_owner)
+    : _viewed_data{data}, _viewed_data_size{data_size}, _data_owner{std::move(data_owner)}, _size{size} {}
+
+const uint128_t* SimdBp128Vector::data() const { return _data_owner ? _viewed_data : _owned_data.data(); }
 
 size_t SimdBp128Vector::on_size() const { return _size; }
-size_t SimdBp128Vector::on_data_size() const { return sizeof(uint128_t) * _data.size(); }
+size_t SimdBp128Vector::on_data_size() const {
+  return sizeof(uint128_t) * (_data_owner ? _viewed_data_size : _owned_data.size());
+}
 
 std::unique_ptr<BaseVectorDecompressor> SimdBp128Vector::on_create_base_decompressor() const {
   return std::make_unique<SimdBp128Decompressor>(*this);
@@ -21,7 +28,7 @@ SimdBp128Iterator SimdBp128Vector::on_end() const { return SimdBp128Iterator{on_
 
 std::unique_ptr<const BaseCompressedVector> SimdBp128Vector::on_copy_using_allocator(
     const PolymorphicAllocator<size_t>& alloc) const {
-  auto data_copy = pmr_vector<uint128_t>{_data, alloc};
+  auto data_copy = pmr_vector<uint128_t>{data(), data() + on_data_size() / sizeof(uint128_t), alloc};
   return std::make_unique<SimdBp128Vector>(std::move(data_copy), _size);
 }
 
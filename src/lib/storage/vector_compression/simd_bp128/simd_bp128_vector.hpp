@@ -1,5 +1,7 @@
 #pragma once
 
+#include <memory>
+
 #include "storage/vector_compression/base_compressed_vector.hpp"
 
 #include "oversized_types.hpp"
@@ -24,9 +26,15 @@ namespace opossum {
 class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
  public:
   explicit SimdBp128Vector(pmr_vector<uint128_t> vector, size_t size);
+
+  // Views the `data_size` packed 128-bit blocks at `data` instead of owning them, e.g., in a memory-mapped file (see
+  // BinaryParser). `data_owner` keeps them alive.
+  SimdBp128Vector(const uint128_t* data, size_t data_size, size_t size, std::shared_ptr<const void> data_owner);
+
   ~SimdBp128Vector() = default;
 
-  const pmr_vector<uint128_t>& data() const;
+  // The packed data consists of data_size() / sizeof(uint128_t) blocks
+  const uint128_t* data() const;
 
   size_t on_size() const;
   size_t on_data_size() const;
@@ -42,7 +50,13 @@ class SimdBp128Vector : public CompressedVector<SimdBp128Vector> {
  private:
   friend class SimdBp128Decompressor;
 
-  const pmr_vector<uint128_t> _data;
+  const pmr_vector<uint128_t> _owned_data;
+
+  // Only used if the data is viewed, i.e., if _data_owner is set
+  const uint128_t* const _viewed_data{nullptr};
+  const size_t _viewed_data_size{0};
+  const std::shared_ptr<const void> _data_owner;
+
   const size_t _size;
 };
 }  // namespace opossum
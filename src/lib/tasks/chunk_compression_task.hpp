@@ -27,6 +27,10 @@ class Chunk;
  * full and all of their end-cids must be smaller than infinity. This task calls
  * those chunks “completed”.
  *
+ * The mutable indexes of the chunk, which were maintained while records were inserted,
+ * are frozen into AdaptiveRadixTreeIndexes on the new dictionary segments (see
+ * Chunk::freeze_mutable_indexes()).
+ *
  * Note: Reference segments are not invalidated by this task because the order in which
  *       records are stored does not change.
  */
@@ -210,6 +210,20 @@ enum class UnionMode { Positions, All };
 
 enum class OrderByMode { Ascending, Descending, AscendingNullsLast, DescendingNullsLast };
 
+// Describes one key of a (multi-column) sort, e.g., the `b DESC` in `ORDER BY a, b DESC`
+struct SortColumnDefinition final {
+  explicit SortColumnDefinition(const ColumnID init_column,
+                                const OrderByMode init_order_by_mode = OrderByMode::Ascending)
+      : column(init_column), order_by_mode(init_order_by_mode) {}
+
+  bool operator==(const SortColumnDefinition& other) const {
+    return column == other.column && order_by_mode == other.order_by_mode;
+  }
+
+  ColumnID column;
+  OrderByMode order_by_mode;
+};
+
 enum class TableType { References, Data };
 
 enum class DescriptionMode { SingleLine, MultiLine };
@@ -1,3 +1,6 @@
+#include <thread>
+#include <vector>
+
 #include "base_test.hpp"
 
 #include "cache/cache.hpp"
@@ -257,6 +260,113 @@ TEST_F(CachePolicyTest, Iterators) {
   ASSERT_EQ(value_sum, 200);
 }
 
+TEST_F(CachePolicyTest, ShardedCache) {
+  // Large caches are split into shards with a share of the capacity each
+  Cache<int, int> cache(1024);
+
+  for (auto key = 0; key < 256; ++key) {
+    cache.set(key, key * 2);
+  }
+
+  ASSERT_EQ(cache.size(), 256u);
+
+  auto element_count = size_t{0};
+  auto key_sum = 0;
+  for (auto it = cache.unsafe_begin(); it != cache.unsafe_end(); ++it) {
+    const auto& [key, value] = *it;
+    ++element_count;
+    key_sum += key;
+    ASSERT_EQ(value, key * 2);
+  }
+
+  ASSERT_EQ(element_count, 256u);
+  ASSERT_EQ(key_sum, 255 * 256 / 2);
+
+  for (auto key = 0; key < 256; ++key) {
+    ASSERT_TRUE(cache.has(key));
+    ASSERT_EQ(cache.try_get(key), key * 2);
+  }
+  ASSERT_FALSE(cache.try_get(256));
+
+  // Shrinking the cache reduces the number of shards, so that the cache holds exactly as many entries as requested
+  cache.resize(16);
+  ASSERT_EQ(cache.size(), 16u);
+  for (auto key = 256; key < 512; ++key) {
+    cache.set(key, key * 2);
+  }
+  ASSERT_EQ(cache.size(), 16u);
+
+  // Growing the cache again distributes the remaining entries over the new shards
+  cache.resize(1024);
+  ASSERT_EQ(cache.size(), 16u);
+  for (auto it = cache.unsafe_begin(); it != cache.unsafe_end(); ++it) {
+    const auto& [key, value] = *it;
+    ASSERT_EQ(cache.try_get(key), value);
+  }
+
+  cache.replace_cache_impl<LRUCache<int, int>>(2);
+  for (auto key = 0; key < 256; ++key) {
+    cache.set(key, key * 2);
+  }
+  ASSERT_EQ(cache.size(), 2u);
+
+  cache.clear();
+  ASSERT_EQ(cache.size(), 0u);
+  ASSERT_EQ(cache.unsafe_begin(), cache.unsafe_end());
+}
+
+TEST_F(CachePolicyTest, PendingAccesses) {
+  Cache<int, int> cache(2);
+  auto& gdfs_cache = dynamic_cast<GDFSCache<int, int>&>(cache.unsafe_cache(1));
+
+  cache.set(1, 2);
+  for (auto access_idx = 0; access_idx < 3; ++access_idx) {
+    ASSERT_EQ(cache.try_get(1), 2);
+  }
+
+  // Hits are passed on to the underlying cache only before an entry is added
+  ASSERT_EQ(gdfs_cache.frequency(1), 1);
+  cache.set(2, 4);
+  ASSERT_EQ(gdfs_cache.frequency(1), 4);
+
+  // The number of accesses passed on at once is limited
+  for (auto access_idx = 0; access_idx < 20; ++access_idx) {
+    ASSERT_EQ(cache.try_get(2), 4);
+  }
+  cache.set(1, 2);
+  ASSERT_EQ(gdfs_cache.frequency(2), 9);
+  ASSERT_EQ(gdfs_cache.frequency(1), 5);
+}
+
+TEST_F(CachePolicyTest, ConcurrentAccess) {
+  constexpr auto KEY_COUNT = 512;
+  Cache<int, int> cache(1024);
+
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0; thread_id < 8; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto iteration = 0; iteration < 20; ++iteration) {
+        for (auto key = thread_id; key < KEY_COUNT; key += 2) {
+          if (const auto value = cache.try_get(key)) {
+            ASSERT_EQ(*value, key + 1);
+          } else {
+            cache.set(key, key + 1);
+          }
+        }
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  for (auto key = 0; key < KEY_COUNT; ++key) {
+    ASSERT_EQ(cache.try_get(key), key + 1);
+  }
+  ASSERT_EQ(cache.size(), static_cast<size_t>(KEY_COUNT));
+}
+
 template <typename T>
 class CacheTest : public BaseTest {};
 
@@ -328,6 +438,20 @@ TYPED_TEST(CacheTest, ResizeShrink) {
   ASSERT_EQ(cache.get(3), 6);
 }
 
+TYPED_TEST(CacheTest, Peek) {
+  TypeParam cache(2);
+
+  cache.set(1, 2);
+  cache.set(2, 4);
+
+  ASSERT_EQ(*cache.peek(1), 2);
+  ASSERT_EQ(*cache.peek(2), 4);
+  ASSERT_EQ(cache.peek(3), nullptr);
+
+  const auto& const_cache = cache;
+  ASSERT_EQ(*const_cache.peek(1), 2);
+}
+
 // Cache Iterator
 TYPED_TEST(CacheTest, CacheIteratorsRangeBasedForLoop) {
   TypeParam cache(2);
@@ -1,7 +1,11 @@
+#include <algorithm>
+#include <atomic>
+#include <chrono>
 #include <functional>
 #include <limits>
 #include <memory>
 #include <string>
+#include <thread>
 #include <utility>
 #include <vector>
 
@@ -86,10 +90,9 @@ TEST_F(TransactionContextTest, CommitShouldCommitAllFollowingPendingTransactions
   /**
    * Execution order
    *
-   * - context_1 gets commit ID
-   * - context_2 gets commit ID
-   * - context_2 tries to commit, but needs to wait for context_1
-   * - context_1 commits, followed by context_2
+   * - context_1 becomes the commit leader and gets a commit ID
+   * - context_2 tries to commit while context_1 commits its records and joins the next batch
+   * - context_1 becomes visible, followed by context_2
    *
    */
   context_1->commit_async(empty_callback);
@@ -151,6 +154,132 @@ TEST_F(TransactionContextTest, CallbackFiresWhenCommitted) {
   EXPECT_EQ(context_2->phase(), TransactionPhase::Committed);
 }
 
+TEST_F(TransactionContextTest, ConcurrentCommitsGetConsecutiveCommitIDs) {
+  constexpr auto THREAD_COUNT = 8u;
+  constexpr auto COMMITS_PER_THREAD = 100u;
+
+  const auto prev_last_commit_id = manager().last_commit_id();
+
+  auto commit_ids_per_thread = std::vector<std::vector<CommitID>>(THREAD_COUNT);
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_id = 0u; thread_id < THREAD_COUNT; ++thread_id) {
+    threads.emplace_back([&, thread_id]() {
+      for (auto commit_idx = 0u; commit_idx < COMMITS_PER_THREAD; ++commit_idx) {
+        auto context = manager().new_transaction_context();
+        auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+        commit_op->set_transaction_context(context);
+        commit_op->execute();
+
+        context->commit();
+
+        // Once commit() returns, the transaction's changes have to be visible
+        EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+        EXPECT_LE(context->commit_id(), manager().last_commit_id());
+        commit_ids_per_thread[thread_id].emplace_back(context->commit_id());
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  auto commit_ids = std::vector<CommitID>{};
+  for (const auto& thread_commit_ids : commit_ids_per_thread) {
+    commit_ids.insert(commit_ids.end(), thread_commit_ids.begin(), thread_commit_ids.end());
+  }
+  std::sort(commit_ids.begin(), commit_ids.end());
+
+  ASSERT_EQ(commit_ids.size(), THREAD_COUNT * COMMITS_PER_THREAD);
+  for (auto commit_idx = CommitID{0}; commit_idx < commit_ids.size(); ++commit_idx) {
+    EXPECT_EQ(commit_ids[commit_idx], prev_last_commit_id + commit_idx + 1);
+  }
+  EXPECT_EQ(manager().last_commit_id(), prev_last_commit_id + THREAD_COUNT * COMMITS_PER_THREAD);
+}
+
+TEST_F(TransactionContextTest, CommitLeaderReturnsWhileOthersKeepCommitting) {
+  // The commit leader processes only its own batch and hands over to a waiting transaction afterwards. Thus, it returns
+  // even though another thread keeps committing.
+  auto leader_returned = std::atomic_bool{false};
+  auto commits_started = std::atomic<size_t>{0};
+
+  const auto keep_committing = [&]() {
+    while (!leader_returned) {
+      auto context = manager().new_transaction_context();
+      auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+      commit_op->set_transaction_context(context);
+      commit_op->execute();
+
+      ++commits_started;
+      context->commit_async([](TransactionID) {});
+    }
+  };
+
+  auto committing_thread = std::thread{};
+  auto leader_context = manager().new_transaction_context();
+  auto leader_commit_op = std::make_shared<CommitFuncOp>([&]() {
+    // Make sure that other transactions are committing while the leader processes its batch
+    committing_thread = std::thread{keep_committing};
+    while (commits_started == 0) {
+      std::this_thread::yield();
+    }
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  });
+  leader_commit_op->set_transaction_context(leader_context);
+  leader_commit_op->execute();
+
+  leader_context->commit();
+  leader_returned = true;
+  committing_thread.join();
+
+  EXPECT_EQ(leader_context->phase(), TransactionPhase::Committed);
+  EXPECT_GT(commits_started, 0u);
+}
+
+TEST_F(TransactionContextTest, CommitFromCallback) {
+  // The commit leader calls the callbacks only after it has given up the leadership, so that a callback can commit
+  // another transaction and wait for it
+  auto nested_context = manager().new_transaction_context();
+  auto nested_commit_op = std::make_shared<CommitFuncOp>([]() {});
+  nested_commit_op->set_transaction_context(nested_context);
+  nested_commit_op->execute();
+
+  auto context = manager().new_transaction_context();
+  auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+  commit_op->set_transaction_context(context);
+  commit_op->execute();
+
+  auto nested_commit_returned = false;
+  context->commit_async([&](TransactionID) {
+    nested_context->commit();
+    nested_commit_returned = true;
+  });
+
+  EXPECT_TRUE(nested_commit_returned);
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(nested_context->phase(), TransactionPhase::Committed);
+  EXPECT_EQ(nested_context->commit_id(), context->commit_id() + 1);
+  EXPECT_EQ(manager().last_commit_id(), nested_context->commit_id());
+}
+
+TEST_F(TransactionContextTest, CommitWaitsForActiveOperators) {
+  auto context = manager().new_transaction_context();
+  auto commit_op = std::make_shared<CommitFuncOp>([]() {});
+  commit_op->set_transaction_context(context);
+  commit_op->execute();
+
+  // Simulate an operator of the transaction that is still executing
+  context->on_operator_started();
+
+  auto commit_thread = std::thread{[&]() { context->commit(); }};
+  std::this_thread::sleep_for(std::chrono::milliseconds{10});
+  EXPECT_EQ(context->phase(), TransactionPhase::Committing);
+
+  context->on_operator_finished();
+  commit_thread.join();
+  EXPECT_EQ(context->phase(), TransactionPhase::Committed);
+}
+
 TEST_F(TransactionContextTest, CommitWithFailedOperator) {
   auto context = manager().new_transaction_context();
   context->rollback();
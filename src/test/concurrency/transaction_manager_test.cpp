@@ -1,4 +1,6 @@
 #include <algorithm>
+#include <thread>
+#include <unordered_set>
 #include <vector>
 
 #include "base_test.hpp"
@@ -12,10 +14,13 @@ class TransactionManagerTest : public BaseTest {
  protected:
   void SetUp() override {}
 
-  static std::unordered_multiset<CommitID>& get_active_snapshot_commit_ids() {
-    return Hyrise::get().transaction_manager._active_snapshot_commit_ids;
+  static std::unordered_multiset<CommitID> get_active_snapshot_commit_ids() {
+    const auto snapshot_commit_ids = Hyrise::get().transaction_manager._active_snapshot_commit_ids();
+    return {snapshot_commit_ids.begin(), snapshot_commit_ids.end()};
   }
 
+  static constexpr auto SNAPSHOT_SLOT_COUNT = TransactionManager::SNAPSHOT_SLOT_COUNT;
+
   static void register_transaction(CommitID snapshot_commit_id) {
     Hyrise::get().transaction_manager._register_transaction(snapshot_commit_id);
   }
@@ -46,30 +51,24 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   const auto vec = std::vector<CommitID>{t1_snapshot_commit_id, t2_snapshot_commit_id, t3_snapshot_commit_id};
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 3);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_snapshot_commit_id) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t1_snapshot_commit_id) > 0);
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t2_snapshot_commit_id) > 0);
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t3_snapshot_commit_id) > 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), *std::min_element(vec.cbegin(), vec.cend()));
 
   t1_context->commit();
   deregister_transaction(t1_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 2);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t1_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t3_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t1_context->snapshot_commit_id()) > 0);
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t3_context->snapshot_commit_id()) > 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t3_context->commit();
   deregister_transaction(t3_context->snapshot_commit_id());
 
   EXPECT_EQ(get_active_snapshot_commit_ids().size(), 1);
-  EXPECT_TRUE(std::find(get_active_snapshot_commit_ids().cbegin(), get_active_snapshot_commit_ids().cend(),
-                        t2_context->snapshot_commit_id()) != get_active_snapshot_commit_ids().cend());
+  EXPECT_TRUE(get_active_snapshot_commit_ids().count(t2_context->snapshot_commit_id()) > 0);
   EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), t2_context->snapshot_commit_id());
 
   t2_context->commit();
@@ -84,4 +83,49 @@ TEST_F(TransactionManagerTest, TrackActiveCommitIDs) {
   register_transaction(t3_snapshot_commit_id);
 }
 
+TEST_F(TransactionManagerTest, TrackMoreActiveCommitIDsThanSlots) {
+  auto& manager = Hyrise::get().transaction_manager;
+
+  // The snapshot-commit-ids that do not fit into the slots are stored separately
+  const auto snapshot_commit_id_count = SNAPSHOT_SLOT_COUNT + 10;
+  for (auto snapshot_commit_id = CommitID{1}; snapshot_commit_id <= snapshot_commit_id_count; ++snapshot_commit_id) {
+    register_transaction(snapshot_commit_id + 100);
+  }
+  register_transaction(CommitID{50});
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), snapshot_commit_id_count + 1);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{50});
+
+  deregister_transaction(CommitID{50});
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), CommitID{101});
+
+  for (auto snapshot_commit_id = CommitID{1}; snapshot_commit_id <= snapshot_commit_id_count; ++snapshot_commit_id) {
+    deregister_transaction(snapshot_commit_id + 100);
+  }
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
+TEST_F(TransactionManagerTest, ConcurrentRegistration) {
+  // Transactions with the same snapshot-commit-id are registered and deregistered by different threads
+  auto threads = std::vector<std::thread>{};
+  for (auto thread_idx = 0; thread_idx < 8; ++thread_idx) {
+    threads.emplace_back([]() {
+      for (auto iteration = 0; iteration < 1000; ++iteration) {
+        const auto snapshot_commit_id = static_cast<CommitID>(iteration % 3 + 1);
+        register_transaction(snapshot_commit_id);
+        register_transaction(snapshot_commit_id + 1);
+        deregister_transaction(snapshot_commit_id);
+        deregister_transaction(snapshot_commit_id + 1);
+      }
+    });
+  }
+
+  for (auto& thread : threads) {
+    thread.join();
+  }
+
+  EXPECT_EQ(get_active_snapshot_commit_ids().size(), 0);
+  EXPECT_EQ(Hyrise::get().transaction_manager.get_lowest_active_snapshot_commit_id(), std::nullopt);
+}
+
 }  // namespace opossum
@@ -52,6 +52,50 @@ TEST_F(LikeMatcherTest, NotMatching) {
   EXPECT_FALSE(match("hello", "Hello"));
   EXPECT_FALSE(match("Hello", "Hello_"));
   EXPECT_FALSE(match("Hello", "He_o"));
+  EXPECT_FALSE(match("Hello", ""));
+  EXPECT_FALSE(match("Hello World", "%Hello%Wor"));
+}
+
+TEST_F(LikeMatcherTest, PatternVariant) {
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::StartsWithPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("Hello%")));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::MultipleContainsPattern>(
+      LikeMatcher::pattern_string_to_pattern_variant("%Hello%World%")));
+  EXPECT_TRUE(
+      std::holds_alternative<LikeMatcher::GeneralPattern>(LikeMatcher::pattern_string_to_pattern_variant("%Hello%W")));
+  EXPECT_TRUE(std::holds_alternative<LikeMatcher::GeneralPattern>(LikeMatcher::pattern_string_to_pattern_variant("")));
+
+  const auto general_pattern = LikeMatcher::GeneralPattern{"H_l%%o W%_d"};
+  ASSERT_EQ(general_pattern.segments.size(), 3u);
+  EXPECT_EQ(general_pattern.segments[0].string, "H_l");
+  EXPECT_EQ(general_pattern.segments[0].search_string, "H");
+  EXPECT_EQ(general_pattern.segments[1].string, "o W");
+  EXPECT_FALSE(general_pattern.segments[1].has_single_char_wildcards);
+  EXPECT_EQ(general_pattern.segments[2].string, "_d");
+  EXPECT_EQ(general_pattern.segments[2].search_string_offset, 1u);
+  EXPECT_EQ(general_pattern.segments[2].search_string, "d");
+}
+
+TEST_F(LikeMatcherTest, GeneralPatternMatching) {
+  EXPECT_TRUE(match("", ""));
+  EXPECT_TRUE(match("", "%"));
+  EXPECT_TRUE(match("Hello", "H_l_o"));
+  EXPECT_TRUE(match("Hello World", "H%o_W%d"));
+  EXPECT_TRUE(match("Hello World", "_%"));
+  EXPECT_TRUE(match("Hello World", "%__"));
+  EXPECT_TRUE(match("Hello World", "%l_o%o_l%"));
+  EXPECT_TRUE(match("Hello World", "%lo%W%"));
+  EXPECT_TRUE(match("aaab", "%a_b"));
+  EXPECT_TRUE(match("abab", "ab%ab"));
+  EXPECT_TRUE(match("Line\nbreak", "Line_break"));
+  EXPECT_TRUE(match("Line\nbreak", "%_%"));
+
+  EXPECT_FALSE(match("", "_"));
+  EXPECT_FALSE(match("aab", "%a_a%"));
+  EXPECT_FALSE(match("aba", "ab%ba"));
+  EXPECT_FALSE(match("Hello World", "H%o_W%l"));
+  EXPECT_FALSE(match("Hello World", "%l_o%W_l%"));
+  EXPECT_FALSE(match("Hello World", "%Hello World_%"));
 }
 
 }  // namespace opossum
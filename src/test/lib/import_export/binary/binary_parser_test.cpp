@@ -1,3 +1,5 @@
+#include <filesystem>
+#include <fstream>
 #include <memory>
 #include <string>
 #include <vector>
@@ -6,8 +8,10 @@
 
 #include "hyrise.hpp"
 #include "import_export/binary/binary_parser.hpp"
+#include "import_export/binary/binary_writer.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/encoding_type.hpp"
+#include "storage/vector_compression/fixed_size_byte_aligned/fixed_size_byte_aligned_vector.hpp"
 
 namespace opossum {
 
@@ -355,6 +359,70 @@ TEST_F(BinaryParserTest, InvalidAttributeVectorWidth) {
 
 TEST_F(BinaryParserTest, FileDoesNotExist) { EXPECT_THROW(BinaryParser::parse("not_existing_file"), std::exception); }
 
+TEST_F(BinaryParserTest, TruncatedFile) {
+  // The file is read from a memory mapping, which must not be read beyond its end
+  const auto filename = test_data_path + "binary_parser_truncated.bin";
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data, 2);
+  table->append({pmr_string{"first"}});
+  table->append({pmr_string{"second"}});
+  table->append({pmr_string{"third"}});
+  BinaryWriter::write(*table, filename);
+  EXPECT_TABLE_EQ_ORDERED(BinaryParser::parse(filename), table);
+
+  std::filesystem::resize_file(filename, std::filesystem::file_size(filename) - 3);
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+
+  std::filesystem::resize_file(filename, 0);
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+
+  std::filesystem::remove(filename);
+}
+
+TEST_F(BinaryParserTest, AttributeVectorViewsMappedFile) {
+  const auto filename = test_data_path + "binary_parser_mapped.bin";
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  table->append({1});
+  table->append({2});
+  table->append({1});
+  ChunkEncoder::encode_all_chunks(table, EncodingType::Dictionary);
+  BinaryWriter::write(*table, filename);
+
+  const auto parsed_table = BinaryParser::parse(filename);
+  const auto segment = parsed_table->get_chunk(ChunkID{1})->get_segment(ColumnID{0});
+  const auto dictionary_segment = std::dynamic_pointer_cast<const DictionarySegment<int32_t>>(segment);
+  ASSERT_TRUE(dictionary_segment);
+  const auto attribute_vector =
+      std::dynamic_pointer_cast<const FixedSizeByteAlignedVector<uint8_t>>(dictionary_segment->attribute_vector());
+  ASSERT_TRUE(attribute_vector);
+  EXPECT_EQ(reinterpret_cast<uintptr_t>(attribute_vector->data()) % BinaryWriter::ALIGNMENT, 0);
+
+  // The segments keep the mapping alive
+  std::filesystem::remove(filename);
+  EXPECT_TABLE_EQ_ORDERED(parsed_table, table);
+}
+
+TEST_F(BinaryParserTest, UnsupportedFormatVersion) {
+  const auto filename = test_data_path + "binary_parser_version.bin";
+  auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 2);
+  table->append({1});
+  BinaryWriter::write(*table, filename);
+
+  const auto overwrite = [&](const std::streamoff offset, const uint32_t value) {
+    auto file = std::fstream{filename, std::ios::binary | std::ios::in | std::ios::out};
+    file.seekp(offset);
+    file.write(reinterpret_cast<const char*>(&value), sizeof(value));
+  };
+
+  overwrite(sizeof(uint32_t), BinaryWriter::FORMAT_VERSION + 1);
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+
+  // Files written before the format was versioned start with the target chunk size
+  overwrite(0, 2);
+  EXPECT_THROW(BinaryParser::parse(filename), std::exception);
+
+  std::filesystem::remove(filename);
+}
+
 TEST_F(BinaryParserTest, TwoColumnsNoValues) {
   TableColumnDefinitions column_definitions;
   column_definitions.emplace_back("FirstColumn", DataType::Int, false);
@@ -1,3 +1,6 @@
+#include <filesystem>
+#include <fstream>
+
 #include "base_test.hpp"
 
 #include "hyrise.hpp"
@@ -5,7 +8,9 @@
 #include "scheduler/immediate_execution_scheduler.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "storage/dictionary_segment.hpp"
 #include "storage/table.hpp"
+#include "storage/value_segment.hpp"
 
 namespace opossum {
 
@@ -270,6 +275,51 @@ TEST_F(CsvParserTest, EmptyTableFromMetaFile) {
   EXPECT_TABLE_EQ_UNORDERED(csv_meta_table, expected_table);
 }
 
+TEST_F(CsvParserTest, QuotedDelimitersAcrossBlocks) {
+  // The file spans multiple blocks, which are scanned in parallel without knowing whether they begin in quotes
+  const auto csv_file = test_data_path + "csv_parser_blocks.csv";
+  auto csv_meta = CsvMeta{};
+  csv_meta.columns = {{"a", "int", false}, {"b", "string", false}};
+
+  auto expected_table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, false}}, TableType::Data, 1000);
+  {
+    auto file = std::ofstream{csv_file};
+    for (auto row = int32_t{0}; row < 60'000; ++row) {
+      if (row % 3 == 0) {
+        file << row << ",\"multi\nline, \"\"quoted\"\" " << row << "\"\n";
+        expected_table->append({row, pmr_string{"multi\nline, \"quoted\" " + std::to_string(row)}});
+      } else {
+        file << row << ",unquoted " << std::string(row % 100, 'x') << "\n";
+        expected_table->append({row, pmr_string{"unquoted " + std::string(row % 100, 'x')}});
+      }
+    }
+  }
+  ASSERT_GT(std::filesystem::file_size(csv_file), 2 * CsvParser::BLOCK_SIZE);
+
+  const auto table = CsvParser::parse(csv_file, ChunkOffset{1000}, csv_meta);
+  EXPECT_EQ(table->chunk_count(), ChunkID{60});
+  EXPECT_TABLE_EQ_ORDERED(table, expected_table);
+
+  std::filesystem::remove(csv_file);
+}
+
+TEST_F(CsvParserTest, EncodeWhileParsing) {
+  const auto encoding_spec =
+      ChunkEncodingSpec{SegmentEncodingSpec{EncodingType::Dictionary}, SegmentEncodingSpec{EncodingType::Unencoded}};
+  const auto table = CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}, std::nullopt,
+                                      encoding_spec);
+
+  for (auto chunk_id = ChunkID{0}; chunk_id < table->chunk_count(); ++chunk_id) {
+    const auto chunk = table->get_chunk(chunk_id);
+    EXPECT_FALSE(chunk->is_mutable());
+    EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<float>>(chunk->get_segment(ColumnID{0})));
+    EXPECT_TRUE(std::dynamic_pointer_cast<const ValueSegment<int32_t>>(chunk->get_segment(ColumnID{1})));
+  }
+
+  EXPECT_TABLE_EQ_ORDERED(table, CsvParser::parse("resources/test_data/csv/float_int_large.csv", ChunkOffset{20}));
+}
+
 TEST_F(CsvParserTest, WithScheduler) {
   Hyrise::get().topology.use_fake_numa_topology(8, 4);
   auto scheduler = Hyrise::get().scheduler();
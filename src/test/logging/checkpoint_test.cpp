@@ -0,0 +1,189 @@
+#include <filesystem>
+#include <memory>
+#include <string>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logging/checkpoint.hpp"
+#include "logging/log_manager.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/dictionary_segment.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class CheckpointTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_file_path);
+
+    const auto column_definitions_t = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Double, false}};
+    auto table_t = std::make_shared<Table>(column_definitions_t, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    table_t->append({1, pmr_string{"one"}, 1.5});
+    table_t->append({2, NULL_VALUE, 2.5});
+    table_t->append({3, pmr_string{"three"}, 3.5});
+    table_t->append({4, pmr_string{"four"}, 4.5});
+    Hyrise::get().storage_manager.add_table("t", table_t);
+
+    // The first two chunks are finalized and dictionary-encoded, the last one is mutable
+    const auto column_definitions_u = TableColumnDefinitions{{"x", DataType::Long, false}};
+    auto table_u = std::make_shared<Table>(column_definitions_u, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    for (auto value = int64_t{10}; value < 15; ++value) {
+      table_u->append({value});
+    }
+    ChunkEncoder::encode_chunks(table_u, {ChunkID{0}, ChunkID{1}}, SegmentEncodingSpec{EncodingType::Dictionary});
+    Hyrise::get().storage_manager.add_table("u", table_u);
+  }
+
+  void TearDown() override {
+    Hyrise::get().log_manager.disable();
+    std::filesystem::remove_all(checkpoint_directory);
+    std::filesystem::remove(log_file_path);
+  }
+
+  static std::shared_ptr<const Table> select_all(const std::string& table_name) {
+    return SQLPipelineBuilder{"SELECT * FROM " + table_name}.create_pipeline().get_result_table().second;
+  }
+
+  static void execute_sql(const std::string& sql,
+                          const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    builder.create_pipeline().get_result_table();
+  }
+
+  const std::string checkpoint_directory = test_data_path + "checkpoint_test";
+  const std::string log_file_path = test_data_path + "checkpoint_test.log";
+};
+
+TEST_F(CheckpointTest, WriteAndLoad) {
+  execute_sql("DELETE FROM t WHERE a = 2");
+  execute_sql("DELETE FROM u WHERE x = 10");
+
+  // Physically delete the second chunk of u
+  execute_sql("DELETE FROM u WHERE x = 12 OR x = 13");
+  Hyrise::get().storage_manager.get_table("u")->remove_chunk(ChunkID{1});
+
+  const auto expected_table_t = select_all("t");
+  const auto expected_table_u = select_all("u");
+
+  const auto commit_id = Checkpoint::write(checkpoint_directory);
+  EXPECT_EQ(commit_id, Hyrise::get().transaction_manager.last_commit_id());
+  EXPECT_TRUE(std::filesystem::exists(std::filesystem::path{checkpoint_directory} / Checkpoint::MANIFEST_FILE_NAME));
+
+  Hyrise::reset();
+  EXPECT_EQ(Checkpoint::load(checkpoint_directory), commit_id);
+  EXPECT_EQ(Hyrise::get().transaction_manager.last_commit_id(), commit_id);
+
+  EXPECT_TABLE_EQ_UNORDERED(select_all("t"), expected_table_t);
+  EXPECT_TABLE_EQ_UNORDERED(select_all("u"), expected_table_u);
+
+  // The rows keep their positions, including the invisible ones, and the chunks keep their encoding and mutability
+  const auto table_t = Hyrise::get().storage_manager.get_table("t");
+  ASSERT_EQ(table_t->chunk_count(), 2u);
+  EXPECT_EQ(table_t->get_chunk(ChunkID{0})->size(), 3u);
+  EXPECT_EQ(table_t->get_chunk(ChunkID{0})->invalid_row_count(), 1u);
+  EXPECT_FALSE(table_t->get_chunk(ChunkID{0})->is_mutable());
+  EXPECT_TRUE(table_t->get_chunk(ChunkID{1})->is_mutable());
+
+  const auto table_u = Hyrise::get().storage_manager.get_table("u");
+  ASSERT_EQ(table_u->chunk_count(), 3u);
+  EXPECT_TRUE(std::dynamic_pointer_cast<const DictionarySegment<int64_t>>(
+      table_u->get_chunk(ChunkID{0})->get_segment(ColumnID{0})));
+  EXPECT_FALSE(table_u->get_chunk(ChunkID{1}));
+  EXPECT_EQ(table_u->get_chunk(ChunkID{2})->size(), 1u);
+
+  // New rows are inserted into the mutable chunk
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  EXPECT_EQ(table_t->chunk_count(), 2u);
+  EXPECT_EQ(select_all("t")->row_count(), 4u);
+}
+
+TEST_F(CheckpointTest, RecoverLogOnTopOfCheckpoint) {
+  Hyrise::get().log_manager.enable(log_file_path);
+
+  // Contained in the checkpoint, so it is not replayed
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+
+  // Transactions that modified rows before the checkpoint is written, but commit or roll back afterwards
+  const auto committed_context = Hyrise::get().transaction_manager.new_transaction_context();
+  execute_sql("INSERT INTO t VALUES (6, 'six', 6.5)", committed_context);
+  execute_sql("DELETE FROM t WHERE a = 1", committed_context);
+  const auto rolled_back_context = Hyrise::get().transaction_manager.new_transaction_context();
+  execute_sql("INSERT INTO t VALUES (100, 'rolled back', 100.5)", rolled_back_context);
+
+  const auto expected_table_at_checkpoint = select_all("t");
+  EXPECT_EQ(expected_table_at_checkpoint->row_count(), 5u);
+  const auto commit_id = Checkpoint::write(checkpoint_directory);
+
+  committed_context->commit();
+  rolled_back_context->rollback();
+  execute_sql("INSERT INTO t VALUES (7, NULL, 7.5)");
+
+  const auto expected_table = select_all("t");
+  EXPECT_EQ(expected_table->row_count(), 6u);
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  EXPECT_TABLE_EQ_UNORDERED(select_all("t"), expected_table_at_checkpoint);
+
+  EXPECT_EQ(Hyrise::get().log_manager.recover(log_file_path, commit_id), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all("t"), expected_table);
+
+  // Commit IDs continue after the replayed transactions, so that new transactions are not skipped when the same
+  // checkpoint is loaded again
+  EXPECT_GT(Hyrise::get().transaction_manager.last_commit_id(), commit_id);
+  Hyrise::get().log_manager.enable(log_file_path);
+  execute_sql("DELETE FROM t WHERE a = 6 OR a = 7");
+  const auto expected_table_after_delete = select_all("t");
+  EXPECT_EQ(expected_table_after_delete->row_count(), 4u);
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  EXPECT_EQ(Hyrise::get().log_manager.recover(log_file_path, commit_id), 3u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all("t"), expected_table_after_delete);
+}
+
+TEST_F(CheckpointTest, ConstraintsAndPrimaryKeyIndex) {
+  Hyrise::get().storage_manager.get_table("t")->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+  Hyrise::get().storage_manager.get_table("t")->create_primary_key_index();
+  Hyrise::get().log_manager.enable(log_file_path);
+
+  // The row is not visible at the checkpoint, so it is loaded as a placeholder and restored by the recovery
+  const auto committed_context = Hyrise::get().transaction_manager.new_transaction_context();
+  execute_sql("INSERT INTO t VALUES (6, 'six', 6.5)", committed_context);
+  const auto commit_id = Checkpoint::write(checkpoint_directory);
+  committed_context->commit();
+
+  Hyrise::reset();
+  Checkpoint::load(checkpoint_directory);
+  const auto table_t = Hyrise::get().storage_manager.get_table("t");
+  ASSERT_EQ(table_t->get_soft_unique_constraints().size(), 1u);
+  EXPECT_EQ(table_t->get_soft_unique_constraints()[0].columns, std::vector<ColumnID>{ColumnID{0}});
+  EXPECT_EQ(table_t->get_soft_unique_constraints()[0].is_primary_key, IsPrimaryKey::Yes);
+  ASSERT_TRUE(table_t->primary_key_index());
+  EXPECT_EQ(table_t->primary_key_index()->lookup({3}), (std::vector<RowID>{RowID{ChunkID{0}, ChunkOffset{2}}}));
+
+  EXPECT_EQ(Hyrise::get().log_manager.recover(log_file_path, commit_id), 1u);
+  EXPECT_EQ(table_t->primary_key_index()->lookup({6}), (std::vector<RowID>{RowID{ChunkID{1}, ChunkOffset{1}}}));
+  EXPECT_TRUE(table_t->primary_key_index()->lookup({0}).empty());
+}
+
+TEST_F(CheckpointTest, IncompleteCheckpoint) {
+  Checkpoint::write(checkpoint_directory);
+
+  // Checkpoints are not overwritten
+  EXPECT_THROW(Checkpoint::write(checkpoint_directory), std::logic_error);
+
+  // A checkpoint whose manifest was not written is not loaded
+  std::filesystem::remove(std::filesystem::path{checkpoint_directory} / Checkpoint::MANIFEST_FILE_NAME);
+  Hyrise::reset();
+  EXPECT_THROW(Checkpoint::load(checkpoint_directory), std::logic_error);
+}
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "logging/log_manager.hpp"
+#include "operators/insert.hpp"
+#include "operators/table_wrapper.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class LogManagerTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    std::remove(log_file_path.c_str());
+    Hyrise::get().storage_manager.add_table("t", create_table());
+  }
+
+  void TearDown() override {
+    Hyrise::get().log_manager.disable();
+    std::remove(log_file_path.c_str());
+  }
+
+  // Creates the table in the state in which it is when logging is enabled. Deleted rows are located in the first
+  // (finalized) chunk as well as in chunks that are created by the logged inserts.
+  static std::shared_ptr<Table> create_table() {
+    const auto column_definitions = TableColumnDefinitions{
+        {"a", DataType::Int, false}, {"b", DataType::String, true}, {"c", DataType::Double, false}};
+    auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+    table->append({1, pmr_string{"one"}, 1.5});
+    table->append({2, NULL_VALUE, 2.5});
+    table->append({3, pmr_string{"three"}, 3.5});
+    table->append({4, pmr_string{"four"}, 4.5});
+    return table;
+  }
+
+  static std::shared_ptr<const Table> select_all() {
+    return SQLPipelineBuilder{"SELECT * FROM t"}.create_pipeline().get_result_table().second;
+  }
+
+  static void execute_sql(const std::string& sql) { SQLPipelineBuilder{sql}.create_pipeline().get_result_table(); }
+
+  // Inserts a row and rolls back the transaction. The row occupies a position in the table, but is not logged.
+  static void insert_and_roll_back() {
+    auto values = std::make_shared<Table>(Hyrise::get().storage_manager.get_table("t")->column_definitions(),
+                                          TableType::Data);
+    values->append({100, pmr_string{"rolled back"}, 100.5});
+    const auto table_wrapper = std::make_shared<TableWrapper>(values);
+    table_wrapper->execute();
+
+    const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+    const auto insert = std::make_shared<Insert>("t", table_wrapper);
+    insert->set_transaction_context(transaction_context);
+    insert->execute();
+    transaction_context->rollback();
+  }
+
+  // Discards all data, reloads the table as it was when logging was enabled, and replays the log
+  size_t restart_and_recover() {
+    Hyrise::reset();
+    Hyrise::get().storage_manager.add_table("t", create_table());
+    return Hyrise::get().log_manager.recover(log_file_path);
+  }
+
+  const std::string log_file_path = test_data_path + "log_manager_test.log";
+};
+
+TEST_F(LogManagerTest, RecoverCommittedTransactions) {
+  Hyrise::get().log_manager.enable(log_file_path);
+  EXPECT_TRUE(Hyrise::get().log_manager.is_enabled());
+
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  insert_and_roll_back();
+  execute_sql("INSERT INTO t VALUES (6, NULL, 6.5)");
+  execute_sql("INSERT INTO t VALUES (7, 'a string that does not fit into the small string buffer', 7.5)");
+  execute_sql("DELETE FROM t WHERE a = 2 OR a = 6");
+  execute_sql("UPDATE t SET b = 'updated' WHERE a = 1 OR a = 5");
+  execute_sql("UPDATE t SET c = c + 10.0 WHERE a = 5");
+  EXPECT_GE(Hyrise::get().log_manager.sync_count(), 1u);
+
+  const auto expected_table = select_all();
+  EXPECT_EQ(expected_table->row_count(), 5u);
+
+  EXPECT_EQ(restart_and_recover(), 6u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+
+  // Transactions after the recovery work on the replayed rows and are appended to the log
+  Hyrise::get().log_manager.enable(log_file_path);
+  execute_sql("DELETE FROM t WHERE a = 7");
+  const auto expected_table_after_delete = select_all();
+  EXPECT_EQ(expected_table_after_delete->row_count(), 4u);
+
+  EXPECT_EQ(restart_and_recover(), 7u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table_after_delete);
+}
+
+TEST_F(LogManagerTest, ThroughputMode) {
+  Hyrise::get().log_manager.enable(log_file_path, LogSyncMode::Throughput);
+  EXPECT_EQ(Hyrise::get().log_manager.sync_mode(), LogSyncMode::Throughput);
+
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  execute_sql("DELETE FROM t WHERE a = 1");
+
+  // Commits are acknowledged before the log is synced, but flush() waits for the sync
+  Hyrise::get().log_manager.flush();
+  EXPECT_GE(Hyrise::get().log_manager.sync_count(), 1u);
+  EXPECT_GT(std::filesystem::file_size(log_file_path), 0u);
+
+  const auto expected_table = select_all();
+  EXPECT_EQ(restart_and_recover(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+}
+
+TEST_F(LogManagerTest, DisabledLoggingDoesNotWriteLog) {
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  EXPECT_FALSE(std::filesystem::exists(log_file_path));
+  EXPECT_EQ(Hyrise::get().log_manager.recover(log_file_path), 0u);
+}
+
+TEST_F(LogManagerTest, IgnoreIncompleteEntry) {
+  Hyrise::get().log_manager.enable(log_file_path);
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  execute_sql("DELETE FROM t WHERE a = 3");
+  Hyrise::get().log_manager.disable();
+  const auto expected_table = select_all();
+
+  // Simulate an entry that was only partially written before a crash
+  const auto valid_size = std::filesystem::file_size(log_file_path);
+  {
+    auto log_file = std::ofstream{log_file_path, std::ios::binary | std::ios::app};
+    const auto incomplete_entry = std::vector<char>{100, 0, 0, 0, 1, 2, 3};
+    log_file.write(incomplete_entry.data(), static_cast<std::streamsize>(incomplete_entry.size()));
+  }
+
+  EXPECT_EQ(restart_and_recover(), 2u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+  EXPECT_EQ(std::filesystem::file_size(log_file_path), valid_size);
+}
+
+TEST_F(LogManagerTest, IgnoreCorruptedEntry) {
+  Hyrise::get().log_manager.enable(log_file_path);
+  execute_sql("INSERT INTO t VALUES (5, 'five', 5.5)");
+  Hyrise::get().log_manager.disable();
+  const auto expected_table = select_all();
+  const auto valid_size = std::filesystem::file_size(log_file_path);
+
+  Hyrise::get().log_manager.enable(log_file_path);
+  execute_sql("INSERT INTO t VALUES (6, 'six', 6.5)");
+  Hyrise::get().log_manager.disable();
+
+  // Flip a byte in the payload of the second entry, which then does not match its checksum anymore
+  {
+    auto log_file = std::fstream{log_file_path, std::ios::binary | std::ios::in | std::ios::out};
+    log_file.seekp(static_cast<std::streamoff>(std::filesystem::file_size(log_file_path) - 1));
+    log_file.put('X');
+  }
+
+  EXPECT_EQ(restart_and_recover(), 1u);
+  EXPECT_TABLE_EQ_UNORDERED(select_all(), expected_table);
+  EXPECT_EQ(std::filesystem::file_size(log_file_path), valid_size);
+}
+
+}  // namespace opossum
@@ -39,6 +39,7 @@
 #include "operators/import.hpp"
 #include "operators/index_scan.hpp"
 #include "operators/join_hash.hpp"
+#include "operators/join_index.hpp"
 #include "operators/join_nested_loop.hpp"
 #include "operators/join_sort_merge.hpp"
 #include "operators/limit.hpp"
@@ -50,6 +51,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_all.hpp"
 #include "operators/union_positions.hpp"
 #include "storage/chunk_encoder.hpp"
@@ -328,22 +330,15 @@ TEST_F(LQPTranslatorTest, Sort) {
   const auto projection_a = std::dynamic_pointer_cast<const Projection>(pqp);
   ASSERT_TRUE(projection_a);
 
-  const auto sort_a = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
-  ASSERT_TRUE(sort_a);
-  EXPECT_EQ(sort_a->column_id(), ColumnID{1});
-  EXPECT_EQ(sort_a->order_by_mode(), OrderByMode::Ascending);
+  const auto sort = std::dynamic_pointer_cast<const Sort>(pqp->input_left());
+  ASSERT_TRUE(sort);
+  const auto expected_sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{2}, OrderByMode::AscendingNullsLast}};
+  EXPECT_EQ(sort->sort_definitions(), expected_sort_definitions);
 
-  const auto sort_a_plus_b = std::dynamic_pointer_cast<const Sort>(sort_a->input_left());
-  ASSERT_TRUE(sort_a_plus_b);
-  EXPECT_EQ(sort_a_plus_b->column_id(), ColumnID{0});
-  EXPECT_EQ(sort_a_plus_b->order_by_mode(), OrderByMode::Descending);
-
-  const auto sort_b = std::dynamic_pointer_cast<const Sort>(sort_a_plus_b->input_left());
-  ASSERT_TRUE(sort_b);
-  EXPECT_EQ(sort_b->column_id(), ColumnID{2});
-  EXPECT_EQ(sort_b->order_by_mode(), OrderByMode::AscendingNullsLast);
-
-  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort_b->input_left());
+  const auto projection_b = std::dynamic_pointer_cast<const Projection>(sort->input_left());
   ASSERT_TRUE(projection_b);
 
   const auto get_table = std::dynamic_pointer_cast<const GetTable>(projection_b->input_left());
@@ -374,6 +369,58 @@ TEST_F(LQPTranslatorTest, LimitLiteral) {
   EXPECT_EQ(get_table->table_name(), "table_int_float");
 }
 
+TEST_F(LQPTranslatorTest, LimitOverSortIsTranslatedToTopK) {
+  /**
+   * Build LQP and translate to PQP
+   *
+   * LQP resembles:
+   *   SELECT * FROM int_float ORDER BY b DESC, a LIMIT 10
+   */
+  const auto order_by_modes = std::vector<OrderByMode>{OrderByMode::Descending, OrderByMode::Ascending};
+
+  // clang-format off
+  const auto lqp =
+  LimitNode::make(value_(int64_t{10}),
+    SortNode::make(expression_vector(int_float_b, int_float_a), order_by_modes,
+      int_float_node));
+  // clang-format on
+  const auto pqp = LQPTranslator{}.translate_node(lqp);
+
+  /**
+   * Check PQP
+   */
+  const auto top_k = std::dynamic_pointer_cast<TopK>(pqp);
+  ASSERT_TRUE(top_k);
+  const auto expected_sort_definitions =
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending},
+                                        SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}};
+  EXPECT_EQ(top_k->sort_definitions(), expected_sort_definitions);
+  EXPECT_EQ(*top_k->row_count_expression(), *value_(int64_t{10}));
+
+  const auto get_table = std::dynamic_pointer_cast<const GetTable>(top_k->input_left());
+  ASSERT_TRUE(get_table);
+  EXPECT_EQ(get_table->table_name(), "table_int_float");
+}
+
+TEST_F(LQPTranslatorTest, LimitOverSortIsNotTranslatedToTopK) {
+  const auto order_by_modes = std::vector<OrderByMode>{OrderByMode::Ascending};
+
+  // The row count exceeds TopK::MAX_ROW_COUNT
+  const auto large_row_count = static_cast<int64_t>(TopK::MAX_ROW_COUNT + 1);
+  const auto large_limit_lqp = LimitNode::make(
+      value_(large_row_count), SortNode::make(expression_vector(int_float_a), order_by_modes, int_float_node));
+  const auto large_limit_pqp = LQPTranslator{}.translate_node(large_limit_lqp);
+  ASSERT_TRUE(std::dynamic_pointer_cast<Limit>(large_limit_pqp));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(large_limit_pqp->input_left()));
+
+  // The row count is not known when the plan is translated
+  const auto placeholder_lqp = LimitNode::make(
+      placeholder_(ParameterID{0}), SortNode::make(expression_vector(int_float_a), order_by_modes, int_float_node));
+  const auto placeholder_pqp = LQPTranslator{}.translate_node(placeholder_lqp);
+  ASSERT_TRUE(std::dynamic_pointer_cast<Limit>(placeholder_pqp));
+  EXPECT_TRUE(std::dynamic_pointer_cast<const Sort>(placeholder_pqp->input_left()));
+}
+
 TEST_F(LQPTranslatorTest, PredicateNodeUnaryScan) {
   /**
    * Build LQP and translate to PQP
@@ -591,6 +638,37 @@ TEST_F(LQPTranslatorTest, JoinNodeToJoinHash) {
   EXPECT_EQ(join_op->mode(), JoinMode::Inner);
 }
 
+TEST_F(LQPTranslatorTest, JoinNodeToJoinIndex) {
+  const auto column_definitions = TableColumnDefinitions{{"x", DataType::Int, false}};
+  const auto indexed_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{25});
+  const auto unindexed_table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{25});
+  for (auto value = int32_t{0}; value < 100; ++value) {
+    indexed_table->append({value});
+    unindexed_table->append({value});
+  }
+  indexed_table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(indexed_table, SegmentEncodingSpec{EncodingType::Dictionary});
+  indexed_table->create_index<GroupKeyIndex>({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("indexed", indexed_table);
+  Hyrise::get().storage_manager.add_table("unindexed", unindexed_table);
+
+  const auto indexed_node = StoredTableNode::make("indexed");
+  const auto unindexed_node = StoredTableNode::make("unindexed");
+  const auto indexed_x = indexed_node->get_column("x");
+
+  // Looking up the three rows of table_int_float in the indexes of the four chunks is cheaper than a JoinHash
+  auto join_node = JoinNode::make(JoinMode::Inner, equals_(indexed_x, int_float_a), indexed_node, int_float_node);
+  const auto join_index = std::dynamic_pointer_cast<JoinIndex>(LQPTranslator{}.translate_node(join_node));
+  ASSERT_TRUE(join_index);
+  EXPECT_EQ(join_index->input_left()->type(), OperatorType::GetTable);
+  EXPECT_EQ(join_index->primary_predicate().column_ids, ColumnIDPair(ColumnID{0}, ColumnID{0}));
+
+  // Looking up each of the 100 rows in four indexes is not
+  join_node = JoinNode::make(JoinMode::Inner, equals_(indexed_x, unindexed_node->get_column("x")), indexed_node,
+                             unindexed_node);
+  EXPECT_TRUE(std::dynamic_pointer_cast<JoinHash>(LQPTranslator{}.translate_node(join_node)));
+}
+
 TEST_F(LQPTranslatorTest, JoinNodeToJoinSortMerge) {
   /**
    * Build LQP and translate to PQP
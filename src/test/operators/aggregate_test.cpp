@@ -19,6 +19,8 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -887,4 +889,113 @@ TYPED_TEST(OperatorsAggregateTest, StringVariations) {
   EXPECT_EQ(values_sorted, result_values_sorted);
 }
 
+TYPED_TEST(OperatorsAggregateTest, ManyChunksInParallel) {
+  // AggregateHash pre-aggregates each chunk and merges the partial results, which needs to yield the same result as
+  // aggregating a single chunk
+  const auto table_column_definitions =
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}, {"c", DataType::Double, false}};
+  const auto chunked_table = std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{100});
+  const auto single_chunk_table =
+      std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{2'000});
+  for (auto row = int32_t{0}; row < 2'000; ++row) {
+    const auto b = row % 11 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row % 101};
+    const auto c = static_cast<double>(row % 7) * 1.5;
+    chunked_table->append({row % 37, b, c});
+    single_chunk_table->append({row % 37, b, c});
+  }
+
+  const auto chunked_table_wrapper = std::make_shared<TableWrapper>(chunked_table);
+  chunked_table_wrapper->execute();
+  const auto single_chunk_table_wrapper = std::make_shared<TableWrapper>(single_chunk_table);
+  single_chunk_table_wrapper->execute();
+
+  const auto b = pqp_column_(ColumnID{1}, DataType::Int, true, "b");
+  const auto c = pqp_column_(ColumnID{2}, DataType::Double, false, "c");
+  const auto star = pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*");
+  const auto aggregate_functions = std::vector<std::pair<AggregateFunction, std::shared_ptr<AbstractExpression>>>{
+      {AggregateFunction::Min, b},
+      {AggregateFunction::Max, b},
+      {AggregateFunction::Sum, b},
+      {AggregateFunction::Avg, b},
+      {AggregateFunction::Count, b},
+      {AggregateFunction::CountDistinct, b},
+      {AggregateFunction::StandardDeviationSample, c},
+      {AggregateFunction::Count, star}};
+  auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{};
+  for (const auto& [aggregate_function, argument] : aggregate_functions) {
+    aggregates.emplace_back(std::make_shared<AggregateExpression>(aggregate_function, argument));
+  }
+
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{}, std::vector<ColumnID>{ColumnID{0}}}) {
+    const auto aggregate = std::make_shared<TypeParam>(chunked_table_wrapper, aggregates, groupby_column_ids);
+    aggregate->execute();
+
+    const auto expected_aggregate =
+        std::make_shared<TypeParam>(single_chunk_table_wrapper, aggregates, groupby_column_ids);
+    expected_aggregate->execute();
+
+    EXPECT_TABLE_EQ_UNORDERED(aggregate->get_output(), expected_aggregate->get_output());
+  }
+
+  // Without aggregates, i.e., DISTINCT
+  const auto distinct = std::make_shared<TypeParam>(
+      chunked_table_wrapper, std::vector<std::shared_ptr<AggregateExpression>>{}, std::vector<ColumnID>{ColumnID{0}});
+  distinct->execute();
+  EXPECT_EQ(distinct->get_output()->row_count(), 37u);
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
+TYPED_TEST(OperatorsAggregateTest, DictionaryEncodedGroupByColumns) {
+  // GROUP BY columns stored in DictionarySegments use the ValueIDs to find the groups, which needs to yield the same
+  // result as grouping unencoded values. Column a has few distinct values, b has many. Short and long strings are
+  // mapped to IDs differently.
+  const auto table_column_definitions = TableColumnDefinitions{
+      {"a", DataType::String, true}, {"b", DataType::String, false}, {"c", DataType::Long, false}};
+  const auto unencoded_table = std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{100});
+  const auto encoded_table = std::make_shared<Table>(table_column_definitions, TableType::Data, ChunkOffset{100});
+  const auto a_values = std::vector<AllTypeVariant>{pmr_string{"A"}, pmr_string{"N"}, pmr_string{"a_long_string"},
+                                                    NULL_VALUE};
+  for (auto row = size_t{0}; row < 1'000; ++row) {
+    const auto b = pmr_string{"b_value_"} + pmr_string{std::to_string(row % 301)};
+    unencoded_table->append({a_values[row % 4], b, static_cast<int64_t>(row)});
+    encoded_table->append({a_values[row % 4], b, static_cast<int64_t>(row)});
+  }
+  ChunkEncoder::encode_all_chunks(encoded_table);
+
+  const auto aggregates = std::vector<std::shared_ptr<AggregateExpression>>{
+      std::make_shared<AggregateExpression>(AggregateFunction::Sum,
+                                            pqp_column_(ColumnID{2}, DataType::Long, false, "c")),
+      std::make_shared<AggregateExpression>(AggregateFunction::Count,
+                                            pqp_column_(INVALID_COLUMN_ID, DataType::Long, false, "*"))};
+
+  for (const auto& groupby_column_ids : {std::vector<ColumnID>{ColumnID{0}}, std::vector<ColumnID>{ColumnID{1}},
+                                         std::vector<ColumnID>{ColumnID{0}, ColumnID{1}}}) {
+    auto outputs = std::vector<std::shared_ptr<const Table>>{};
+    for (const auto& table : {unencoded_table, encoded_table}) {
+      const auto table_wrapper = std::make_shared<TableWrapper>(table);
+      table_wrapper->execute();
+
+      const auto aggregate = std::make_shared<TypeParam>(table_wrapper, aggregates, groupby_column_ids);
+      aggregate->execute();
+      outputs.emplace_back(aggregate->get_output());
+
+      // On a ReferenceSegment that references a single chunk
+      const auto table_scan =
+          std::make_shared<TableScan>(table_wrapper, greater_than_(pqp_column_(ColumnID{2}, DataType::Long, false, "c"),
+                                                                   int64_t{100}));
+      table_scan->execute();
+      const auto aggregate_on_references = std::make_shared<TypeParam>(table_scan, aggregates, groupby_column_ids);
+      aggregate_on_references->execute();
+      outputs.emplace_back(aggregate_on_references->get_output());
+    }
+
+    EXPECT_TABLE_EQ_UNORDERED(outputs[2], outputs[0]);
+    EXPECT_TABLE_EQ_UNORDERED(outputs[3], outputs[1]);
+  }
+}
+
 }  // namespace opossum
@@ -1,3 +1,5 @@
+#include <numeric>
+
 #include "../base_test.hpp"
 
 #include "operators/join_hash/join_hash_steps.hpp"
@@ -205,6 +207,51 @@ TEST_F(JoinHashStepsTest, MaterializeInputHistograms) {
   EXPECT_EQ(empty_cluster_count, 2 * this->_table_size_zero_one / this->_chunk_size_zero_one);
 }
 
+TEST_F(JoinHashStepsTest, BloomFilter) {
+  auto bloom_filter = BloomFilter{1'000};
+  const auto hash_function = std::hash<int>{};
+  for (auto value = 0; value < 1'000; ++value) {
+    bloom_filter.insert(hash_function(2 * value));
+  }
+
+  auto false_positive_count = size_t{0};
+  for (auto value = 0; value < 1'000; ++value) {
+    EXPECT_TRUE(bloom_filter.may_contain(hash_function(2 * value)));
+    if (bloom_filter.may_contain(hash_function(2 * value + 1))) ++false_positive_count;
+  }
+  EXPECT_LT(false_positive_count, 50);
+}
+
+TEST_F(JoinHashStepsTest, MaterializeInputWithBloomFilter) {
+  // The build side only contains zeros
+  const auto build_table = std::make_shared<Table>(_table_zero_one->column_definitions(), TableType::Data);
+  build_table->append({0});
+  build_table->append({0});
+
+  auto bloom_filter = BloomFilter{build_table->row_count()};
+  std::vector<std::vector<size_t>> histograms;
+  const auto materialized_build_column =
+      materialize_input<int, int, false>(build_table, ColumnID{0}, histograms, 0, &bloom_filter);
+  EXPECT_EQ(materialized_build_column[0].elements.size(), 2u);
+
+  // The ones of the probe side are discarded, unless the filter yields a false positive for them. The histograms only
+  // count the materialized rows.
+  histograms.clear();
+  const auto materialized_probe_column =
+      materialize_input<int, int, false>(_table_zero_one, ColumnID{0}, histograms, 1, nullptr, &bloom_filter);
+  const auto one_is_false_positive = bloom_filter.may_contain(std::hash<int>{}(1));
+  const auto expected_row_count = one_is_false_positive ? _chunk_size_zero_one : _chunk_size_zero_one / 2;
+  for (auto chunk_id = size_t{0}; chunk_id < materialized_probe_column.size(); ++chunk_id) {
+    const auto& elements = materialized_probe_column[chunk_id].elements;
+    EXPECT_EQ(elements.size(), expected_row_count);
+    for (const auto& element : elements) {
+      EXPECT_TRUE(element.value == 0 || one_is_false_positive);
+    }
+    EXPECT_EQ(std::accumulate(histograms[chunk_id].begin(), histograms[chunk_id].end(), size_t{0}),
+              expected_row_count);
+  }
+}
+
 TEST_F(JoinHashStepsTest, RadixClusteringOfNulls) {
   const size_t radix_bit_count = 1;
   std::vector<std::vector<size_t>> histograms;
@@ -7,9 +7,11 @@
 #include "base_test.hpp"
 
 #include "all_type_variant.hpp"
+#include "hyrise.hpp"
 #include "operators/join_index.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
 #include "storage/index/b_tree/b_tree_index.hpp"
@@ -223,6 +225,17 @@ TYPED_TEST(JoinIndexTest, InnerRefDictJoin) {
                          "resources/test_data/tbl/join_operators/int_inner_join.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, InnerRefJoinPrunedChunk) {
+  // No row of the first chunk of table b matches, so that the scan drops it. The only chunk of the scan output
+  // references (and is joined using the index of) the second chunk of table b.
+  auto scan_b = create_table_scan(this->_table_wrapper_b, ColumnID{0}, PredicateCondition::LessThan, 1000);
+  scan_b->execute();
+  ASSERT_EQ(scan_b->get_output()->chunk_count(), 1);
+
+  this->test_join_output(this->_table_wrapper_a, scan_b, {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals},
+                         JoinMode::Inner, "resources/test_data/tbl/join_operators/int_inner_join_pruned_chunk.tbl", 1);
+}
+
 TYPED_TEST(JoinIndexTest, InnerRefDictJoinFiltered) {
   auto scan_a = create_table_scan(this->_table_wrapper_a, ColumnID{0}, PredicateCondition::GreaterThan, 1000);
   scan_a->execute();
@@ -249,6 +262,33 @@ TYPED_TEST(JoinIndexTest, InnerRefJoinFilteredBig) {
                          "resources/test_data/tbl/join_operators/int_string_inner_join_filtered.tbl", 1);
 }
 
+TYPED_TEST(JoinIndexTest, InnerRefJoinFilteredBigIndexSideLeft) {
+  auto scan_c = create_table_scan(this->_table_wrapper_c, ColumnID{0}, PredicateCondition::GreaterThanEquals, 0);
+  scan_c->execute();
+  auto scan_d = create_table_scan(this->_table_wrapper_d, ColumnID{1}, PredicateCondition::GreaterThanEquals, 6);
+  scan_d->execute();
+
+  this->test_join_output(scan_c, scan_d, {{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals}, JoinMode::Inner,
+                         "resources/test_data/tbl/join_operators/int_string_inner_join_filtered.tbl", 1, true,
+                         IndexSide::Left);
+}
+
+TYPED_TEST(JoinIndexTest, JoinWithScheduler) {
+  // The probe side chunks are joined by concurrent jobs
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  this->test_join_output(this->_table_wrapper_c, this->_table_wrapper_d,
+                         {{ColumnID{0}, ColumnID{1}}, PredicateCondition::Equals}, JoinMode::Inner,
+                         "resources/test_data/tbl/join_operators/int_string_inner_join.tbl", 1);
+  this->test_join_output(this->_table_wrapper_a, this->_table_wrapper_b,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::Left,
+                         "resources/test_data/tbl/join_operators/int_left_join_equals.tbl", 1);
+  this->test_join_output(this->_table_wrapper_a, this->_table_wrapper_b,
+                         {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::FullOuter,
+                         "resources/test_data/tbl/join_operators/int_outer_join.tbl", 1);
+}
+
 TYPED_TEST(JoinIndexTest, OuterJoin) {
   this->test_join_output(this->_table_wrapper_a, this->_table_wrapper_b,
                          {{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals}, JoinMode::FullOuter,
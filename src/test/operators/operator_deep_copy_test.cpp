@@ -14,6 +14,7 @@
 #include "operators/sort.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
 #include "operators/union_positions.hpp"
 #include "sql/sql_pipeline_builder.hpp"
 #include "storage/table.hpp"
@@ -135,7 +136,9 @@ TEST_F(OperatorDeepCopyTest, DeepCopySort) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 1);
 
   // build and execute sort
-  auto sort = std::make_shared<Sort>(_table_wrapper_a, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_a,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
   EXPECT_TABLE_EQ_UNORDERED(sort->get_output(), expected_result);
 
@@ -149,6 +152,25 @@ TEST_F(OperatorDeepCopyTest, DeepCopySort) {
   EXPECT_TABLE_EQ_UNORDERED(copied_sort->get_output(), expected_result);
 }
 
+TEST_F(OperatorDeepCopyTest, DeepCopyTopK) {
+  // build and execute top k
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper_a,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}},
+      to_expression(int64_t{2}));
+  top_k->execute();
+  EXPECT_EQ(top_k->get_output()->row_count(), 2u);
+
+  // copy end execute copied top k
+  auto copied_top_k = top_k->deep_copy();
+  EXPECT_NE(copied_top_k, nullptr) << "Could not copy TopK";
+
+  // table wrapper needs to be executed manually
+  copied_top_k->mutable_input_left()->execute();
+  copied_top_k->execute();
+  EXPECT_TABLE_EQ_ORDERED(copied_top_k->get_output(), top_k->get_output());
+}
+
 TEST_F(OperatorDeepCopyTest, DeepCopyTableScan) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_filtered2.tbl", 1);
 
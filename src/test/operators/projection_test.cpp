@@ -13,6 +13,8 @@
 #include "operators/projection.hpp"
 #include "operators/table_scan.hpp"
 #include "operators/table_wrapper.hpp"
+#include "scheduler/immediate_execution_scheduler.hpp"
+#include "scheduler/node_queue_scheduler.hpp"
 #include "storage/chunk_encoder.hpp"
 #include "storage/table.hpp"
 #include "types.hpp"
@@ -53,6 +55,24 @@ TEST_F(OperatorsProjectionTest, ExecutedOnAllChunks) {
                             load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
 }
 
+TEST_F(OperatorsProjectionTest, ExecutedOnAllChunksInParallel) {
+  Hyrise::get().topology.use_fake_numa_topology(8, 4);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  const auto projection = std::make_shared<opossum::Projection>(table_wrapper_a, expression_vector(add_(a_a, a_b)));
+  projection->execute();
+
+  // Chunks are projected by separate jobs, but the output chunks have to be in the order of the input chunks
+  const auto& output_table = projection->get_output();
+  EXPECT_TABLE_EQ_ORDERED(output_table, load_table("resources/test_data/tbl/projection/int_float_add.tbl"));
+  ASSERT_EQ(output_table->chunk_count(), table_wrapper_a->get_output()->chunk_count());
+  for (auto chunk_id = ChunkID{0}; chunk_id < output_table->chunk_count(); ++chunk_id) {
+    EXPECT_EQ(output_table->get_chunk(chunk_id)->size(), table_wrapper_a->get_output()->get_chunk(chunk_id)->size());
+  }
+
+  Hyrise::get().set_scheduler(std::make_shared<ImmediateExecutionScheduler>());
+}
+
 TEST_F(OperatorsProjectionTest, PassThroughInvalidRowCount) {
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
 
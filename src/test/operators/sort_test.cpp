@@ -62,7 +62,8 @@ INSTANTIATE_TEST_SUITE_P(DictionaryEncodingTypes, OperatorsSortTest, ::testing::
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumn) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -77,7 +78,8 @@ TEST_P(OperatorsSortTest, AscendingSortOFilteredColumn) {
   auto scan = create_table_scan(input, ColumnID{0}, PredicateCondition::NotEquals, 123);
   scan->execute();
 
-  auto sort = std::make_shared<Sort>(scan, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      scan, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -86,7 +88,8 @@ TEST_P(OperatorsSortTest, AscendingSortOFilteredColumn) {
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithoutChunkSize) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Ascending);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -95,10 +98,13 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithoutChunkSize) {
 TEST_P(OperatorsSortTest, DoubleSortOfOneColumn) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 2);
 
-  auto sort1 = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 2u);
+  auto sort1 = std::make_shared<Sort>(
+      _table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 2u);
   sort1->execute();
 
-  auto sort2 = std::make_shared<Sort>(sort1, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort2 = std::make_shared<Sort>(
+      sort1, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort2->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort2->get_output(), expected_result);
@@ -107,7 +113,9 @@ TEST_P(OperatorsSortTest, DoubleSortOfOneColumn) {
 TEST_P(OperatorsSortTest, DescendingSortOfOneColumn) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_reverse.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper, ColumnID{0}, OrderByMode::Descending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -121,10 +129,12 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStable) {
 
   // we want the output to be sorted after column a and in second place after column b.
   // So first we sort after column b and then after column a.
-  auto sort_after_b = std::make_shared<Sort>(table_wrapper, ColumnID{1}, OrderByMode::Ascending, 2u);
+  auto sort_after_b = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, 2u);
   sort_after_b->execute();
 
-  auto sort_after_a = std::make_shared<Sort>(sort_after_b, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort_after_a = std::make_shared<Sort>(
+      sort_after_b, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort_after_a->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
@@ -138,19 +148,77 @@ TEST_P(OperatorsSortTest, MultipleColumnSortIsStableMixedOrder) {
 
   // we want the output to be sorted after column a and in second place after column b.
   // So first we sort after column b and then after column a.
-  auto sort_after_b = std::make_shared<Sort>(table_wrapper, ColumnID{1}, OrderByMode::Descending, 2u);
+  auto sort_after_b = std::make_shared<Sort>(
+      table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}}, 2u);
   sort_after_b->execute();
 
-  auto sort_after_a = std::make_shared<Sort>(sort_after_b, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort_after_a = std::make_shared<Sort>(
+      sort_after_b, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort_after_a->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort_after_a->get_output(), expected_result);
 }
 
+TEST_P(OperatorsSortTest, SortByMultipleColumns) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+  EXPECT_EQ(sort->get_output()->get_chunk(ChunkID{0})->ordered_by(),
+            std::make_pair(ColumnID{0}, OrderByMode::Ascending));
+}
+
+TEST_P(OperatorsSortTest, SortByMultipleColumnsMixedOrder) {
+  auto table_wrapper = std::make_shared<TableWrapper>(load_table("resources/test_data/tbl/int_float4.tbl", 2));
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float2_sorted_mixed.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
+TEST_P(OperatorsSortTest, SortByStringsWithSharedPrefixes) {
+  // The strings share a prefix that is longer than the part of the string stored in the normalized key. Thus, the
+  // full strings have to be compared before the second sort column is looked at.
+  auto table = load_table("resources/test_data/tbl/string_int_shared_prefix.tbl", 2);
+  ChunkEncoder::encode_all_chunks(table, _encoding_type);
+  auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+
+  std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/string_int_shared_prefix_sorted.tbl", 2);
+
+  auto sort = std::make_shared<Sort>(
+      table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      2u);
+  sort->execute();
+
+  EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
+}
+
 TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -159,7 +227,9 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNull) {
 TEST_P(OperatorsSortTest, DescendingSortOfOneColumnWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_desc.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, OrderByMode::Descending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -169,7 +239,9 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneColumnWithNullsLast) {
   std::shared_ptr<Table> expected_result =
       load_table("resources/test_data/tbl/int_float_null_sorted_asc_nulls_last.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, OrderByMode::AscendingNullsLast, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::AscendingNullsLast}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -179,7 +251,9 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneColumnWithNullsLast) {
   std::shared_ptr<Table> expected_result =
       load_table("resources/test_data/tbl/int_float_null_sorted_desc_nulls_last.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null, ColumnID{0}, OrderByMode::DescendingNullsLast, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::DescendingNullsLast}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -188,7 +262,9 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneColumnWithNullsLast) {
 TEST_P(OperatorsSortTest, AscendingSortOfOneDictSegmentWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_asc.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null_dict,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -197,7 +273,9 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneDictSegmentWithNull) {
 TEST_P(OperatorsSortTest, DescendingSortOfOneDictSegmentWithNull) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_null_sorted_desc.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_null_dict, ColumnID{0}, OrderByMode::Descending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_null_dict,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -206,7 +284,9 @@ TEST_P(OperatorsSortTest, DescendingSortOfOneDictSegmentWithNull) {
 TEST_P(OperatorsSortTest, AscendingSortOfOneDictSegment) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_sorted.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_dict, ColumnID{0}, OrderByMode::Ascending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_dict,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -215,7 +295,9 @@ TEST_P(OperatorsSortTest, AscendingSortOfOneDictSegment) {
 TEST_P(OperatorsSortTest, DescendingSortOfOneDictSegment) {
   std::shared_ptr<Table> expected_result = load_table("resources/test_data/tbl/int_float_reverse.tbl", 2);
 
-  auto sort = std::make_shared<Sort>(_table_wrapper_dict, ColumnID{0}, OrderByMode::Descending, 2u);
+  auto sort = std::make_shared<Sort>(
+      _table_wrapper_dict,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 2u);
   sort->execute();
 
   EXPECT_TABLE_EQ_ORDERED(sort->get_output(), expected_result);
@@ -227,7 +309,8 @@ TEST_P(OperatorsSortTest, SortAfterOuterJoin) {
                                        OperatorJoinPredicate{{ColumnID{0}, ColumnID{0}}, PredicateCondition::Equals});
   join->execute();
 
-  auto sort = std::make_shared<Sort>(join, ColumnID{0}, OrderByMode::Ascending);
+  auto sort = std::make_shared<Sort>(
+      join, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}});
   sort->execute();
 
   std::shared_ptr<Table> expected_result =
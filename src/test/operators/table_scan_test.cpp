@@ -875,6 +875,50 @@ TEST_P(OperatorsTableScanTest, SetParameters) {
   EXPECT_EQ(*scan_c->predicate(), *greater_than_equals_(column, placeholder_(ParameterID{4})));
 }
 
+TEST_P(OperatorsTableScanTest, PruneChunksAtRuntime) {
+  // Four chunks with the values 0-4, 5-9, 10-14, and 15-19
+  const auto table = std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::Int, false}}, TableType::Data, 5);
+  for (auto value = 0; value < 20; ++value) {
+    table->append({value});
+  }
+  table->last_chunk()->finalize();
+  ChunkEncoder::encode_all_chunks(table, SegmentEncodingSpec{_encoding_type});
+
+  const auto table_wrapper = std::make_shared<TableWrapper>(table);
+  table_wrapper->execute();
+  const auto column = get_column_expression(table_wrapper, ColumnID{0});
+
+  const auto chunks_pruned = [](const auto& table_scan) {
+    return static_cast<const TableScan::PerformanceData&>(table_scan->performance_data()).chunks_pruned;
+  };
+
+  // The value of the placeholder is only known at runtime, so the ChunkPruningRule could not have pruned any chunk
+  const auto scan_equals = std::make_shared<TableScan>(table_wrapper, equals_(column, placeholder_(ParameterID{0})));
+  scan_equals->set_parameters({{ParameterID{0}, AllTypeVariant{7}}});
+  scan_equals->execute();
+  EXPECT_EQ(scan_equals->get_output()->row_count(), 1u);
+  EXPECT_EQ(chunks_pruned(scan_equals), 3u);
+
+  const auto scan_between = std::make_shared<TableScan>(
+      table_wrapper, between_inclusive_(column, placeholder_(ParameterID{0}), placeholder_(ParameterID{1})));
+  scan_between->set_parameters({{ParameterID{0}, AllTypeVariant{8}}, {ParameterID{1}, AllTypeVariant{12}}});
+  scan_between->execute();
+  EXPECT_EQ(scan_between->get_output()->row_count(), 5u);
+  EXPECT_EQ(chunks_pruned(scan_between), 2u);
+
+  // Each chunk of the first scan's output references a single chunk, whose statistics can be used
+  const auto scan_less_than = std::make_shared<TableScan>(scan_between, less_than_(column, 10));
+  scan_less_than->execute();
+  EXPECT_EQ(scan_less_than->get_output()->row_count(), 2u);
+  EXPECT_EQ(chunks_pruned(scan_less_than), 1u);
+
+  // Predicates that cannot be checked against the statistics do not prune any chunk
+  const auto scan_expression = std::make_shared<TableScan>(table_wrapper, greater_than_(column, add_(column, 1)));
+  scan_expression->execute();
+  EXPECT_EQ(scan_expression->get_output()->row_count(), 0u);
+  EXPECT_EQ(chunks_pruned(scan_expression), 0u);
+}
+
 TEST_P(OperatorsTableScanTest, GetImpl) {
   /**
    * Test that the correct scanning backend is chosen
@@ -0,0 +1,93 @@
+#include <algorithm>
+#include <functional>
+#include <memory>
+#include <random>
+#include <string>
+#include <utility>
+
+#include "base_test.hpp"
+
+#include "operators/table_scan/value_id_scan_kernel.hpp"
+#include "storage/vector_compression/vector_compression.hpp"
+
+namespace opossum {
+
+// Parameters: compression type and the largest ValueID, which determines the width of FixedSizeByteAlignedVectors
+using ValueIDScanKernelTestParams = std::pair<VectorCompressionType, uint32_t>;
+
+class OperatorsTableScanValueIDScanKernelTest : public BaseTest,
+                                                public ::testing::WithParamInterface<ValueIDScanKernelTestParams> {
+ protected:
+  void SetUp() override {
+    const auto [compression_type, max_value_id] = GetParam();
+    _null_value_id = ValueID{max_value_id};
+
+    // Use a size that is neither a multiple of the kernel's block size nor of SimdBp128's (meta) block size
+    auto random_engine = std::mt19937{};
+    auto distribution = std::uniform_int_distribution<uint32_t>{0, max_value_id};
+    _value_ids = pmr_vector<uint32_t>(5'000);
+    for (auto& value_id : _value_ids) {
+      value_id = distribution(random_engine);
+    }
+
+    _attribute_vector = compress_vector(_value_ids, compression_type, {}, {max_value_id});
+  }
+
+  template <bool CheckForNull, typename Comparator>
+  void test_scan(const Comparator& comparator, const ValueID search_value_id) {
+    const auto typed_search_value_id = static_cast<ValueID::base_type>(search_value_id);
+    const auto typed_null_value_id = static_cast<ValueID::base_type>(_null_value_id);
+
+    auto expected_matches = PosList{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < _value_ids.size(); ++chunk_offset) {
+      const auto value_id = _value_ids[chunk_offset];
+      if ((!CheckForNull || value_id != typed_null_value_id) && comparator(value_id, typed_search_value_id)) {
+        expected_matches.emplace_back(RowID{ChunkID{3}, chunk_offset});
+      }
+    }
+
+    // The kernel appends to existing matches
+    auto matches = PosList{RowID{ChunkID{3}, 0}};
+    ValueIDScanKernel::scan<CheckForNull>(*_attribute_vector, comparator, search_value_id, _null_value_id,
+                                          ChunkID{3}, matches);
+
+    ASSERT_EQ(matches.size(), expected_matches.size() + 1);
+    EXPECT_TRUE(std::equal(expected_matches.cbegin(), expected_matches.cend(), matches.cbegin() + 1));
+  }
+
+  pmr_vector<uint32_t> _value_ids;
+  ValueID _null_value_id;
+  std::unique_ptr<const BaseCompressedVector> _attribute_vector;
+};
+
+auto value_id_scan_kernel_test_formatter = [](const ::testing::TestParamInfo<ValueIDScanKernelTestParams> info) {
+  const auto compression_type = info.param.first == VectorCompressionType::SimdBp128 ? "SimdBp128" : "FixedSize";
+  return std::string{compression_type} + "MaxValueID" + std::to_string(info.param.second);
+};
+
+INSTANTIATE_TEST_SUITE_P(VectorCompressionTypes, OperatorsTableScanValueIDScanKernelTest,
+                         ::testing::Values(std::make_pair(VectorCompressionType::FixedSizeByteAligned, 200u),
+                                           std::make_pair(VectorCompressionType::FixedSizeByteAligned, 60'000u),
+                                           std::make_pair(VectorCompressionType::FixedSizeByteAligned, 100'000u),
+                                           std::make_pair(VectorCompressionType::SimdBp128, 1'000u)),
+                         value_id_scan_kernel_test_formatter);
+
+TEST_P(OperatorsTableScanValueIDScanKernelTest, Equals) {
+  test_scan<false>(std::equal_to<void>{}, ValueID{17});
+  test_scan<false>(std::equal_to<void>{}, ValueID{0});
+}
+
+TEST_P(OperatorsTableScanValueIDScanKernelTest, NotEquals) { test_scan<true>(std::not_equal_to<void>{}, ValueID{17}); }
+
+TEST_P(OperatorsTableScanValueIDScanKernelTest, LessThan) {
+  test_scan<false>(std::less<void>{}, ValueID{_null_value_id / 2});
+  test_scan<false>(std::less<void>{}, ValueID{0});
+}
+
+TEST_P(OperatorsTableScanValueIDScanKernelTest, GreaterThanEquals) {
+  test_scan<true>(std::greater_equal<void>{}, ValueID{_null_value_id / 3});
+  // Without the NULL check, the null_value_id would match
+  test_scan<false>(std::greater_equal<void>{}, ValueID{_null_value_id / 3});
+}
+
+}  // namespace opossum
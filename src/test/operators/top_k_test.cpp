@@ -0,0 +1,159 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "expression/expression_functional.hpp"
+#include "operators/limit.hpp"
+#include "operators/sort.hpp"
+#include "operators/table_scan.hpp"
+#include "operators/table_wrapper.hpp"
+#include "operators/top_k.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "types.hpp"
+
+using namespace opossum::expression_functional;  // NOLINT
+
+namespace opossum {
+
+class OperatorsTopKTest : public BaseTestWithParam<EncodingType> {
+ protected:
+  void SetUp() override {
+    _encoding_type = GetParam();
+
+    _table_wrapper = _load_encoded("resources/test_data/tbl/int_float4.tbl");
+    _table_wrapper_null = _load_encoded("resources/test_data/tbl/int_float_with_null.tbl");
+    _table_wrapper_strings = _load_encoded("resources/test_data/tbl/string_int_shared_prefix.tbl");
+  }
+
+  std::shared_ptr<TableWrapper> _load_encoded(const std::string& path) {
+    auto table = load_table(path, 2);
+    ChunkEncoder::encode_all_chunks(table, _encoding_type);
+
+    auto table_wrapper = std::make_shared<TableWrapper>(table);
+    table_wrapper->execute();
+    return table_wrapper;
+  }
+
+  // TopK has to return the same rows in the same order as a (stable) Sort followed by a Limit
+  void _test_against_sort_and_limit(const std::shared_ptr<AbstractOperator>& input,
+                                    const std::vector<SortColumnDefinition>& sort_definitions,
+                                    const int64_t row_count) {
+    auto top_k = std::make_shared<TopK>(input, sort_definitions, value_(row_count));
+    top_k->execute();
+
+    auto sort = std::make_shared<Sort>(input, sort_definitions);
+    sort->execute();
+    auto limit = std::make_shared<Limit>(sort, value_(row_count));
+    limit->execute();
+
+    EXPECT_EQ(top_k->get_output()->type(), TableType::References);
+    EXPECT_TABLE_EQ_ORDERED(top_k->get_output(), limit->get_output());
+  }
+
+  std::shared_ptr<TableWrapper> _table_wrapper, _table_wrapper_null, _table_wrapper_strings;
+  EncodingType _encoding_type;
+};
+
+auto top_k_test_formatter = [](const ::testing::TestParamInfo<EncodingType> info) {
+  return std::to_string(static_cast<uint32_t>(info.param));
+};
+
+INSTANTIATE_TEST_SUITE_P(EncodingTypes, OperatorsTopKTest,
+                         ::testing::Values(EncodingType::Unencoded, EncodingType::Dictionary), top_k_test_formatter);
+
+TEST_P(OperatorsTopKTest, Description) {
+  const auto top_k = std::make_shared<TopK>(
+      _table_wrapper,
+      std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+                                        SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      value_(int64_t{3}));
+
+  EXPECT_EQ(top_k->description(DescriptionMode::SingleLine),
+            "TopK 3l {Column #0 AscendingNullsFirst, Column #1 DescendingNullsFirst}");
+}
+
+TEST_P(OperatorsTopKTest, SingleColumn) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}},
+      value_(int64_t{2}));
+  top_k->execute();
+
+  const auto expected_result = load_table("resources/test_data/tbl/int_float2_sorted.tbl", 2);
+  const auto& expected_rows = expected_result->get_rows();
+  const auto& output_rows = top_k->get_output()->get_rows();
+  ASSERT_EQ(output_rows.size(), 2u);
+  EXPECT_EQ(output_rows[0], expected_rows[0]);
+  EXPECT_EQ(output_rows[1], expected_rows[1]);
+}
+
+TEST_P(OperatorsTopKTest, MultipleColumns) {
+  for (const auto row_count : {int64_t{1}, int64_t{3}, int64_t{5}}) {
+    _test_against_sort_and_limit(
+        _table_wrapper,
+        {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}, SortColumnDefinition{ColumnID{1}}}, row_count);
+    _test_against_sort_and_limit(
+        _table_wrapper,
+        {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending},
+         SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}},
+        row_count);
+  }
+}
+
+TEST_P(OperatorsTopKTest, EqualKeysKeepInputOrder) {
+  // Most rows have equal values in column a, so the candidates of different chunks have to be merged stably
+  _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{0}, OrderByMode::Descending}}, 4);
+}
+
+TEST_P(OperatorsTopKTest, StringsWithSharedPrefixes) {
+  _test_against_sort_and_limit(
+      _table_wrapper_strings,
+      {SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending},
+       SortColumnDefinition{ColumnID{1}, OrderByMode::Descending}},
+      4);
+}
+
+TEST_P(OperatorsTopKTest, Nulls) {
+  for (const auto order_by_mode : {OrderByMode::Ascending, OrderByMode::Descending, OrderByMode::AscendingNullsLast,
+                                   OrderByMode::DescendingNullsLast}) {
+    _test_against_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{0}, order_by_mode}}, 2);
+    _test_against_sort_and_limit(_table_wrapper_null, {SortColumnDefinition{ColumnID{1}, order_by_mode}}, 3);
+  }
+}
+
+TEST_P(OperatorsTopKTest, ReferenceSegments) {
+  auto table_scan = create_table_scan(_table_wrapper, ColumnID{0}, PredicateCondition::GreaterThan, 123);
+  table_scan->execute();
+
+  _test_against_sort_and_limit(
+      table_scan,
+      {SortColumnDefinition{ColumnID{1}, OrderByMode::Descending},
+       SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}},
+      2);
+}
+
+TEST_P(OperatorsTopKTest, RowCountExceedsInput) {
+  _test_against_sort_and_limit(_table_wrapper, {SortColumnDefinition{ColumnID{1}, OrderByMode::Ascending}}, 100);
+}
+
+TEST_P(OperatorsTopKTest, ZeroRows) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}},
+      value_(int64_t{0}));
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 0u);
+  EXPECT_EQ(top_k->get_output()->column_definitions(), _table_wrapper->get_output()->column_definitions());
+}
+
+TEST_P(OperatorsTopKTest, RowCountParameter) {
+  auto top_k = std::make_shared<TopK>(
+      _table_wrapper, std::vector<SortColumnDefinition>{SortColumnDefinition{ColumnID{0}, OrderByMode::Ascending}},
+      placeholder_(ParameterID{0}));
+  top_k->set_parameters({{ParameterID{0}, int64_t{3}}});
+  top_k->execute();
+
+  EXPECT_EQ(top_k->get_output()->row_count(), 3u);
+}
+
+}  // namespace opossum
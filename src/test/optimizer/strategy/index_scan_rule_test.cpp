@@ -177,4 +177,44 @@ TEST_F(IndexScanRuleTest, IndexScanOnlyOnOutputOfStoredTableNode) {
   EXPECT_EQ(predicate_node_1->scan_type, ScanType::TableScan);
 }
 
+TEST_F(IndexScanRuleTest, PrimaryKeyIndexScan) {
+  table->add_soft_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+
+  // The equality predicates on the primary key columns are merged and moved to the StoredTableNode, regardless of the
+  // statistics
+  generate_mock_statistics();
+
+  // clang-format off
+  const auto input_lqp =
+  PredicateNode::make(equals_(b, 4),
+    PredicateNode::make(greater_than_(c, 10),
+      PredicateNode::make(equals_(5, a),
+        stored_table_node)));
+
+  const auto expected_lqp =
+  PredicateNode::make(greater_than_(c, 10),
+    PredicateNode::make(and_(equals_(a, 5), equals_(b, 4)),
+      stored_table_node));
+  // clang-format on
+
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, input_lqp);
+  EXPECT_LQP_EQ(actual_lqp, expected_lqp);
+  EXPECT_EQ(std::static_pointer_cast<PredicateNode>(actual_lqp->left_input())->scan_type,
+            ScanType::PrimaryKeyIndexScan);
+}
+
+TEST_F(IndexScanRuleTest, NoPrimaryKeyIndexScanForPartialKey) {
+  table->add_soft_unique_constraint({ColumnID{0}, ColumnID{1}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+
+  generate_mock_statistics();
+
+  const auto predicate_node =
+      PredicateNode::make(equals_(a, 5), PredicateNode::make(greater_than_(b, 4), stored_table_node));
+  const auto actual_lqp = StrategyBaseTest::apply_rule(rule, predicate_node);
+  EXPECT_EQ(actual_lqp, predicate_node);
+  EXPECT_EQ(predicate_node->scan_type, ScanType::TableScan);
+}
+
 }  // namespace opossum
@@ -13,6 +13,7 @@
 #include "scheduler/job_task.hpp"
 #include "scheduler/node_queue_scheduler.hpp"
 #include "scheduler/operator_task.hpp"
+#include "scheduler/worker.hpp"
 
 using namespace opossum::expression_functional;  // NOLINT
 
@@ -257,4 +258,34 @@ TEST_F(SchedulerTest, SingleWorkerGuaranteeProgress) {
   Hyrise::get().scheduler()->finish();
 }
 
+TEST_F(SchedulerTest, WorkerStatistics) {
+  Hyrise::get().topology.use_fake_numa_topology(4, 2);
+  const auto node_queue_scheduler = std::make_shared<NodeQueueScheduler>();
+  Hyrise::get().set_scheduler(node_queue_scheduler);
+
+  // The subtasks are pushed to the deque of the worker that executes the outer task, so that others can steal them
+  auto counter = std::atomic_uint{0};
+  auto task = std::make_shared<JobTask>([&counter]() {
+    auto subtasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto subtask_idx = 0; subtask_idx < 100; ++subtask_idx) {
+      subtasks.emplace_back(std::make_shared<JobTask>([&counter]() { ++counter; }));
+    }
+    Hyrise::get().scheduler()->schedule_and_wait_for_tasks(subtasks);
+  });
+  task->schedule();
+  Hyrise::get().scheduler()->wait_for_all_tasks();
+  EXPECT_EQ(counter, 100);
+
+  auto num_finished_tasks = uint64_t{0};
+  auto num_stolen_tasks = uint64_t{0};
+  for (const auto& worker : node_queue_scheduler->workers()) {
+    num_finished_tasks += worker->num_finished_tasks();
+    num_stolen_tasks += worker->num_stolen_tasks();
+  }
+  EXPECT_EQ(num_finished_tasks, 101);
+  EXPECT_LE(num_stolen_tasks, 100);
+
+  Hyrise::get().scheduler()->finish();
+}
+
 }  // namespace opossum
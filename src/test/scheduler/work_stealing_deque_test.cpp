@@ -0,0 +1,96 @@
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <thread>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "scheduler/job_task.hpp"
+#include "scheduler/work_stealing_deque.hpp"
+
+namespace opossum {
+
+class WorkStealingDequeTest : public BaseTest {
+ protected:
+  std::vector<std::shared_ptr<AbstractTask>> create_tasks(const size_t count) {
+    auto tasks = std::vector<std::shared_ptr<AbstractTask>>{};
+    for (auto task_idx = size_t{0}; task_idx < count; ++task_idx) {
+      tasks.emplace_back(std::make_shared<JobTask>([]() {}));
+    }
+    return tasks;
+  }
+};
+
+TEST_F(WorkStealingDequeTest, PopIsLifoAndStealIsFifo) {
+  auto deque = WorkStealingDeque{};
+  const auto tasks = create_tasks(3);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size(), 3);
+
+  EXPECT_EQ(deque.pop(), tasks[2]);
+  EXPECT_EQ(deque.steal(), tasks[0]);
+  EXPECT_EQ(deque.pop(), tasks[1]);
+
+  EXPECT_TRUE(deque.empty());
+  EXPECT_EQ(deque.pop(), nullptr);
+  EXPECT_EQ(deque.steal(), nullptr);
+}
+
+TEST_F(WorkStealingDequeTest, Grow) {
+  auto deque = WorkStealingDeque{2};
+  const auto tasks = create_tasks(9);
+  for (const auto& task : tasks) {
+    deque.push(task);
+  }
+  EXPECT_EQ(deque.size(), 9);
+
+  for (auto task_idx = size_t{0}; task_idx < tasks.size(); ++task_idx) {
+    EXPECT_EQ(deque.steal(), tasks[task_idx]);
+  }
+  EXPECT_TRUE(deque.empty());
+}
+
+TEST_F(WorkStealingDequeTest, ConcurrentPopAndSteal) {
+  // Each task must be taken exactly once, either by the owner or by one of the thieves
+  constexpr auto TASK_COUNT = size_t{10'000};
+  constexpr auto THIEF_COUNT = size_t{3};
+
+  auto deque = WorkStealingDeque{16};
+  const auto tasks = create_tasks(TASK_COUNT);
+  auto taken_counts = std::vector<std::atomic_uint32_t>(TASK_COUNT);
+  auto owner_done = std::atomic_bool{false};
+
+  const auto mark_taken = [&](const std::shared_ptr<AbstractTask>& task) {
+    ++taken_counts[std::find(tasks.begin(), tasks.end(), task) - tasks.begin()];
+  };
+
+  auto thieves = std::vector<std::thread>{};
+  for (auto thief_idx = size_t{0}; thief_idx < THIEF_COUNT; ++thief_idx) {
+    thieves.emplace_back([&]() {
+      while (!owner_done || !deque.empty()) {
+        if (auto task = deque.steal()) mark_taken(task);
+      }
+    });
+  }
+
+  for (auto task_idx = size_t{0}; task_idx < TASK_COUNT; ++task_idx) {
+    deque.push(tasks[task_idx]);
+    if (task_idx % 3 == 0) {
+      if (auto task = deque.pop()) mark_taken(task);
+    }
+  }
+  owner_done = true;
+
+  for (auto& thief : thieves) {
+    thief.join();
+  }
+
+  for (const auto& taken_count : taken_counts) {
+    EXPECT_EQ(taken_count, 1);
+  }
+}
+
+}  // namespace opossum
@@ -240,15 +240,16 @@ TEST_F(PostgresProtocolHandlerTest, ReadBindPacket) {
   _mocked_socket->write(std::string{'\0', '\0', '\0', '\x04'});
   // Set parameter to value "test"
   _mocked_socket->write("test");
-  // Assuming one result column
-  _mocked_socket->write(std::string{'\0', '\x01'});
-  // Also format code 0: text format
-  _mocked_socket->write(std::string{"\0", 2});
+  // Assuming two result columns
+  _mocked_socket->write(std::string{'\0', '\x02'});
+  // Format code 0: text format and format code 1: binary format
+  _mocked_socket->write(std::string{'\0', '\0', '\0', '\x01'});
 
   const auto& statement_information = _protocol_handler->read_bind_packet();
   EXPECT_EQ(statement_information.portal, portal);
   EXPECT_EQ(statement_information.statement_name, statement_name);
   EXPECT_EQ(statement_information.parameters, std::vector<AllTypeVariant>{"test"});
+  EXPECT_EQ(statement_information.result_formats, (std::vector<FormatCode>{FormatCode::Text, FormatCode::Binary}));
 }
 
 TEST_F(PostgresProtocolHandlerTest, ReadExecutePacket) {
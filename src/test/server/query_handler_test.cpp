@@ -31,7 +31,7 @@ TEST_F(QueryHandlerTest, CreatePreparedPlan) {
 
 TEST_F(QueryHandlerTest, BindParameters) {
   QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {123}};
+  const auto specification = PreparedStatementDetails{"test_statement", "", {123}, {}};
 
   const auto result = QueryHandler::bind_prepared_plan(specification);
   EXPECT_EQ(result->type(), OperatorType::TableScan);
@@ -39,7 +39,7 @@ TEST_F(QueryHandlerTest, BindParameters) {
 
 TEST_F(QueryHandlerTest, ExecutePreparedStatement) {
   QueryHandler::setup_prepared_plan("test_statement", "SELECT * FROM table_a WHERE a > ?");
-  const auto specification = PreparedStatementDetails{"test_statement", "", {123}};
+  const auto specification = PreparedStatementDetails{"test_statement", "", {123}, {}};
   const auto pqp = QueryHandler::bind_prepared_plan(specification);
 
   auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
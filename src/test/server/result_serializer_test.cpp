@@ -43,6 +43,48 @@ TEST_F(ResultSerializerTest, QueryResponse) {
   EXPECT_EQ(std::count(file_content.begin(), file_content.end(), 'D'), _test_table->row_count());
 }
 
+TEST_F(ResultSerializerTest, SerializeChunk) {
+  auto table = std::make_shared<Table>(
+      TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::String, true}}, TableType::Data);
+  table->append({-12, "xy"});
+  table->append({3, NULL_VALUE});
+  const auto& chunk = *table->get_chunk(ChunkID{0});
+
+  // Message type, length, column count, and length + value for each column
+  const auto expected_text = std::string{"D\0\0\0\x13\0\x02\0\0\0\x03-12\0\0\0\x02xy", 20} +
+                             std::string{"D\0\0\0\x0f\0\x02\0\0\0\x01" "3\xff\xff\xff\xff", 16};
+  EXPECT_EQ(ResultSerializer::serialize_chunk(chunk, {}), expected_text);
+  EXPECT_EQ(ResultSerializer::serialize_chunk(chunk, {FormatCode::Text, FormatCode::Text}), expected_text);
+
+  // Integers are sent as four bytes in network byte order, strings are the same as in the text format
+  const auto expected_binary =
+      std::string{"D\0\0\0\x14\0\x02\0\0\0\x04\xff\xff\xff\xf4\0\0\0\x02xy", 21} +
+      std::string{"D\0\0\0\x12\0\x02\0\0\0\x04\0\0\0\x03\xff\xff\xff\xff", 19};
+  EXPECT_EQ(ResultSerializer::serialize_chunk(chunk, {FormatCode::Binary}), expected_binary);
+  EXPECT_EQ(ResultSerializer::serialize_chunk(chunk, {FormatCode::Binary, FormatCode::Text}), expected_binary);
+}
+
+TEST_F(ResultSerializerTest, ColumnFormat) {
+  EXPECT_EQ(ResultSerializer::column_format({}, ColumnID{3}), FormatCode::Text);
+  EXPECT_EQ(ResultSerializer::column_format({FormatCode::Binary}, ColumnID{3}), FormatCode::Binary);
+  EXPECT_EQ(ResultSerializer::column_format({FormatCode::Text, FormatCode::Binary}, ColumnID{1}), FormatCode::Binary);
+  EXPECT_THROW(ResultSerializer::column_format({FormatCode::Text, FormatCode::Binary}, ColumnID{2}),
+               InvalidInputException);
+}
+
+TEST_F(ResultSerializerTest, BinaryRowDescription) {
+  ResultSerializer::send_table_description(_test_table, _protocol_handler, {FormatCode::Binary});
+  _protocol_handler->force_flush();
+  const std::string file_content = _mocked_socket->read();
+
+  // The format code is the last field of each column description
+  const auto first_column_end = file_content.find(_test_table->column_name(ColumnID{0})) +
+                                _test_table->column_name(ColumnID{0}).size() + sizeof('\0') + 3 * sizeof(uint32_t) +
+                                3 * sizeof(uint16_t);
+  EXPECT_EQ(NetworkConversionHelper::get_small_int(file_content.cbegin() + first_column_end - sizeof(uint16_t)),
+            static_cast<uint16_t>(FormatCode::Binary));
+}
+
 TEST_F(ResultSerializerTest, CommandCompleteMessage) {
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Insert, 1), "INSERT 0 1");
   EXPECT_EQ(ResultSerializer::build_command_complete_message(OperatorType::Update, 1), "UPDATE -1");
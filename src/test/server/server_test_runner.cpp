@@ -1,5 +1,6 @@
 #include <pqxx/pqxx>
 
+#include <array>
 #include <fstream>
 #include <future>
 #include <thread>
@@ -328,6 +329,96 @@ TEST_F(ServerTestRunner, TestParallelConnections) {
   }
 }
 
+TEST_F(ServerTestRunner, TestManyOpenConnections) {
+  // Sessions do not occupy a thread while they wait for requests. Thus, a single client thread can keep many more
+  // connections open than the server has I/O threads and use them in an interleaved fashion.
+  const auto num_connections = 200u;
+  auto connections = std::vector<std::unique_ptr<pqxx::connection>>{};
+  for (auto connection_num = 0u; connection_num < num_connections; ++connection_num) {
+    connections.emplace_back(std::make_unique<pqxx::connection>(_connection_string));
+  }
+
+  for (auto round = 0u; round < 2u; ++round) {
+    for (auto& connection : connections) {
+      pqxx::nontransaction transaction{*connection};
+      const auto result = transaction.exec("SELECT * FROM table_a;");
+      EXPECT_EQ(result.size(), _table_a->row_count());
+    }
+  }
+}
+
+TEST_F(ServerTestRunner, TestStalledClients) {
+  // Messages are received asynchronously by the I/O threads. Clients that send only parts of a message must not block
+  // the scheduler's workers, even if there are more of these clients than workers.
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  auto io_service = boost::asio::io_service{};
+  const auto endpoint = boost::asio::ip::tcp::endpoint{boost::asio::ip::address_v4::loopback(), _server->server_port()};
+  auto stalled_sockets = std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>>{};
+  for (auto socket_id = 0u; socket_id < 8u; ++socket_id) {
+    auto socket = std::make_unique<boost::asio::ip::tcp::socket>(io_service);
+    socket->connect(endpoint);
+
+    // The first bytes of a startup packet's length field
+    const auto partial_message = std::array<char, 2>{0, 0};
+    boost::asio::write(*socket, boost::asio::buffer(partial_message));
+    stalled_sockets.emplace_back(std::move(socket));
+  }
+
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+  const auto result = transaction.exec("SELECT * FROM table_a;");
+  EXPECT_EQ(result.size(), _table_a->row_count());
+}
+
+TEST_F(ServerTestRunner, TestClientsNotReadingResults) {
+  // Results are sent with backpressure: a session whose client does not read its results waits until the queued data
+  // has been sent. Such sessions must not block the scheduler's workers, even if there are more of them than workers.
+  Hyrise::get().topology.use_fake_numa_topology(2, 2);
+  Hyrise::get().set_scheduler(std::make_shared<NodeQueueScheduler>());
+
+  // Each result is much larger than the send queue and the socket buffers
+  const auto large_table =
+      std::make_shared<Table>(TableColumnDefinitions{{"a", DataType::String, false}}, TableType::Data, 10'000);
+  for (auto row_id = 0; row_id < 100'000; ++row_id) {
+    large_table->append({pmr_string(256, 'x')});
+  }
+  Hyrise::get().storage_manager.add_table("large_table", large_table);
+
+  const auto append_network_value = [](std::string& message, const uint32_t value) {
+    const auto network_value = htonl(value);
+    message.append(reinterpret_cast<const char*>(&network_value), sizeof(network_value));
+  };
+
+  auto startup_packet = std::string{};
+  const auto startup_body = std::string{"user\0test\0\0", 11};
+  append_network_value(startup_packet, static_cast<uint32_t>(2 * sizeof(uint32_t) + startup_body.size()));
+  append_network_value(startup_packet, uint32_t{196'608});  // Protocol version 3.0
+  startup_packet += startup_body;
+
+  const auto query = std::string{"SELECT * FROM large_table;"};
+  auto query_message = std::string{"Q"};
+  append_network_value(query_message, static_cast<uint32_t>(sizeof(uint32_t) + query.size() + 1));
+  query_message += query;
+  query_message.push_back('\0');
+
+  auto io_service = boost::asio::io_service{};
+  const auto endpoint = boost::asio::ip::tcp::endpoint{boost::asio::ip::address_v4::loopback(), _server->server_port()};
+  auto non_reading_sockets = std::vector<std::unique_ptr<boost::asio::ip::tcp::socket>>{};
+  for (auto socket_id = 0u; socket_id < 8u; ++socket_id) {
+    auto socket = std::make_unique<boost::asio::ip::tcp::socket>(io_service);
+    socket->connect(endpoint);
+    boost::asio::write(*socket, boost::asio::buffer(startup_packet + query_message));
+    non_reading_sockets.emplace_back(std::move(socket));
+  }
+
+  pqxx::connection connection{_connection_string};
+  pqxx::nontransaction transaction{connection};
+  const auto result = transaction.exec("SELECT * FROM table_a;");
+  EXPECT_EQ(result.size(), _table_a->row_count());
+}
+
 TEST_F(ServerTestRunner, TestTransactionConflicts) {
   // Similar to TestParallelConnections, but this time we modify the table, expecting some conflicts on the way
   // Also similar to StressTest.TestTransactionConflicts, only that we go through the server
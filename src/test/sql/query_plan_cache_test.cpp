@@ -159,7 +159,7 @@ TEST_F(QueryPlanCacheTest, CachedPQPFrequencyCount) {
   auto new_sql_pipeline = SQLPipelineBuilder{Q1}.create_pipeline_statement();
   new_sql_pipeline.get_result_table();
   auto& gdfs_cache = dynamic_cast<GDFSCache<std::string, std::shared_ptr<AbstractOperator>>&>(
-      Hyrise::get().default_pqp_cache->unsafe_cache());
+      Hyrise::get().default_pqp_cache->unsafe_cache(Q1));
   EXPECT_EQ(1, gdfs_cache.frequency(Q1));
 }
 
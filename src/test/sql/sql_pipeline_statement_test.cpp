@@ -8,8 +8,10 @@
 #include "SQLParserResult.h"
 
 #include "cache/cache.hpp"
+#include "expression/expression_utils.hpp"
 #include "hyrise.hpp"
 #include "logical_query_plan/join_node.hpp"
+#include "logical_query_plan/lqp_utils.hpp"
 #include "operators/abstract_join_operator.hpp"
 #include "operators/print.hpp"
 #include "operators/validate.hpp"
@@ -290,7 +292,7 @@ TEST_F(SQLPipelineStatementTest, GetOptimizedLQPNotValidated) {
 
 TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPValidated) {
   // Expect cache to be empty
-  EXPECT_FALSE(_lqp_cache->has(_select_query_a));
+  EXPECT_EQ(_lqp_cache->size(), 0u);
 
   auto validated_sql_pipeline =
       SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
@@ -299,25 +301,33 @@ TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPValidated) {
   EXPECT_TRUE(lqp_is_validated(validated_lqp));
 
   // Expect cache to contain validated LQP
-  EXPECT_TRUE(_lqp_cache->has(_select_query_a));
-  const auto validated_cached_lqp = _lqp_cache->get_entry(_select_query_a);
-  EXPECT_TRUE(lqp_is_validated(validated_cached_lqp));
+  ASSERT_EQ(_lqp_cache->size(), 1u);
+  EXPECT_TRUE(lqp_is_validated(_lqp_cache->unsafe_begin()->second));
+
+  // Expect the cached LQP to be used again
+  auto second_validated_sql_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
+  EXPECT_TRUE(lqp_is_validated(second_validated_sql_pipeline.get_optimized_logical_plan()));
+  EXPECT_EQ(_lqp_cache->size(), 1u);
 
-  // Evict validated version by requesting a not validated version
+  // Requesting a not validated version does not evict the validated version
   auto not_validated_sql_pipeline =
       SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).disable_mvcc().create_pipeline_statement();
   const auto& not_validated_lqp = not_validated_sql_pipeline.get_optimized_logical_plan();
   EXPECT_FALSE(lqp_is_validated(not_validated_lqp));
 
-  // Expect cache to contain not validated LQP
-  EXPECT_TRUE(_lqp_cache->has(_select_query_a));
-  const auto not_validated_cached_lqp = _lqp_cache->get_entry(_select_query_a);
-  EXPECT_FALSE(lqp_is_validated(not_validated_cached_lqp));
+  // Expect cache to contain both LQPs
+  EXPECT_EQ(_lqp_cache->size(), 2u);
+  auto validated_lqp_count = size_t{0};
+  for (auto iter = _lqp_cache->unsafe_begin(); iter != _lqp_cache->unsafe_end(); ++iter) {
+    if (lqp_is_validated(iter->second)) ++validated_lqp_count;
+  }
+  EXPECT_EQ(validated_lqp_count, 1u);
 }
 
 TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPNotValidated) {
   // Expect cache to be empty
-  EXPECT_FALSE(_lqp_cache->has(_select_query_a));
+  EXPECT_EQ(_lqp_cache->size(), 0u);
 
   auto not_validated_sql_pipeline =
       SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).disable_mvcc().create_pipeline_statement();
@@ -326,20 +336,94 @@ TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPNotValidated) {
   EXPECT_FALSE(lqp_is_validated(not_validated_lqp));
 
   // Expect cache to contain not validated LQP
-  EXPECT_TRUE(_lqp_cache->has(_select_query_a));
-  const auto not_validated_cached_lqp = _lqp_cache->get_entry(_select_query_a);
-  EXPECT_FALSE(lqp_is_validated(not_validated_cached_lqp));
+  ASSERT_EQ(_lqp_cache->size(), 1u);
+  EXPECT_FALSE(lqp_is_validated(_lqp_cache->unsafe_begin()->second));
+
+  // Expect the cached LQP to be used again
+  auto second_not_validated_sql_pipeline =
+      SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).disable_mvcc().create_pipeline_statement();
+  EXPECT_FALSE(lqp_is_validated(second_not_validated_sql_pipeline.get_optimized_logical_plan()));
+  EXPECT_EQ(_lqp_cache->size(), 1u);
 
-  // Evict not validated version by requesting a validated version
+  // Requesting a validated version does not evict the not validated version
   auto validated_sql_pipeline =
       SQLPipelineBuilder{_select_query_a}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
   const auto& validated_lqp = validated_sql_pipeline.get_optimized_logical_plan();
   EXPECT_TRUE(lqp_is_validated(validated_lqp));
 
-  // Expect cache to contain not validated LQP
-  EXPECT_TRUE(_lqp_cache->has(_select_query_a));
-  const auto validated_cached_lqp = _lqp_cache->get_entry(_select_query_a);
-  EXPECT_TRUE(lqp_is_validated(validated_cached_lqp));
+  // Expect cache to contain both LQPs
+  EXPECT_EQ(_lqp_cache->size(), 2u);
+  auto validated_lqp_count = size_t{0};
+  for (auto iter = _lqp_cache->unsafe_begin(); iter != _lqp_cache->unsafe_end(); ++iter) {
+    if (lqp_is_validated(iter->second)) ++validated_lqp_count;
+  }
+  EXPECT_EQ(validated_lqp_count, 1u);
+}
+
+TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPForDifferentLiterals) {
+  // Neither predicate prunes a chunk of table_int and both select most of its rows, so that the optimized LQP of the
+  // first statement is shared with the second one.
+  auto first_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a < 12"}
+                                .with_lqp_cache(_lqp_cache)
+                                .with_pqp_cache(_pqp_cache)
+                                .create_pipeline_statement();
+  const auto [first_pipeline_status, first_result] = first_sql_pipeline.get_result_table();
+  EXPECT_EQ(first_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(first_result->row_count(), 4u);
+  EXPECT_EQ(_lqp_cache->size(), 1u);
+
+  auto second_sql_pipeline = SQLPipelineBuilder{"SELECT * FROM table_int WHERE a < 11"}
+                                 .with_lqp_cache(_lqp_cache)
+                                 .with_pqp_cache(_pqp_cache)
+                                 .create_pipeline_statement();
+  const auto [second_pipeline_status, second_result] = second_sql_pipeline.get_result_table();
+  EXPECT_EQ(second_pipeline_status, SQLPipelineStatus::Success);
+  EXPECT_EQ(_lqp_cache->size(), 1u);
+  EXPECT_EQ(_pqp_cache->size(), 2u);
+
+  auto expected_result = std::make_shared<Table>(_int_int_int_column_definitions, TableType::Data);
+  expected_result->append({9, 10, 11});
+  expected_result->append({10, 10, 10});
+  expected_result->append({9, 10, 9});
+
+  EXPECT_TABLE_EQ_UNORDERED(second_result, expected_result);
+
+  // The LQP that a statement retrieves from the cache contains parameters, which are bound to its literals in the PQP
+  auto third_sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_int WHERE a < 11"}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
+  const auto& third_lqp = third_sql_pipeline.get_optimized_logical_plan();
+  auto contains_parameter = false;
+  visit_lqp(third_lqp, [&](const auto& node) {
+    for (const auto& expression : node->node_expressions) {
+      visit_expression(expression, [&](const auto& sub_expression) {
+        if (sub_expression->type == ExpressionType::CorrelatedParameter) contains_parameter = true;
+        return ExpressionVisitation::VisitArguments;
+      });
+    }
+    return LQPVisitation::VisitInputs;
+  });
+  EXPECT_TRUE(contains_parameter);
+
+  EXPECT_TABLE_EQ_UNORDERED(third_sql_pipeline.get_result_table().second, expected_result);
+}
+
+TEST_F(SQLPipelineStatementTest, GetCachedOptimizedLQPForPrunedLiterals) {
+  // Both predicates prune all chunks of table_int. As the chunks pruned depend on the literal, the optimized LQPs are
+  // only cached for the literals they were optimized with.
+  auto first_sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 12"}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
+  EXPECT_EQ(first_sql_pipeline.get_result_table().second->row_count(), 0u);
+  EXPECT_EQ(_lqp_cache->size(), 1u);
+
+  auto second_sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 13"}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
+  EXPECT_EQ(second_sql_pipeline.get_result_table().second->row_count(), 0u);
+  EXPECT_EQ(_lqp_cache->size(), 2u);
+
+  auto third_sql_pipeline =
+      SQLPipelineBuilder{"SELECT * FROM table_int WHERE a = 12"}.with_lqp_cache(_lqp_cache).create_pipeline_statement();
+  EXPECT_EQ(third_sql_pipeline.get_result_table().second->row_count(), 0u);
+  EXPECT_EQ(_lqp_cache->size(), 2u);
 }
 
 TEST_F(SQLPipelineStatementTest, GetOptimizedLQPDoesNotInfluenceUnoptimizedLQP) {
@@ -638,7 +722,6 @@ TEST_F(SQLPipelineStatementTest, CacheQueryPlan) {
   sql_pipeline.get_result_table();
 
   EXPECT_EQ(_lqp_cache->size(), 1u);
-  EXPECT_TRUE(_lqp_cache->has(_select_query_a));
 }
 
 TEST_F(SQLPipelineStatementTest, CopySubselectFromCache) {
@@ -697,7 +780,6 @@ TEST_F(SQLPipelineStatementTest, MetaTableNoCaching) {
   sql_pipeline.get_result_table();
 
   EXPECT_EQ(_lqp_cache->size(), 0u);
-  EXPECT_FALSE(_lqp_cache->has(meta_table_query));
 
   EXPECT_EQ(_pqp_cache->size(), 0u);
   EXPECT_FALSE(_pqp_cache->has(meta_table_query));
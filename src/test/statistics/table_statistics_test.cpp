@@ -1,5 +1,7 @@
 #include "base_test.hpp"
 
+#include "hyrise.hpp"
+#include "sql/sql_pipeline_builder.hpp"
 #include "statistics/attribute_statistics.hpp"
 #include "statistics/generate_pruning_statistics.hpp"
 #include "statistics/statistics_objects/abstract_histogram.hpp"
@@ -41,4 +43,117 @@ TEST_F(TableStatisticsTest, FromTable) {
   EXPECT_FLOAT_EQ(histogram_b->total_distinct_count(), 190);
 }
 
+TEST_F(TableStatisticsTest, FromTableSampled) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{1'000});
+  for (auto row_idx = int32_t{0}; row_idx < 10'000; ++row_idx) {
+    table->append({row_idx % 100, row_idx % 4 == 0 ? AllTypeVariant{NULL_VALUE} : AllTypeVariant{row_idx}});
+  }
+
+  // Tables with up to target_sample_row_count rows are not sampled
+  const auto exact_statistics = TableStatistics::from_table(*table, 10'000);
+  const auto exact_histogram_a = std::dynamic_pointer_cast<EqualDistinctCountHistogram<int32_t>>(
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(exact_statistics->column_statistics.at(0))->histogram);
+  ASSERT_TRUE(exact_histogram_a);
+  EXPECT_FLOAT_EQ(exact_histogram_a->total_count(), 10'000);
+  EXPECT_FLOAT_EQ(exact_histogram_a->total_distinct_count(), 100);
+
+  const auto sampled_statistics = TableStatistics::from_table(*table, 1'000);
+  EXPECT_FLOAT_EQ(sampled_statistics->row_count, 10'000);
+
+  const auto column_statistics_a =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(sampled_statistics->column_statistics.at(0));
+  const auto histogram_a = std::dynamic_pointer_cast<GenericHistogram<int32_t>>(column_statistics_a->histogram);
+  ASSERT_TRUE(histogram_a);
+  EXPECT_NEAR(histogram_a->total_count(), 10'000, 1);
+  // Each value occurs about ten times in the sample, so the estimated distinct count is close to the actual one
+  EXPECT_NEAR(histogram_a->total_distinct_count(), 100, 15);
+
+  const auto column_statistics_b =
+      std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(sampled_statistics->column_statistics.at(1));
+  const auto histogram_b = std::dynamic_pointer_cast<GenericHistogram<int32_t>>(column_statistics_b->histogram);
+  ASSERT_TRUE(histogram_b);
+  EXPECT_NEAR(histogram_b->total_count(), 7'500, 1);
+  EXPECT_NEAR(column_statistics_b->null_value_ratio->ratio, 0.25f, 0.01f);
+  // Values that occur only once in the sample stand for more than one distinct value
+  EXPECT_GT(histogram_b->total_distinct_count(), 750);
+  EXPECT_LE(histogram_b->total_distinct_count(), 7'500);
+}
+
+TEST_F(TableStatisticsTest, MaintainedIncrementally) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{100}, UseMvcc::Yes);
+  for (auto value = int32_t{0}; value < 150; ++value) {
+    table->append({value});
+  }
+
+  table->maintain_table_statistics(1'000);
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 150);
+
+  // The statistics are refreshed whenever a chunk is appended. The rows of the new chunk are not covered yet.
+  for (auto value = int32_t{150}; value < 250; ++value) {
+    table->append({value});
+  }
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 200);
+  const auto exact_histogram = std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(
+                                   table->table_statistics()->column_statistics.at(0))
+                                   ->histogram;
+  EXPECT_TRUE(std::dynamic_pointer_cast<EqualDistinctCountHistogram<int32_t>>(exact_histogram));
+  EXPECT_FLOAT_EQ(exact_histogram->total_distinct_count(), 200);
+
+  // Once the table has grown beyond twice the target sample size, it is sampled
+  for (auto value = int32_t{250}; value < 3'000; ++value) {
+    table->append({value});
+  }
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 2'900);
+  const auto sampled_histogram = std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(
+                                     table->table_statistics()->column_statistics.at(0))
+                                     ->histogram;
+  EXPECT_TRUE(std::dynamic_pointer_cast<GenericHistogram<int32_t>>(sampled_histogram));
+  EXPECT_NEAR(sampled_histogram->total_count(), 2'900, 1);
+
+  // Removed chunks are dropped from the statistics
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->increase_invalid_row_count(chunk->size());
+  table->remove_chunk(ChunkID{0});
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 2'800);
+}
+
+TEST_F(TableStatisticsTest, MaintainedWithInserts) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  const auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({1});
+  table->append({2});
+  Hyrise::get().storage_manager.add_table("t", table);
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 2);
+
+  // The statistics are refreshed when an Insert commits, also if its rows fit into the last chunk
+  SQLPipelineBuilder{"INSERT INTO t VALUES (3), (4), (5)"}.create_pipeline().get_result_table();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 5);
+
+  SQLPipelineBuilder{"INSERT INTO t VALUES (6)"}.create_pipeline().get_result_table();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 6);
+
+  // Rows of Inserts that have not committed yet are not sampled
+  const auto transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  SQLPipelineBuilder{"INSERT INTO t VALUES (7), (8)"}
+      .with_transaction_context(transaction_context)
+      .create_pipeline()
+      .get_result_table();
+  table->schedule_table_statistics_refresh();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 6);
+
+  // Deleted rows are dropped from the statistics once the Delete has committed
+  SQLPipelineBuilder{"DELETE FROM t WHERE a <= 2"}.create_pipeline().get_result_table();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 4);
+
+  transaction_context->commit();
+  EXPECT_FLOAT_EQ(table->table_statistics()->row_count, 6);
+  const auto histogram = std::dynamic_pointer_cast<AttributeStatistics<int32_t>>(
+                             table->table_statistics()->column_statistics.at(0))
+                             ->histogram;
+  EXPECT_EQ(histogram->bin_minimum(BinID{0}), 3);
+  EXPECT_EQ(histogram->bin_maximum(histogram->bin_count() - 1), 8);
+}
+
 }  // namespace opossum
@@ -0,0 +1,131 @@
+#include <memory>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "storage/compact_pos_list.hpp"
+#include "storage/pos_list.hpp"
+
+namespace opossum {
+
+class CompactPosListTest : public BaseTest {
+ protected:
+  // Returns a PosList that references every `step`-th row of a chunk of `chunk_size` rows
+  static PosList every_nth_row(const ChunkOffset step, const ChunkOffset chunk_size) {
+    auto pos_list = PosList{};
+    for (auto chunk_offset = ChunkOffset{0}; chunk_offset < chunk_size; chunk_offset += step) {
+      pos_list.emplace_back(RowID{ChunkID{3}, chunk_offset});
+    }
+    return pos_list;
+  }
+};
+
+TEST_F(CompactPosListTest, Range) {
+  const auto compact_pos_list = CompactPosList{ChunkID{3}, ChunkOffset{5}, ChunkOffset{9}};
+
+  EXPECT_TRUE(compact_pos_list.is_range());
+  EXPECT_EQ(compact_pos_list.chunk_id(), ChunkID{3});
+  EXPECT_EQ(compact_pos_list.size(), 4u);
+  EXPECT_EQ(compact_pos_list.begin_chunk_offset(), 5u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{0}), 5u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{3}), 8u);
+  EXPECT_EQ(compact_pos_list.next_chunk_offset(ChunkOffset{6}), 7u);
+
+  const auto expected_pos_list =
+      PosList{RowID{ChunkID{3}, 5}, RowID{ChunkID{3}, 6}, RowID{ChunkID{3}, 7}, RowID{ChunkID{3}, 8}};
+  EXPECT_EQ(*compact_pos_list.materialize(), expected_pos_list);
+  EXPECT_TRUE(compact_pos_list.materialize()->references_single_chunk());
+
+  // The PosList is only materialized once
+  EXPECT_EQ(compact_pos_list.materialize(), compact_pos_list.materialize());
+}
+
+TEST_F(CompactPosListTest, Bitmap) {
+  // Rows 1, 64, 66, and 200
+  auto bitmap = std::vector<uint64_t>(4);
+  bitmap[0] = uint64_t{1} << 1;
+  bitmap[1] = (uint64_t{1} << 0) | (uint64_t{1} << 2);
+  bitmap[3] = uint64_t{1} << 8;
+  const auto compact_pos_list = CompactPosList{ChunkID{3}, std::move(bitmap)};
+
+  EXPECT_FALSE(compact_pos_list.is_range());
+  EXPECT_EQ(compact_pos_list.size(), 4u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{0}), 1u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{1}), 64u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{2}), 66u);
+  EXPECT_EQ(compact_pos_list.chunk_offset(ChunkOffset{3}), 200u);
+  EXPECT_EQ(compact_pos_list.next_chunk_offset(ChunkOffset{1}), 64u);
+  EXPECT_EQ(compact_pos_list.next_chunk_offset(ChunkOffset{64}), 66u);
+  EXPECT_EQ(compact_pos_list.next_chunk_offset(ChunkOffset{66}), 200u);
+
+  auto chunk_offsets = std::vector<ChunkOffset>{};
+  compact_pos_list.for_each([&](const auto chunk_offset) { chunk_offsets.emplace_back(chunk_offset); });
+  EXPECT_EQ(chunk_offsets, std::vector<ChunkOffset>({1, 64, 66, 200}));
+
+  const auto expected_pos_list =
+      PosList{RowID{ChunkID{3}, 1}, RowID{ChunkID{3}, 64}, RowID{ChunkID{3}, 66}, RowID{ChunkID{3}, 200}};
+  EXPECT_EQ(*compact_pos_list.materialize(), expected_pos_list);
+}
+
+TEST_F(CompactPosListTest, EmptyBitmap) {
+  const auto compact_pos_list = CompactPosList{ChunkID{3}, std::vector<uint64_t>{}};
+
+  EXPECT_FALSE(compact_pos_list.is_range());
+  EXPECT_EQ(compact_pos_list.size(), 0u);
+  EXPECT_TRUE(compact_pos_list.materialize()->empty());
+}
+
+TEST_F(CompactPosListTest, TryCompactRange) {
+  const auto entire_chunk = CompactPosList::try_compact(every_nth_row(1, 1000), 1000);
+  ASSERT_TRUE(entire_chunk);
+  EXPECT_TRUE(entire_chunk->is_range());
+  EXPECT_EQ(entire_chunk->chunk_id(), ChunkID{3});
+  EXPECT_EQ(entire_chunk->begin_chunk_offset(), 0u);
+  EXPECT_EQ(entire_chunk->size(), 1000u);
+
+  const auto pos_list = PosList{RowID{ChunkID{3}, 17}, RowID{ChunkID{3}, 18}, RowID{ChunkID{3}, 19}};
+  const auto range = CompactPosList::try_compact(pos_list, 1000);
+  ASSERT_TRUE(range);
+  EXPECT_TRUE(range->is_range());
+  EXPECT_EQ(range->begin_chunk_offset(), 17u);
+  EXPECT_EQ(range->size(), 3u);
+}
+
+TEST_F(CompactPosListTest, TryCompactBitmap) {
+  const auto pos_list = every_nth_row(3, 1000);
+  const auto compact_pos_list = CompactPosList::try_compact(pos_list, 1000);
+  ASSERT_TRUE(compact_pos_list);
+  EXPECT_FALSE(compact_pos_list->is_range());
+  EXPECT_LT(compact_pos_list->memory_usage(), pos_list.size() * sizeof(RowID));
+  EXPECT_EQ(*compact_pos_list->materialize(), pos_list);
+
+  for (auto pos_list_offset = ChunkOffset{0}; pos_list_offset < pos_list.size(); ++pos_list_offset) {
+    EXPECT_EQ(compact_pos_list->chunk_offset(pos_list_offset), pos_list[pos_list_offset].chunk_offset);
+  }
+}
+
+TEST_F(CompactPosListTest, TryCompactFails) {
+  // Empty
+  EXPECT_FALSE(CompactPosList::try_compact(PosList{}, 1000));
+
+  // Too sparse for a bitmap
+  EXPECT_FALSE(CompactPosList::try_compact(every_nth_row(100, 1000), 1000));
+
+  // Not sorted
+  auto unsorted_pos_list = every_nth_row(3, 1000);
+  std::swap(unsorted_pos_list[4], unsorted_pos_list[5]);
+  EXPECT_FALSE(CompactPosList::try_compact(unsorted_pos_list, 1000));
+
+  auto unsorted_range = PosList{RowID{ChunkID{3}, 1}, RowID{ChunkID{3}, 0}, RowID{ChunkID{3}, 2}};
+  EXPECT_FALSE(CompactPosList::try_compact(unsorted_range, 1000));
+
+  // Multiple chunks
+  auto multiple_chunks = every_nth_row(1, 100);
+  multiple_chunks[50].chunk_id = ChunkID{4};
+  EXPECT_FALSE(CompactPosList::try_compact(multiple_chunks, 100));
+
+  // NULL values
+  EXPECT_FALSE(CompactPosList::try_compact(PosList{NULL_ROW_ID, NULL_ROW_ID}, 100));
+}
+
+}  // namespace opossum
@@ -17,8 +17,9 @@ namespace {
 
 // Used for debugging purposes
 [[maybe_unused]] void print_encoded_vector(const SimdBp128Vector& vector) {
-  for (auto _128_bit : vector.data()) {
-    for (auto _32_bit : _128_bit.data) {
+  const auto block_count = vector.data_size() / sizeof(uint128_t);
+  for (auto block_index = size_t{0}; block_index < block_count; ++block_index) {
+    for (auto _32_bit : vector.data()[block_index].data) {
       std::cout << std::bitset<32>{_32_bit} << "|";
     }
     std::cout << std::endl;
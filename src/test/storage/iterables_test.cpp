@@ -373,6 +373,37 @@ TEST_F(IterablesTest, ReferenceSegmentIteratorWithIteratorsSingleChunkTypeErased
             (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}, ChunkOffset{3}}));
 }
 
+TEST_F(IterablesTest, ReferenceSegmentIteratorWithIteratorsCompactPosList) {
+  const auto iterate = [&](const std::shared_ptr<const CompactPosList>& compact_pos_list) {
+    const auto reference_segment = std::make_unique<ReferenceSegment>(table, ColumnID{0u}, compact_pos_list);
+    const auto iterable = ReferenceSegmentIterable<int32_t, EraseReferencedSegmentType::No>{*reference_segment};
+
+    auto sum = int32_t{0};
+    auto accessed_offsets = std::vector<ChunkOffset>{};
+    iterable.with_iterators(SumUpWithIterator<int32_t>{sum, accessed_offsets});
+    return std::make_pair(sum, accessed_offsets);
+  };
+
+  // Entire chunk, iterated sequentially
+  const auto [entire_chunk_sum, entire_chunk_offsets] =
+      iterate(std::make_shared<CompactPosList>(ChunkID{0}, ChunkOffset{0}, ChunkOffset{4}));
+  EXPECT_EQ(entire_chunk_sum, 24'825);
+  EXPECT_EQ(entire_chunk_offsets,
+            (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}, ChunkOffset{3}}));
+
+  // Range within the chunk
+  const auto [range_sum, range_offsets] =
+      iterate(std::make_shared<CompactPosList>(ChunkID{0}, ChunkOffset{1}, ChunkOffset{3}));
+  EXPECT_EQ(range_sum, 12'468);
+  EXPECT_EQ(range_offsets, (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}}));
+
+  // Bitmap referencing rows 0, 2, and 3
+  const auto [bitmap_sum, bitmap_offsets] =
+      iterate(std::make_shared<CompactPosList>(ChunkID{0}, std::vector<uint64_t>{0b1101}));
+  EXPECT_EQ(bitmap_sum, 12'480);
+  EXPECT_EQ(bitmap_offsets, (std::vector<ChunkOffset>{ChunkOffset{0}, ChunkOffset{1}, ChunkOffset{2}}));
+}
+
 // Value Segment Tests
 
 TEST_F(IterablesTest, ValueSegmentIteratorForEach) {
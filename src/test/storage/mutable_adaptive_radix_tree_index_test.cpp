@@ -0,0 +1,232 @@
+#include <algorithm>
+#include <memory>
+#include <optional>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "hyrise.hpp"
+#include "operators/get_table.hpp"
+#include "operators/index_scan.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/chunk_encoder.hpp"
+#include "storage/index/adaptive_radix_tree/adaptive_radix_tree_index.hpp"
+#include "storage/index/adaptive_radix_tree/mutable_adaptive_radix_tree_index.hpp"
+#include "storage/table.hpp"
+#include "storage/value_segment.hpp"
+
+namespace opossum {
+
+class MutableAdaptiveRadixTreeIndexTest : public BaseTest {
+ protected:
+  using Bound = MutableAdaptiveRadixTreeIndex::Bound;
+
+  static std::optional<Bound> inclusive(const AllTypeVariant& value) { return Bound{value, true}; }
+  static std::optional<Bound> exclusive(const AllTypeVariant& value) { return Bound{value, false}; }
+};
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, IntRanges) {
+  const auto segment = std::make_shared<ValueSegment<int32_t>>(
+      pmr_vector<int32_t>{5, -3, 7, 5, 0, 0, -100, 1000}, pmr_vector<bool>{false, false, false, false, true, false,
+                                                                          false, false});
+  const auto index = MutableAdaptiveRadixTreeIndex{segment};
+
+  // NULLs are not indexed, all other rows are returned ordered by value
+  EXPECT_EQ(index.range(std::nullopt, std::nullopt), std::vector<ChunkOffset>({6, 1, 5, 0, 3, 2, 7}));
+
+  EXPECT_EQ(index.range(inclusive(5), inclusive(5)), std::vector<ChunkOffset>({0, 3}));
+  EXPECT_EQ(index.range(std::nullopt, exclusive(5)), std::vector<ChunkOffset>({6, 1, 5}));
+  EXPECT_EQ(index.range(std::nullopt, inclusive(5)), std::vector<ChunkOffset>({6, 1, 5, 0, 3}));
+  EXPECT_EQ(index.range(exclusive(5), std::nullopt), std::vector<ChunkOffset>({2, 7}));
+  EXPECT_EQ(index.range(inclusive(5), std::nullopt), std::vector<ChunkOffset>({0, 3, 2, 7}));
+  EXPECT_EQ(index.range(exclusive(-3), exclusive(7)), std::vector<ChunkOffset>({5, 0, 3}));
+  EXPECT_EQ(index.range(inclusive(-3), inclusive(7)), std::vector<ChunkOffset>({1, 5, 0, 3, 2}));
+  EXPECT_EQ(index.range(inclusive(-99), inclusive(-4)), std::vector<ChunkOffset>());
+  EXPECT_EQ(index.range(inclusive(7), inclusive(5)), std::vector<ChunkOffset>());
+  EXPECT_EQ(index.range(exclusive(5), exclusive(5)), std::vector<ChunkOffset>());
+
+  // Bounds are cast to the data type of the segment
+  EXPECT_EQ(index.range(inclusive(int64_t{7}), inclusive(7.0)), std::vector<ChunkOffset>({2}));
+  EXPECT_THROW(index.range(inclusive(7.5), std::nullopt), std::logic_error);
+  EXPECT_THROW(index.range(inclusive(NULL_VALUE), std::nullopt), std::logic_error);
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, FloatingPointOrder) {
+  const auto segment = std::make_shared<ValueSegment<double>>(pmr_vector<double>{2.5, -0.0, -1.5, 0.0, -2.5, 1e300});
+  const auto index = MutableAdaptiveRadixTreeIndex{segment};
+
+  const auto all = index.range(std::nullopt, std::nullopt);
+  ASSERT_EQ(all.size(), 6u);
+  EXPECT_EQ(all[0], ChunkOffset{4});
+  EXPECT_EQ(all[1], ChunkOffset{2});
+  EXPECT_EQ(all[4], ChunkOffset{0});
+  EXPECT_EQ(all[5], ChunkOffset{5});
+
+  // -0.0 and 0.0 are equal
+  auto zeros = index.range(inclusive(0.0), inclusive(0.0));
+  std::sort(zeros.begin(), zeros.end());
+  EXPECT_EQ(zeros, std::vector<ChunkOffset>({1, 3}));
+  EXPECT_EQ(index.range(exclusive(-2.5), exclusive(-0.0)), std::vector<ChunkOffset>({2}));
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, StringOrder) {
+  const auto segment = std::make_shared<ValueSegment<pmr_string>>(
+      pmr_vector<pmr_string>{"ab", "", "a", pmr_string{"a\0b", 3}, "abc", "b", pmr_string{"a\0", 2}, "ab"});
+  const auto index = MutableAdaptiveRadixTreeIndex{segment};
+
+  // Strings that are prefixes of others and strings with embedded NUL characters are ordered like std::string
+  EXPECT_EQ(index.range(std::nullopt, std::nullopt), std::vector<ChunkOffset>({1, 2, 6, 3, 0, 7, 4, 5}));
+  EXPECT_EQ(index.range(inclusive(pmr_string{"ab"}), inclusive(pmr_string{"ab"})), std::vector<ChunkOffset>({0, 7}));
+  EXPECT_EQ(index.range(exclusive(pmr_string{"a"}), exclusive(pmr_string{"ab"})), std::vector<ChunkOffset>({6, 3}));
+  EXPECT_EQ(index.range(exclusive(pmr_string{"ab"}), std::nullopt), std::vector<ChunkOffset>({4, 5}));
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, ManyValues) {
+  // Enough distinct values to grow nodes through all node types, inserted in random order
+  auto values = pmr_vector<int64_t>{};
+  for (auto value = int64_t{-600}; value < 600; ++value) {
+    values.emplace_back(value * 37);
+    values.emplace_back(value * 37);
+  }
+  std::shuffle(values.begin(), values.end(), std::mt19937{42});
+
+  const auto segment = std::make_shared<ValueSegment<int64_t>>(pmr_vector<int64_t>{});
+  auto index = MutableAdaptiveRadixTreeIndex{segment};
+  for (const auto value : values) {
+    segment->append(value);
+    index.insert(ChunkOffset{segment->size() - 1}, ChunkOffset{segment->size()});
+  }
+
+  auto sorted_values = std::vector<int64_t>{};
+  for (const auto chunk_offset : index.range(std::nullopt, std::nullopt)) {
+    sorted_values.emplace_back(values[chunk_offset]);
+  }
+  EXPECT_EQ(sorted_values.size(), values.size());
+  EXPECT_TRUE(std::is_sorted(sorted_values.begin(), sorted_values.end()));
+
+  for (const auto value : {int64_t{-600 * 37}, int64_t{0}, int64_t{37}, int64_t{599 * 37}}) {
+    const auto chunk_offsets = index.range(inclusive(value), inclusive(value));
+    ASSERT_EQ(chunk_offsets.size(), 2u);
+    EXPECT_EQ(values[chunk_offsets[0]], value);
+    EXPECT_EQ(values[chunk_offsets[1]], value);
+  }
+  EXPECT_TRUE(index.range(inclusive(int64_t{1}), inclusive(int64_t{36})).empty());
+  EXPECT_EQ(index.range(exclusive(int64_t{-37}), exclusive(int64_t{74})).size(), 4u);
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, RequiresValueSegment) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({1});
+  table->append({2});
+  table->get_chunk(ChunkID{0})->finalize();
+  ChunkEncoder::encode_all_chunks(table);
+
+  EXPECT_THROW(MutableAdaptiveRadixTreeIndex{table->get_chunk(ChunkID{0})->get_segment(ColumnID{0})},
+               std::logic_error);
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, MaintainedByChunk) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}, {"b", DataType::Int, true}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{3}, UseMvcc::Yes);
+  table->append({3, 30});
+  table->append({1, NULL_VALUE});
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{1}});
+
+  const auto chunk_0 = table->get_chunk(ChunkID{0});
+  EXPECT_FALSE(chunk_0->get_mutable_index(ColumnID{0}));
+  ASSERT_TRUE(chunk_0->get_mutable_index(ColumnID{1}));
+  EXPECT_TRUE(chunk_0->get_indexes(std::vector<ColumnID>{ColumnID{1}}).empty());
+
+  table->append({2, 20});
+  table->append({4, 20});
+  EXPECT_EQ(chunk_0->get_mutable_index(ColumnID{1})->range(std::nullopt, std::nullopt),
+            std::vector<ChunkOffset>({2, 0}));
+
+  // New chunks get a mutable index as well
+  const auto chunk_1 = table->get_chunk(ChunkID{1});
+  ASSERT_TRUE(chunk_1->get_mutable_index(ColumnID{1}));
+  EXPECT_EQ(chunk_1->get_mutable_index(ColumnID{1})->range(std::nullopt, std::nullopt),
+            std::vector<ChunkOffset>({0}));
+
+  // Encoding the chunk replaces the mutable index with an AdaptiveRadixTreeIndex
+  ChunkEncoder::encode_chunk(chunk_0, table->column_data_types());
+  EXPECT_FALSE(chunk_0->get_mutable_index(ColumnID{1}));
+  EXPECT_TRUE(chunk_0->get_index(SegmentIndexType::AdaptiveRadixTree, std::vector<ColumnID>{ColumnID{1}}));
+  EXPECT_TRUE(chunk_1->get_mutable_index(ColumnID{1}));
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, FrozenIndexMatchesRebuiltIndex) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::String, true}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{8}, UseMvcc::Yes);
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  for (const auto& value : {AllTypeVariant{"d"}, AllTypeVariant{"b"}, NULL_VALUE, AllTypeVariant{"d"},
+                            AllTypeVariant{"a"}, AllTypeVariant{"c"}, NULL_VALUE, AllTypeVariant{"b"}}) {
+    table->append({value});
+  }
+
+  const auto chunk = table->get_chunk(ChunkID{0});
+  chunk->finalize();
+  ChunkEncoder::encode_chunk(chunk, table->column_data_types());
+  ASSERT_FALSE(chunk->get_mutable_index(ColumnID{0}));
+
+  const auto frozen_index = chunk->get_index(SegmentIndexType::AdaptiveRadixTree, std::vector<ColumnID>{ColumnID{0}});
+  ASSERT_TRUE(frozen_index);
+  const auto rebuilt_index = AdaptiveRadixTreeIndex{{chunk->get_segment(ColumnID{0})}};
+
+  EXPECT_EQ(std::vector<ChunkOffset>(frozen_index->cbegin(), frozen_index->cend()),
+            std::vector<ChunkOffset>(rebuilt_index.cbegin(), rebuilt_index.cend()));
+  EXPECT_EQ(std::vector<ChunkOffset>(frozen_index->null_cbegin(), frozen_index->null_cend()),
+            std::vector<ChunkOffset>({2, 6}));
+  EXPECT_EQ(std::vector<ChunkOffset>(frozen_index->lower_bound({"b"}), frozen_index->upper_bound({"c"})),
+            std::vector<ChunkOffset>({1, 7, 5}));
+}
+
+TEST_F(MutableAdaptiveRadixTreeIndexTest, IndexScan) {
+  const auto column_definitions = TableColumnDefinitions{{"a", DataType::Int, false}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{4}, UseMvcc::Yes);
+  table->append({5});
+  table->append({1});
+  table->append({3});
+  table->append({4});
+  table->get_chunk(ChunkID{0})->finalize();
+  ChunkEncoder::encode_all_chunks(table);
+  table->create_index<AdaptiveRadixTreeIndex>({ColumnID{0}});
+  Hyrise::get().storage_manager.add_table("t", table);
+
+  // Rows added by the Insert operator are indexed in the mutable chunk
+  SQLPipelineBuilder{"INSERT INTO t VALUES (2), (4), (6)"}.create_pipeline().get_result_table();
+  ASSERT_EQ(table->chunk_count(), 2u);
+  ASSERT_TRUE(table->get_chunk(ChunkID{1})->get_mutable_index(ColumnID{0}));
+
+  const auto get_table = std::make_shared<GetTable>("t");
+  get_table->execute();
+
+  const auto scan = [&](const PredicateCondition predicate_condition, const std::vector<AllTypeVariant>& right_values,
+                        const std::vector<AllTypeVariant>& right_values2 = {}) {
+    auto index_scan = std::make_shared<IndexScan>(get_table, SegmentIndexType::AdaptiveRadixTree,
+                                                  std::vector<ColumnID>{ColumnID{0}}, predicate_condition,
+                                                  right_values, right_values2);
+    index_scan->included_chunk_ids = {ChunkID{0}, ChunkID{1}};
+    index_scan->execute();
+
+    auto result = std::vector<int32_t>{};
+    const auto output_table = index_scan->get_output();
+    for (auto row_idx = size_t{0}; row_idx < output_table->row_count(); ++row_idx) {
+      result.emplace_back(output_table->get_value<int32_t>(ColumnID{0}, row_idx));
+    }
+    std::sort(result.begin(), result.end());
+    return result;
+  };
+
+  EXPECT_EQ(scan(PredicateCondition::Equals, {4}), std::vector<int32_t>({4, 4}));
+  EXPECT_EQ(scan(PredicateCondition::NotEquals, {4}), std::vector<int32_t>({1, 2, 3, 5, 6}));
+  EXPECT_EQ(scan(PredicateCondition::LessThan, {3}), std::vector<int32_t>({1, 2}));
+  EXPECT_EQ(scan(PredicateCondition::GreaterThanEquals, {5}), std::vector<int32_t>({5, 6}));
+  EXPECT_EQ(scan(PredicateCondition::BetweenInclusive, {2}, {4}), std::vector<int32_t>({2, 3, 4, 4}));
+}
+
+}  // namespace opossum
@@ -0,0 +1,170 @@
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "base_test.hpp"
+
+#include "concurrency/transaction_context.hpp"
+#include "hyrise.hpp"
+#include "operators/abstract_operator.hpp"
+#include "sql/sql_pipeline_builder.hpp"
+#include "storage/index/primary_key/primary_key_index.hpp"
+#include "storage/table.hpp"
+
+namespace opossum {
+
+class PrimaryKeyIndexTest : public BaseTest {
+ protected:
+  void SetUp() override {
+    table_t = std::make_shared<Table>(column_definitions_t, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table_t->append({1, pmr_string{"one"}});
+    table_t->append({2, pmr_string{"two"}});
+    table_t->append({3, pmr_string{"three"}});
+    table_t->append({4, pmr_string{"four"}});
+    table_t->add_soft_unique_constraint({ColumnID{0}}, IsPrimaryKey::Yes);
+    Hyrise::get().storage_manager.add_table("t", table_t);
+
+    const auto column_definitions_u = TableColumnDefinitions{{"x", DataType::Int, false}};
+    auto table_u = std::make_shared<Table>(column_definitions_u, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+    table_u->append({2});
+    table_u->append({3});
+    table_u->append({3});
+    table_u->append({7});
+    Hyrise::get().storage_manager.add_table("u", table_u);
+  }
+
+  static void execute_sql(const std::string& sql,
+                          const std::shared_ptr<TransactionContext>& transaction_context = nullptr) {
+    auto builder = SQLPipelineBuilder{sql};
+    if (transaction_context) builder.with_transaction_context(transaction_context);
+    builder.create_pipeline().get_result_table();
+  }
+
+  // Executes the query and checks whether its physical plan contains an operator of the given type
+  static std::shared_ptr<const Table> execute_query(const std::string& sql, const OperatorType expected_operator_type) {
+    auto pipeline = SQLPipelineBuilder{sql}.create_pipeline();
+    const auto result_table = pipeline.get_result_table().second;
+    EXPECT_TRUE(pqp_contains(pipeline.get_physical_plans().at(0), expected_operator_type));
+    return result_table;
+  }
+
+  static bool pqp_contains(const std::shared_ptr<const AbstractOperator>& pqp, const OperatorType operator_type) {
+    if (!pqp) return false;
+    return pqp->type() == operator_type || pqp_contains(pqp->input_left(), operator_type) ||
+           pqp_contains(pqp->input_right(), operator_type);
+  }
+
+  const TableColumnDefinitions column_definitions_t{{"a", DataType::Int, false}, {"b", DataType::String, false}};
+  std::shared_ptr<Table> table_t;
+};
+
+TEST_F(PrimaryKeyIndexTest, Lookup) {
+  table_t->create_primary_key_index();
+  const auto index = table_t->primary_key_index();
+  ASSERT_TRUE(index);
+  EXPECT_EQ(index->column_ids(), std::vector<ColumnID>({ColumnID{0}}));
+
+  EXPECT_EQ(index->lookup({3}), std::vector<RowID>({RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index->lookup({5}).empty());
+
+  // Values are cast to the data type of the column if this is lossless
+  EXPECT_EQ(index->lookup({int64_t{2}}), std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(index->lookup({2.0}), std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_TRUE(index->lookup({2.5}).empty());
+  EXPECT_TRUE(index->lookup({NULL_VALUE}).empty());
+
+  EXPECT_THROW(index->lookup({1, 2}), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, CompositeKey) {
+  const auto column_definitions = TableColumnDefinitions{
+      {"w_id", DataType::Int, false}, {"d_id", DataType::Int, false}, {"v", DataType::Int, false}};
+  auto table = std::make_shared<Table>(column_definitions, TableType::Data, ChunkOffset{2}, UseMvcc::Yes);
+  table->append({1, 1, 10});
+  table->append({1, 2, 20});
+  table->append({2, 1, 30});
+  table->add_soft_unique_constraint({ColumnID{1}, ColumnID{0}}, IsPrimaryKey::Yes);
+  table->create_primary_key_index();
+
+  const auto index = table->primary_key_index();
+  EXPECT_EQ(index->column_ids(), std::vector<ColumnID>({ColumnID{0}, ColumnID{1}}));
+  EXPECT_EQ(index->lookup({1, 2}), std::vector<RowID>({RowID{ChunkID{0}, ChunkOffset{1}}}));
+  EXPECT_EQ(index->lookup({2, 1}), std::vector<RowID>({RowID{ChunkID{1}, ChunkOffset{0}}}));
+  EXPECT_TRUE(index->lookup({2, 2}).empty());
+}
+
+TEST_F(PrimaryKeyIndexTest, RequiresPrimaryKey) {
+  auto table = std::make_shared<Table>(column_definitions_t, TableType::Data);
+  EXPECT_THROW(table->create_primary_key_index(), std::logic_error);
+
+  table_t->create_primary_key_index();
+  EXPECT_THROW(table_t->create_primary_key_index(), std::logic_error);
+}
+
+TEST_F(PrimaryKeyIndexTest, MaintainedByInsert) {
+  table_t->create_primary_key_index();
+  const auto index = table_t->primary_key_index();
+
+  execute_sql("INSERT INTO t VALUES (5, 'five')");
+  EXPECT_EQ(index->lookup({5}), std::vector<RowID>({RowID{ChunkID{2}, ChunkOffset{0}}}));
+
+  // Deleted rows stay in the index until the key is inserted again and no transaction can see them anymore
+  const auto old_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  execute_sql("DELETE FROM t WHERE a = 5");
+  EXPECT_EQ(index->lookup({5}).size(), 1u);
+  execute_sql("INSERT INTO t VALUES (5, 'five again')");
+  EXPECT_EQ(index->lookup({5}).size(), 2u);
+
+  old_transaction_context->rollback();
+  execute_sql("UPDATE t SET b = 'five updated' WHERE a = 5");
+  EXPECT_EQ(index->lookup({5}).size(), 2u);
+
+  // Rolled back inserts are removed as well
+  const auto rolled_back_transaction_context = Hyrise::get().transaction_manager.new_transaction_context();
+  execute_sql("INSERT INTO t VALUES (6, 'six')", rolled_back_transaction_context);
+  EXPECT_EQ(index->lookup({6}).size(), 1u);
+  rolled_back_transaction_context->rollback();
+  execute_sql("INSERT INTO t VALUES (6, 'six')");
+  EXPECT_EQ(index->lookup({6}).size(), 1u);
+}
+
+TEST_F(PrimaryKeyIndexTest, PointLookup) {
+  table_t->create_primary_key_index();
+  execute_sql("INSERT INTO t VALUES (5, 'five')");
+  execute_sql("UPDATE t SET b = 'three updated' WHERE a = 3");
+
+  const auto expected_table = std::make_shared<Table>(column_definitions_t, TableType::Data);
+  expected_table->append({3, pmr_string{"three updated"}});
+  EXPECT_TABLE_EQ_UNORDERED(execute_query("SELECT * FROM t WHERE a = 3", OperatorType::PrimaryKeyIndexScan),
+                            expected_table);
+
+  const auto expected_b =
+      std::make_shared<Table>(TableColumnDefinitions{{"b", DataType::String, false}}, TableType::Data);
+  expected_b->append({pmr_string{"five"}});
+  EXPECT_TABLE_EQ_UNORDERED(
+      execute_query("SELECT b FROM t WHERE b <> 'x' AND a = 5", OperatorType::PrimaryKeyIndexScan), expected_b);
+
+  execute_sql("DELETE FROM t WHERE a = 5");
+  EXPECT_EQ(execute_query("SELECT * FROM t WHERE a = 5", OperatorType::PrimaryKeyIndexScan)->row_count(), 0u);
+}
+
+TEST_F(PrimaryKeyIndexTest, IndexNestedLoopJoin) {
+  table_t->create_primary_key_index();
+
+  const auto column_definitions = TableColumnDefinitions{{"x", DataType::Int, false}, {"b", DataType::String, false}};
+  auto expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({2, pmr_string{"two"}});
+  expected_table->append({3, pmr_string{"three"}});
+  expected_table->append({3, pmr_string{"three"}});
+  EXPECT_TABLE_EQ_UNORDERED(execute_query("SELECT x, b FROM u, t WHERE x = a", OperatorType::JoinIndex),
+                            expected_table);
+
+  // Rows of the indexed table that are not visible are not joined, even though the table is not validated
+  execute_sql("DELETE FROM t WHERE a = 3");
+  expected_table = std::make_shared<Table>(column_definitions, TableType::Data);
+  expected_table->append({2, pmr_string{"two"}});
+  EXPECT_TABLE_EQ_UNORDERED(execute_query("SELECT x, b FROM u, t WHERE x = a", OperatorType::JoinIndex),
+                            expected_table);
+}
+
+}  // namespace opossum
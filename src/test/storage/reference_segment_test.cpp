@@ -104,6 +104,63 @@ TEST_F(ReferenceSegmentTest, RetrieveNullValueFromNullRowID) {
   EXPECT_EQ(ref_segment[3], segment[2]);
 }
 
+TEST_F(ReferenceSegmentTest, RetrievesValuesFromCompactPosList) {
+  // Rows 0, 2, and 4 of the dictionary-encoded chunk 1
+  const auto compact_pos_list = std::make_shared<CompactPosList>(ChunkID{1}, std::vector<uint64_t>{0b10101});
+  auto ref_segment = ReferenceSegment(_test_table_dict, ColumnID{0}, compact_pos_list);
+
+  EXPECT_EQ(ref_segment.size(), 3u);
+  EXPECT_EQ(ref_segment.compact_pos_list(), compact_pos_list);
+  EXPECT_EQ(ref_segment[0], AllTypeVariant{10});
+  EXPECT_EQ(ref_segment[1], AllTypeVariant{14});
+  EXPECT_EQ(ref_segment[2], AllTypeVariant{18});
+
+  // The PosList is materialized on demand
+  const auto expected_pos_list = PosList{RowID{ChunkID{1}, 0}, RowID{ChunkID{1}, 2}, RowID{ChunkID{1}, 4}};
+  EXPECT_EQ(*ref_segment.pos_list(), expected_pos_list);
+  EXPECT_EQ(ref_segment.pos_list(), ref_segment.pos_list());
+}
+
+TEST_F(ReferenceSegmentTest, ScanProducesCompactPosLists) {
+  // All rows of chunk 0, rows 0, 1, and 3 of chunk 1, and rows 0 and 1 of chunk 2 match. Each scan uses the
+  // CompactPosLists of the previous one.
+  auto gt = std::make_shared<GetTable>("test_table_dict");
+  gt->execute();
+
+  auto scan = create_table_scan(gt, ColumnID{1}, PredicateCondition::NotEquals, 114);
+  auto scan_2 = create_table_scan(scan, ColumnID{1}, PredicateCondition::LessThan, 124);
+  auto scan_3 = create_table_scan(scan_2, ColumnID{1}, PredicateCondition::NotEquals, 118);
+  scan_3->execute();
+
+  const auto& table = scan_3->get_output();
+  ASSERT_EQ(table->chunk_count(), 3u);
+
+  const auto entire_chunk =
+      std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{0})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(entire_chunk->compact_pos_list());
+  EXPECT_TRUE(entire_chunk->compact_pos_list()->is_range());
+  EXPECT_EQ(entire_chunk->size(), 5u);
+
+  const auto filtered_chunk =
+      std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{1})->get_segment(ColumnID{1}));
+  ASSERT_TRUE(filtered_chunk->compact_pos_list());
+  EXPECT_FALSE(filtered_chunk->compact_pos_list()->is_range());
+  EXPECT_EQ(filtered_chunk->size(), 3u);
+  EXPECT_EQ((*filtered_chunk)[2], AllTypeVariant{116});
+
+  const auto prefix_of_chunk =
+      std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{2})->get_segment(ColumnID{0}));
+  ASSERT_TRUE(prefix_of_chunk->compact_pos_list());
+  EXPECT_TRUE(prefix_of_chunk->compact_pos_list()->is_range());
+  EXPECT_EQ(prefix_of_chunk->size(), 2u);
+
+  // The segments of a chunk share the CompactPosList
+  const auto other_filtered_segment =
+      std::static_pointer_cast<const ReferenceSegment>(table->get_chunk(ChunkID{1})->get_segment(ColumnID{0}));
+  EXPECT_EQ(other_filtered_segment->compact_pos_list(), filtered_chunk->compact_pos_list());
+  EXPECT_TRUE(table->get_chunk(ChunkID{1})->references_exactly_one_table());
+}
+
 TEST_F(ReferenceSegmentTest, MemoryUsageEstimation) {
   /**
    * WARNING: Since it's hard to assert what constitutes a correct "estimation", this just tests basic sanity of the